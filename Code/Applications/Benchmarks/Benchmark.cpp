@@ -0,0 +1,91 @@
+#include "Benchmark.h"
+#include "EASTL/sort.h"
+#include <stdio.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmark
+{
+    static Registration const* g_pRegistrations = nullptr;
+
+    //-------------------------------------------------------------------------
+
+    Registration::Registration( char const* pSuiteName, char const* pBenchmarkName, BenchmarkFunction pFunction )
+        : m_pSuiteName( pSuiteName )
+        , m_pBenchmarkName( pBenchmarkName )
+        , m_pFunction( pFunction )
+        , m_pNext( g_pRegistrations )
+    {
+        g_pRegistrations = this;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void Context::RecordResult( char const* pName, uint64_t numOpsPerSample, TVector<uint64_t>& sampleTimes )
+    {
+        EE_ASSERT( numOpsPerSample > 0 && !sampleTimes.empty() );
+
+        eastl::sort( sampleTimes.begin(), sampleTimes.end() );
+        size_t const numSamples = sampleTimes.size();
+        double const medianTime = ( numSamples % 2 == 1 ) ? double( sampleTimes[numSamples / 2] ) : ( double( sampleTimes[numSamples / 2 - 1] ) + double( sampleTimes[numSamples / 2] ) ) / 2.0;
+
+        Result& result = m_results.emplace_back();
+        result.m_name.sprintf( "%s / %s", m_benchmarkName.c_str(), pName );
+        result.m_medianNanosecondsPerOp = medianTime / numOpsPerSample;
+        result.m_minNanosecondsPerOp = double( sampleTimes[0] ) / numOpsPerSample;
+
+        printf( "  %-64s %12.2f ns %12.2f ns\n", result.m_name.c_str(), result.m_medianNanosecondsPerOp, result.m_minNanosecondsPerOp );
+        fflush( stdout );
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t RunBenchmarks( char const* pFilter, int32_t numSamples )
+    {
+        EE_ASSERT( numSamples > 0 );
+
+        // Sort the benchmarks so the output order doesnt depend on the static initialization order
+        TVector<Registration const*> benchmarks;
+        for ( Registration const* pRegistration = g_pRegistrations; pRegistration != nullptr; pRegistration = pRegistration->m_pNext )
+        {
+            InlineString const fullName( InlineString::CtorSprintf(), "%s.%s", pRegistration->m_pSuiteName, pRegistration->m_pBenchmarkName );
+            if ( pFilter == nullptr || strstr( fullName.c_str(), pFilter ) != nullptr )
+            {
+                benchmarks.emplace_back( pRegistration );
+            }
+        }
+
+        auto Comparator = [] ( Registration const* pA, Registration const* pB )
+        {
+            int32_t const result = strcmp( pA->m_pSuiteName, pB->m_pSuiteName );
+            return ( result != 0 ) ? result < 0 : strcmp( pA->m_pBenchmarkName, pB->m_pBenchmarkName ) < 0;
+        };
+
+        eastl::sort( benchmarks.begin(), benchmarks.end(), Comparator );
+
+        if ( benchmarks.empty() )
+        {
+            return 0;
+        }
+
+        //-------------------------------------------------------------------------
+
+        printf( "  %-64s %15s %15s\n", "Benchmark", "Median/Op", "Min/Op" );
+
+        TVector<Result> results;
+        char const* pCurrentSuite = nullptr;
+        for ( Registration const* pRegistration : benchmarks )
+        {
+            if ( pCurrentSuite == nullptr || strcmp( pCurrentSuite, pRegistration->m_pSuiteName ) != 0 )
+            {
+                pCurrentSuite = pRegistration->m_pSuiteName;
+                printf( "\n%s\n", pCurrentSuite );
+            }
+
+            Context context( pRegistration->m_pBenchmarkName, numSamples, results );
+            pRegistration->m_pFunction( context );
+        }
+
+        return (int32_t) benchmarks.size();
+    }
+}
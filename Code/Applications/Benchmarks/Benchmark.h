@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Base/Types/Arrays.h"
+#include "Base/Types/String.h"
+#include <chrono>
+
+#if _WIN32
+#include <intrin.h>
+#endif
+
+//-------------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------------
+// A minimal micro-benchmark framework, benchmarks are registered statically with EE_BENCHMARK and run from Main.cpp
+//
+// A benchmark does its setup and then calls Context::Measure one or more times with the code to time. Each measurement
+// is run for a number of samples and we report the median and the fastest sample in nanoseconds per operation, the
+// median is what should be compared between runs.
+//
+// Usage:
+//
+//  EE_BENCHMARK( Math, Multiply )
+//  {
+//      ... setup ...
+//      context.Measure( "256 Transforms", 256, [&] () { BatchMath::Multiply( ... ); } );
+//  }
+
+namespace EE::Benchmark
+{
+    // Prevent the compiler from optimizing away a computed value
+    template<typename T>
+    EE_FORCE_INLINE void DoNotOptimize( T const& value )
+    {
+        #if _WIN32
+        _ReadWriteBarrier();
+        static_cast<void>( *reinterpret_cast<char const volatile*>( &value ) );
+        #else
+        asm volatile( "" : : "r,m"( value ) : "memory" );
+        #endif
+    }
+
+    //-------------------------------------------------------------------------
+
+    struct Result
+    {
+        InlineString                    m_name;
+        double                          m_medianNanosecondsPerOp = 0.0;
+        double                          m_minNanosecondsPerOp = 0.0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class Context
+    {
+    public:
+
+        Context( char const* pBenchmarkName, int32_t numSamples, TVector<Result>& results )
+            : m_benchmarkName( pBenchmarkName )
+            , m_numSamples( numSamples )
+            , m_results( results )
+        {}
+
+        // Time a piece of code that performs 'numOpsPerCall' operations per call
+        template<typename F>
+        void Measure( char const* pName, uint64_t numOpsPerCall, F&& function )
+        {
+            EE_ASSERT( numOpsPerCall > 0 );
+
+            // Warm up and find how many calls we need per sample for the sample to be long enough to time accurately
+            uint64_t numCallsPerSample = 1;
+            while ( true )
+            {
+                uint64_t const elapsed = TimeCalls( function, numCallsPerSample );
+                if ( elapsed >= s_minSampleTime || numCallsPerSample >= s_maxCallsPerSample )
+                {
+                    break;
+                }
+
+                numCallsPerSample *= 2;
+            }
+
+            //-------------------------------------------------------------------------
+
+            TVector<uint64_t> sampleTimes;
+            sampleTimes.reserve( m_numSamples );
+            for ( int32_t i = 0; i < m_numSamples; i++ )
+            {
+                sampleTimes.emplace_back( TimeCalls( function, numCallsPerSample ) );
+            }
+
+            RecordResult( pName, numOpsPerCall * numCallsPerSample, sampleTimes );
+        }
+
+        // Time a piece of code that needs to be set up again before each call (e.g. erasing all the elements of a container)
+        // The setup isnt timed, each sample times a single call so the call needs to be long enough to time accurately
+        template<typename S, typename F>
+        void MeasureWithSetup( char const* pName, uint64_t numOpsPerCall, S&& setup, F&& function )
+        {
+            EE_ASSERT( numOpsPerCall > 0 );
+
+            // Warm up
+            setup();
+            TimeCalls( function, 1 );
+
+            TVector<uint64_t> sampleTimes;
+            sampleTimes.reserve( m_numSamples );
+            for ( int32_t i = 0; i < m_numSamples; i++ )
+            {
+                setup();
+                sampleTimes.emplace_back( TimeCalls( function, 1 ) );
+            }
+
+            RecordResult( pName, numOpsPerCall, sampleTimes );
+        }
+
+        // Record a result that was measured by the benchmark itself (e.g. multithreaded benchmarks that time each thread)
+        void RecordResult( char const* pName, uint64_t numOpsPerSample, TVector<uint64_t>& sampleTimes );
+
+        inline int32_t GetNumSamples() const { return m_numSamples; }
+
+    private:
+
+        template<typename F>
+        EE_FORCE_INLINE static uint64_t TimeCalls( F& function, uint64_t numCalls )
+        {
+            auto const startTime = std::chrono::steady_clock::now();
+            for ( uint64_t i = 0; i < numCalls; i++ )
+            {
+                function();
+            }
+            auto const endTime = std::chrono::steady_clock::now();
+            return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>( endTime - startTime ).count();
+        }
+
+    private:
+
+        constexpr static uint64_t const s_minSampleTime = 1000000; // 1 ms
+        constexpr static uint64_t const s_maxCallsPerSample = 1 << 20;
+
+        InlineString                    m_benchmarkName;
+        int32_t                         m_numSamples;
+        TVector<Result>&                m_results;
+    };
+
+    //-------------------------------------------------------------------------
+
+    using BenchmarkFunction = void( * )( Context& );
+
+    // Registrations are static objects so they form an intrusive list, this way we dont allocate before the memory system is initialized
+    struct Registration
+    {
+        Registration( char const* pSuiteName, char const* pBenchmarkName, BenchmarkFunction pFunction );
+
+        char const*                     m_pSuiteName = nullptr;
+        char const*                     m_pBenchmarkName = nullptr;
+        BenchmarkFunction               m_pFunction = nullptr;
+        Registration const*             m_pNext = nullptr;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Run all the benchmarks whose 'Suite.Name' contains the filter string (all of them if the filter is null)
+    // Returns the number of benchmarks that were run
+    int32_t RunBenchmarks( char const* pFilter, int32_t numSamples );
+}
+
+//-------------------------------------------------------------------------
+
+#define EE_BENCHMARK( SuiteName, BenchmarkName ) \
+    static void Benchmark_##SuiteName##_##BenchmarkName( EE::Benchmark::Context& context ); \
+    static EE::Benchmark::Registration const g_benchmarkRegistration_##SuiteName##_##BenchmarkName( #SuiteName, #BenchmarkName, &Benchmark_##SuiteName##_##BenchmarkName ); \
+    static void Benchmark_##SuiteName##_##BenchmarkName( EE::Benchmark::Context& context )
@@ -0,0 +1,101 @@
+#include "Benchmark.h"
+#include "Base/Types/FlatHashMap.h"
+#include "Base/Types/HashMap.h"
+#include "Base/Math/MathRandom.h"
+
+//-------------------------------------------------------------------------
+// TFlatHashMap vs THashMap: insert, find (hit and miss) and erase with 64bit keys
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmark
+{
+    static void CreateRandomKeys( TVector<uint64_t>& keys, int32_t numKeys, uint32_t seed )
+    {
+        Math::RNG rng( seed );
+        keys.resize( numKeys );
+        for ( auto& key : keys )
+        {
+            key = ( uint64_t( rng.GetUInt() ) << 32 ) | rng.GetUInt();
+        }
+    }
+
+    template<typename MapType>
+    static void BenchmarkMap( Context& context )
+    {
+        for ( int32_t numElements : { 1000, 10000, 100000, 1000000 } )
+        {
+            // The miss keys are random as well, so the chance of one of them being in the map is negligible
+            TVector<uint64_t> keys, missingKeys;
+            CreateRandomKeys( keys, numElements, 1 );
+            CreateRandomKeys( missingKeys, numElements, 2 );
+
+            InlineString name;
+            MapType map;
+
+            auto FillMap = [&] ()
+            {
+                map.clear();
+                for ( uint64_t key : keys )
+                {
+                    map.insert( eastl::pair<uint64_t, uint64_t>( key, key ) );
+                }
+            };
+
+            //-------------------------------------------------------------------------
+
+            name.sprintf( "Insert %d", numElements );
+            context.MeasureWithSetup( name.c_str(), numElements, [&] () { map = MapType(); }, [&] ()
+            {
+                for ( uint64_t key : keys )
+                {
+                    map.insert( eastl::pair<uint64_t, uint64_t>( key, key ) );
+                }
+            } );
+
+            FillMap();
+
+            name.sprintf( "Find Hit %d", numElements );
+            context.Measure( name.c_str(), numElements, [&] ()
+            {
+                uint64_t sum = 0;
+                for ( uint64_t key : keys )
+                {
+                    sum += map.find( key )->second;
+                }
+                DoNotOptimize( sum );
+            } );
+
+            name.sprintf( "Find Miss %d", numElements );
+            context.Measure( name.c_str(), numElements, [&] ()
+            {
+                uint64_t numFound = 0;
+                for ( uint64_t key : missingKeys )
+                {
+                    numFound += ( map.find( key ) != map.end() ) ? 1 : 0;
+                }
+                DoNotOptimize( numFound );
+            } );
+
+            name.sprintf( "Erase %d", numElements );
+            context.MeasureWithSetup( name.c_str(), numElements, FillMap, [&] ()
+            {
+                for ( uint64_t key : keys )
+                {
+                    map.erase( key );
+                }
+            } );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    EE_BENCHMARK( HashMap, THashMap )
+    {
+        BenchmarkMap<THashMap<uint64_t, uint64_t>>( context );
+    }
+
+    EE_BENCHMARK( HashMap, TFlatHashMap )
+    {
+        BenchmarkMap<TFlatHashMap<uint64_t, uint64_t>>( context );
+    }
+}
@@ -0,0 +1,149 @@
+#include "Benchmark.h"
+#include "Base/Math/FloatCurve.h"
+#include "Base/Math/MathRandom.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+// Float curve evaluation: per parameter vs coherent vs batch vs baked look-up tables
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmark
+{
+    static constexpr int32_t const g_numParameters = 1024;
+    static constexpr int32_t const g_numCurves = 64;
+
+    //-------------------------------------------------------------------------
+
+    static void CreateRandomCurve( FloatCurve& curve, int32_t numPoints, Math::RNG& rng )
+    {
+        curve.Clear();
+        for ( int32_t i = 0; i < numPoints; i++ )
+        {
+            curve.AddPoint( float( i ) + rng.GetFloat( 0.0f, 0.5f ), rng.GetFloat( -1, 1 ), rng.GetFloat( -3, 3 ), rng.GetFloat( -3, 3 ) );
+        }
+    }
+
+    static void CreateRandomParameters( TVector<float>& parameters, FloatRange const& range, Math::RNG& rng, bool sorted )
+    {
+        parameters.resize( g_numParameters );
+        for ( auto& parameter : parameters )
+        {
+            parameter = rng.GetFloat( range.m_begin - 0.5f, range.m_end + 0.5f );
+        }
+
+        if ( sorted )
+        {
+            eastl::sort( parameters.begin(), parameters.end() );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    EE_BENCHMARK( FloatCurve, SingleCurve )
+    {
+        Math::RNG rng( 11 );
+
+        for ( int32_t numPoints : { 4, 16 } )
+        {
+            FloatCurve curve;
+            CreateRandomCurve( curve, numPoints, rng );
+
+            TVector<float> randomParameters, sortedParameters, results( g_numParameters );
+            CreateRandomParameters( randomParameters, curve.GetParameterRange(), rng, false );
+            CreateRandomParameters( sortedParameters, curve.GetParameterRange(), rng, true );
+
+            InlineString name;
+
+            name.sprintf( "%d Points - Evaluate (random)", numPoints );
+            context.Measure( name.c_str(), g_numParameters, [&] ()
+            {
+                for ( int32_t i = 0; i < g_numParameters; i++ )
+                {
+                    results[i] = curve.Evaluate( randomParameters[i] );
+                }
+                DoNotOptimize( results[0] );
+            } );
+
+            name.sprintf( "%d Points - Evaluate (sorted)", numPoints );
+            context.Measure( name.c_str(), g_numParameters, [&] ()
+            {
+                for ( int32_t i = 0; i < g_numParameters; i++ )
+                {
+                    results[i] = curve.Evaluate( sortedParameters[i] );
+                }
+                DoNotOptimize( results[0] );
+            } );
+
+            name.sprintf( "%d Points - Evaluate with hint (sorted)", numPoints );
+            context.Measure( name.c_str(), g_numParameters, [&] ()
+            {
+                int32_t segmentHint = 0;
+                for ( int32_t i = 0; i < g_numParameters; i++ )
+                {
+                    results[i] = curve.Evaluate( sortedParameters[i], segmentHint );
+                }
+                DoNotOptimize( results[0] );
+            } );
+
+            name.sprintf( "%d Points - Batch (random)", numPoints );
+            context.Measure( name.c_str(), g_numParameters, [&] ()
+            {
+                curve.Evaluate( randomParameters.data(), results.data(), g_numParameters );
+                DoNotOptimize( results[0] );
+            } );
+
+            name.sprintf( "%d Points - Batch (sorted)", numPoints );
+            context.Measure( name.c_str(), g_numParameters, [&] ()
+            {
+                curve.Evaluate( sortedParameters.data(), results.data(), g_numParameters );
+                DoNotOptimize( results[0] );
+            } );
+
+            FloatCurveLUT lut;
+            lut.BakeWithTolerance( curve, 0.001f );
+
+            name.sprintf( "%d Points - LUT %d Samples (random)", numPoints, lut.GetNumSamples() );
+            context.Measure( name.c_str(), g_numParameters, [&] ()
+            {
+                lut.Evaluate( randomParameters.data(), results.data(), g_numParameters );
+                DoNotOptimize( results[0] );
+            } );
+        }
+    }
+
+    EE_BENCHMARK( FloatCurve, MultipleCurves )
+    {
+        Math::RNG rng( 12 );
+
+        TVector<FloatCurve> curves( g_numCurves );
+        for ( auto& curve : curves )
+        {
+            CreateRandomCurve( curve, 8, rng );
+        }
+
+        // One parameter per instance, each instance uses one of the curves
+        TVector<FloatCurve const*> instanceCurves( g_numParameters );
+        TVector<float> parameters( g_numParameters ), results( g_numParameters );
+        for ( int32_t i = 0; i < g_numParameters; i++ )
+        {
+            instanceCurves[i] = &curves[rng.GetUInt( 0, g_numCurves - 1 )];
+            FloatRange const range = instanceCurves[i]->GetParameterRange();
+            parameters[i] = rng.GetFloat( range.m_begin, range.m_end );
+        }
+
+        context.Measure( "Evaluate", g_numParameters, [&] ()
+        {
+            for ( int32_t i = 0; i < g_numParameters; i++ )
+            {
+                results[i] = instanceCurves[i]->Evaluate( parameters[i] );
+            }
+            DoNotOptimize( results[0] );
+        } );
+
+        context.Measure( "Batch", g_numParameters, [&] ()
+        {
+            FloatCurve::Evaluate( instanceCurves.data(), parameters.data(), results.data(), g_numParameters );
+            DoNotOptimize( results[0] );
+        } );
+    }
+}
@@ -0,0 +1,148 @@
+#include "Benchmark.h"
+#include "Base/Math/BatchMath.h"
+#include "Base/Math/MathRandom.h"
+
+//-------------------------------------------------------------------------
+// Batch math kernels with each instruction set vs the equivalent scalar loops
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmark
+{
+    static constexpr int32_t const g_numTransforms = 256;
+    static constexpr int32_t const g_numBoxes = 4096;
+
+    //-------------------------------------------------------------------------
+
+    static Quaternion GetRandomRotation( Math::RNG& rng )
+    {
+        Quaternion q( rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ) );
+        q.Normalize();
+        return q;
+    }
+
+    static void CreateRandomTransforms( TVector<Transform>& transforms, int32_t numTransforms, uint32_t seed )
+    {
+        Math::RNG rng( seed );
+        transforms.resize( numTransforms );
+        for ( auto& transform : transforms )
+        {
+            transform = Transform( GetRandomRotation( rng ), Vector( rng.GetFloat( -10, 10 ), rng.GetFloat( -10, 10 ), rng.GetFloat( -10, 10 ) ), rng.GetFloat( 0.5f, 2.0f ) );
+        }
+    }
+
+    // Run a benchmark for each instruction set the CPU supports and restore the default afterwards
+    template<typename F>
+    static void MeasureInstructionSets( Context& context, uint64_t numOps, F&& function )
+    {
+        BatchMath::InstructionSet const defaultInstructionSet = BatchMath::GetInstructionSet();
+
+        if ( BatchMath::SetInstructionSet( BatchMath::InstructionSet::SSE42 ) )
+        {
+            context.Measure( "SSE4.2", numOps, function );
+        }
+
+        if ( BatchMath::SetInstructionSet( BatchMath::InstructionSet::AVX2 ) )
+        {
+            context.Measure( "AVX2", numOps, function );
+        }
+
+        BatchMath::SetInstructionSet( defaultInstructionSet );
+    }
+
+    //-------------------------------------------------------------------------
+
+    EE_BENCHMARK( Math, FastSLerp )
+    {
+        TVector<Transform> from, to, results( g_numTransforms );
+        CreateRandomTransforms( from, g_numTransforms, 1 );
+        CreateRandomTransforms( to, g_numTransforms, 2 );
+
+        context.Measure( "Scalar", g_numTransforms, [&] ()
+        {
+            for ( int32_t i = 0; i < g_numTransforms; i++ )
+            {
+                results[i] = Transform::FastSLerp( from[i], to[i], 0.37f );
+            }
+            DoNotOptimize( results[0] );
+        } );
+
+        MeasureInstructionSets( context, g_numTransforms, [&] ()
+        {
+            BatchMath::FastSLerp( from.data(), to.data(), 0.37f, results.data(), g_numTransforms );
+            DoNotOptimize( results[0] );
+        } );
+    }
+
+    EE_BENCHMARK( Math, Multiply )
+    {
+        TVector<Transform> a, b, results( g_numTransforms );
+        CreateRandomTransforms( a, g_numTransforms, 3 );
+        CreateRandomTransforms( b, g_numTransforms, 4 );
+
+        context.Measure( "Scalar", g_numTransforms, [&] ()
+        {
+            for ( int32_t i = 0; i < g_numTransforms; i++ )
+            {
+                results[i] = a[i] * b[i];
+            }
+            DoNotOptimize( results[0] );
+        } );
+
+        MeasureInstructionSets( context, g_numTransforms, [&] ()
+        {
+            BatchMath::Multiply( a.data(), b.data(), results.data(), g_numTransforms );
+            DoNotOptimize( results[0] );
+        } );
+    }
+
+    EE_BENCHMARK( Math, MultiplyToMatrices )
+    {
+        TVector<Transform> a, b;
+        TVector<Matrix> results( g_numTransforms );
+        CreateRandomTransforms( a, g_numTransforms, 5 );
+        CreateRandomTransforms( b, g_numTransforms, 6 );
+
+        context.Measure( "Scalar", g_numTransforms, [&] ()
+        {
+            for ( int32_t i = 0; i < g_numTransforms; i++ )
+            {
+                results[i] = ( a[i] * b[i] ).ToMatrix();
+            }
+            DoNotOptimize( results[0] );
+        } );
+
+        MeasureInstructionSets( context, g_numTransforms, [&] ()
+        {
+            BatchMath::MultiplyToMatrices( a.data(), b.data(), results.data(), g_numTransforms );
+            DoNotOptimize( results[0] );
+        } );
+    }
+
+    EE_BENCHMARK( Math, OverlapsOBB )
+    {
+        Math::RNG rng( 7 );
+        TVector<OBB> boxes( g_numBoxes );
+        for ( auto& box : boxes )
+        {
+            box = OBB( Vector( rng.GetFloat( -100, 100 ), rng.GetFloat( -100, 100 ), rng.GetFloat( -100, 100 ) ), Vector( rng.GetFloat( 0.1f, 8 ), rng.GetFloat( 0.1f, 8 ), rng.GetFloat( 0.1f, 8 ) ), GetRandomRotation( rng ) );
+        }
+
+        AABB const bounds( Vector( 10, -5, 3 ), Vector( 40, 30, 25 ) );
+        TVector<bool> results( g_numBoxes );
+
+        context.Measure( "Scalar", g_numBoxes, [&] ()
+        {
+            for ( int32_t i = 0; i < g_numBoxes; i++ )
+            {
+                results[i] = bounds.Overlaps( boxes[i] );
+            }
+            DoNotOptimize( results[0] );
+        } );
+
+        MeasureInstructionSets( context, g_numBoxes, [&] ()
+        {
+            BatchMath::Overlaps( bounds, boxes.data(), results.data(), g_numBoxes );
+            DoNotOptimize( results[0] );
+        } );
+    }
+}
@@ -0,0 +1,53 @@
+#include "Benchmark.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+// Built-in profiler overhead
+//-------------------------------------------------------------------------
+// A zone reads the timestamp counter twice (once per edge) and writes one event to the thread's zone buffer. The cost of
+// a timestamp read depends a lot on the machine (it is much slower in some virtual machines), so we time it separately
+// to be able to tell the cost of the reads from the cost of recording the zone.
+
+#if EE_ENABLE_BUILTIN_PROFILER
+namespace EE::Benchmark
+{
+    // Less than the zone buffer capacity so that no zones are dropped, the buffers are drained between samples
+    static constexpr int32_t const g_numZonesPerSample = 8000;
+
+    //-------------------------------------------------------------------------
+
+    EE_BENCHMARK( Profiler, ZoneOverhead )
+    {
+        context.Measure( "Timestamp Read", g_numZonesPerSample, [] ()
+        {
+            uint64_t sum = 0;
+            for ( int32_t i = 0; i < g_numZonesPerSample; i++ )
+            {
+                sum += Profiling::GetTimestamp();
+            }
+            DoNotOptimize( sum );
+        } );
+
+        context.MeasureWithSetup( "Zone", g_numZonesPerSample, [] () { Profiling::EndFrame(); }, [] ()
+        {
+            for ( int32_t i = 0; i < g_numZonesPerSample; i++ )
+            {
+                EE_PROFILE_SCOPE( "Benchmark Zone" );
+            }
+        } );
+
+        context.MeasureWithSetup( "Nested Zone", g_numZonesPerSample, [] () { Profiling::EndFrame(); }, [] ()
+        {
+            for ( int32_t i = 0; i < g_numZonesPerSample / 2; i++ )
+            {
+                EE_PROFILE_SCOPE( "Benchmark Outer Zone" );
+                {
+                    EE_PROFILE_SCOPE_ANIMATION( "Benchmark Inner Zone" );
+                }
+            }
+        } );
+
+        Profiling::EndFrame();
+    }
+}
+#endif
@@ -0,0 +1,156 @@
+#include "Benchmark.h"
+#include "Base/Types/StringID.h"
+#include "Base/Types/HashMap.h"
+#include "Base/Encoding/Hash.h"
+#include "Base/Math/Math.h"
+#include "Base/Threading/Threading.h"
+#include <atomic>
+#include <thread>
+
+//-------------------------------------------------------------------------
+// StringID creation from many threads at once
+//-------------------------------------------------------------------------
+// Each thread creates StringIDs from a shared set of runtime strings, results are the wall clock time divided by the number
+// of StringIDs each thread created. So with no contention the time stays flat as the thread count goes up.
+//
+// We compare the lock-free string table against a mutex protected hash map (the previous StringID implementation) and
+// against EE_STRING_ID, which doesnt touch the string table once the literal has been added.
+
+namespace EE::Benchmark
+{
+    static constexpr int32_t const g_numStrings = 4096;
+    static constexpr int32_t const g_numStringIDsPerThread = 100000;
+
+    //-------------------------------------------------------------------------
+
+    class MutexStringTable
+    {
+    public:
+
+        uint64_t GetID( char const* pStr )
+        {
+            uint64_t const ID = Hash::GetHash64( pStr );
+
+            Threading::ScopeLock lock( m_mutex );
+            auto iter = m_strings.find( ID );
+            if ( iter == m_strings.end() )
+            {
+                m_strings[ID] = String( pStr );
+            }
+
+            return ID;
+        }
+
+    private:
+
+        Threading::Mutex                m_mutex;
+        THashMap<uint64_t, String>      m_strings;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Runs the function on each thread at the same time and returns the time taken for all the threads to complete
+    // The threads are created before the timer starts
+    template<typename F>
+    static uint64_t RunOnThreads( int32_t numThreads, F& function )
+    {
+        std::atomic<int32_t> numThreadsReady = 0;
+        std::atomic<bool> startSignal = false;
+
+        TVector<std::thread> threads;
+        threads.reserve( numThreads );
+        for ( int32_t i = 0; i < numThreads; i++ )
+        {
+            threads.emplace_back( [&, i] ()
+            {
+                numThreadsReady++;
+                while ( !startSignal.load( std::memory_order_acquire ) ) { std::this_thread::yield(); }
+                function( i );
+            } );
+        }
+
+        while ( numThreadsReady.load() != numThreads ) { std::this_thread::yield(); }
+
+        auto const startTime = std::chrono::steady_clock::now();
+        startSignal.store( true, std::memory_order_release );
+        for ( auto& thread : threads )
+        {
+            thread.join();
+        }
+        auto const endTime = std::chrono::steady_clock::now();
+
+        return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>( endTime - startTime ).count();
+    }
+
+    template<typename F>
+    static void MeasureOnThreads( Context& context, char const* pName, F&& function )
+    {
+        uint32_t const numHardwareThreads = Math::Max( 1u, std::thread::hardware_concurrency() );
+
+        for ( int32_t numThreads : { 1, 4, 8, 16 } )
+        {
+            TVector<uint64_t> sampleTimes;
+            for ( int32_t i = 0; i < context.GetNumSamples(); i++ )
+            {
+                sampleTimes.emplace_back( RunOnThreads( numThreads, function ) );
+            }
+
+            InlineString const name( InlineString::CtorSprintf(), "%s - %d Threads%s", pName, numThreads, ( (uint32_t) numThreads > numHardwareThreads ) ? " (oversubscribed)" : "" );
+            context.RecordResult( name.c_str(), g_numStringIDsPerThread, sampleTimes );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    EE_BENCHMARK( StringID, Contention )
+    {
+        TVector<InlineString> strings( g_numStrings );
+        for ( int32_t i = 0; i < g_numStrings; i++ )
+        {
+            strings[i].sprintf( "Bone_%d_Parameter_%d", i, i * 7919 );
+        }
+
+        // All the strings are already in the tables, this is the common case at runtime
+        MutexStringTable mutexStringTable;
+        for ( auto const& str : strings )
+        {
+            StringID const ID( str.c_str() );
+            mutexStringTable.GetID( str.c_str() );
+        }
+
+        // Each thread walks the strings in a different order
+        auto GetStringIdx = [] ( int32_t threadIdx, int32_t i ) { return ( i * 31 + threadIdx * 977 ) % g_numStrings; };
+
+        //-------------------------------------------------------------------------
+
+        MeasureOnThreads( context, "Lock-free Table", [&] ( int32_t threadIdx )
+        {
+            uint64_t sum = 0;
+            for ( int32_t i = 0; i < g_numStringIDsPerThread; i++ )
+            {
+                sum += StringID( strings[GetStringIdx( threadIdx, i )].c_str() ).ToUint();
+            }
+            DoNotOptimize( sum );
+        } );
+
+        MeasureOnThreads( context, "Mutex Table", [&] ( int32_t threadIdx )
+        {
+            uint64_t sum = 0;
+            for ( int32_t i = 0; i < g_numStringIDsPerThread; i++ )
+            {
+                sum += mutexStringTable.GetID( strings[GetStringIdx( threadIdx, i )].c_str() );
+            }
+            DoNotOptimize( sum );
+        } );
+
+        MeasureOnThreads( context, "EE_STRING_ID", [&] ( int32_t threadIdx )
+        {
+            uint64_t sum = 0;
+            for ( int32_t i = 0; i < g_numStringIDsPerThread; i++ )
+            {
+                sum += EE_STRING_ID( "HR_Flinch" ).ToUint();
+            }
+            DoNotOptimize( sum );
+        } );
+    }
+}
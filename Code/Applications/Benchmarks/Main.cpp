@@ -0,0 +1,65 @@
+#include "Benchmark.h"
+#include "Base/Memory/Memory.h"
+#include "Base/Math/Math.h"
+#include "Base/Types/StringID.h"
+#include "Base/Profiling.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Logging/SystemLog.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+//-------------------------------------------------------------------------
+// Usage: Esoterica.Applications.Benchmarks [filter] [-samples N]
+//
+// The filter is matched against 'Suite.Name' (e.g. "FlatHashMap" or "Math.Multiply")
+//-------------------------------------------------------------------------
+
+using namespace EE;
+
+//-------------------------------------------------------------------------
+
+int main( int argc, char *argv[] )
+{
+    char const* pFilter = nullptr;
+    int32_t numSamples = 15;
+
+    for ( int32_t i = 1; i < argc; i++ )
+    {
+        if ( strcmp( argv[i], "-samples" ) == 0 && ( i + 1 ) < argc )
+        {
+            numSamples = Math::Max( 1, atoi( argv[++i] ) );
+        }
+        else
+        {
+            pFilter = argv[i];
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    // We only initialize the systems that the benchmarked code needs rather than the full ApplicationGlobalState,
+    // since this also needs to build on platforms that only have the core of Base ported (see CMakeLists.txt)
+    Memory::Initialize();
+    Threading::Initialize( "Main Thread" );
+    Profiling::Initialize();
+    SystemLog::Initialize();
+    StringID::Initialize();
+
+    int32_t const numBenchmarksRun = Benchmark::RunBenchmarks( pFilter, numSamples );
+
+    StringID::Shutdown();
+    SystemLog::Shutdown();
+    Profiling::Shutdown();
+    Threading::Shutdown();
+    Memory::Shutdown();
+
+    //-------------------------------------------------------------------------
+
+    if ( numBenchmarksRun == 0 )
+    {
+        printf( "No benchmarks match the filter '%s'\n", pFilter );
+        return 1;
+    }
+
+    return 0;
+}
@@ -49,6 +49,7 @@ namespace EE
     {
         cli::Parser cmdParser( argc, argv );
         cmdParser.set_optional<std::string>( "map", "map", "", "The startup map." );
+        cmdParser.set_optional<std::string>( "perfcounters", "perfcounters", "", "Record the performance counters to this file (.csv or .json)." );
 
         if ( !cmdParser.run() )
         {
@@ -61,6 +62,12 @@ namespace EE
             m_engine.m_startupMap = DataPath( map.c_str() );
         }
 
+        std::string const perfCountersPath = cmdParser.get<std::string>( "perfcounters" );
+        if ( !perfCountersPath.empty() )
+        {
+            m_engine.m_performanceCountersRecordingPath = FileSystem::Path( perfCountersPath.c_str() );
+        }
+
         return true;
     }
 
@@ -3,6 +3,7 @@
 #include "Base/Memory/Memory.h"
 #include "Base/Types/StringID.h"
 #include "Base/Profiling.h"
+#include "Base/Telemetry/PerformanceCounters.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Logging/SystemLog.h"
 #include "Base/Platform/Platform.h"
@@ -27,6 +28,8 @@ namespace EE
         Platform::Initialize();
         Memory::Initialize();
         Threading::Initialize( ( pMainThreadName != nullptr ) ? pMainThreadName : "Main Thread" );
+        Profiling::Initialize();
+        Telemetry::Initialize();
         SystemLog::Initialize();
         StringID::Initialize();
         TypeSystem::CoreTypeRegistry::Initialize();
@@ -45,6 +48,8 @@ namespace EE
         TypeSystem::CoreTypeRegistry::Shutdown();
         StringID::Shutdown();
         SystemLog::Shutdown();
+        Telemetry::Shutdown();
+        Profiling::Shutdown();
         Threading::Shutdown();
         Memory::Shutdown();
         Platform::Shutdown();
@@ -1,4 +1,5 @@
 #include "DebugDrawingCommands.h"
+#include "Base/Threading/TaskSystem.h"
 
 //-------------------------------------------------------------------------
 
@@ -46,17 +47,143 @@ namespace EE::Drawing
         }
     }
 
-    void FrameCommandBuffer::AddThreadCommands( ThreadCommandBuffer const& threadCommands )
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        // Copy a single chunk of commands into its final location in the frame buffer
+        struct ChunkCopyJob
+        {
+            void                        ( *m_pCopyFunction )( void* pDestination, void const* pSource, uint32_t numCommands );
+            void*                       m_pDestination;
+            void const*                 m_pSource;
+            uint32_t                    m_numCommands;
+        };
+
+        using ChunkCopyJobList = TInlineVector<ChunkCopyJob, 256>;
+
+        template<typename T>
+        static void CopyCommands( void* pDestination, void const* pSource, uint32_t numCommands )
+        {
+            if constexpr ( eastl::is_trivially_copyable<T>::value )
+            {
+                memcpy( pDestination, pSource, sizeof( T ) * numCommands );
+            }
+            else
+            {
+                eastl::copy( (T const*) pSource, (T const*) pSource + numCommands, (T*) pDestination );
+            }
+        }
+
+        // Grows the frame command list to fit all the thread commands and creates the copy jobs for them
+        template<typename T>
+        static void CreateCopyJobs( TVector<T>& frameCommands, TCommandList<T> const* const* ppThreadCommands, uint32_t numThreadBuffers, ChunkCopyJobList& outJobs )
+        {
+            size_t numCommands = frameCommands.size();
+            for ( uint32_t i = 0; i < numThreadBuffers; i++ )
+            {
+                numCommands += ppThreadCommands[i]->size();
+            }
+
+            if ( numCommands == frameCommands.size() )
+            {
+                return;
+            }
+
+            size_t offset = frameCommands.size();
+            frameCommands.resize( numCommands );
+
+            for ( uint32_t i = 0; i < numThreadBuffers; i++ )
+            {
+                TCommandList<T> const& threadCommands = *ppThreadCommands[i];
+                uint32_t const numChunks = threadCommands.GetNumChunks();
+                for ( uint32_t chunkIdx = 0; chunkIdx < numChunks; chunkIdx++ )
+                {
+                    ChunkCopyJob& job = outJobs.emplace_back();
+                    job.m_pCopyFunction = &CopyCommands<T>;
+                    job.m_pDestination = &frameCommands[offset];
+                    job.m_pSource = threadCommands.GetChunk( chunkIdx );
+                    job.m_numCommands = threadCommands.GetNumCommandsInChunk( chunkIdx );
+                    offset += job.m_numCommands;
+                }
+            }
+        }
+
+        struct ChunkCopyTask final : public ITaskSet
+        {
+            ChunkCopyTask( ChunkCopyJobList const& jobs ) : ITaskSet( (uint32_t) jobs.size(), 16 ), m_jobs( jobs ) {}
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    ChunkCopyJob const& job = m_jobs[i];
+                    job.m_pCopyFunction( job.m_pDestination, job.m_pSource, job.m_numCommands );
+                }
+            }
+
+        private:
+
+            ChunkCopyJobList const&     m_jobs;
+        };
+    }
+
+    void FrameCommandBuffer::AddThreadCommands( ThreadCommandBuffer const* const* ppThreadBuffers, uint32_t numThreadBuffers, TaskSystem* pTaskSystem )
     {
         // TODO:
         // Broad-phase culling
         // Sort transparent and depth test off primitives by distance to camera
         // Sort text by font
 
-        m_opaqueDepthOn.Append( threadCommands.GetOpaqueDepthTestEnabledBuffer() );
-        m_opaqueDepthOff.Append( threadCommands.GetOpaqueDepthTestDisabledBuffer() );
-        m_transparentDepthOn.Append( threadCommands.GetTransparentDepthTestEnabledBuffer() );
-        m_transparentDepthOff.Append( threadCommands.GetTransparentDepthTestDisabledBuffer() );
+        // Each frame list is resized once, then the thread chunks are copied into their final positions
+        //-------------------------------------------------------------------------
+
+        ChunkCopyJobList jobs;
+        TInlineVector<TCommandList<PointCommand> const*, 32> pointCommands;
+        TInlineVector<TCommandList<LineCommand> const*, 32> lineCommands;
+        TInlineVector<TCommandList<TriangleCommand> const*, 32> triangleCommands;
+        TInlineVector<TCommandList<TextCommand> const*, 32> textCommands;
+
+        for ( uint8_t bufferType = 0; bufferType < ThreadCommandBuffer::NumBufferTypes; bufferType++ )
+        {
+            pointCommands.clear();
+            lineCommands.clear();
+            triangleCommands.clear();
+            textCommands.clear();
+
+            for ( uint32_t i = 0; i < numThreadBuffers; i++ )
+            {
+                ChunkedCommandBuffer const& threadBuffer = ppThreadBuffers[i]->GetBuffer( (ThreadCommandBuffer::BufferType) bufferType );
+                pointCommands.emplace_back( &threadBuffer.m_pointCommands );
+                lineCommands.emplace_back( &threadBuffer.m_lineCommands );
+                triangleCommands.emplace_back( &threadBuffer.m_triangleCommands );
+                textCommands.emplace_back( &threadBuffer.m_textCommands );
+            }
+
+            CommandBuffer& frameBuffer = GetBuffer( (ThreadCommandBuffer::BufferType) bufferType );
+            CreateCopyJobs( frameBuffer.m_pointCommands, pointCommands.data(), numThreadBuffers, jobs );
+            CreateCopyJobs( frameBuffer.m_lineCommands, lineCommands.data(), numThreadBuffers, jobs );
+            CreateCopyJobs( frameBuffer.m_triangleCommands, triangleCommands.data(), numThreadBuffers, jobs );
+            CreateCopyJobs( frameBuffer.m_textCommands, textCommands.data(), numThreadBuffers, jobs );
+        }
+
+        // Only go wide if there is enough work to be worth the scheduling cost
+        //-------------------------------------------------------------------------
+
+        constexpr static uint32_t const s_minJobsForParallelCopy = 32;
+        if ( pTaskSystem != nullptr && jobs.size() >= s_minJobsForParallelCopy )
+        {
+            ChunkCopyTask copyTask( jobs );
+            pTaskSystem->ScheduleTask( &copyTask );
+            pTaskSystem->WaitForTask( &copyTask );
+        }
+        else
+        {
+            for ( ChunkCopyJob const& job : jobs )
+            {
+                job.m_pCopyFunction( job.m_pDestination, job.m_pSource, job.m_numCommands );
+            }
+        }
     }
 }
 #endif
\ No newline at end of file
@@ -7,10 +7,13 @@
 #include "Base/Types/String.h"
 #include "Base/Types/BitFlags.h"
 #include "Base/Threading/Threading.h"
+#include "Base/Memory/Memory.h"
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
+namespace EE { class TaskSystem; }
+
 namespace EE::Drawing
 {
     enum class DepthTest : uint8_t
@@ -44,6 +47,8 @@ namespace EE::Drawing
 
     struct PointCommand
     {
+        PointCommand() = default;
+
         PointCommand( Float3 const& position, Float4 const& color, float pointThickness, Seconds TTL )
             : m_position( position )
             , m_thickness( pointThickness )
@@ -63,6 +68,8 @@ namespace EE::Drawing
 
     struct LineCommand
     {
+        LineCommand() = default;
+
         LineCommand( Float3 const& startPosition, Float3 const& endPosition, Float4 const& color, float lineThickness, Seconds TTL )
             : m_startPosition( startPosition )
             , m_startThickness( lineThickness )
@@ -119,6 +126,8 @@ namespace EE::Drawing
 
     struct TriangleCommand
     {
+        TriangleCommand() = default;
+
         TriangleCommand( Float3 const& V0, Float3 const& V1, Float3 const& V2, Float4 const& color, Seconds TTL )
             : m_vertex0( V0 )
             , m_color0( color )
@@ -156,6 +165,8 @@ namespace EE::Drawing
 
     struct TextCommand
     {
+        TextCommand() = default;
+
         TextCommand( Float2 const& position, char const* pText, Float4 const& color, FontSize size, TextAlignment alignment, bool background, Seconds TTL )
             : m_color( color )
             , m_position( position.m_x, position.m_y, 0 )
@@ -194,21 +205,6 @@ namespace EE::Drawing
 
     struct CommandBuffer
     {
-        inline void Append( CommandBuffer const& buffer )
-        {
-            m_pointCommands.reserve( m_pointCommands.size() + buffer.m_pointCommands.size() );
-            m_pointCommands.insert( m_pointCommands.end(), buffer.m_pointCommands.begin(), buffer.m_pointCommands.end() );
-
-            m_lineCommands.reserve( m_lineCommands.size() + buffer.m_lineCommands.size() );
-            m_lineCommands.insert( m_lineCommands.end(), buffer.m_lineCommands.begin(), buffer.m_lineCommands.end() );
-
-            m_triangleCommands.reserve( m_triangleCommands.size() + buffer.m_triangleCommands.size() );
-            m_triangleCommands.insert( m_triangleCommands.end(), buffer.m_triangleCommands.begin(), buffer.m_triangleCommands.end() );
-
-            m_textCommands.reserve( m_textCommands.size() + buffer.m_textCommands.size() );
-            m_textCommands.insert( m_textCommands.end(), buffer.m_textCommands.begin(), buffer.m_textCommands.end() );
-        }
-
         inline void Clear()
         {
             m_pointCommands.clear();
@@ -227,6 +223,113 @@ namespace EE::Drawing
         TVector<TextCommand>        m_textCommands;
     };
 
+    //-------------------------------------------------------------------------
+    // Chunked command list
+    //-------------------------------------------------------------------------
+    // Append-only command storage made up of fixed size chunks, adding commands never moves existing commands
+    // Clearing the list keeps the allocated chunks so that a thread buffer stops allocating once it has warmed up
+
+    template<typename T>
+    class TCommandList
+    {
+    public:
+
+        constexpr static uint32_t const s_numCommandsPerChunk = 256;
+
+    public:
+
+        TCommandList() = default;
+        TCommandList( TCommandList const& ) = delete;
+        TCommandList& operator=( TCommandList const& ) = delete;
+
+        ~TCommandList()
+        {
+            Clear();
+
+            for ( T* pChunk : m_chunks )
+            {
+                EE::Free( (void*&) pChunk );
+            }
+        }
+
+        template<typename... Args>
+        EE_FORCE_INLINE void Emplace( Args&&... args )
+        {
+            if ( m_numCommandsInLastChunk == s_numCommandsPerChunk || m_numUsedChunks == 0 )
+            {
+                StartNewChunk();
+            }
+
+            new ( &m_chunks[m_numUsedChunks - 1][m_numCommandsInLastChunk] ) T( eastl::forward<Args>( args )... );
+            m_numCommandsInLastChunk++;
+        }
+
+        inline void Clear()
+        {
+            if constexpr ( !eastl::is_trivially_destructible<T>::value )
+            {
+                for ( uint32_t i = 0; i < m_numUsedChunks; i++ )
+                {
+                    T* pChunk = m_chunks[i];
+                    uint32_t const numCommands = GetNumCommandsInChunk( i );
+                    for ( uint32_t j = 0; j < numCommands; j++ )
+                    {
+                        pChunk[j].~T();
+                    }
+                }
+            }
+
+            m_numUsedChunks = 0;
+            m_numCommandsInLastChunk = 0;
+        }
+
+        inline uint32_t size() const { return ( m_numUsedChunks == 0 ) ? 0 : ( ( m_numUsedChunks - 1 ) * s_numCommandsPerChunk ) + m_numCommandsInLastChunk; }
+        inline bool empty() const { return m_numUsedChunks == 0; }
+
+        inline uint32_t GetNumChunks() const { return m_numUsedChunks; }
+        inline T const* GetChunk( uint32_t chunkIdx ) const { EE_ASSERT( chunkIdx < m_numUsedChunks ); return m_chunks[chunkIdx]; }
+        inline uint32_t GetNumCommandsInChunk( uint32_t chunkIdx ) const { EE_ASSERT( chunkIdx < m_numUsedChunks ); return ( chunkIdx == m_numUsedChunks - 1 ) ? m_numCommandsInLastChunk : s_numCommandsPerChunk; }
+
+    private:
+
+        void StartNewChunk()
+        {
+            if ( m_numUsedChunks == m_chunks.size() )
+            {
+                m_chunks.emplace_back( (T*) EE::Alloc( sizeof( T ) * s_numCommandsPerChunk, alignof( T ) ) );
+            }
+
+            m_numUsedChunks++;
+            m_numCommandsInLastChunk = 0;
+        }
+
+    private:
+
+        TVector<T*>                 m_chunks;
+        uint32_t                    m_numUsedChunks = 0;
+        uint32_t                    m_numCommandsInLastChunk = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct ChunkedCommandBuffer
+    {
+        inline void Clear()
+        {
+            m_pointCommands.Clear();
+            m_lineCommands.Clear();
+            m_triangleCommands.Clear();
+            m_textCommands.Clear();
+        }
+
+    public:
+
+        TCommandList<PointCommand>      m_pointCommands;
+        TCommandList<LineCommand>       m_lineCommands;
+        TCommandList<TriangleCommand>   m_triangleCommands;
+        TCommandList<TextCommand>       m_textCommands;
+    };
+
     //-------------------------------------------------------------------------
     // Per-Thread command buffer
     //-------------------------------------------------------------------------
@@ -237,74 +340,59 @@ namespace EE::Drawing
 
     public:
 
-        ThreadCommandBuffer( Threading::ThreadID threadID )
-            : m_ID( threadID )
-        {}
+        enum BufferType : uint8_t
+        {
+            OpaqueDepthOn = 0,
+            OpaqueDepthOff,
+            TransparentDepthOn,
+            TransparentDepthOff,
 
-        inline Threading::ThreadID GetThreadID() const { return m_ID; }
+            NumBufferTypes
+        };
+
+    public:
 
         EE_FORCE_INLINE void AddCommand( PointCommand&& cmd, DepthTest depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
-            pBuffer->m_pointCommands.emplace_back( eastl::move( cmd ) );
+            GetCommandBuffer( depthTestState, cmd.IsTransparent() ).m_pointCommands.Emplace( eastl::move( cmd ) );
         }
 
         EE_FORCE_INLINE void AddCommand( LineCommand&& cmd, DepthTest depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
-            pBuffer->m_lineCommands.emplace_back( eastl::move( cmd ) );
+            GetCommandBuffer( depthTestState, cmd.IsTransparent() ).m_lineCommands.Emplace( eastl::move( cmd ) );
         }
 
         EE_FORCE_INLINE void AddCommand( TriangleCommand&& cmd, DepthTest depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
-            pBuffer->m_triangleCommands.emplace_back( eastl::move( cmd ) );
+            GetCommandBuffer( depthTestState, cmd.IsTransparent() ).m_triangleCommands.Emplace( eastl::move( cmd ) );
         }
 
         EE_FORCE_INLINE void AddCommand( TextCommand&& cmd, DepthTest depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
-            pBuffer->m_textCommands.emplace_back( eastl::move( cmd ) );
+            GetCommandBuffer( depthTestState, cmd.IsTransparent() ).m_textCommands.Emplace( eastl::move( cmd ) );
         }
 
         inline void Clear()
         {
-            m_opaqueDepthOn.Clear();
-            m_opaqueDepthOff.Clear();
-            m_transparentDepthOn.Clear();
-            m_transparentDepthOff.Clear();
+            for ( auto& buffer : m_buffers )
+            {
+                buffer.Clear();
+            }
         }
 
-        CommandBuffer const& GetOpaqueDepthTestEnabledBuffer() const { return m_opaqueDepthOn; }
-        CommandBuffer const& GetOpaqueDepthTestDisabledBuffer() const { return m_opaqueDepthOff; }
-        CommandBuffer const& GetTransparentDepthTestEnabledBuffer() const { return m_transparentDepthOn; }
-        CommandBuffer const& GetTransparentDepthTestDisabledBuffer() const { return m_transparentDepthOff; }
+        inline ChunkedCommandBuffer const& GetBuffer( BufferType type ) const { return m_buffers[type]; }
 
     private:
 
-        inline CommandBuffer* GetCommandBuffer( DepthTest depthTestState, bool isTransparent )
+        EE_FORCE_INLINE ChunkedCommandBuffer& GetCommandBuffer( DepthTest depthTestState, bool isTransparent )
         {
-            CommandBuffer* pBuffer = nullptr;
-
-            if ( depthTestState == DepthTest::Enable )
-            {
-                pBuffer = isTransparent ? &m_transparentDepthOn : &m_opaqueDepthOn;
-            }
-            else // Disable depth test
-            {
-                pBuffer = isTransparent ? &m_transparentDepthOff : &m_opaqueDepthOff;
-            }
-
-            return pBuffer;
+            uint32_t const bufferIdx = ( isTransparent ? TransparentDepthOn : OpaqueDepthOn ) + ( ( depthTestState == DepthTest::Enable ) ? 0 : 1 );
+            return m_buffers[bufferIdx];
         }
 
     private:
 
-        Threading::ThreadID         m_ID;
-        CommandBuffer               m_opaqueDepthOn;
-        CommandBuffer               m_opaqueDepthOff;
-        CommandBuffer               m_transparentDepthOn;
-        CommandBuffer               m_transparentDepthOff;
+        ChunkedCommandBuffer        m_buffers[NumBufferTypes];
     };
 
     //-------------------------------------------------------------------------
@@ -317,7 +405,19 @@ namespace EE::Drawing
     {
     public:
 
-        void AddThreadCommands( ThreadCommandBuffer const& threadCommands );
+        // Appends the commands from all the thread buffers, the copying is spread across the task system workers if one is supplied
+        void AddThreadCommands( ThreadCommandBuffer const* const* ppThreadBuffers, uint32_t numThreadBuffers, TaskSystem* pTaskSystem = nullptr );
+
+        inline CommandBuffer& GetBuffer( ThreadCommandBuffer::BufferType type )
+        {
+            switch ( type )
+            {
+                case ThreadCommandBuffer::OpaqueDepthOn: return m_opaqueDepthOn;
+                case ThreadCommandBuffer::OpaqueDepthOff: return m_opaqueDepthOff;
+                case ThreadCommandBuffer::TransparentDepthOn: return m_transparentDepthOn;
+                default: return m_transparentDepthOff;
+            }
+        }
 
         // Empties the command buffer ignoring any TTL state
         inline void Clear()
@@ -5,32 +5,85 @@
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Drawing
 {
-    ThreadCommandBuffer& DrawingSystem::GetThreadCommandBuffer()
+    namespace
     {
-        Threading::ScopeLock Lock( m_commandBufferMutex );
+        static std::atomic<int32_t>                     g_numThreadIndices = 0;
+        static thread_local int32_t                     t_threadIndex = InvalidIndex;
 
-        auto const threadID = Threading::GetCurrentThreadID();
+        EE_FORCE_INLINE static int32_t GetThreadIndex()
+        {
+            if ( t_threadIndex == InvalidIndex )
+            {
+                t_threadIndex = g_numThreadIndices.fetch_add( 1, std::memory_order_relaxed );
+            }
 
-        // Check for an already created buffer for this thread
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+            return t_threadIndex;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    template<typename T>
+    void DrawingSystem::ForEachThreadCommandBuffer( T&& function )
+    {
+        for ( auto& threadCommandBuffer : m_threadCommandBuffers )
         {
-            if ( pThreadBuffer->GetThreadID() == threadID )
+            ThreadCommandBuffer* pBuffer = threadCommandBuffer.load( std::memory_order_acquire );
+            if ( pBuffer != nullptr )
             {
-                return *pThreadBuffer;
+                function( pBuffer );
             }
         }
 
-        // Create a new buffer
-        auto& pThreadBuffer = m_threadCommandBuffers.emplace_back( EE::New<ThreadCommandBuffer>( threadID ) );
-        return *pThreadBuffer;
+        Threading::ScopeLock Lock( m_overflowCommandBufferMutex );
+        for ( auto& overflowBuffer : m_overflowCommandBuffers )
+        {
+            function( overflowBuffer.second );
+        }
     }
 
     DrawingSystem::~DrawingSystem()
     {
-        for ( auto& pBuffer : m_threadCommandBuffers )
+        ForEachThreadCommandBuffer( [] ( ThreadCommandBuffer* pBuffer ) { EE::Delete( pBuffer ); } );
+    }
+
+    ThreadCommandBuffer& DrawingSystem::GetThreadCommandBuffer()
+    {
+        int32_t const threadIdx = GetThreadIndex();
+        if ( threadIdx >= s_maxThreads )
+        {
+            return GetOverflowThreadCommandBuffer();
+        }
+
+        // Only the owning thread ever creates its buffer so no synchronization is needed beyond publishing it
+        ThreadCommandBuffer* pBuffer = m_threadCommandBuffers[threadIdx].load( std::memory_order_relaxed );
+        if ( pBuffer == nullptr )
+        {
+            pBuffer = EE::New<ThreadCommandBuffer>();
+            m_threadCommandBuffers[threadIdx].store( pBuffer, std::memory_order_release );
+        }
+
+        return *pBuffer;
+    }
+
+    ThreadCommandBuffer& DrawingSystem::GetOverflowThreadCommandBuffer()
+    {
+        Threading::ScopeLock Lock( m_overflowCommandBufferMutex );
+
+        auto const threadID = Threading::GetCurrentThreadID();
+
+        // Check for an already created buffer for this thread
+        for ( auto& overflowBuffer : m_overflowCommandBuffers )
         {
-            EE::Delete( pBuffer );
+            if ( overflowBuffer.first == threadID )
+            {
+                return *overflowBuffer.second;
+            }
         }
+
+        // Create a new buffer
+        auto& overflowBuffer = m_overflowCommandBuffers.emplace_back( threadID, EE::New<ThreadCommandBuffer>() );
+        return *overflowBuffer.second;
     }
 
     void DrawingSystem::ReflectFrameCommandBuffer( Seconds const deltaTime, FrameCommandBuffer& reflectedFrameCommands )
@@ -39,21 +92,16 @@ namespace EE::Drawing
         reflectedFrameCommands.Reset( deltaTime );
 
         // Reflect all the new commands into the frame buffer
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
-        {
-            reflectedFrameCommands.AddThreadCommands( *pThreadBuffer );
-            pThreadBuffer->Clear();
-        }
+        TInlineVector<ThreadCommandBuffer const*, s_maxThreads> threadBuffers;
+        ForEachThreadCommandBuffer( [&threadBuffers] ( ThreadCommandBuffer* pBuffer ) { threadBuffers.emplace_back( pBuffer ); } );
+        reflectedFrameCommands.AddThreadCommands( threadBuffers.data(), (uint32_t) threadBuffers.size(), m_pTaskSystem );
+
+        Reset();
     }
 
     void DrawingSystem::Reset()
     {
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
-        {
-            pThreadBuffer->Clear();
-        }
+        ForEachThreadCommandBuffer( [] ( ThreadCommandBuffer* pBuffer ) { pBuffer->Clear(); } );
     }
 }
-#endif
\ No newline at end of file
+#endif
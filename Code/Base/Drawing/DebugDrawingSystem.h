@@ -3,20 +3,28 @@
 #include "Base/_Module/API.h"
 #include "Base/Drawing/DebugDrawing.h"
 #include "Base/Threading/Threading.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
+namespace EE { class TaskSystem; }
+
 namespace EE::Drawing
 {
     class EE_BASE_API DrawingSystem
     {
+        // Threads are assigned a global index on their first draw call, this is used to look up the per-thread buffers without locking
+        constexpr static int32_t const s_maxThreads = 128;
 
     public:
 
         DrawingSystem() = default;
         ~DrawingSystem();
 
+        // Optional, if set the per-thread buffers will be merged in parallel
+        inline void SetTaskSystem( TaskSystem* pTaskSystem ) { m_pTaskSystem = pTaskSystem; }
+
         // Empty all per thread buffers
         void Reset();
 
@@ -24,16 +32,24 @@ namespace EE::Drawing
         inline DrawContext GetDrawingContext() { return DrawContext( GetThreadCommandBuffer() ); }
 
         // Reflects all the individual per-thread buffers into a single supplied frame command buffer. Clears all thread buffers.
+        // This must not run concurrently with any drawing
         void ReflectFrameCommandBuffer( Seconds const deltaTime, FrameCommandBuffer& reflectedFrameCommands );
 
     private:
 
         ThreadCommandBuffer& GetThreadCommandBuffer();
+        ThreadCommandBuffer& GetOverflowThreadCommandBuffer();
+
+        template<typename T> void ForEachThreadCommandBuffer( T&& function );
 
     private:
 
-        TVector<ThreadCommandBuffer*>       m_threadCommandBuffers;
-        Threading::Mutex                    m_commandBufferMutex;
+        TaskSystem*                                     m_pTaskSystem = nullptr;
+        std::atomic<ThreadCommandBuffer*>               m_threadCommandBuffers[s_maxThreads] = {};
+
+        // Buffers for threads beyond the max thread count, these fall back to a locked lookup
+        TVector<TPair<Threading::ThreadID, ThreadCommandBuffer*>>   m_overflowCommandBuffers;
+        Threading::Mutex                                m_overflowCommandBufferMutex;
     };
 }
-#endif
\ No newline at end of file
+#endif
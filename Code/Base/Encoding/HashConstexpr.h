@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Base/Esoterica.h"
+
+//-------------------------------------------------------------------------
+// Compile time XXHash
+//-------------------------------------------------------------------------
+// Produces the same results as XXHash::GetHash64 (with a zero seed) but can be evaluated at compile time
+// This is much slower than the library version at runtime so only use this for constant expressions
+
+namespace EE::Hash::XXHash
+{
+    namespace Constexpr
+    {
+        constexpr uint64_t const g_prime64_1 = 0x9E3779B185EBCA87ull;
+        constexpr uint64_t const g_prime64_2 = 0xC2B2AE3D27D4EB4Full;
+        constexpr uint64_t const g_prime64_3 = 0x165667B19E3779F9ull;
+        constexpr uint64_t const g_prime64_4 = 0x85EBCA77C2B2AE63ull;
+        constexpr uint64_t const g_prime64_5 = 0x27D4EB2F165667C5ull;
+
+        constexpr inline uint64_t RotateLeft( uint64_t value, int32_t numBits ) { return ( value << numBits ) | ( value >> ( 64 - numBits ) ); }
+
+        constexpr inline uint64_t Read64( char const* pData )
+        {
+            uint64_t value = 0;
+            for ( int32_t i = 0; i < 8; i++ )
+            {
+                value |= uint64_t( uint8_t( pData[i] ) ) << ( i * 8 );
+            }
+            return value;
+        }
+
+        constexpr inline uint32_t Read32( char const* pData )
+        {
+            uint32_t value = 0;
+            for ( int32_t i = 0; i < 4; i++ )
+            {
+                value |= uint32_t( uint8_t( pData[i] ) ) << ( i * 8 );
+            }
+            return value;
+        }
+
+        constexpr inline uint64_t Round( uint64_t accumulator, uint64_t input )
+        {
+            accumulator += input * g_prime64_2;
+            accumulator = RotateLeft( accumulator, 31 );
+            return accumulator * g_prime64_1;
+        }
+
+        constexpr inline uint64_t MergeRound( uint64_t accumulator, uint64_t value )
+        {
+            accumulator ^= Round( 0, value );
+            return accumulator * g_prime64_1 + g_prime64_4;
+        }
+    }
+
+    constexpr inline uint64_t GetHash64Constexpr( char const* pData, size_t size )
+    {
+        using namespace Constexpr;
+
+        char const* pCurrent = pData;
+        char const* const pEnd = pData + size;
+        uint64_t hash = 0;
+
+        if ( size >= 32 )
+        {
+            uint64_t v1 = g_prime64_1 + g_prime64_2;
+            uint64_t v2 = g_prime64_2;
+            uint64_t v3 = 0;
+            uint64_t v4 = 0 - g_prime64_1;
+
+            char const* const pLimit = pEnd - 32;
+            do
+            {
+                v1 = Round( v1, Read64( pCurrent ) );
+                v2 = Round( v2, Read64( pCurrent + 8 ) );
+                v3 = Round( v3, Read64( pCurrent + 16 ) );
+                v4 = Round( v4, Read64( pCurrent + 24 ) );
+                pCurrent += 32;
+            }
+            while ( pCurrent <= pLimit );
+
+            hash = RotateLeft( v1, 1 ) + RotateLeft( v2, 7 ) + RotateLeft( v3, 12 ) + RotateLeft( v4, 18 );
+            hash = MergeRound( hash, v1 );
+            hash = MergeRound( hash, v2 );
+            hash = MergeRound( hash, v3 );
+            hash = MergeRound( hash, v4 );
+        }
+        else
+        {
+            hash = g_prime64_5;
+        }
+
+        hash += uint64_t( size );
+
+        // Remaining bytes
+        //-------------------------------------------------------------------------
+
+        while ( pEnd - pCurrent >= 8 )
+        {
+            hash ^= Round( 0, Read64( pCurrent ) );
+            hash = RotateLeft( hash, 27 ) * g_prime64_1 + g_prime64_4;
+            pCurrent += 8;
+        }
+
+        if ( pEnd - pCurrent >= 4 )
+        {
+            hash ^= uint64_t( Read32( pCurrent ) ) * g_prime64_1;
+            hash = RotateLeft( hash, 23 ) * g_prime64_2 + g_prime64_3;
+            pCurrent += 4;
+        }
+
+        while ( pCurrent < pEnd )
+        {
+            hash ^= uint64_t( uint8_t( *pCurrent ) ) * g_prime64_5;
+            hash = RotateLeft( hash, 11 ) * g_prime64_1;
+            pCurrent++;
+        }
+
+        // Avalanche
+        //-------------------------------------------------------------------------
+
+        hash ^= hash >> 33;
+        hash *= g_prime64_2;
+        hash ^= hash >> 29;
+        hash *= g_prime64_3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+}
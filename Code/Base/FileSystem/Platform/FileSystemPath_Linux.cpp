@@ -0,0 +1,87 @@
+#if __linux__
+#include "../FileSystemPath.h"
+#include <sys/stat.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    char const Path::s_pathDelimiter = '/';
+
+    //-------------------------------------------------------------------------
+
+    void Path::EnsureCorrectPathStringFormat()
+    {
+        struct stat fileStatus;
+        if ( stat( m_fullpath.c_str(), &fileStatus ) != 0 )
+        {
+            return;
+        }
+
+        bool const isPathADirectory = S_ISDIR( fileStatus.st_mode );
+
+        //-------------------------------------------------------------------------
+
+        // Add trailing delimiter for directories
+        if ( isPathADirectory && !IsDirectoryPath() )
+        {
+            m_fullpath += s_pathDelimiter;
+            UpdatePathInternals();
+        }
+
+        // Remove trailing delimiter for files
+        else if ( !isPathADirectory && IsDirectoryPath() )
+        {
+            m_fullpath.pop_back();
+            UpdatePathInternals();
+        }
+    }
+
+    bool Path::GetFullPathString( char const* pPath, String& outPath )
+    {
+        if ( pPath != nullptr && pPath[0] != 0 )
+        {
+            // Unlike GetFullPathName, realpath fails for paths that dont exist, so we resolve relative paths against the working directory ourselves
+            char workingBuffer[PATH_MAX];
+            if ( realpath( pPath, workingBuffer ) != nullptr )
+            {
+                outPath = workingBuffer;
+            }
+            else if ( pPath[0] == s_pathDelimiter || getcwd( workingBuffer, PATH_MAX ) == nullptr )
+            {
+                outPath = pPath;
+            }
+            else
+            {
+                outPath = workingBuffer;
+                outPath += s_pathDelimiter;
+                outPath += pPath;
+            }
+
+            // Ensure directory paths have the final slash appended
+            struct stat fileStatus;
+            if ( stat( outPath.c_str(), &fileStatus ) == 0 && S_ISDIR( fileStatus.st_mode ) && outPath.back() != s_pathDelimiter )
+            {
+                outPath += s_pathDelimiter;
+            }
+
+            return true;
+        }
+
+        outPath.clear();
+        return false;
+    }
+
+    bool Path::GetCorrectCaseForPath( char const* pPath, String& outPath )
+    {
+        // Paths are case sensitive, so if the path exists its case is already correct
+        outPath = pPath;
+
+        struct stat fileStatus;
+        return stat( pPath, &fileStatus ) == 0;
+    }
+}
+#endif
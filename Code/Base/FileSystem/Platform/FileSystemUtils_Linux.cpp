@@ -0,0 +1,19 @@
+#if __linux__
+#include "../FileSystemUtils.h"
+#include <limits.h>
+#include <unistd.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    Path GetCurrentProcessPath()
+    {
+        char buffer[PATH_MAX];
+        ssize_t const length = readlink( "/proc/self/exe", buffer, PATH_MAX - 1 );
+        EE_ASSERT( length > 0 );
+        buffer[length] = 0;
+        return Path( buffer ).GetParentDirectory();
+    }
+}
+#endif
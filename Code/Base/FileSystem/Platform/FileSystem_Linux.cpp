@@ -0,0 +1,311 @@
+#if __linux__
+#include "../FileSystem.h"
+#include "Base/Encoding/Hash.h"
+#include "Base/Math/Math.h"
+#include "Base/Types/UUID.h"
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fstream>
+#include <filesystem>
+
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    bool Exists( char const* pPath )
+    {
+        struct stat fileStatus;
+        return stat( pPath, &fileStatus ) == 0;
+    }
+
+    bool IsReadOnly( char const* pPath )
+    {
+        return Exists( pPath ) && access( pPath, W_OK ) != 0;
+    }
+
+    bool IsExistingFile( char const* pPath )
+    {
+        struct stat fileStatus;
+        return stat( pPath, &fileStatus ) == 0 && !S_ISDIR( fileStatus.st_mode );
+    }
+
+    bool IsExistingDirectory( char const* pPath )
+    {
+        struct stat fileStatus;
+        return stat( pPath, &fileStatus ) == 0 && S_ISDIR( fileStatus.st_mode );
+    }
+
+    bool IsFileReadOnly( char const* pPath )
+    {
+        return IsExistingFile( pPath ) && access( pPath, W_OK ) != 0;
+    }
+
+    uint64_t GetFileModifiedTime( char const* path )
+    {
+        struct stat fileStatus;
+        if ( stat( path, &fileStatus ) != 0 )
+        {
+            return 0;
+        }
+
+        return uint64_t( fileStatus.st_mtim.tv_sec ) * 1000000000ull + uint64_t( fileStatus.st_mtim.tv_nsec );
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CreateDir( char const* path )
+    {
+        std::error_code ec;
+        std::filesystem::create_directories( path, ec );
+
+        if ( ec.value() != 0 )
+        {
+            EE_LOG_ERROR( "FileSystem", "Create Directory", "Error creating directory %s - %s", path, ec.message().c_str() );
+        }
+
+        return ec.value() == 0;
+    }
+
+    bool EraseDir( char const* path )
+    {
+        std::error_code ec;
+        std::filesystem::remove_all( path, ec );
+
+        if ( ec.value() != 0 )
+        {
+            EE_LOG_ERROR( "FileSystem", "Erase Directory", "Error deleting directory %s - %s", path, ec.message().c_str() );
+        }
+
+        return ec.value() == 0;
+    }
+
+    bool EraseFile( char const* path )
+    {
+        if ( IsExistingFile( path ) )
+        {
+            return unlink( path ) == 0;
+        }
+
+        return true;
+    }
+
+    bool CopyExistingFile( char const* fromFilePath, char const* toFilePath )
+    {
+        std::error_code ec;
+        std::filesystem::copy( fromFilePath, toFilePath, std::filesystem::copy_options::overwrite_existing, ec );
+
+        if ( ec.value() != 0 )
+        {
+            EE_LOG_ERROR( "FileSystem", "Copy File", "Error copying from %s to %s - %s", fromFilePath, toFilePath, ec.message().c_str() );
+        }
+
+        return ec.value() == 0;
+    }
+
+    bool MoveExistingFile( char const* fromFilePath, char const* toFilePath )
+    {
+        std::error_code ec;
+        std::filesystem::rename( fromFilePath, toFilePath, ec );
+
+        if ( ec.value() != 0 )
+        {
+            EE_LOG_ERROR( "FileSystem", "Move File", "Error moving from %s to %s - %s", fromFilePath, toFilePath, ec.message().c_str() );
+        }
+
+        return ec.value() == 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    static bool WriteFile( char const* pPath, void const* pData, size_t size, bool isBinary )
+    {
+        EE_ASSERT( pPath != nullptr );
+        EE_ASSERT( pData != nullptr && size > 0 );
+
+        // Write to a temp file first
+        //-------------------------------------------------------------------------
+
+        Path tmpPath( pPath );
+        tmpPath = tmpPath.GetParentDirectory();
+        tmpPath.Append( UUID::GenerateID().ToString().c_str() );
+
+        FILE* pFile = fopen( tmpPath.c_str(), isBinary ? "wb" : "w" );
+        if ( pFile == nullptr )
+        {
+            EE_LOG_ERROR( "FileSystem", "Write File", "Error writing temp file %s.", tmpPath.c_str() );
+            return false;
+        }
+
+        fwrite( pData, size, 1, pFile );
+        fclose( pFile );
+
+        // Rename to final name
+        //-------------------------------------------------------------------------
+
+        std::error_code ec;
+        std::filesystem::rename( tmpPath.c_str(), pPath, ec );
+
+        if ( ec.value() != 0 )
+        {
+            EE_LOG_ERROR( "FileSystem", "Write File", "Failed to rename tmp path (%s) to final path (%s) during file write. Error: %s", tmpPath.c_str(), pPath, ec.message().c_str() );
+            return false;
+        }
+
+        return ec.value() == 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ReadTextFile( char const* pFilePath, String& fileData )
+    {
+        // Open the stream to 'lock' the file.
+        std::ifstream f( pFilePath, std::ios::in );
+        if ( f.fail() )
+        {
+            return false;
+        }
+
+        // Obtain the size of the file.
+        uintmax_t const fileSize = std::filesystem::file_size( pFilePath );
+
+        // Create a buffer.
+        fileData.resize( fileSize );
+        Memory::MemsetZero( fileData.data(), fileSize );
+
+        // Read the whole file into the buffer.
+        f.read( fileData.data(), fileSize );
+
+        // Handle any EOL conversions that result in a smaller string than expected
+        fileData.resize( f.gcount() );
+
+        return true;
+    }
+
+    bool WriteTextFile( char const* pPath, char const* pData, size_t size )
+    {
+        return WriteFile( pPath, pData, size, false );
+    }
+
+    bool UpdateTextFile( char const* pFilePath, char const* pData, size_t size )
+    {
+        EE_ASSERT( pFilePath != nullptr );
+        EE_ASSERT( pData != nullptr && size > 0 );
+
+        bool shouldUpdateFile = false;
+        if ( Exists( pFilePath ) )
+        {
+            String currentFileContents;
+            if ( !FileSystem::ReadTextFile( pFilePath, currentFileContents ) )
+            {
+                EE_LOG_ERROR( "FileSystem", "Update File", "Failed to read file (%s) during file update!", pFilePath );
+                return false;
+            }
+
+            if ( currentFileContents != pData )
+            {
+                shouldUpdateFile = true;
+            }
+        }
+        else
+        {
+            shouldUpdateFile = true;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( shouldUpdateFile )
+        {
+            return FileSystem::WriteTextFile( pFilePath, pData );
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ReadBinaryFile( char const* pPath, Blob& fileData )
+    {
+        EE_ASSERT( pPath != nullptr );
+
+        FILE* pFile = fopen( pPath, "rb" );
+        if ( pFile == nullptr )
+        {
+            return false;
+        }
+
+        // Get file size
+        struct stat fileStatus;
+        if ( fstat( fileno( pFile ), &fileStatus ) != 0 )
+        {
+            fclose( pFile );
+            return false;
+        }
+
+        // Read file
+        size_t const fileSize = (size_t) fileStatus.st_size;
+        fileData.resize( fileSize );
+        size_t const bytesRead = fread( fileData.data(), 1, fileSize, pFile );
+        fclose( pFile );
+        return bytesRead == fileSize;
+    }
+
+    bool WriteBinaryFile( char const* pPath, void const* pData, size_t size )
+    {
+        return WriteFile( pPath, pData, size, true );
+    }
+
+    bool UpdateBinaryFile( char const* pFilePath, void const* pData, size_t size )
+    {
+        EE_ASSERT( pFilePath != nullptr );
+        EE_ASSERT( pData != nullptr && size > 0 );
+
+        bool shouldUpdateFile = false;
+        if ( Exists( pFilePath ) )
+        {
+            // Note: this is a very naive and sub-optimal way to do this
+            // TODO: if this is proving to be too slow, then replace this naive code below with a proper file diff
+
+            Blob currentFileContents;
+            if ( !FileSystem::ReadBinaryFile( pFilePath, currentFileContents ) )
+            {
+                EE_LOG_ERROR( "FileSystem", "Update File", "Failed to read file (%s) during file update!", pFilePath );
+                return false;
+            }
+
+            if ( currentFileContents.size() != size )
+            {
+                shouldUpdateFile = true;
+            }
+            else
+            {
+                uint8_t const* pByteData = (uint8_t const*) pData;
+                for ( int32_t i = 0; i < size; i++ )
+                {
+                    if ( pByteData[i] != currentFileContents[i] )
+                    {
+                        shouldUpdateFile = true;
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            shouldUpdateFile = true;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( shouldUpdateFile )
+        {
+            return FileSystem::WriteBinaryFile( pFilePath, pData, size );
+        }
+        else
+        {
+            return true;
+        }
+    }
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,584 @@
+#include "LogRecord.h"
+#include "Base/Esoterica.h"
+#include <stddef.h>
+#include <stdint.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Log
+{
+    namespace
+    {
+        enum class LengthModifier : uint8_t
+        {
+            None,
+            Char,       // hh
+            Short,      // h
+            Long,       // l
+            LongLong,   // ll
+            IntMax,     // j
+            Size,       // z, I
+            PtrDiff,    // t
+            LongDouble, // L
+            Int32,      // I32
+            Int64,      // I64
+        };
+
+        enum class ArgumentType : uint8_t
+        {
+            SignedInteger,
+            UnsignedInteger,
+            Character,
+            Double,
+            Pointer,
+            String,
+            Percent,
+            Unsupported,
+        };
+
+        struct FormatSpecifier
+        {
+            char const*                 m_pStart = nullptr;         // The '%'
+            char const*                 m_pLengthModifier = nullptr;
+            char const*                 m_pConversion = nullptr;
+            char const*                 m_pEnd = nullptr;           // The first character after the specifier
+            int32_t                     m_precision = -1;
+            LengthModifier              m_lengthModifier = LengthModifier::None;
+            ArgumentType                m_type = ArgumentType::Unsupported;
+            bool                        m_hasStarWidth = false;
+            bool                        m_hasStarPrecision = false;
+        };
+
+        // The rebuilt specifier is at most '%', the flags, the width, the precision, 'll' and the conversion
+        constexpr static size_t const s_maxSpecifierLength = 24;
+
+        //-------------------------------------------------------------------------
+
+        static inline bool IsDigit( char c ) { return c >= '0' && c <= '9'; }
+
+        static inline size_t AlignTo8( size_t size ) { return ( size + 7 ) & ~size_t( 7 ); }
+
+        // Parses a printf format specifier, pFormat needs to point to the '%'
+        static void ParseSpecifier( char const* pFormat, FormatSpecifier& spec )
+        {
+            EE_ASSERT( *pFormat == '%' );
+            spec = FormatSpecifier();
+            spec.m_pStart = pFormat;
+
+            char const* p = pFormat + 1;
+            if ( *p == '%' )
+            {
+                spec.m_type = ArgumentType::Percent;
+                spec.m_pLengthModifier = spec.m_pConversion = p;
+                spec.m_pEnd = p + 1;
+                return;
+            }
+
+            // Flags
+            while ( *p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0' )
+            {
+                p++;
+            }
+
+            // Width
+            if ( *p == '*' )
+            {
+                spec.m_hasStarWidth = true;
+                p++;
+            }
+            else
+            {
+                while ( IsDigit( *p ) )
+                {
+                    p++;
+                }
+            }
+
+            // Precision
+            if ( *p == '.' )
+            {
+                p++;
+                if ( *p == '*' )
+                {
+                    spec.m_hasStarPrecision = true;
+                    p++;
+                }
+                else
+                {
+                    spec.m_precision = 0;
+                    while ( IsDigit( *p ) )
+                    {
+                        spec.m_precision = ( spec.m_precision * 10 ) + ( *p - '0' );
+                        p++;
+                    }
+                }
+            }
+
+            // Length modifier
+            spec.m_pLengthModifier = p;
+            switch ( *p )
+            {
+                case 'h':
+                {
+                    p++;
+                    spec.m_lengthModifier = LengthModifier::Short;
+                    if ( *p == 'h' )
+                    {
+                        p++;
+                        spec.m_lengthModifier = LengthModifier::Char;
+                    }
+                }
+                break;
+
+                case 'l':
+                {
+                    p++;
+                    spec.m_lengthModifier = LengthModifier::Long;
+                    if ( *p == 'l' )
+                    {
+                        p++;
+                        spec.m_lengthModifier = LengthModifier::LongLong;
+                    }
+                }
+                break;
+
+                case 'j': p++; spec.m_lengthModifier = LengthModifier::IntMax; break;
+                case 'z': p++; spec.m_lengthModifier = LengthModifier::Size; break;
+                case 't': p++; spec.m_lengthModifier = LengthModifier::PtrDiff; break;
+                case 'L': p++; spec.m_lengthModifier = LengthModifier::LongDouble; break;
+
+                case 'I':
+                {
+                    p++;
+                    if ( p[0] == '6' && p[1] == '4' )
+                    {
+                        p += 2;
+                        spec.m_lengthModifier = LengthModifier::Int64;
+                    }
+                    else if ( p[0] == '3' && p[1] == '2' )
+                    {
+                        p += 2;
+                        spec.m_lengthModifier = LengthModifier::Int32;
+                    }
+                    else
+                    {
+                        spec.m_lengthModifier = LengthModifier::Size;
+                    }
+                }
+                break;
+
+                default:
+                break;
+            }
+
+            // Conversion
+            spec.m_pConversion = p;
+            if ( *p == 0 )
+            {
+                spec.m_pEnd = p;
+                return;
+            }
+
+            spec.m_pEnd = p + 1;
+
+            bool const isIntegerLength = spec.m_lengthModifier != LengthModifier::LongDouble;
+            switch ( *p )
+            {
+                case 'd':
+                case 'i':
+                spec.m_type = isIntegerLength ? ArgumentType::SignedInteger : ArgumentType::Unsupported;
+                break;
+
+                case 'u':
+                case 'o':
+                case 'x':
+                case 'X':
+                spec.m_type = isIntegerLength ? ArgumentType::UnsignedInteger : ArgumentType::Unsupported;
+                break;
+
+                case 'c':
+                spec.m_type = ( spec.m_lengthModifier == LengthModifier::None ) ? ArgumentType::Character : ArgumentType::Unsupported;
+                break;
+
+                case 's':
+                spec.m_type = ( spec.m_lengthModifier == LengthModifier::None ) ? ArgumentType::String : ArgumentType::Unsupported;
+                break;
+
+                case 'p':
+                spec.m_type = ArgumentType::Pointer;
+                break;
+
+                case 'e':
+                case 'E':
+                case 'f':
+                case 'F':
+                case 'g':
+                case 'G':
+                case 'a':
+                case 'A':
+                spec.m_type = ( spec.m_lengthModifier == LengthModifier::None || spec.m_lengthModifier == LengthModifier::Long || spec.m_lengthModifier == LengthModifier::LongDouble ) ? ArgumentType::Double : ArgumentType::Unsupported;
+                break;
+
+                // %n, wide strings and any other platform specific conversions
+                default:
+                spec.m_type = ArgumentType::Unsupported;
+                break;
+            }
+
+            // Pathologically long specifiers are formatted immediately
+            if ( size_t( spec.m_pEnd - spec.m_pStart ) > s_maxSpecifierLength - 2 )
+            {
+                spec.m_type = ArgumentType::Unsupported;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        static inline void Write( TVector<uint8_t>& buffer, void const* pData, size_t size )
+        {
+            size_t const offset = buffer.size();
+            buffer.resize( offset + size );
+            memcpy( buffer.data() + offset, pData, size );
+        }
+
+        template<typename T>
+        static inline void WriteValue( TVector<uint8_t>& buffer, T value )
+        {
+            static_assert( sizeof( T ) == 8, "All packed values are 8 bytes" );
+            Write( buffer, &value, sizeof( T ) );
+        }
+
+        static inline void WriteString( TVector<uint8_t>& buffer, char const* pString, size_t length )
+        {
+            Write( buffer, pString, length );
+            buffer.push_back( 0 );
+        }
+
+        // Read a signed integer argument and apply any truncation that printf would apply
+        static int64_t ReadSignedInteger( LengthModifier lengthModifier, va_list& args )
+        {
+            switch ( lengthModifier )
+            {
+                case LengthModifier::Char: return (signed char) va_arg( args, int );
+                case LengthModifier::Short: return (short) va_arg( args, int );
+                case LengthModifier::Long: return va_arg( args, long );
+                case LengthModifier::LongLong: return va_arg( args, long long );
+                case LengthModifier::IntMax: return va_arg( args, intmax_t );
+                case LengthModifier::Size: return (ptrdiff_t) va_arg( args, size_t );
+                case LengthModifier::PtrDiff: return va_arg( args, ptrdiff_t );
+                case LengthModifier::Int32: return va_arg( args, int32_t );
+                case LengthModifier::Int64: return va_arg( args, int64_t );
+                default: return va_arg( args, int );
+            }
+        }
+
+        static uint64_t ReadUnsignedInteger( LengthModifier lengthModifier, va_list& args )
+        {
+            switch ( lengthModifier )
+            {
+                case LengthModifier::Char: return (unsigned char) va_arg( args, unsigned int );
+                case LengthModifier::Short: return (unsigned short) va_arg( args, unsigned int );
+                case LengthModifier::Long: return va_arg( args, unsigned long );
+                case LengthModifier::LongLong: return va_arg( args, unsigned long long );
+                case LengthModifier::IntMax: return va_arg( args, uintmax_t );
+                case LengthModifier::Size: return va_arg( args, size_t );
+                case LengthModifier::PtrDiff: return (size_t) va_arg( args, ptrdiff_t );
+                case LengthModifier::Int32: return va_arg( args, uint32_t );
+                case LengthModifier::Int64: return va_arg( args, uint64_t );
+                default: return va_arg( args, unsigned int );
+            }
+        }
+
+        // Packs all the format arguments, returns false if the format string contains a specifier that we cant pack
+        static bool PackArguments( TVector<uint8_t>& buffer, char const* pFormat, va_list& args )
+        {
+            FormatSpecifier spec;
+            for ( char const* p = pFormat; *p != 0; )
+            {
+                if ( *p != '%' )
+                {
+                    p++;
+                    continue;
+                }
+
+                ParseSpecifier( p, spec );
+                p = spec.m_pEnd;
+
+                if ( spec.m_type == ArgumentType::Unsupported )
+                {
+                    return false;
+                }
+
+                if ( spec.m_type == ArgumentType::Percent )
+                {
+                    continue;
+                }
+
+                //-------------------------------------------------------------------------
+
+                if ( spec.m_hasStarWidth )
+                {
+                    WriteValue<int64_t>( buffer, va_arg( args, int ) );
+                }
+
+                int32_t precision = spec.m_precision;
+                if ( spec.m_hasStarPrecision )
+                {
+                    precision = va_arg( args, int );
+                    WriteValue<int64_t>( buffer, precision );
+                }
+
+                switch ( spec.m_type )
+                {
+                    case ArgumentType::SignedInteger:
+                    WriteValue<int64_t>( buffer, ReadSignedInteger( spec.m_lengthModifier, args ) );
+                    break;
+
+                    case ArgumentType::UnsignedInteger:
+                    WriteValue<uint64_t>( buffer, ReadUnsignedInteger( spec.m_lengthModifier, args ) );
+                    break;
+
+                    case ArgumentType::Character:
+                    WriteValue<int64_t>( buffer, va_arg( args, int ) );
+                    break;
+
+                    case ArgumentType::Double:
+                    {
+                        double const value = ( spec.m_lengthModifier == LengthModifier::LongDouble ) ? (double) va_arg( args, long double ) : va_arg( args, double );
+                        WriteValue<double>( buffer, value );
+                    }
+                    break;
+
+                    case ArgumentType::Pointer:
+                    WriteValue<uint64_t>( buffer, (uintptr_t) va_arg( args, void* ) );
+                    break;
+
+                    case ArgumentType::String:
+                    {
+                        char const* pString = va_arg( args, char const* );
+                        if ( pString == nullptr )
+                        {
+                            pString = "(null)";
+                        }
+
+                        // The precision limits how much of the string is read, the string doesnt need to be null terminated in that case
+                        size_t length = 0;
+                        size_t const maxLength = ( precision >= 0 ) ? size_t( precision ) : SIZE_MAX;
+                        while ( length < maxLength && pString[length] != 0 )
+                        {
+                            length++;
+                        }
+
+                        WriteValue<uint64_t>( buffer, length );
+                        WriteString( buffer, pString, length );
+                        buffer.resize( AlignTo8( buffer.size() ) );
+                    }
+                    break;
+
+                    default:
+                    EE_UNREACHABLE_CODE();
+                    break;
+                }
+            }
+
+            return true;
+        }
+
+        //-------------------------------------------------------------------------
+
+        template<typename T>
+        static inline T ReadValue( uint8_t const*& pData )
+        {
+            T value;
+            memcpy( &value, pData, sizeof( T ) );
+            pData += 8;
+            return value;
+        }
+
+        template<typename T>
+        static inline void AppendArgument( String& outMessage, char const* pSpecifier, FormatSpecifier const& spec, int32_t width, int32_t precision, T value )
+        {
+            if ( spec.m_hasStarWidth && spec.m_hasStarPrecision )
+            {
+                outMessage.append_sprintf( pSpecifier, width, precision, value );
+            }
+            else if ( spec.m_hasStarWidth )
+            {
+                outMessage.append_sprintf( pSpecifier, width, value );
+            }
+            else if ( spec.m_hasStarPrecision )
+            {
+                outMessage.append_sprintf( pSpecifier, precision, value );
+            }
+            else
+            {
+                outMessage.append_sprintf( pSpecifier, value );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void PackRecord( TVector<uint8_t>& outRecord, Severity severity, char const* pCategory, char const* pSourceInfo, char const* pFilename, int32_t lineNumber, uint64_t timestamp, char const* pMessageFormat, va_list args )
+    {
+        EE_ASSERT( pCategory != nullptr && pFilename != nullptr && pMessageFormat != nullptr );
+
+        if ( pSourceInfo == nullptr )
+        {
+            pSourceInfo = "";
+        }
+
+        RecordHeader header;
+        header.m_severity = (uint8_t) severity;
+        header.m_lineNumber = lineNumber;
+        header.m_categoryLength = (uint32_t) strlen( pCategory );
+        header.m_sourceInfoLength = (uint32_t) strlen( pSourceInfo );
+        header.m_filenameLength = (uint32_t) strlen( pFilename );
+        header.m_formatLength = (uint32_t) strlen( pMessageFormat );
+        header.m_timestamp = timestamp;
+
+        outRecord.clear();
+        Write( outRecord, &header, sizeof( RecordHeader ) );
+        WriteString( outRecord, pCategory, header.m_categoryLength );
+        WriteString( outRecord, pSourceInfo, header.m_sourceInfoLength );
+        WriteString( outRecord, pFilename, header.m_filenameLength );
+        WriteString( outRecord, pMessageFormat, header.m_formatLength );
+        size_t const formatEndOffset = outRecord.size();
+        outRecord.resize( AlignTo8( outRecord.size() ) );
+
+        // Pack the arguments, if that fails replace the format string with the formatted message
+        //-------------------------------------------------------------------------
+
+        va_list argsCopy;
+        va_copy( argsCopy, args );
+        bool const argumentsPacked = PackArguments( outRecord, pMessageFormat, argsCopy );
+        va_end( argsCopy );
+
+        if ( !argumentsPacked )
+        {
+            outRecord.resize( formatEndOffset - header.m_formatLength - 1 );
+
+            va_copy( argsCopy, args );
+            int32_t const messageLength = vsnprintf( nullptr, 0, pMessageFormat, argsCopy );
+            va_end( argsCopy );
+
+            // If the format string is invalid, we just log it as is
+            if ( messageLength < 0 )
+            {
+                WriteString( outRecord, pMessageFormat, header.m_formatLength );
+            }
+            else
+            {
+                header.m_formatLength = (uint32_t) messageLength;
+                size_t const messageOffset = outRecord.size();
+                outRecord.resize( messageOffset + header.m_formatLength + 1 );
+
+                va_copy( argsCopy, args );
+                vsnprintf( (char*) outRecord.data() + messageOffset, header.m_formatLength + 1, pMessageFormat, argsCopy );
+                va_end( argsCopy );
+            }
+
+            outRecord.resize( AlignTo8( outRecord.size() ) );
+            header.m_flags |= RecordHeader::Preformatted;
+        }
+
+        //-------------------------------------------------------------------------
+
+        header.m_size = (uint32_t) outRecord.size();
+        memcpy( outRecord.data(), &header, sizeof( RecordHeader ) );
+    }
+
+    void FormatRecordMessage( RecordHeader const* pRecord, String& outMessage )
+    {
+        EE_ASSERT( pRecord != nullptr && ( pRecord->m_flags & RecordHeader::Padding ) == 0 );
+
+        char const* const pFormat = pRecord->GetFormat();
+        if ( pRecord->m_flags & RecordHeader::Preformatted )
+        {
+            outMessage.assign( pFormat, pRecord->m_formatLength );
+            return;
+        }
+
+        uint8_t const* pRecordStart = reinterpret_cast<uint8_t const*>( pRecord );
+        uint8_t const* pArguments = pRecordStart + AlignTo8( ( pFormat + pRecord->m_formatLength + 1 ) - reinterpret_cast<char const*>( pRecordStart ) );
+
+        outMessage.clear();
+
+        FormatSpecifier spec;
+        char specifierBuffer[s_maxSpecifierLength];
+        char const* pLiteralStart = pFormat;
+        for ( char const* p = pFormat; *p != 0; )
+        {
+            if ( *p != '%' )
+            {
+                p++;
+                continue;
+            }
+
+            outMessage.append( pLiteralStart, p );
+            ParseSpecifier( p, spec );
+            p = pLiteralStart = spec.m_pEnd;
+
+            if ( spec.m_type == ArgumentType::Percent )
+            {
+                outMessage.push_back( '%' );
+                continue;
+            }
+
+            EE_ASSERT( spec.m_type != ArgumentType::Unsupported );
+
+            int32_t const width = spec.m_hasStarWidth ? (int32_t) ReadValue<int64_t>( pArguments ) : 0;
+            int32_t const precision = spec.m_hasStarPrecision ? (int32_t) ReadValue<int64_t>( pArguments ) : 0;
+
+            // Rebuild the specifier with the length modifier replaced to match the packed argument type
+            size_t const prefixLength = spec.m_pLengthModifier - spec.m_pStart;
+            memcpy( specifierBuffer, spec.m_pStart, prefixLength );
+            char* pSpecifierEnd = specifierBuffer + prefixLength;
+            if ( spec.m_type == ArgumentType::SignedInteger || spec.m_type == ArgumentType::UnsignedInteger )
+            {
+                *pSpecifierEnd++ = 'l';
+                *pSpecifierEnd++ = 'l';
+            }
+            *pSpecifierEnd++ = *spec.m_pConversion;
+            *pSpecifierEnd = 0;
+
+            switch ( spec.m_type )
+            {
+                case ArgumentType::SignedInteger:
+                AppendArgument( outMessage, specifierBuffer, spec, width, precision, (long long) ReadValue<int64_t>( pArguments ) );
+                break;
+
+                case ArgumentType::UnsignedInteger:
+                AppendArgument( outMessage, specifierBuffer, spec, width, precision, (unsigned long long) ReadValue<uint64_t>( pArguments ) );
+                break;
+
+                case ArgumentType::Character:
+                AppendArgument( outMessage, specifierBuffer, spec, width, precision, (int) ReadValue<int64_t>( pArguments ) );
+                break;
+
+                case ArgumentType::Double:
+                AppendArgument( outMessage, specifierBuffer, spec, width, precision, ReadValue<double>( pArguments ) );
+                break;
+
+                case ArgumentType::Pointer:
+                AppendArgument( outMessage, specifierBuffer, spec, width, precision, (void*) (uintptr_t) ReadValue<uint64_t>( pArguments ) );
+                break;
+
+                case ArgumentType::String:
+                {
+                    size_t const length = (size_t) ReadValue<uint64_t>( pArguments );
+                    char const* pString = reinterpret_cast<char const*>( pArguments );
+                    pArguments += AlignTo8( length + 1 );
+                    AppendArgument( outMessage, specifierBuffer, spec, width, precision, pString );
+                }
+                break;
+
+                default:
+                EE_UNREACHABLE_CODE();
+                break;
+            }
+        }
+
+        outMessage.append( pLiteralStart );
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Base/Types/Severity.h"
+#include "Base/Types/String.h"
+#include "Base/Types/Arrays.h"
+#include <stdarg.h>
+
+//-------------------------------------------------------------------------
+// Log Record
+//-------------------------------------------------------------------------
+// A compact, self-contained binary representation of a log call
+// The message is not formatted when the record is created, instead we store the format string and the packed format
+// arguments and only generate the message when the record is processed (usually on the log thread)
+//
+// All strings (including string arguments) are copied into the record since we cannot rely on their lifetimes
+// Format specifiers that we cannot pack (e.g. wide strings or %n) result in the message being formatted immediately
+//
+// Layout: [RecordHeader][category\0][sourceInfo\0][filename\0][format\0][padding][packed arguments]
+
+namespace EE::Log
+{
+    struct RecordHeader
+    {
+        enum Flags : uint8_t
+        {
+            Padding         = 1 << 0,   // Unused space in a ring buffer, only the size and flags are valid
+            Preformatted    = 1 << 1,   // The format string is the final message
+        };
+
+    public:
+
+        inline char const* GetCategory() const { return reinterpret_cast<char const*>( this + 1 ); }
+        inline char const* GetSourceInfo() const { return GetCategory() + m_categoryLength + 1; }
+        inline char const* GetFilename() const { return GetSourceInfo() + m_sourceInfoLength + 1; }
+        inline char const* GetFormat() const { return GetFilename() + m_filenameLength + 1; }
+
+    public:
+
+        uint32_t                        m_size = 0;             // The total size of the record including this header, always a multiple of 8
+        uint8_t                         m_flags = 0;
+        uint8_t                         m_severity = 0;
+        int32_t                         m_lineNumber = 0;
+        uint32_t                        m_categoryLength = 0;
+        uint32_t                        m_sourceInfoLength = 0;
+        uint32_t                        m_filenameLength = 0;
+        uint32_t                        m_formatLength = 0;
+        uint64_t                        m_timestamp = 0;        // Platform clock time in nanoseconds
+    };
+
+    static_assert( sizeof( RecordHeader ) % 8 == 0, "Records need to be 8 byte aligned" );
+
+    //-------------------------------------------------------------------------
+
+    // Packs a log call into a record, the output buffer is reused to avoid allocations
+    void PackRecord( TVector<uint8_t>& outRecord, Severity severity, char const* pCategory, char const* pSourceInfo, char const* pFilename, int32_t lineNumber, uint64_t timestamp, char const* pMessageFormat, va_list args );
+
+    // Generates the message for a record
+    void FormatRecordMessage( RecordHeader const* pRecord, String& outMessage );
+}
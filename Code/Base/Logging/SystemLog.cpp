@@ -1,28 +1,296 @@
 #include "SystemLog.h"
+#include "LogRecord.h"
 #include "Base/Threading/Threading.h"
 #include "Base/FileSystem/FileSystem.h"
 #include "Base/FileSystem/FileStreams.h"
 #include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Memory/Memory.h"
+#include "Base/Math/Math.h"
+#include "Base/Profiling.h"
+#include <atomic>
 #include <ctime>
 
 //-------------------------------------------------------------------------
+// Log calls only pack a compact record (see LogRecord.h) into a per-thread ring buffer, the log thread then formats the
+// records, outputs them and adds them to the entry list. This keeps locks, allocations and formatting off the calling thread.
+//
+// If a thread's ring buffer is full, info messages are dropped (and counted) while warnings and errors are processed
+// immediately on the calling thread. Fatal errors and asserts flush all pending records so they are never lost.
 
 namespace EE::SystemLog
 {
     namespace
     {
+        using Log::RecordHeader;
+
+        // Single producer (the owning thread) single consumer (whoever holds the processing mutex) ring buffer of records
+        class ThreadLogBuffer
+        {
+        public:
+
+            constexpr static uint32_t const s_capacity = 64 * 1024;
+            constexpr static uint32_t const s_maxRecordSize = s_capacity / 2;
+
+        public:
+
+            ThreadLogBuffer()
+            {
+                m_pData = (uint8_t*) EE::Alloc( s_capacity, 8 );
+            }
+
+            ~ThreadLogBuffer()
+            {
+                EE::Free( (void*&) m_pData );
+            }
+
+            inline uint32_t GetUsedSpace() const
+            {
+                return uint32_t( m_writePosition.load( std::memory_order_relaxed ) - m_readPosition.load( std::memory_order_relaxed ) );
+            }
+
+            // Producer - returns false if there isnt enough space for the record
+            bool TryWrite( uint8_t const* pRecord, uint32_t size )
+            {
+                EE_ASSERT( size % 8 == 0 && size <= s_maxRecordSize );
+
+                uint64_t writePosition = m_writePosition.load( std::memory_order_relaxed );
+                uint64_t const readPosition = m_readPosition.load( std::memory_order_acquire );
+
+                // Records are never split, if the record doesnt fit at the end of the buffer we pad and wrap around
+                uint32_t const offset = uint32_t( writePosition & ( s_capacity - 1 ) );
+                uint32_t const contiguousSpace = s_capacity - offset;
+                uint32_t const paddingSize = ( size > contiguousSpace ) ? contiguousSpace : 0;
+                if ( s_capacity - ( writePosition - readPosition ) < uint64_t( size ) + paddingSize )
+                {
+                    return false;
+                }
+
+                if ( paddingSize > 0 )
+                {
+                    RecordHeader* pPadding = reinterpret_cast<RecordHeader*>( m_pData + offset );
+                    pPadding->m_size = paddingSize;
+                    pPadding->m_flags = RecordHeader::Padding;
+                    writePosition += paddingSize;
+                }
+
+                memcpy( m_pData + ( writePosition & ( s_capacity - 1 ) ), pRecord, size );
+                m_writePosition.store( writePosition + size, std::memory_order_release );
+                return true;
+            }
+
+            // Consumer - returns the next record without removing it
+            RecordHeader const* Peek()
+            {
+                uint64_t const writePosition = m_writePosition.load( std::memory_order_acquire );
+                uint64_t readPosition = m_readPosition.load( std::memory_order_relaxed );
+                while ( readPosition != writePosition )
+                {
+                    RecordHeader const* pRecord = reinterpret_cast<RecordHeader const*>( m_pData + ( readPosition & ( s_capacity - 1 ) ) );
+                    if ( ( pRecord->m_flags & RecordHeader::Padding ) == 0 )
+                    {
+                        return pRecord;
+                    }
+
+                    readPosition += pRecord->m_size;
+                    m_readPosition.store( readPosition, std::memory_order_release );
+                }
+
+                return nullptr;
+            }
+
+            // Consumer - removes the record returned by peek
+            void Pop( RecordHeader const* pRecord )
+            {
+                m_readPosition.store( m_readPosition.load( std::memory_order_relaxed ) + pRecord->m_size, std::memory_order_release );
+            }
+
+        public:
+
+            TVector<uint8_t>                        m_recordBuffer; // Scratch buffer for the owning thread to pack records into
+
+        private:
+
+            uint8_t*                                m_pData = nullptr;
+            alignas( 64 ) std::atomic<uint64_t>     m_writePosition = 0;
+            alignas( 64 ) std::atomic<uint64_t>     m_readPosition = 0;
+        };
+
+        //-------------------------------------------------------------------------
+
+        constexpr static int32_t const s_maxThreads = 128;
+
         struct LogData
         {
-            TVector<Log::Entry>             m_logEntries;
-            TVector<Log::Entry>             m_unhandledWarningsAndErrors;
-            FileSystem::Path                m_logPath;
-            Threading::Mutex                m_mutex;
-            int32_t                         m_fatalErrorIndex = InvalidIndex;
-            int32_t                         m_numWarnings = 0;
-            int32_t                         m_numErrors = 0;
+            TVector<Log::Entry>                     m_logEntries;
+            TVector<Log::Entry>                     m_unhandledWarningsAndErrors;
+            FileSystem::Path                        m_logPath;
+            Threading::Mutex                        m_mutex;
+            std::atomic<int32_t>                    m_fatalErrorIndex = InvalidIndex;   // Written under the mutex, read without it
+            std::atomic<int32_t>                    m_numWarnings = 0;
+            std::atomic<int32_t>                    m_numErrors = 0;
+
+            // Record processing
+            std::atomic<ThreadLogBuffer*>           m_threadBuffers[s_maxThreads] = {};
+            std::atomic<int32_t>                    m_numThreadBuffers = 0;
+            std::atomic<uint64_t>                   m_numDroppedEntries = 0;
+            Threading::RecursiveMutex               m_processingMutex;
+
+            // Used to convert record timestamps to calendar time
+            time_t                                  m_startTime = 0;
+            uint64_t                                m_startTimestamp = 0;
+
+            // Log thread
+            Threading::Thread                       m_logThread;
+            Threading::Mutex                        m_logThreadMutex;
+            Threading::ConditionVariable            m_logThreadWakeCondition;
+            std::atomic<bool>                       m_exitRequested = false;
         };
 
-        static LogData*                     g_pLog = nullptr;
+        static LogData*                             g_pLog = nullptr;
+        static thread_local ThreadLogBuffer*        t_pThreadBuffer = nullptr;
+        static thread_local LogData*                t_pThreadBufferOwner = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        // Returns nullptr if we have run out of buffer slots, the log calls from this thread will be processed immediately
+        static ThreadLogBuffer* GetThreadBuffer()
+        {
+            if ( t_pThreadBufferOwner != g_pLog )
+            {
+                t_pThreadBufferOwner = g_pLog;
+                t_pThreadBuffer = nullptr;
+
+                int32_t const slotIdx = g_pLog->m_numThreadBuffers.fetch_add( 1 );
+                EE_ASSERT( slotIdx < s_maxThreads );
+                if ( slotIdx < s_maxThreads )
+                {
+                    t_pThreadBuffer = EE::New<ThreadLogBuffer>();
+                    g_pLog->m_threadBuffers[slotIdx].store( t_pThreadBuffer, std::memory_order_release );
+                }
+            }
+
+            return t_pThreadBuffer;
+        }
+
+        static void ProcessRecord( RecordHeader const* pRecord )
+        {
+            Log::Entry entry;
+            entry.m_category = pRecord->GetCategory();
+            entry.m_sourceInfo = pRecord->GetSourceInfo();
+            entry.m_filename = pRecord->GetFilename();
+            entry.m_lineNumber = pRecord->m_lineNumber;
+            entry.m_severity = (Severity) pRecord->m_severity;
+
+            // Message
+            Log::FormatRecordMessage( pRecord, entry.m_message );
+
+            // Timestamp
+            entry.m_timestamp.resize( 9 );
+            int64_t const nanosecondsSinceStart = int64_t( pRecord->m_timestamp - g_pLog->m_startTimestamp );
+            time_t const t = g_pLog->m_startTime + time_t( nanosecondsSinceStart / 1000000000 );
+            strftime( entry.m_timestamp.data(), 9, "%H:%M:%S", std::localtime( &t ) );
+
+            // Immediate display of log
+            //-------------------------------------------------------------------------
+            // This uses a less verbose format, if you want more info look at the saved log
+
+            InlineString traceMessage;
+            if ( entry.m_sourceInfo.empty() )
+            {
+                traceMessage.sprintf( "[%s][%s][%s] %s", entry.m_timestamp.c_str(), GetSeverityAsString( entry.m_severity ), entry.m_category.c_str(), entry.m_message.c_str() );
+            }
+            else
+            {
+                traceMessage.sprintf( "[%s][%s][%s][%s] %s", entry.m_timestamp.c_str(), GetSeverityAsString( entry.m_severity ), entry.m_category.c_str(), entry.m_sourceInfo.c_str(), entry.m_message.c_str() );
+            }
+
+            // Print to debug trace
+            EE_TRACE_MSG( traceMessage.c_str() );
+
+            // Print to std out
+            printf( "%s\n", traceMessage.c_str() );
+
+            // Store entry and track unhandled warnings and errors
+            //-------------------------------------------------------------------------
+
+            std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
+
+            if ( entry.m_severity == Severity::FatalError )
+            {
+                g_pLog->m_fatalErrorIndex.store( (int32_t) g_pLog->m_logEntries.size(), std::memory_order_release );
+            }
+
+            if ( entry.m_severity > Severity::Info )
+            {
+                g_pLog->m_numWarnings.fetch_add( ( entry.m_severity == Severity::Warning ) ? 1 : 0, std::memory_order_relaxed );
+                g_pLog->m_numErrors.fetch_add( ( entry.m_severity == Severity::Error ) ? 1 : 0, std::memory_order_relaxed );
+                g_pLog->m_unhandledWarningsAndErrors.emplace_back( entry );
+            }
+
+            g_pLog->m_logEntries.emplace_back( eastl::move( entry ) );
+        }
+
+        // Process all pending records in timestamp order, requires the processing mutex
+        static void ProcessPendingRecords()
+        {
+            int32_t const numThreadBuffers = Math::Min( g_pLog->m_numThreadBuffers.load( std::memory_order_acquire ), s_maxThreads );
+
+            while ( true )
+            {
+                ThreadLogBuffer* pOldestBuffer = nullptr;
+                RecordHeader const* pOldestRecord = nullptr;
+
+                for ( int32_t i = 0; i < numThreadBuffers; i++ )
+                {
+                    ThreadLogBuffer* pBuffer = g_pLog->m_threadBuffers[i].load( std::memory_order_acquire );
+                    if ( pBuffer == nullptr )
+                    {
+                        continue;
+                    }
+
+                    RecordHeader const* pRecord = pBuffer->Peek();
+                    if ( pRecord != nullptr && ( pOldestRecord == nullptr || pRecord->m_timestamp < pOldestRecord->m_timestamp ) )
+                    {
+                        pOldestBuffer = pBuffer;
+                        pOldestRecord = pRecord;
+                    }
+                }
+
+                if ( pOldestRecord == nullptr )
+                {
+                    break;
+                }
+
+                ProcessRecord( pOldestRecord );
+                pOldestBuffer->Pop( pOldestRecord );
+            }
+        }
+
+        static void WakeLogThread()
+        {
+            g_pLog->m_logThreadWakeCondition.notify_one();
+        }
+
+        static void LogThreadMain()
+        {
+            Memory::InitializeThreadHeap();
+            EE_PROFILE_THREAD_START( "EE Log Thread" );
+            Threading::SetCurrentThreadName( "EE Log Thread" );
+
+            while ( !g_pLog->m_exitRequested.load( std::memory_order_acquire ) )
+            {
+                {
+                    Threading::Lock lock( g_pLog->m_logThreadMutex );
+                    g_pLog->m_logThreadWakeCondition.wait_for( lock, std::chrono::milliseconds( 10 ) );
+                }
+
+                Threading::RecursiveScopeLock processingLock( g_pLog->m_processingMutex );
+                ProcessPendingRecords();
+            }
+
+            EE_PROFILE_THREAD_END();
+            Memory::ShutdownThreadHeap();
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -31,11 +299,27 @@ namespace EE::SystemLog
     {
         EE_ASSERT( g_pLog == nullptr );
         g_pLog = EE::New<LogData>();
+        g_pLog->m_startTime = std::time( nullptr );
+        g_pLog->m_startTimestamp = PlatformClock::GetTime().ToU64();
+        g_pLog->m_logThread = Threading::Thread( &LogThreadMain );
     }
 
     void Shutdown()
     {
         EE_ASSERT( g_pLog != nullptr );
+
+        g_pLog->m_exitRequested.store( true, std::memory_order_release );
+        WakeLogThread();
+        g_pLog->m_logThread.join();
+
+        Flush();
+
+        for ( int32_t i = 0; i < s_maxThreads; i++ )
+        {
+            ThreadLogBuffer* pBuffer = g_pLog->m_threadBuffers[i].load();
+            EE::Delete( pBuffer );
+        }
+
         EE::Delete( g_pLog );
     }
 
@@ -44,12 +328,36 @@ namespace EE::SystemLog
         return g_pLog != nullptr;
     }
 
+    void Flush()
+    {
+        EE_ASSERT( WasInitialized() );
+        Threading::RecursiveScopeLock processingLock( g_pLog->m_processingMutex );
+        ProcessPendingRecords();
+    }
+
+    uint64_t GetNumDroppedEntries()
+    {
+        EE_ASSERT( WasInitialized() );
+        return g_pLog->m_numDroppedEntries.load( std::memory_order_relaxed );
+    }
+
     //-------------------------------------------------------------------------
 
-    TVector<Log::Entry> const& GetLogEntries()
+    size_t GetNumLogEntries()
+    {
+        EE_ASSERT( WasInitialized() );
+        std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
+        return g_pLog->m_logEntries.size();
+    }
+
+    void IterateLogEntries( TFunction<void( Log::Entry const& entry )> const& perEntryFunction )
     {
         EE_ASSERT( WasInitialized() );
-        return g_pLog->m_logEntries;
+        std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
+        for ( auto const& entry : g_pLog->m_logEntries )
+        {
+            perEntryFunction( entry );
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -69,6 +377,8 @@ namespace EE::SystemLog
             return;
         }
 
+        Flush();
+
         g_pLog->m_logPath.EnsureDirectoryExists();
 
         String logData;
@@ -98,13 +408,18 @@ namespace EE::SystemLog
     bool HasFatalErrorOccurred()
     {
         EE_ASSERT( WasInitialized() );
-        return g_pLog->m_fatalErrorIndex != InvalidIndex;
+        return g_pLog->m_fatalErrorIndex.load( std::memory_order_acquire ) != InvalidIndex;
     }
 
-    Log::Entry const& GetFatalError()
+    Log::Entry GetFatalError()
     {
-        EE_ASSERT( WasInitialized() && g_pLog->m_fatalErrorIndex != InvalidIndex );
-        return g_pLog->m_logEntries[g_pLog->m_fatalErrorIndex];
+        EE_ASSERT( WasInitialized() );
+
+        // The log thread can append (and reallocate) the entries at any time, so we need to copy the entry under the lock
+        std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
+        int32_t const fatalErrorIndex = g_pLog->m_fatalErrorIndex.load( std::memory_order_relaxed );
+        EE_ASSERT( fatalErrorIndex != InvalidIndex );
+        return g_pLog->m_logEntries[fatalErrorIndex];
     }
 
     //-------------------------------------------------------------------------
@@ -122,13 +437,13 @@ namespace EE::SystemLog
     int32_t GetNumWarnings()
     {
         EE_ASSERT( WasInitialized() );
-        return g_pLog->m_numWarnings;
+        return g_pLog->m_numWarnings.load( std::memory_order_relaxed );
     }
 
     int32_t GetNumErrors()
     {
         EE_ASSERT( WasInitialized() );
-        return g_pLog->m_numErrors;
+        return g_pLog->m_numErrors.load( std::memory_order_relaxed );
     }
 }
 
@@ -150,63 +465,46 @@ namespace EE::SystemLog
         EE_ASSERT( WasInitialized() );
         EE_ASSERT( pCategory != nullptr && pFilename != nullptr && pMessageFormat != nullptr );
 
-        {
-            std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
-
-            if ( severity == Severity::FatalError )
-            {
-                g_pLog->m_fatalErrorIndex = (int32_t) g_pLog->m_logEntries.size();
-            }
+        ThreadLogBuffer* pBuffer = GetThreadBuffer();
 
-            auto& entry = g_pLog->m_logEntries.emplace_back( Log::Entry() );
+        TVector<uint8_t> overflowRecordBuffer;
+        TVector<uint8_t>& recordBuffer = ( pBuffer != nullptr ) ? pBuffer->m_recordBuffer : overflowRecordBuffer;
+        Log::PackRecord( recordBuffer, severity, pCategory, pSourceInfo, pFilename, pLineNumber, PlatformClock::GetTime().ToU64(), pMessageFormat, args );
+        uint32_t const recordSize = (uint32_t) recordBuffer.size();
 
-            //-------------------------------------------------------------------------
+        // Try to queue the record for the log thread
+        //-------------------------------------------------------------------------
 
-            entry.m_category = pCategory;
-            entry.m_sourceInfo = ( pSourceInfo != nullptr ) ? pSourceInfo : String();
-            entry.m_filename = pFilename;
-            entry.m_lineNumber = pLineNumber;
-            entry.m_severity = severity;
-            entry.m_timestamp.resize( 9 );
-
-            // Message
-            entry.m_message.sprintf_va_list( pMessageFormat, args );
-            va_end( args );
-
-            // Timestamp
-            entry.m_timestamp.resize( 9 );
-            time_t const t = std::time( nullptr );
-            strftime( entry.m_timestamp.data(), 9, "%H:%M:%S", std::localtime( &t ) );
-
-            // Immediate display of log
-            //-------------------------------------------------------------------------
-            // This uses a less verbose format, if you want more info look at the saved log
-
-            InlineString traceMessage;
-            if ( entry.m_sourceInfo.empty() )
+        bool const canBeQueued = pBuffer != nullptr && recordSize <= ThreadLogBuffer::s_maxRecordSize;
+        if ( canBeQueued && pBuffer->TryWrite( recordBuffer.data(), recordSize ) )
+        {
+            if ( severity == Severity::FatalError )
             {
-                traceMessage.sprintf( "[%s][%s][%s] %s", entry.m_timestamp.c_str(), GetSeverityAsString( entry.m_severity ), entry.m_category.c_str(), entry.m_message.c_str() );
+                Flush();
             }
-            else
+            else if ( severity > Severity::Info || pBuffer->GetUsedSpace() > ThreadLogBuffer::s_capacity / 2 )
             {
-                traceMessage.sprintf( "[%s][%s][%s][%s] %s", entry.m_timestamp.c_str(), GetSeverityAsString( entry.m_severity ), entry.m_category.c_str(), entry.m_sourceInfo.c_str(), entry.m_message.c_str() );
+                WakeLogThread();
             }
 
-            // Print to debug trace
-            EE_TRACE_MSG( traceMessage.c_str() );
+            return;
+        }
 
-            // Print to std out
-            printf( "%s\n", traceMessage.c_str() );
+        // The buffer is full, drop info messages but never warnings or errors
+        //-------------------------------------------------------------------------
 
-            // Track unhandled warnings and errors
-            //-------------------------------------------------------------------------
+        if ( canBeQueued && severity == Severity::Info )
+        {
+            g_pLog->m_numDroppedEntries.fetch_add( 1, std::memory_order_relaxed );
+            WakeLogThread();
+            return;
+        }
 
-            if ( entry.m_severity > Severity::Info )
-            {
-                g_pLog->m_numWarnings += ( entry.m_severity == Severity::Warning ) ? 1 : 0;
-                g_pLog->m_numErrors += ( entry.m_severity == Severity::Error ) ? 1 : 0;
-                g_pLog->m_unhandledWarningsAndErrors.emplace_back( entry );
-            }
+        // Process the record immediately, flush the pending records first to maintain the log order
+        {
+            Threading::RecursiveScopeLock processingLock( g_pLog->m_processingMutex );
+            ProcessPendingRecords();
+            ProcessRecord( reinterpret_cast<RecordHeader const*>( recordBuffer.data() ) );
         }
     }
 
@@ -218,7 +516,9 @@ namespace EE::SystemLog
 
         if ( g_pLog != nullptr )
         {
-            AddEntry( Severity::Error, "Assert", "Assert", pFile, line, pAssertInfo );
+            // Asserts usually precede a break or a crash, so ensure that everything is in the log
+            AddEntry( Severity::Error, "Assert", "Assert", pFile, line, "%s", pAssertInfo );
+            Flush();
         }
     }
 
@@ -232,4 +532,4 @@ namespace EE::SystemLog
 
         LogAssert( pFile, line, &buffer[0] );
     }
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "LogEntry.h"
 #include "Base/Types/Containers_ForwardDecl.h"
+#include "Base/Types/Function.h"
 
 //-------------------------------------------------------------------------
 
@@ -17,15 +18,26 @@ namespace EE::SystemLog
     EE_BASE_API void Shutdown();
     EE_BASE_API bool WasInitialized();
 
+    // Log calls are processed asynchronously on the log thread, this processes all pending log calls on the calling thread
+    EE_BASE_API void Flush();
+
+    // The number of info messages that were dropped because a thread's log buffer was full
+    EE_BASE_API uint64_t GetNumDroppedEntries();
+
     // Accessors
     //-------------------------------------------------------------------------
 
-    EE_BASE_API TVector<Log::Entry> const& GetLogEntries();
+    EE_BASE_API size_t GetNumLogEntries();
+
+    // The log is locked during iteration, so dont log from within the function
+    EE_BASE_API void IterateLogEntries( TFunction<void( Log::Entry const& entry )> const& perEntryFunction );
     EE_BASE_API int32_t GetNumWarnings();
     EE_BASE_API int32_t GetNumErrors();
 
     EE_BASE_API bool HasFatalErrorOccurred();
-    EE_BASE_API Log::Entry const& GetFatalError();
+
+    // Returns a copy since the log entries can be modified by the log thread at any time
+    EE_BASE_API Log::Entry GetFatalError();
 
     // Transfers a list of unhandled warnings and errors - useful for displaying all errors for a given frame.
     // Calling this function will clear the list of warnings and errors.
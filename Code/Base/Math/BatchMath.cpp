@@ -0,0 +1,155 @@
+#include "BatchMath.h"
+#include "Base/Platform/Platform.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE::BatchMath
+{
+    // Implemented in BatchMath_AVX2.cpp, these only process full batches of 8 elements
+    namespace AVX2
+    {
+        void FastSLerp( Transform const* pFrom, Transform const* pTo, float t, Transform* pResults, int32_t numTransforms );
+        void Multiply( Transform const* pA, Transform const* pB, Transform* pResults, int32_t numTransforms );
+        void MultiplyToMatrices( Transform const* pA, Transform const* pB, Matrix* pResults, int32_t numTransforms );
+        void RejectSeparatedBoxes( AABB const& bounds, OBB const* pBoxes, bool* pMayOverlap, int32_t numBoxes );
+
+        // Used by the AVX2 multiply kernels for the batches that contain negative scales, these need the matrix path
+        // They are implemented here, so that the AVX2 file never instantiates any of the inline scalar math functions
+        void MultiplyScalar( Transform const* pA, Transform const* pB, Transform* pResults, int32_t numTransforms )
+        {
+            for ( int32_t i = 0; i < numTransforms; i++ )
+            {
+                pResults[i] = pA[i] * pB[i];
+            }
+        }
+
+        void MultiplyToMatricesScalar( Transform const* pA, Transform const* pB, Matrix* pResults, int32_t numTransforms )
+        {
+            for ( int32_t i = 0; i < numTransforms; i++ )
+            {
+                pResults[i] = ( pA[i] * pB[i] ).ToMatrix();
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        static bool IsAVX2Supported()
+        {
+            return Platform::IsCPUFeatureSupported( Platform::CPUFeature::AVX2 ) && Platform::IsCPUFeatureSupported( Platform::CPUFeature::FMA );
+        }
+
+        static std::atomic<InstructionSet>& GetSelectedInstructionSet()
+        {
+            static std::atomic<InstructionSet> instructionSet = IsAVX2Supported() ? InstructionSet::AVX2 : InstructionSet::SSE42;
+            return instructionSet;
+        }
+
+        EE_FORCE_INLINE static bool UseAVX2()
+        {
+            return GetSelectedInstructionSet().load( std::memory_order_relaxed ) == InstructionSet::AVX2;
+        }
+
+        // Returns the number of elements handled by the AVX2 kernels, i.e. the full batches of 8
+        EE_FORCE_INLINE static int32_t GetNumBatchedElements( int32_t numElements )
+        {
+            return UseAVX2() ? ( numElements & ~7 ) : 0;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    InstructionSet GetInstructionSet()
+    {
+        return GetSelectedInstructionSet().load( std::memory_order_relaxed );
+    }
+
+    bool SetInstructionSet( InstructionSet instructionSet )
+    {
+        if ( instructionSet == InstructionSet::AVX2 && !IsAVX2Supported() )
+        {
+            return false;
+        }
+
+        GetSelectedInstructionSet().store( instructionSet, std::memory_order_relaxed );
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void FastSLerp( Transform const* pFrom, Transform const* pTo, float t, Transform* pResults, int32_t numTransforms )
+    {
+        EE_ASSERT( numTransforms == 0 || ( pFrom != nullptr && pTo != nullptr && pResults != nullptr ) );
+
+        int32_t const numBatched = GetNumBatchedElements( numTransforms );
+        if ( numBatched > 0 )
+        {
+            AVX2::FastSLerp( pFrom, pTo, t, pResults, numBatched );
+        }
+
+        for ( int32_t i = numBatched; i < numTransforms; i++ )
+        {
+            pResults[i] = Transform::FastSLerp( pFrom[i], pTo[i], t );
+        }
+    }
+
+    void Multiply( Transform const* pA, Transform const* pB, Transform* pResults, int32_t numTransforms )
+    {
+        EE_ASSERT( numTransforms == 0 || ( pA != nullptr && pB != nullptr && pResults != nullptr ) );
+
+        int32_t const numBatched = GetNumBatchedElements( numTransforms );
+        if ( numBatched > 0 )
+        {
+            AVX2::Multiply( pA, pB, pResults, numBatched );
+        }
+
+        for ( int32_t i = numBatched; i < numTransforms; i++ )
+        {
+            pResults[i] = pA[i] * pB[i];
+        }
+    }
+
+    void MultiplyToMatrices( Transform const* pA, Transform const* pB, Matrix* pResults, int32_t numTransforms )
+    {
+        EE_ASSERT( numTransforms == 0 || ( pA != nullptr && pB != nullptr && pResults != nullptr ) );
+
+        int32_t const numBatched = GetNumBatchedElements( numTransforms );
+        if ( numBatched > 0 )
+        {
+            AVX2::MultiplyToMatrices( pA, pB, pResults, numBatched );
+        }
+
+        for ( int32_t i = numBatched; i < numTransforms; i++ )
+        {
+            pResults[i] = ( pA[i] * pB[i] ).ToMatrix();
+        }
+    }
+
+    void Overlaps( AABB const& bounds, OBB const* pBoxes, bool* pResults, int32_t numBoxes )
+    {
+        EE_ASSERT( numBoxes == 0 || ( pBoxes != nullptr && pResults != nullptr ) );
+
+        int32_t const numBatched = GetNumBatchedElements( numBoxes );
+        if ( numBatched > 0 )
+        {
+            AVX2::RejectSeparatedBoxes( bounds, pBoxes, pResults, numBatched );
+        }
+
+        for ( int32_t i = 0; i < numBatched; i++ )
+        {
+            if ( pResults[i] )
+            {
+                pResults[i] = bounds.Overlaps( pBoxes[i] );
+            }
+        }
+
+        for ( int32_t i = numBatched; i < numBoxes; i++ )
+        {
+            pResults[i] = bounds.Overlaps( pBoxes[i] );
+        }
+    }
+
+}
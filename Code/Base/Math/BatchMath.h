@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Base/_Module/API.h"
+#include "Base/Math/BoundingVolumes.h"
+
+//-------------------------------------------------------------------------
+// Batch Math
+//-------------------------------------------------------------------------
+// Kernels that apply the same operation to arrays of math types, used by the hot per-bone and per-instance loops
+// (pose blending, clip sampling, skinning matrices, culling).
+//
+// Each kernel has an SSE implementation (matching the scalar math functions exactly) and an AVX2/FMA implementation that
+// processes eight elements at a time using the 8-wide SoA types (see Vector8.h). The implementation is selected at
+// runtime based on the CPU features, so the engine still runs on CPUs without AVX2. The AVX2 results can differ from the
+// SSE ones in the last bits due to fused multiply-adds.
+//
+// Unless otherwise specified, the result arrays may alias the input arrays.
+
+namespace EE::BatchMath
+{
+    enum class InstructionSet : uint8_t
+    {
+        SSE42,
+        AVX2,           // Also requires FMA
+    };
+
+    // Get the instruction set used by the kernels, this is the best one the CPU supports unless overridden
+    EE_BASE_API InstructionSet GetInstructionSet();
+
+    // Override the instruction set used by the kernels (for debugging and benchmarking)
+    // Returns false and leaves the current instruction set unchanged if the CPU doesnt support the requested one
+    EE_BASE_API bool SetInstructionSet( InstructionSet instructionSet );
+
+    //-------------------------------------------------------------------------
+
+    // pResults[i] = Transform::FastSLerp( pFrom[i], pTo[i], t )
+    EE_BASE_API void FastSLerp( Transform const* pFrom, Transform const* pTo, float t, Transform* pResults, int32_t numTransforms );
+
+    // pResults[i] = pA[i] * pB[i]
+    EE_BASE_API void Multiply( Transform const* pA, Transform const* pB, Transform* pResults, int32_t numTransforms );
+
+    // pResults[i] = ( pA[i] * pB[i] ).ToMatrix()
+    EE_BASE_API void MultiplyToMatrices( Transform const* pA, Transform const* pB, Matrix* pResults, int32_t numTransforms );
+
+    // pResults[i] = bounds.Overlaps( pBoxes[i] )
+    // The AVX2 implementation first rejects the boxes that are separated from the bounds along one of the world axes and
+    // only runs the full overlap test on the remaining boxes, so the results are identical for both implementations
+    EE_BASE_API void Overlaps( AABB const& bounds, OBB const* pBoxes, bool* pResults, int32_t numBoxes );
+}
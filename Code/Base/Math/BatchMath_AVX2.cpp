@@ -0,0 +1,143 @@
+// This file is compiled with AVX2 enabled (/arch:AVX2 is set for this file only in the project), the kernels are only
+// called once the dispatch in BatchMath.cpp has verified that the CPU supports AVX2 and FMA.
+//
+// Only use intrinsics and the 8-wide types in here! Any inline function from the regular math headers that gets instantiated
+// in this file is compiled with AVX2 as well, and the linker is free to pick that copy for the whole program.
+
+#if defined( __GNUC__ ) && !defined( __AVX2__ )
+#if defined( __clang__ )
+#pragma clang attribute push( __attribute__( ( target( "avx2,fma" ) ) ), apply_to = function )
+#define EE_BATCHMATH_CLANG_TARGET_PUSHED 1
+#else
+#pragma GCC target( "avx2,fma" )
+#endif
+#endif
+
+#include "BatchMath.h"
+#include "Base/Math/Transform8.h"
+#include <cstddef>
+
+//-------------------------------------------------------------------------
+
+namespace EE::BatchMath::AVX2
+{
+    void MultiplyScalar( Transform const* pA, Transform const* pB, Transform* pResults, int32_t numTransforms );
+    void MultiplyToMatricesScalar( Transform const* pA, Transform const* pB, Matrix* pResults, int32_t numTransforms );
+
+    //-------------------------------------------------------------------------
+
+    void FastSLerp( Transform const* pFrom, Transform const* pTo, float t, Transform* pResults, int32_t numTransforms )
+    {
+        EE_ASSERT( ( numTransforms % 8 ) == 0 );
+
+        __m256 const t8 = _mm256_set1_ps( t );
+        for ( int32_t i = 0; i < numTransforms; i += 8 )
+        {
+            Transform8 const from( &pFrom[i] );
+            Transform8 const to( &pTo[i] );
+            Transform8::FastSLerp( from, to, t8 ).Store( &pResults[i] );
+        }
+    }
+
+    void Multiply( Transform const* pA, Transform const* pB, Transform* pResults, int32_t numTransforms )
+    {
+        EE_ASSERT( ( numTransforms % 8 ) == 0 );
+
+        for ( int32_t i = 0; i < numTransforms; i += 8 )
+        {
+            Transform8 const a( &pA[i] );
+            Transform8 const b( &pB[i] );
+            if ( ( a.GetNegativeScaleMask() | b.GetNegativeScaleMask() ) != 0 )
+            {
+                MultiplyScalar( &pA[i], &pB[i], &pResults[i], 8 );
+            }
+            else
+            {
+                Transform8::Multiply( a, b ).Store( &pResults[i] );
+            }
+        }
+    }
+
+    void MultiplyToMatrices( Transform const* pA, Transform const* pB, Matrix* pResults, int32_t numTransforms )
+    {
+        EE_ASSERT( ( numTransforms % 8 ) == 0 );
+
+        for ( int32_t i = 0; i < numTransforms; i += 8 )
+        {
+            Transform8 const a( &pA[i] );
+            Transform8 const b( &pB[i] );
+            if ( ( a.GetNegativeScaleMask() | b.GetNegativeScaleMask() ) != 0 )
+            {
+                MultiplyToMatricesScalar( &pA[i], &pB[i], &pResults[i], 8 );
+            }
+            else
+            {
+                Transform8::Multiply( a, b ).StoreAsMatrices( &pResults[i] );
+            }
+        }
+    }
+
+    // Separating axis test using only the world axes, i.e. the box is separated from the bounds along axis j if
+    // |c(box)j - c(bounds)j| > h(bounds)j + sum_i( |R(i,j)| * h(box)i ), where R is the rotation matrix of the box
+    // This is conservative (it never rejects overlapping boxes) but it will miss separations along the other axes
+    void RejectSeparatedBoxes( AABB const& bounds, OBB const* pBoxes, bool* pMayOverlap, int32_t numBoxes )
+    {
+        EE_ASSERT( ( numBoxes % 8 ) == 0 );
+
+        static_assert( sizeof( OBB ) == 12 * sizeof( float ), "OBB layout changed, the loads below assume [orientation, center, extents]" );
+        static_assert( offsetof( OBB, m_orientation ) == 0 && offsetof( OBB, m_center ) == 4 * sizeof( float ) && offsetof( OBB, m_extents ) == 8 * sizeof( float ) );
+
+        float const* pBoundsCenter = (float const*) &bounds.m_center;
+        float const* pBoundsHalfExtents = (float const*) &bounds.m_halfExtents;
+        __m256 const boundsCenterX = _mm256_set1_ps( pBoundsCenter[0] );
+        __m256 const boundsCenterY = _mm256_set1_ps( pBoundsCenter[1] );
+        __m256 const boundsCenterZ = _mm256_set1_ps( pBoundsCenter[2] );
+        __m256 const boundsHalfExtentsX = _mm256_set1_ps( pBoundsHalfExtents[0] );
+        __m256 const boundsHalfExtentsY = _mm256_set1_ps( pBoundsHalfExtents[1] );
+        __m256 const boundsHalfExtentsZ = _mm256_set1_ps( pBoundsHalfExtents[2] );
+
+        // Allow for some error in the rotation matrix, so that we never reject boxes that the full test would accept
+        __m256 const relativeTolerance = _mm256_set1_ps( 1.0f + 1.0e-4f );
+        __m256 const absoluteTolerance = _mm256_set1_ps( 1.0e-4f );
+
+        for ( int32_t i = 0; i < numBoxes; i += 8 )
+        {
+            float const* pData = (float const*) &pBoxes[i];
+
+            Quaternion8 orientation;
+            Vector8 center, extents;
+            SIMD::LoadTransposed8x4( pData, 12, orientation.m_x, orientation.m_y, orientation.m_z, orientation.m_w );
+            SIMD::LoadTransposed8x4( pData + 4, 12, center.m_x, center.m_y, center.m_z, center.m_w );
+            SIMD::LoadTransposed8x4( pData + 8, 12, extents.m_x, extents.m_y, extents.m_z, extents.m_w );
+
+            Vector8 row0, row1, row2;
+            orientation.GetRotationMatrixRows( row0, row1, row2 );
+            row0 = row0.GetAbs();
+            row1 = row1.GetAbs();
+            row2 = row2.GetAbs();
+
+            // World space half extents of the box
+            __m256 const boxHalfExtentsX = _mm256_fmadd_ps( row2.m_x, extents.m_z, _mm256_fmadd_ps( row1.m_x, extents.m_y, _mm256_mul_ps( row0.m_x, extents.m_x ) ) );
+            __m256 const boxHalfExtentsY = _mm256_fmadd_ps( row2.m_y, extents.m_z, _mm256_fmadd_ps( row1.m_y, extents.m_y, _mm256_mul_ps( row0.m_y, extents.m_x ) ) );
+            __m256 const boxHalfExtentsZ = _mm256_fmadd_ps( row2.m_z, extents.m_z, _mm256_fmadd_ps( row1.m_z, extents.m_y, _mm256_mul_ps( row0.m_z, extents.m_x ) ) );
+
+            __m256 const limitX = _mm256_fmadd_ps( _mm256_add_ps( boxHalfExtentsX, boundsHalfExtentsX ), relativeTolerance, absoluteTolerance );
+            __m256 const limitY = _mm256_fmadd_ps( _mm256_add_ps( boxHalfExtentsY, boundsHalfExtentsY ), relativeTolerance, absoluteTolerance );
+            __m256 const limitZ = _mm256_fmadd_ps( _mm256_add_ps( boxHalfExtentsZ, boundsHalfExtentsZ ), relativeTolerance, absoluteTolerance );
+
+            __m256 const separatedX = _mm256_cmp_ps( SIMD::Abs8( _mm256_sub_ps( center.m_x, boundsCenterX ) ), limitX, _CMP_GT_OQ );
+            __m256 const separatedY = _mm256_cmp_ps( SIMD::Abs8( _mm256_sub_ps( center.m_y, boundsCenterY ) ), limitY, _CMP_GT_OQ );
+            __m256 const separatedZ = _mm256_cmp_ps( SIMD::Abs8( _mm256_sub_ps( center.m_z, boundsCenterZ ) ), limitZ, _CMP_GT_OQ );
+
+            uint32_t const separatedMask = (uint32_t) _mm256_movemask_ps( _mm256_or_ps( separatedX, _mm256_or_ps( separatedY, separatedZ ) ) );
+            for ( int32_t j = 0; j < 8; j++ )
+            {
+                pMayOverlap[i + j] = ( separatedMask & ( 1u << j ) ) == 0;
+            }
+        }
+    }
+}
+
+#if EE_BATCHMATH_CLANG_TARGET_PUSHED
+#pragma clang attribute pop
+#endif
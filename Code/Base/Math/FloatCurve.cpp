@@ -7,6 +7,112 @@
 
 namespace EE
 {
+    namespace
+    {
+        // Get the segment to evaluate for a parameter, the parameter needs to be within the parameter range (exclusive)
+        // This is the last segment that starts before the parameter, which is also the first segment that contains it
+        static int32_t FindSegment( FloatCurve::Point const* pPoints, int32_t numPoints, float parameter, int32_t segmentHint )
+        {
+            int32_t const numSegments = numPoints - 1;
+            EE_ASSERT( numSegments > 0 && parameter > pPoints[0].m_parameter && parameter < pPoints[numSegments].m_parameter );
+
+            int32_t segmentIdx = Math::Clamp( segmentHint, 0, numSegments - 1 );
+            while ( segmentIdx > 0 && pPoints[segmentIdx].m_parameter >= parameter )
+            {
+                segmentIdx--;
+            }
+
+            while ( segmentIdx < numSegments - 1 && pPoints[segmentIdx + 1].m_parameter < parameter )
+            {
+                segmentIdx++;
+            }
+
+            return segmentIdx;
+        }
+
+        // A single evaluation for the batch evaluation, parameters outside the curve parameter range use the clamped value
+        struct HermiteLane
+        {
+            FloatCurve::Point const*    m_pSegment;         // The start point of the segment, the end point follows it
+            float                       m_parameter;
+            float                       m_clampedValue;
+            int32_t                     m_clampedMask;      // All bits set if we should use the clamped value
+        };
+
+        // A dummy segment for the clamped lanes, so that we dont divide by zero
+        static FloatCurve::Point const g_clampedLaneSegment[2] = { { 0.0f, 0.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f, 0.0f } };
+
+        // Set up a single evaluation (matches 'FloatCurve::Evaluate'), returns the updated segment hint
+        EE_FORCE_INLINE static int32_t SetHermiteLane( HermiteLane& lane, FloatCurve::Point const* pPoints, int32_t numPoints, float parameter, int32_t segmentHint )
+        {
+            lane.m_parameter = parameter;
+
+            if ( numPoints > 1 && parameter > pPoints[0].m_parameter && parameter < pPoints[numPoints - 1].m_parameter )
+            {
+                segmentHint = FindSegment( pPoints, numPoints, parameter, segmentHint );
+                lane.m_pSegment = &pPoints[segmentHint];
+                lane.m_clampedValue = 0.0f;
+                lane.m_clampedMask = 0;
+            }
+            else
+            {
+                lane.m_pSegment = g_clampedLaneSegment;
+                lane.m_clampedValue = ( numPoints == 0 ) ? 0.0f : ( parameter <= pPoints[0].m_parameter ) ? pPoints[0].m_value : pPoints[numPoints - 1].m_value;
+                lane.m_clampedMask = -1;
+            }
+
+            return segmentHint;
+        }
+
+        // Evaluates four lanes, this uses the exact same operations as Math::CubicHermite::GetPoint (no FMA) so the results
+        // are identical to the scalar evaluation
+        static void EvaluateHermiteLanes( HermiteLane const lanes[4], float* pResults, int32_t numResults )
+        {
+            #define EE_GATHER_LANES( pointIdx, member ) _mm_setr_ps( lanes[0].m_pSegment[pointIdx].member, lanes[1].m_pSegment[pointIdx].member, lanes[2].m_pSegment[pointIdx].member, lanes[3].m_pSegment[pointIdx].member )
+            __m128 const segmentStart = EE_GATHER_LANES( 0, m_parameter );
+            __m128 const segmentEnd = EE_GATHER_LANES( 1, m_parameter );
+            __m128 const value0 = EE_GATHER_LANES( 0, m_value );
+            __m128 const tangent0 = EE_GATHER_LANES( 0, m_outTangent );
+            __m128 const value1 = EE_GATHER_LANES( 1, m_value );
+            __m128 const tangent1 = EE_GATHER_LANES( 1, m_inTangent );
+            #undef EE_GATHER_LANES
+
+            __m128 const parameter = _mm_setr_ps( lanes[0].m_parameter, lanes[1].m_parameter, lanes[2].m_parameter, lanes[3].m_parameter );
+            __m128 const T = _mm_div_ps( _mm_sub_ps( parameter, segmentStart ), _mm_sub_ps( segmentEnd, segmentStart ) );
+
+            __m128 const TSquared = _mm_mul_ps( T, T );
+            __m128 const TCubed = _mm_mul_ps( TSquared, T );
+            __m128 const ThreeTSquared = _mm_mul_ps( _mm_set1_ps( 3.0f ), TSquared );
+            __m128 const TwoTCubed = _mm_mul_ps( TCubed, _mm_set1_ps( 2.0f ) );
+
+            __m128 const a = _mm_mul_ps( value0, _mm_add_ps( _mm_sub_ps( TwoTCubed, ThreeTSquared ), _mm_set1_ps( 1.0f ) ) );
+            __m128 const b = _mm_mul_ps( tangent0, _mm_add_ps( _mm_sub_ps( TCubed, _mm_mul_ps( _mm_set1_ps( 2.0f ), TSquared ) ), T ) );
+            __m128 const c = _mm_mul_ps( tangent1, _mm_sub_ps( TCubed, TSquared ) );
+            __m128 const d = _mm_mul_ps( value1, _mm_sub_ps( ThreeTSquared, TwoTCubed ) );
+            __m128 const hermite = _mm_add_ps( _mm_add_ps( _mm_add_ps( a, b ), c ), d );
+
+            __m128 const clampedValue = _mm_setr_ps( lanes[0].m_clampedValue, lanes[1].m_clampedValue, lanes[2].m_clampedValue, lanes[3].m_clampedValue );
+            __m128 const clampedMask = _mm_castsi128_ps( _mm_setr_epi32( lanes[0].m_clampedMask, lanes[1].m_clampedMask, lanes[2].m_clampedMask, lanes[3].m_clampedMask ) );
+            __m128 const result = _mm_blendv_ps( hermite, clampedValue, clampedMask );
+
+            if ( numResults == 4 )
+            {
+                _mm_storeu_ps( pResults, result );
+            }
+            else
+            {
+                alignas( 16 ) float results[4];
+                _mm_store_ps( results, result );
+                for ( int32_t i = 0; i < numResults; i++ )
+                {
+                    pResults[i] = results[i];
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     #if EE_DEVELOPMENT_TOOLS
     // ID generator needed for curve editor
     uint16_t FloatCurve::s_pointIdentifierGenerator = 0;
@@ -15,6 +121,12 @@ namespace EE
     //-------------------------------------------------------------------------
 
     float FloatCurve::Evaluate( float parameter ) const
+    {
+        int32_t segmentHint = 0;
+        return Evaluate( parameter, segmentHint );
+    }
+
+    float FloatCurve::Evaluate( float parameter, int32_t& segmentHint ) const
     {
         float result = 0;
 
@@ -30,29 +142,19 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
-        FloatRange const parameterRange = GetParameterRange();
-
-        if ( parameterRange.ContainsExclusive( parameter ) )
+        // The points are always sorted, so the parameter range is defined by the first and last points
+        if ( parameter > m_points[0].m_parameter && parameter < m_points.back().m_parameter )
         {
-            int32_t const numPoints = GetNumPoints();
-            int32_t const numCurves = numPoints - 1;
-            for ( int32_t i = 0; i < numCurves; i++ )
-            {
-                int32_t const startIdx = i;
-                int32_t const endIdx = i + 1;
+            segmentHint = FindSegment( m_points.data(), GetNumPoints(), parameter, segmentHint );
 
-                // If the parameter is within this curve, evaluate it
-                if ( parameter >= m_points[startIdx].m_parameter && parameter <= m_points[endIdx].m_parameter )
-                {
-                    float const T = ( parameter - m_points[startIdx].m_parameter ) / ( m_points[endIdx].m_parameter - m_points[startIdx].m_parameter );
-                    result = Math::CubicHermite::GetPoint( m_points[startIdx].m_value, m_points[startIdx].m_outTangent, m_points[endIdx].m_value, m_points[endIdx].m_inTangent, T );
-                    break;
-                }
-            }
+            Point const& startPoint = m_points[segmentHint];
+            Point const& endPoint = m_points[segmentHint + 1];
+            float const T = ( parameter - startPoint.m_parameter ) / ( endPoint.m_parameter - startPoint.m_parameter );
+            result = Math::CubicHermite::GetPoint( startPoint.m_value, startPoint.m_outTangent, endPoint.m_value, endPoint.m_inTangent, T );
         }
         else // Outside curve range
         {
-            if ( parameter <= parameterRange.m_begin )
+            if ( parameter <= m_points[0].m_parameter )
             {
                 result = m_points[0].m_value;
             }
@@ -65,6 +167,50 @@ namespace EE
         return result;
     }
 
+    void FloatCurve::Evaluate( float const* pParameters, float* pResults, int32_t numParameters ) const
+    {
+        EE_ASSERT( numParameters == 0 || ( pParameters != nullptr && pResults != nullptr ) );
+
+        Point const* pPoints = m_points.data();
+        int32_t const numPoints = GetNumPoints();
+
+        HermiteLane lanes[4];
+        int32_t segmentHint = 0;
+        for ( int32_t i = 0; i < numParameters; i += 4 )
+        {
+            int32_t const numLanes = Math::Min( 4, numParameters - i );
+            for ( int32_t laneIdx = 0; laneIdx < 4; laneIdx++ )
+            {
+                // Pad the last batch with the last parameter
+                float const parameter = pParameters[i + Math::Min( laneIdx, numLanes - 1 )];
+                segmentHint = SetHermiteLane( lanes[laneIdx], pPoints, numPoints, parameter, segmentHint );
+            }
+
+            EvaluateHermiteLanes( lanes, &pResults[i], numLanes );
+        }
+    }
+
+    void FloatCurve::Evaluate( FloatCurve const* const* ppCurves, float const* pParameters, float* pResults, int32_t numCurves )
+    {
+        EE_ASSERT( numCurves == 0 || ( ppCurves != nullptr && pParameters != nullptr && pResults != nullptr ) );
+
+        HermiteLane lanes[4];
+        for ( int32_t i = 0; i < numCurves; i += 4 )
+        {
+            int32_t const numLanes = Math::Min( 4, numCurves - i );
+            for ( int32_t laneIdx = 0; laneIdx < 4; laneIdx++ )
+            {
+                // Pad the last batch with the last curve
+                int32_t const curveIdx = i + Math::Min( laneIdx, numLanes - 1 );
+                EE_ASSERT( ppCurves[curveIdx] != nullptr );
+                FloatCurve const* pCurve = ppCurves[curveIdx];
+                SetHermiteLane( lanes[laneIdx], pCurve->m_points.data(), pCurve->GetNumPoints(), pParameters[curveIdx], 0 );
+            }
+
+            EvaluateHermiteLanes( lanes, &pResults[i], numLanes );
+        }
+    }
+
     void FloatCurve::AddPoint( float parameter, float value, float inTangent, float outTangent )
     {
         m_points.push_back( { parameter, value, inTangent, outTangent } );
@@ -208,4 +354,164 @@ namespace EE
 
         return curveStr;
     }
+
+    //-------------------------------------------------------------------------
+    // Look-up Table
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        // Get the maximum distance between the line through (x0, y0) and (x1, y1) and the curve over [x0, x1]
+        static double CalculateMaxLinearError( FloatCurve const& curve, double x0, double y0, double x1, double y1 )
+        {
+            double const slope = ( y1 - y0 ) / ( x1 - x0 );
+            double maxError = 0.0;
+
+            int32_t const numSegments = curve.GetNumPoints() - 1;
+            for ( int32_t segmentIdx = 0; segmentIdx < numSegments; segmentIdx++ )
+            {
+                FloatCurve::Point const& startPoint = curve.GetPoint( segmentIdx );
+                FloatCurve::Point const& endPoint = curve.GetPoint( segmentIdx + 1 );
+
+                // Skip segments that dont overlap the range, zero length segments are never evaluated
+                double const segmentStart = startPoint.m_parameter;
+                double const segmentLength = double( endPoint.m_parameter ) - segmentStart;
+                if ( segmentLength <= 0.0 || endPoint.m_parameter <= x0 || startPoint.m_parameter >= x1 )
+                {
+                    continue;
+                }
+
+                // The segment as a cubic in T: a3*T^3 + a2*T^2 + a1*T + a0 (see Math::CubicHermite::GetPoint)
+                double const v0 = startPoint.m_value, m0 = startPoint.m_outTangent, v1 = endPoint.m_value, m1 = endPoint.m_inTangent;
+                double const a3 = 2 * v0 + m0 + m1 - 2 * v1;
+                double const a2 = -3 * v0 - 2 * m0 - m1 + 3 * v1;
+                double const a1 = m0;
+                double const a0 = v0;
+
+                // The error is also a cubic in T, so the maximum is either at the ends of the range or at a turning point
+                auto GetError = [&] ( double T )
+                {
+                    double const curveValue = ( ( a3 * T + a2 ) * T + a1 ) * T + a0;
+                    double const lineValue = y0 + slope * ( segmentStart + T * segmentLength - x0 );
+                    return Math::Abs( curveValue - lineValue );
+                };
+
+                double const startT = Math::Max( 0.0, ( x0 - segmentStart ) / segmentLength );
+                double const endT = Math::Min( 1.0, ( x1 - segmentStart ) / segmentLength );
+                maxError = Math::Max( maxError, Math::Max( GetError( startT ), GetError( endT ) ) );
+
+                // Turning points: 3*a3*T^2 + 2*a2*T + ( a1 - slope * length ) = 0
+                double const qa = 3 * a3, qb = 2 * a2, qc = a1 - slope * segmentLength;
+                double roots[2];
+                int32_t numRoots = 0;
+                if ( Math::Abs( qa ) < 1e-12 )
+                {
+                    if ( Math::Abs( qb ) > 1e-12 )
+                    {
+                        roots[numRoots++] = -qc / qb;
+                    }
+                }
+                else
+                {
+                    double const discriminant = qb * qb - 4 * qa * qc;
+                    if ( discriminant >= 0.0 )
+                    {
+                        double const sqrtDiscriminant = sqrt( discriminant );
+                        roots[numRoots++] = ( -qb + sqrtDiscriminant ) / ( 2 * qa );
+                        roots[numRoots++] = ( -qb - sqrtDiscriminant ) / ( 2 * qa );
+                    }
+                }
+
+                for ( int32_t i = 0; i < numRoots; i++ )
+                {
+                    if ( roots[i] > startT && roots[i] < endT )
+                    {
+                        maxError = Math::Max( maxError, GetError( roots[i] ) );
+                    }
+                }
+            }
+
+            return maxError;
+        }
+    }
+
+    float FloatCurveLUT::Bake( FloatCurve const& curve, int32_t numSamples )
+    {
+        EE_ASSERT( numSamples >= 2 );
+
+        m_samples.clear();
+        m_maxError = 0.0f;
+
+        // Curves without a parameter range (less than two points or all points at the same parameter) get a single sample
+        // The error is then the jump from the first to the last value
+        int32_t const numPoints = curve.GetNumPoints();
+        if ( numPoints < 2 || curve.GetPoint( numPoints - 1 ).m_parameter <= curve.GetPoint( 0 ).m_parameter )
+        {
+            float const firstValue = curve.Evaluate( -FLT_MAX );
+            m_samples.emplace_back( firstValue );
+            m_parameterStart = ( numPoints > 0 ) ? curve.GetPoint( 0 ).m_parameter : 0.0f;
+            m_samplesPerUnit = 0.0f;
+            m_maxError = Math::Abs( curve.Evaluate( FLT_MAX ) - firstValue );
+            return m_maxError;
+        }
+
+        //-------------------------------------------------------------------------
+
+        double const parameterStart = curve.GetPoint( 0 ).m_parameter;
+        double const parameterEnd = curve.GetPoint( numPoints - 1 ).m_parameter;
+        double const stepSize = ( parameterEnd - parameterStart ) / ( numSamples - 1 );
+
+        m_parameterStart = (float) parameterStart;
+        m_samplesPerUnit = float( ( numSamples - 1 ) / ( parameterEnd - parameterStart ) );
+
+        m_samples.resize( numSamples );
+        int32_t segmentHint = 0;
+        for ( int32_t i = 0; i < numSamples - 1; i++ )
+        {
+            m_samples[i] = curve.Evaluate( float( parameterStart + i * stepSize ), segmentHint );
+        }
+        m_samples[numSamples - 1] = curve.GetPoint( numPoints - 1 ).m_value;
+
+        //-------------------------------------------------------------------------
+
+        double maxError = 0.0;
+        for ( int32_t i = 0; i < numSamples - 1; i++ )
+        {
+            double const x0 = parameterStart + i * stepSize;
+            double const x1 = ( i == numSamples - 2 ) ? parameterEnd : x0 + stepSize;
+            maxError = Math::Max( maxError, CalculateMaxLinearError( curve, x0, m_samples[i], x1, m_samples[i + 1] ) );
+        }
+
+        m_maxError = (float) maxError;
+        return m_maxError;
+    }
+
+    bool FloatCurveLUT::BakeWithTolerance( FloatCurve const& curve, float maxError, int32_t maxSamples )
+    {
+        EE_ASSERT( maxError >= 0.0f && maxSamples >= 2 );
+
+        int32_t numSamples = 2;
+        while ( Bake( curve, numSamples ) > maxError )
+        {
+            int32_t const nextNumSamples = ( numSamples - 1 ) * 2 + 1;
+            if ( nextNumSamples > maxSamples )
+            {
+                return false;
+            }
+
+            numSamples = nextNumSamples;
+        }
+
+        return true;
+    }
+
+    void FloatCurveLUT::Evaluate( float const* pParameters, float* pResults, int32_t numParameters ) const
+    {
+        EE_ASSERT( numParameters == 0 || ( pParameters != nullptr && pResults != nullptr ) );
+
+        for ( int32_t i = 0; i < numParameters; i++ )
+        {
+            pResults[i] = Evaluate( pParameters[i] );
+        }
+    }
 }
\ No newline at end of file
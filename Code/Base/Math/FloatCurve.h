@@ -10,6 +10,9 @@
 //-------------------------------------------------------------------------
 // A sequence of piece wise cubic hermite splines -
 // This curve is useful for when you want remap one float value to another
+//
+// For hot code, there are batch evaluation functions (evaluating with a SIMD kernel), a segment hint for coherent evaluation
+// (i.e. parameters that change slowly over time) and a baked look-up table version of the curve (see FloatCurveLUT)
 
 namespace EE
 {
@@ -98,6 +101,17 @@ namespace EE
         // If the parameter supplied is outside the parameter range the value returned will be that of the nearest extremity point
         float Evaluate( float parameter ) const;
 
+        // Evaluate the curve starting the segment search from the supplied segment, the hint is updated to the segment used
+        // Keep the hint around between calls when evaluating parameters that change slowly (e.g. time) to avoid the search
+        float Evaluate( float parameter, int32_t& segmentHint ) const;
+
+        // Evaluate the curve for a set of parameters, results are identical to evaluating each parameter individually
+        // The segment search is coherent, so sorted parameters are the cheapest to evaluate
+        void Evaluate( float const* pParameters, float* pResults, int32_t numParameters ) const;
+
+        // Evaluate a set of curves, each curve is evaluated for the parameter with the same index
+        static void Evaluate( FloatCurve const* const* ppCurves, float const* pParameters, float* pResults, int32_t numCurves );
+
         // Curve manipulation
         //-------------------------------------------------------------------------
 
@@ -148,4 +162,62 @@ namespace EE
 
         TInlineVector<Point, 8>     m_points; // Space for 4 curves
     };
+
+    //-------------------------------------------------------------------------
+    // Float Curve Look-up Table
+    //-------------------------------------------------------------------------
+    // A curve baked into uniformly spaced samples over its parameter range, evaluated with a single linear interpolation
+    // Parameters outside the range return the value of the nearest extremity, same as the curve
+    //
+    // Baking calculates the maximum error of the table versus the curve. Between two samples the error is a cubic per curve
+    // segment, so its maximum is found exactly (end points and turning points) rather than estimated by sampling
+
+    class EE_BASE_API FloatCurveLUT
+    {
+    public:
+
+        FloatCurveLUT() = default;
+
+        // Bake the curve with the specified number of samples (at least 2), returns the maximum error
+        float Bake( FloatCurve const& curve, int32_t numSamples );
+
+        // Bake the curve with the smallest number of samples (2^n + 1) that keeps the error within the tolerance
+        // Returns false if the tolerance could not be reached with the maximum number of samples, the table is still baked
+        bool BakeWithTolerance( FloatCurve const& curve, float maxError, int32_t maxSamples = 1025 );
+
+        inline bool IsValid() const { return !m_samples.empty(); }
+        inline int32_t GetNumSamples() const { return (int32_t) m_samples.size(); }
+        inline float GetMaxError() const { return m_maxError; }
+
+        EE_FORCE_INLINE float Evaluate( float parameter ) const
+        {
+            EE_ASSERT( IsValid() );
+
+            int32_t const lastSampleIdx = GetNumSamples() - 1;
+            float const sampleParameter = ( parameter - m_parameterStart ) * m_samplesPerUnit;
+            if ( sampleParameter <= 0.0f )
+            {
+                return m_samples[0];
+            }
+
+            // Also handles NaN parameters the same way as the curve
+            if ( !( sampleParameter < lastSampleIdx ) )
+            {
+                return m_samples[lastSampleIdx];
+            }
+
+            int32_t const sampleIdx = (int32_t) sampleParameter;
+            float const t = sampleParameter - sampleIdx;
+            return m_samples[sampleIdx] + ( ( m_samples[sampleIdx + 1] - m_samples[sampleIdx] ) * t );
+        }
+
+        void Evaluate( float const* pParameters, float* pResults, int32_t numParameters ) const;
+
+    private:
+
+        TVector<float>              m_samples;
+        float                       m_parameterStart = 0.0f;
+        float                       m_samplesPerUnit = 0.0f;
+        float                       m_maxError = 0.0f;
+    };
 }
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+#include "Base/Esoterica.h"
+
+namespace EE::Math
+{
+    EE_FORCE_INLINE uint32_t GetMostSignificantBit( uint64_t value )
+    {
+        // The builtin is undefined for an input of 0, so we need to handle it explicitly
+        if ( value == 0 )
+        {
+            return 0;
+        }
+
+        return 63u - (uint32_t) __builtin_clzll( value );
+    }
+}
\ No newline at end of file
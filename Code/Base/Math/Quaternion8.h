@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Base/Math/Vector8.h"
+#include "Base/Math/Quaternion.h"
+
+//-------------------------------------------------------------------------
+// 8 quaternions in SoA form, see Vector8.h for the AVX2 requirements
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class alignas( 32 ) Quaternion8
+    {
+    public:
+
+        EE_FORCE_INLINE static Quaternion8 Splat( Quaternion const& q )
+        {
+            __m128 const& data = q;
+            __m256 const v8 = _mm256_broadcast_ps( &data );
+            return Quaternion8( _mm256_permute_ps( v8, 0x00 ), _mm256_permute_ps( v8, 0x55 ), _mm256_permute_ps( v8, 0xAA ), _mm256_permute_ps( v8, 0xFF ) );
+        }
+
+        EE_FORCE_INLINE static __m256 Dot( Quaternion8 const& a, Quaternion8 const& b )
+        {
+            return _mm256_fmadd_ps( a.m_w, b.m_w, _mm256_fmadd_ps( a.m_z, b.m_z, _mm256_fmadd_ps( a.m_y, b.m_y, _mm256_mul_ps( a.m_x, b.m_x ) ) ) );
+        }
+
+        // Matches Quaternion::FastSLerp
+        EE_FORCE_INLINE static Quaternion8 FastSLerp( Quaternion8 const& q0, Quaternion8 const& q1, __m256 t )
+        {
+            __m256 const dot = Dot( q0, q1 );
+            __m256 const d = SIMD::Abs8( dot );
+            __m256 const A = _mm256_fmadd_ps( d, _mm256_fmadd_ps( d, _mm256_fnmadd_ps( d, _mm256_set1_ps( 1.43519f ), _mm256_set1_ps( 3.55645f ) ), _mm256_set1_ps( -3.2452f ) ), _mm256_set1_ps( 1.0904f ) );
+            __m256 const B = _mm256_fmadd_ps( d, _mm256_fmadd_ps( d, _mm256_set1_ps( 0.215638f ), _mm256_set1_ps( -1.06021f ) ), _mm256_set1_ps( 0.848013f ) );
+            __m256 const tMinusHalf = _mm256_sub_ps( t, _mm256_set1_ps( 0.5f ) );
+            __m256 const k = _mm256_fmadd_ps( A, _mm256_mul_ps( tMinusHalf, tMinusHalf ), B );
+            __m256 const ot = _mm256_fmadd_ps( _mm256_mul_ps( _mm256_mul_ps( t, tMinusHalf ), _mm256_sub_ps( t, _mm256_set1_ps( 1.0f ) ) ), k, t );
+
+            // Take the shortest path, i.e. negate the weight of the target if the quaternions are in opposite hemispheres
+            __m256 const qt0 = _mm256_sub_ps( _mm256_set1_ps( 1.0f ), ot );
+            __m256 const isPositiveDot = _mm256_cmp_ps( dot, _mm256_setzero_ps(), _CMP_GT_OQ );
+            __m256 const qt1 = _mm256_blendv_ps( _mm256_xor_ps( ot, _mm256_set1_ps( -0.0f ) ), ot, isPositiveDot );
+
+            Quaternion8 result( _mm256_fmadd_ps( q1.m_x, qt1, _mm256_mul_ps( q0.m_x, qt0 ) ),
+                                _mm256_fmadd_ps( q1.m_y, qt1, _mm256_mul_ps( q0.m_y, qt0 ) ),
+                                _mm256_fmadd_ps( q1.m_z, qt1, _mm256_mul_ps( q0.m_z, qt0 ) ),
+                                _mm256_fmadd_ps( q1.m_w, qt1, _mm256_mul_ps( q0.m_w, qt0 ) ) );
+            result.Normalize();
+            return result;
+        }
+
+    public:
+
+        Quaternion8() = default;
+
+        EE_FORCE_INLINE Quaternion8( __m256 x, __m256 y, __m256 z, __m256 w )
+            : m_x( x ), m_y( y ), m_z( z ), m_w( w )
+        {}
+
+        // Load 8 consecutive quaternions
+        EE_FORCE_INLINE explicit Quaternion8( Quaternion const* pQuaternions ) { SIMD::LoadTransposed8x4( (float const*) pQuaternions, 4, m_x, m_y, m_z, m_w ); }
+
+        // Store to 8 consecutive quaternions
+        EE_FORCE_INLINE void Store( Quaternion* pQuaternions ) const { SIMD::StoreTransposed8x4( (float*) pQuaternions, 4, m_x, m_y, m_z, m_w ); }
+
+        EE_FORCE_INLINE Quaternion8& Normalize()
+        {
+            __m256 const inverseLength = _mm256_div_ps( _mm256_set1_ps( 1.0f ), _mm256_sqrt_ps( Dot( *this, *this ) ) );
+            m_x = _mm256_mul_ps( m_x, inverseLength );
+            m_y = _mm256_mul_ps( m_y, inverseLength );
+            m_z = _mm256_mul_ps( m_z, inverseLength );
+            m_w = _mm256_mul_ps( m_w, inverseLength );
+            return *this;
+        }
+
+        // Matches Quaternion::operator*: apply this rotation then the rhs rotation, i.e. the quaternion product rhs.this
+        EE_FORCE_INLINE Quaternion8 operator*( Quaternion8 const& rhs ) const
+        {
+            __m256 const w = _mm256_fnmadd_ps( rhs.m_z, m_z, _mm256_fnmadd_ps( rhs.m_y, m_y, _mm256_fnmadd_ps( rhs.m_x, m_x, _mm256_mul_ps( rhs.m_w, m_w ) ) ) );
+            __m256 const x = _mm256_fnmadd_ps( rhs.m_z, m_y, _mm256_fmadd_ps( rhs.m_y, m_z, _mm256_fmadd_ps( rhs.m_x, m_w, _mm256_mul_ps( rhs.m_w, m_x ) ) ) );
+            __m256 const y = _mm256_fmadd_ps( rhs.m_z, m_x, _mm256_fmadd_ps( rhs.m_y, m_w, _mm256_fnmadd_ps( rhs.m_x, m_z, _mm256_mul_ps( rhs.m_w, m_y ) ) ) );
+            __m256 const z = _mm256_fmadd_ps( rhs.m_z, m_w, _mm256_fnmadd_ps( rhs.m_y, m_x, _mm256_fmadd_ps( rhs.m_x, m_y, _mm256_mul_ps( rhs.m_w, m_z ) ) ) );
+            return Quaternion8( x, y, z, w );
+        }
+
+        // Rotate a vector (ignores w), i.e. v + 2w(q x v) + 2q x (q x v)
+        EE_FORCE_INLINE Vector8 RotateVector( Vector8 const& v ) const
+        {
+            __m256 const two = _mm256_set1_ps( 2.0f );
+            __m256 const tx = _mm256_mul_ps( _mm256_fmsub_ps( m_y, v.m_z, _mm256_mul_ps( m_z, v.m_y ) ), two );
+            __m256 const ty = _mm256_mul_ps( _mm256_fmsub_ps( m_z, v.m_x, _mm256_mul_ps( m_x, v.m_z ) ), two );
+            __m256 const tz = _mm256_mul_ps( _mm256_fmsub_ps( m_x, v.m_y, _mm256_mul_ps( m_y, v.m_x ) ), two );
+
+            __m256 const rx = _mm256_add_ps( _mm256_fmadd_ps( m_w, tx, v.m_x ), _mm256_fmsub_ps( m_y, tz, _mm256_mul_ps( m_z, ty ) ) );
+            __m256 const ry = _mm256_add_ps( _mm256_fmadd_ps( m_w, ty, v.m_y ), _mm256_fmsub_ps( m_z, tx, _mm256_mul_ps( m_x, tz ) ) );
+            __m256 const rz = _mm256_add_ps( _mm256_fmadd_ps( m_w, tz, v.m_z ), _mm256_fmsub_ps( m_x, ty, _mm256_mul_ps( m_y, tx ) ) );
+            return Vector8( rx, ry, rz, v.m_w );
+        }
+
+        // Get the rows of the rotation matrices for these quaternions (matches Matrix::SetRotation), the w components are zero
+        EE_FORCE_INLINE void GetRotationMatrixRows( Vector8& row0, Vector8& row1, Vector8& row2 ) const
+        {
+            __m256 const one = _mm256_set1_ps( 1.0f );
+            __m256 const x2 = _mm256_add_ps( m_x, m_x ), y2 = _mm256_add_ps( m_y, m_y ), z2 = _mm256_add_ps( m_z, m_z );
+            __m256 const xx = _mm256_mul_ps( m_x, x2 ), yy = _mm256_mul_ps( m_y, y2 ), zz = _mm256_mul_ps( m_z, z2 );
+            __m256 const xy = _mm256_mul_ps( m_x, y2 ), xz = _mm256_mul_ps( m_x, z2 ), yz = _mm256_mul_ps( m_y, z2 );
+            __m256 const wx = _mm256_mul_ps( m_w, x2 ), wy = _mm256_mul_ps( m_w, y2 ), wz = _mm256_mul_ps( m_w, z2 );
+
+            row0 = Vector8( _mm256_sub_ps( one, _mm256_add_ps( yy, zz ) ), _mm256_add_ps( xy, wz ), _mm256_sub_ps( xz, wy ), _mm256_setzero_ps() );
+            row1 = Vector8( _mm256_sub_ps( xy, wz ), _mm256_sub_ps( one, _mm256_add_ps( xx, zz ) ), _mm256_add_ps( yz, wx ), _mm256_setzero_ps() );
+            row2 = Vector8( _mm256_add_ps( xz, wy ), _mm256_sub_ps( yz, wx ), _mm256_sub_ps( one, _mm256_add_ps( xx, yy ) ), _mm256_setzero_ps() );
+        }
+
+    public:
+
+        __m256 m_x, m_y, m_z, m_w;
+    };
+}
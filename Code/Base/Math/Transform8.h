@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Base/Math/Quaternion8.h"
+#include "Base/Math/Transform.h"
+
+//-------------------------------------------------------------------------
+// 8 transforms in SoA form, see Vector8.h for the AVX2 requirements
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class alignas( 32 ) Transform8
+    {
+    public:
+
+        EE_FORCE_INLINE static Transform8 Splat( Transform const& transform )
+        {
+            return Transform8( Quaternion8::Splat( transform.GetRotation() ), Vector8::Splat( transform.GetTranslationAndScale() ) );
+        }
+
+        // Matches Transform::FastSLerp
+        EE_FORCE_INLINE static Transform8 FastSLerp( Transform8 const& from, Transform8 const& to, __m256 t )
+        {
+            return Transform8( Quaternion8::FastSLerp( from.m_rotation, to.m_rotation, t ), Vector8::Lerp( from.m_translationScale, to.m_translationScale, t ) );
+        }
+
+        // Calculates 'a * b', matches Transform::operator* for non-negative scales (see GetNegativeScaleMask)
+        EE_FORCE_INLINE static Transform8 Multiply( Transform8 const& a, Transform8 const& b )
+        {
+            Transform8 result;
+            result.m_rotation = a.m_rotation * b.m_rotation;
+            result.m_rotation.Normalize();
+
+            Vector8 const scaledTranslation = a.m_translationScale * b.m_translationScale.m_w;
+            Vector8 const rotatedTranslation = b.m_rotation.RotateVector( scaledTranslation );
+            result.m_translationScale = Vector8( _mm256_add_ps( rotatedTranslation.m_x, b.m_translationScale.m_x ),
+                                                 _mm256_add_ps( rotatedTranslation.m_y, b.m_translationScale.m_y ),
+                                                 _mm256_add_ps( rotatedTranslation.m_z, b.m_translationScale.m_z ),
+                                                 _mm256_mul_ps( a.m_translationScale.m_w, b.m_translationScale.m_w ) );
+            return result;
+        }
+
+    public:
+
+        Transform8() = default;
+
+        EE_FORCE_INLINE Transform8( Quaternion8 const& rotation, Vector8 const& translationScale )
+            : m_rotation( rotation )
+            , m_translationScale( translationScale )
+        {}
+
+        // Load 8 consecutive transforms
+        EE_FORCE_INLINE explicit Transform8( Transform const* pTransforms )
+        {
+            static_assert( sizeof( Transform ) == 8 * sizeof( float ), "Transform layout changed, the loads below assume [rotation, translationScale]" );
+            float const* pData = (float const*) pTransforms;
+            SIMD::LoadTransposed8x4( pData, 8, m_rotation.m_x, m_rotation.m_y, m_rotation.m_z, m_rotation.m_w );
+            SIMD::LoadTransposed8x4( pData + 4, 8, m_translationScale.m_x, m_translationScale.m_y, m_translationScale.m_z, m_translationScale.m_w );
+        }
+
+        // Store to 8 consecutive transforms
+        EE_FORCE_INLINE void Store( Transform* pTransforms ) const
+        {
+            float* pData = (float*) pTransforms;
+            SIMD::StoreTransposed8x4( pData, 8, m_rotation.m_x, m_rotation.m_y, m_rotation.m_z, m_rotation.m_w );
+            SIMD::StoreTransposed8x4( pData + 4, 8, m_translationScale.m_x, m_translationScale.m_y, m_translationScale.m_z, m_translationScale.m_w );
+        }
+
+        // Store the 8 transforms as matrices, matches Transform::ToMatrix
+        EE_FORCE_INLINE void StoreAsMatrices( Matrix* pMatrices ) const
+        {
+            static_assert( sizeof( Matrix ) == 16 * sizeof( float ), "Matrix layout changed, the stores below assume 4 rows of 4 floats" );
+
+            Vector8 row0, row1, row2;
+            m_rotation.GetRotationMatrixRows( row0, row1, row2 );
+
+            __m256 const scale = m_translationScale.m_w;
+            float* pData = (float*) pMatrices;
+            SIMD::StoreTransposed8x4( pData, 16, _mm256_mul_ps( row0.m_x, scale ), _mm256_mul_ps( row0.m_y, scale ), _mm256_mul_ps( row0.m_z, scale ), row0.m_w );
+            SIMD::StoreTransposed8x4( pData + 4, 16, _mm256_mul_ps( row1.m_x, scale ), _mm256_mul_ps( row1.m_y, scale ), _mm256_mul_ps( row1.m_z, scale ), row1.m_w );
+            SIMD::StoreTransposed8x4( pData + 8, 16, _mm256_mul_ps( row2.m_x, scale ), _mm256_mul_ps( row2.m_y, scale ), _mm256_mul_ps( row2.m_z, scale ), row2.m_w );
+            SIMD::StoreTransposed8x4( pData + 12, 16, m_translationScale.m_x, m_translationScale.m_y, m_translationScale.m_z, _mm256_set1_ps( 1.0f ) );
+        }
+
+        // Get a bitmask (one bit per transform) of the transforms with a negative scale
+        EE_FORCE_INLINE uint32_t GetNegativeScaleMask() const
+        {
+            return (uint32_t) _mm256_movemask_ps( _mm256_cmp_ps( m_translationScale.m_w, _mm256_setzero_ps(), _CMP_LT_OQ ) );
+        }
+
+    public:
+
+        Quaternion8     m_rotation;
+        Vector8         m_translationScale;
+    };
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Base/Math/Vector.h"
+#include <immintrin.h>
+
+//-------------------------------------------------------------------------
+// 8-wide SoA Math Types
+//-------------------------------------------------------------------------
+// These types store 8 values with one AVX register per component and are meant for batch kernels that process eight
+// elements at a time (see BatchMath.h). They use AVX2/FMA instructions, so only include them in translation units that are
+// compiled with AVX2 enabled and only call that code once the CPU support has been checked.
+
+#if defined( _MSC_VER ) && !defined( __AVX2__ )
+#error "The 8-wide math types require AVX2, only include this file in translation units compiled with /arch:AVX2"
+#endif
+
+//-------------------------------------------------------------------------
+
+namespace EE::SIMD
+{
+    // Transpose four registers that each contain two 4-component vectors (one per 128 bit lane)
+    // i.e. [v0|v4], [v1|v5], [v2|v6], [v3|v7] -> [x0..x7], [y0..y7], [z0..z7], [w0..w7] and vice-versa
+    EE_FORCE_INLINE void Transpose8x4( __m256& r0, __m256& r1, __m256& r2, __m256& r3 )
+    {
+        __m256 const t0 = _mm256_unpacklo_ps( r0, r1 );
+        __m256 const t1 = _mm256_unpackhi_ps( r0, r1 );
+        __m256 const t2 = _mm256_unpacklo_ps( r2, r3 );
+        __m256 const t3 = _mm256_unpackhi_ps( r2, r3 );
+        r0 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        r1 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+        r2 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        r3 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+    }
+
+    // Load 8 4-component vectors with the given stride (in floats) and transpose them into SoA form
+    EE_FORCE_INLINE void LoadTransposed8x4( float const* pData, size_t stride, __m256& x, __m256& y, __m256& z, __m256& w )
+    {
+        x = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( pData + 0 * stride ) ), _mm_loadu_ps( pData + 4 * stride ), 1 );
+        y = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( pData + 1 * stride ) ), _mm_loadu_ps( pData + 5 * stride ), 1 );
+        z = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( pData + 2 * stride ) ), _mm_loadu_ps( pData + 6 * stride ), 1 );
+        w = _mm256_insertf128_ps( _mm256_castps128_ps256( _mm_loadu_ps( pData + 3 * stride ) ), _mm_loadu_ps( pData + 7 * stride ), 1 );
+        Transpose8x4( x, y, z, w );
+    }
+
+    // Transpose SoA components back into 8 4-component vectors and store them with the given stride (in floats)
+    EE_FORCE_INLINE void StoreTransposed8x4( float* pData, size_t stride, __m256 x, __m256 y, __m256 z, __m256 w )
+    {
+        Transpose8x4( x, y, z, w );
+        _mm_storeu_ps( pData + 0 * stride, _mm256_castps256_ps128( x ) );
+        _mm_storeu_ps( pData + 1 * stride, _mm256_castps256_ps128( y ) );
+        _mm_storeu_ps( pData + 2 * stride, _mm256_castps256_ps128( z ) );
+        _mm_storeu_ps( pData + 3 * stride, _mm256_castps256_ps128( w ) );
+        _mm_storeu_ps( pData + 4 * stride, _mm256_extractf128_ps( x, 1 ) );
+        _mm_storeu_ps( pData + 5 * stride, _mm256_extractf128_ps( y, 1 ) );
+        _mm_storeu_ps( pData + 6 * stride, _mm256_extractf128_ps( z, 1 ) );
+        _mm_storeu_ps( pData + 7 * stride, _mm256_extractf128_ps( w, 1 ) );
+    }
+
+    EE_FORCE_INLINE __m256 Abs8( __m256 v ) { return _mm256_andnot_ps( _mm256_set1_ps( -0.0f ), v ); }
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    // 8 4-component vectors in SoA form
+    class alignas( 32 ) Vector8
+    {
+    public:
+
+        EE_FORCE_INLINE static Vector8 Splat( Vector const& v )
+        {
+            __m128 const& data = v;
+            __m256 const v8 = _mm256_broadcast_ps( &data );
+            return Vector8( _mm256_permute_ps( v8, 0x00 ), _mm256_permute_ps( v8, 0x55 ), _mm256_permute_ps( v8, 0xAA ), _mm256_permute_ps( v8, 0xFF ) );
+        }
+
+        EE_FORCE_INLINE static __m256 Dot3( Vector8 const& a, Vector8 const& b )
+        {
+            return _mm256_fmadd_ps( a.m_z, b.m_z, _mm256_fmadd_ps( a.m_y, b.m_y, _mm256_mul_ps( a.m_x, b.m_x ) ) );
+        }
+
+        EE_FORCE_INLINE static __m256 Dot4( Vector8 const& a, Vector8 const& b )
+        {
+            return _mm256_fmadd_ps( a.m_w, b.m_w, Dot3( a, b ) );
+        }
+
+        // Matches Vector::Lerp: from + ( to - from ) * t
+        EE_FORCE_INLINE static Vector8 Lerp( Vector8 const& from, Vector8 const& to, __m256 t )
+        {
+            return Vector8( _mm256_fmadd_ps( _mm256_sub_ps( to.m_x, from.m_x ), t, from.m_x ),
+                            _mm256_fmadd_ps( _mm256_sub_ps( to.m_y, from.m_y ), t, from.m_y ),
+                            _mm256_fmadd_ps( _mm256_sub_ps( to.m_z, from.m_z ), t, from.m_z ),
+                            _mm256_fmadd_ps( _mm256_sub_ps( to.m_w, from.m_w ), t, from.m_w ) );
+        }
+
+    public:
+
+        Vector8() = default;
+
+        EE_FORCE_INLINE Vector8( __m256 x, __m256 y, __m256 z, __m256 w )
+            : m_x( x ), m_y( y ), m_z( z ), m_w( w )
+        {}
+
+        // Load 8 consecutive vectors
+        EE_FORCE_INLINE explicit Vector8( Vector const* pVectors ) { SIMD::LoadTransposed8x4( (float const*) pVectors, 4, m_x, m_y, m_z, m_w ); }
+
+        // Store to 8 consecutive vectors
+        EE_FORCE_INLINE void Store( Vector* pVectors ) const { SIMD::StoreTransposed8x4( (float*) pVectors, 4, m_x, m_y, m_z, m_w ); }
+
+        EE_FORCE_INLINE Vector8 operator+( Vector8 const& rhs ) const { return Vector8( _mm256_add_ps( m_x, rhs.m_x ), _mm256_add_ps( m_y, rhs.m_y ), _mm256_add_ps( m_z, rhs.m_z ), _mm256_add_ps( m_w, rhs.m_w ) ); }
+        EE_FORCE_INLINE Vector8 operator-( Vector8 const& rhs ) const { return Vector8( _mm256_sub_ps( m_x, rhs.m_x ), _mm256_sub_ps( m_y, rhs.m_y ), _mm256_sub_ps( m_z, rhs.m_z ), _mm256_sub_ps( m_w, rhs.m_w ) ); }
+        EE_FORCE_INLINE Vector8 operator*( Vector8 const& rhs ) const { return Vector8( _mm256_mul_ps( m_x, rhs.m_x ), _mm256_mul_ps( m_y, rhs.m_y ), _mm256_mul_ps( m_z, rhs.m_z ), _mm256_mul_ps( m_w, rhs.m_w ) ); }
+        EE_FORCE_INLINE Vector8 operator*( __m256 s ) const { return Vector8( _mm256_mul_ps( m_x, s ), _mm256_mul_ps( m_y, s ), _mm256_mul_ps( m_z, s ), _mm256_mul_ps( m_w, s ) ); }
+
+        EE_FORCE_INLINE Vector8 GetAbs() const { return Vector8( SIMD::Abs8( m_x ), SIMD::Abs8( m_y ), SIMD::Abs8( m_z ), SIMD::Abs8( m_w ) ); }
+
+    public:
+
+        __m256 m_x, m_y, m_z, m_w;
+    };
+}
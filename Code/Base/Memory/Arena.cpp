@@ -0,0 +1,329 @@
+#include "Arena.h"
+#include "MemoryTags.h"
+#include "Base/Math/Math.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Memory
+{
+    LinearArena::LinearArena( size_t blockSize )
+        : m_blockSize( blockSize )
+    {
+        EE_ASSERT( blockSize > 0 );
+    }
+
+    LinearArena::~LinearArena()
+    {
+        ReleaseMemory();
+    }
+
+    void* LinearArena::Allocate( size_t size, size_t alignment )
+    {
+        EE_ASSERT( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0 );
+
+        if ( size == 0 )
+        {
+            return nullptr;
+        }
+
+        if ( m_pCurrentBlock != nullptr )
+        {
+            uint8_t* pAddress = GetBlockData( m_pCurrentBlock ) + m_pCurrentBlock->m_used;
+            size_t const padding = CalculatePaddingForAlignment( pAddress, alignment );
+            if ( ( m_pCurrentBlock->m_used + padding + size ) <= m_pCurrentBlock->m_size )
+            {
+                m_pCurrentBlock->m_used += padding + size;
+                m_numAllocations++;
+                m_peakUsedMemory = Math::Max( m_peakUsedMemory, GetUsedMemory() );
+                return pAddress + padding;
+            }
+        }
+
+        return AllocateFromNewBlock( size, alignment );
+    }
+
+    void* LinearArena::AllocateFromNewBlock( size_t size, size_t alignment )
+    {
+        size_t const requiredSize = size + alignment;
+
+        // Reuse a block released by a rewind if possible, otherwise allocate a new one
+        //-------------------------------------------------------------------------
+
+        Block* pBlock = nullptr;
+        if ( m_pFreeBlocks != nullptr && m_pFreeBlocks->m_size >= requiredSize )
+        {
+            pBlock = m_pFreeBlocks;
+            m_pFreeBlocks = pBlock->m_pPrevious;
+        }
+        else
+        {
+            size_t const blockSize = Math::Max( m_blockSize, requiredSize );
+            pBlock = new( EE::Alloc( sizeof( Block ) + blockSize, 16 ) ) Block();
+            pBlock->m_size = blockSize;
+            m_reservedMemory += blockSize;
+            m_numBlocks++;
+        }
+
+        if ( m_pCurrentBlock != nullptr )
+        {
+            m_usedInPreviousBlocks += m_pCurrentBlock->m_used;
+        }
+
+        pBlock->m_pPrevious = m_pCurrentBlock;
+        m_pCurrentBlock = pBlock;
+
+        // Allocate from the new block
+        //-------------------------------------------------------------------------
+
+        uint8_t* pData = GetBlockData( pBlock );
+        size_t const padding = CalculatePaddingForAlignment( pData, alignment );
+        pBlock->m_used = padding + size;
+        EE_ASSERT( pBlock->m_used <= pBlock->m_size );
+
+        m_numAllocations++;
+        m_peakUsedMemory = Math::Max( m_peakUsedMemory, GetUsedMemory() );
+        return pData + padding;
+    }
+
+    void LinearArena::Reset()
+    {
+        if ( m_numBlocks > 1 )
+        {
+            // Free all the blocks, the next allocation will create a single block large enough for the peak usage
+            m_blockSize = Math::Max( m_blockSize, m_peakUsedMemory );
+            FreeBlocks( m_pCurrentBlock );
+            FreeBlocks( m_pFreeBlocks );
+        }
+        else if ( m_pCurrentBlock != nullptr )
+        {
+            m_pCurrentBlock->m_used = 0;
+        }
+        else if ( m_pFreeBlocks != nullptr )
+        {
+            m_pCurrentBlock = m_pFreeBlocks;
+            m_pCurrentBlock->m_pPrevious = nullptr;
+            m_pCurrentBlock->m_used = 0;
+            m_pFreeBlocks = nullptr;
+        }
+
+        m_usedInPreviousBlocks = 0;
+        m_numAllocations = 0;
+    }
+
+    void LinearArena::ReleaseMemory()
+    {
+        FreeBlocks( m_pCurrentBlock );
+        FreeBlocks( m_pFreeBlocks );
+        EE_ASSERT( m_numBlocks == 0 && m_reservedMemory == 0 );
+
+        m_usedInPreviousBlocks = 0;
+        m_numAllocations = 0;
+    }
+
+    void LinearArena::RewindToMarker( Marker const& marker )
+    {
+        // Move all blocks started after the marker to the free list
+        while ( m_pCurrentBlock != marker.m_pBlock )
+        {
+            EE_ASSERT( m_pCurrentBlock != nullptr ); // The marker is not from this arena or the arena was reset since the marker was created
+            Block* pBlock = m_pCurrentBlock;
+            m_pCurrentBlock = pBlock->m_pPrevious;
+            pBlock->m_pPrevious = m_pFreeBlocks;
+            m_pFreeBlocks = pBlock;
+        }
+
+        if ( m_pCurrentBlock != nullptr )
+        {
+            EE_ASSERT( m_pCurrentBlock->m_used >= marker.m_used );
+            m_pCurrentBlock->m_used = marker.m_used;
+        }
+
+        m_usedInPreviousBlocks = marker.m_usedInPreviousBlocks;
+    }
+
+    void LinearArena::FreeBlocks( Block*& pBlockList )
+    {
+        while ( pBlockList != nullptr )
+        {
+            Block* pBlock = pBlockList;
+            pBlockList = pBlock->m_pPrevious;
+
+            EE_ASSERT( m_numBlocks > 0 && m_reservedMemory >= pBlock->m_size );
+            m_reservedMemory -= pBlock->m_size;
+            m_numBlocks--;
+
+            pBlock->~Block();
+            EE::Free( (void*&) pBlock );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Per-thread arenas
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct ThreadArenas
+        {
+            LinearArena                             m_frameArena;
+            LinearArena                             m_scratchArena;
+            std::atomic<uint64_t>                   m_frameIdx = 0;             // The frame the frame arena was last reset for
+            int32_t                                 m_scratchDepth = 0;
+
+            // Frame arena stats, published by the owning thread so that they can be gathered when advancing the frame
+            std::atomic<uint32_t>                   m_numFrameAllocations = 0;
+            std::atomic<size_t>                     m_frameMemoryUsed = 0;
+            std::atomic<size_t>                     m_frameMemoryReserved = 0;
+        };
+
+        constexpr static int32_t const s_maxThreads = 128;
+
+        static ThreadArenas*                        g_threadArenas[s_maxThreads] = {};
+        static std::atomic<int32_t>                 g_numThreadArenas = 0;
+        static std::atomic<uint64_t>                g_frameIdx = 1;
+        static FrameStats                           g_lastFrameStats;
+        static AllocationStats                      g_frameStartAllocationStats;
+        static thread_local ThreadArenas*           t_pThreadArenas = nullptr;
+
+        static ThreadArenas& GetThreadArenas()
+        {
+            if ( t_pThreadArenas == nullptr )
+            {
+                t_pThreadArenas = EE::New<ThreadArenas>();
+
+                int32_t const slotIdx = g_numThreadArenas.fetch_add( 1 );
+                EE_ASSERT( slotIdx < s_maxThreads );
+                if ( slotIdx < s_maxThreads )
+                {
+                    g_threadArenas[slotIdx] = t_pThreadArenas;
+                }
+            }
+
+            return *t_pThreadArenas;
+        }
+    }
+
+    void ReleaseThreadArenas()
+    {
+        int32_t const numThreadArenas = Math::Min( g_numThreadArenas.load(), s_maxThreads );
+        for ( int32_t i = 0; i < numThreadArenas; i++ )
+        {
+            EE::Delete( g_threadArenas[i] );
+        }
+
+        g_numThreadArenas = 0;
+        t_pThreadArenas = nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void* FrameAlloc( size_t size, size_t alignment )
+    {
+        ThreadArenas& threadArenas = GetThreadArenas();
+
+        uint64_t const frameIdx = g_frameIdx.load( std::memory_order_relaxed );
+        if ( threadArenas.m_frameIdx.load( std::memory_order_relaxed ) != frameIdx )
+        {
+            threadArenas.m_frameArena.Reset();
+            threadArenas.m_frameIdx.store( frameIdx, std::memory_order_relaxed );
+        }
+
+        void* pMemory = threadArenas.m_frameArena.Allocate( size, alignment );
+
+        threadArenas.m_numFrameAllocations.store( threadArenas.m_frameArena.GetNumAllocations(), std::memory_order_relaxed );
+        threadArenas.m_frameMemoryUsed.store( threadArenas.m_frameArena.GetUsedMemory(), std::memory_order_relaxed );
+        threadArenas.m_frameMemoryReserved.store( threadArenas.m_frameArena.GetReservedMemory(), std::memory_order_relaxed );
+
+        return pMemory;
+    }
+
+    void AdvanceFrame()
+    {
+        uint64_t const frameIdx = g_frameIdx.load();
+
+        // Gather the stats for the frame that just ended
+        //-------------------------------------------------------------------------
+
+        FrameStats stats;
+
+        int32_t const numThreadArenas = Math::Min( g_numThreadArenas.load(), s_maxThreads );
+        for ( int32_t i = 0; i < numThreadArenas; i++ )
+        {
+            ThreadArenas const* pThreadArenas = g_threadArenas[i];
+            if ( pThreadArenas == nullptr )
+            {
+                continue;
+            }
+
+            // Ignore arenas that weren't used this frame, their counts are from an earlier frame
+            if ( pThreadArenas->m_frameIdx.load( std::memory_order_relaxed ) == frameIdx )
+            {
+                stats.m_numFrameAllocations += pThreadArenas->m_numFrameAllocations.load( std::memory_order_relaxed );
+                stats.m_frameMemoryUsed += pThreadArenas->m_frameMemoryUsed.load( std::memory_order_relaxed );
+            }
+
+            stats.m_frameMemoryReserved += pThreadArenas->m_frameMemoryReserved.load( std::memory_order_relaxed );
+        }
+
+        AllocationStats const allocationStats = GetAllocationStats();
+        stats.m_globalAllocations = allocationStats - g_frameStartAllocationStats;
+        g_frameStartAllocationStats = allocationStats;
+        g_lastFrameStats = stats;
+
+        #if EE_MEMORY_TAGGING
+        UpdateTagStats();
+        #endif
+
+        // Invalidate all frame allocations
+        //-------------------------------------------------------------------------
+
+        g_frameIdx.store( frameIdx + 1 );
+    }
+
+    uint64_t GetFrameIndex()
+    {
+        return g_frameIdx.load( std::memory_order_relaxed );
+    }
+
+    FrameStats const& GetLastFrameStats()
+    {
+        return g_lastFrameStats;
+    }
+
+    //-------------------------------------------------------------------------
+    // Scoped Scratch
+    //-------------------------------------------------------------------------
+
+    ScopedScratch::ScopedScratch()
+    {
+        ThreadArenas& threadArenas = GetThreadArenas();
+        m_pArena = &threadArenas.m_scratchArena;
+        m_marker = m_pArena->GetMarker();
+        m_depth = ++threadArenas.m_scratchDepth;
+    }
+
+    ScopedScratch::~ScopedScratch()
+    {
+        EE_ASSERT( IsInnermostScope() );
+
+        ThreadArenas& threadArenas = GetThreadArenas();
+        threadArenas.m_scratchDepth--;
+
+        // Fully reset the arena once the outermost scope ends so that we coalesce any extra blocks
+        if ( threadArenas.m_scratchDepth == 0 )
+        {
+            m_pArena->Reset();
+        }
+        else
+        {
+            m_pArena->RewindToMarker( m_marker );
+        }
+    }
+
+    bool ScopedScratch::IsInnermostScope() const
+    {
+        ThreadArenas const& threadArenas = GetThreadArenas();
+        return &threadArenas.m_scratchArena == m_pArena && threadArenas.m_scratchDepth == m_depth;
+    }
+}
@@ -0,0 +1,249 @@
+#pragma once
+
+#include "Memory.h"
+#include "EASTL/vector.h"
+#include "EASTL/fixed_vector.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Memory
+{
+    //-------------------------------------------------------------------------
+    // Linear Arena
+    //-------------------------------------------------------------------------
+    // A bump allocator: individual allocations are never freed, the whole arena is reset at once (or rewound to a marker)
+    // Memory is requested from the global allocator in blocks. If an arena needed more than one block, the blocks are
+    // coalesced into a single block on the next reset so that the arena settles at its peak usage and stops allocating
+    // Destructors are never called for objects allocated from an arena
+    // Not threadsafe
+
+    class EE_BASE_API LinearArena
+    {
+        struct Block
+        {
+            Block*                          m_pPrevious = nullptr;
+            size_t                          m_size = 0;
+            size_t                          m_used = 0;
+        };
+
+    public:
+
+        constexpr static size_t const s_defaultBlockSize = 64 * 1024;
+
+        struct Marker
+        {
+            Block*                          m_pBlock = nullptr;
+            size_t                          m_used = 0;
+            size_t                          m_usedInPreviousBlocks = 0;
+        };
+
+    public:
+
+        LinearArena( size_t blockSize = s_defaultBlockSize );
+        LinearArena( LinearArena const& ) = delete;
+        ~LinearArena();
+
+        LinearArena& operator=( LinearArena const& ) = delete;
+
+        [[nodiscard]] void* Allocate( size_t size, size_t alignment = EE_DEFAULT_ALIGNMENT );
+
+        // Allocates uninitialized memory for an array
+        template<typename T>
+        [[nodiscard]] inline T* AllocateArray( size_t numElements )
+        {
+            return reinterpret_cast<T*>( Allocate( sizeof( T ) * numElements, alignof( T ) ) );
+        }
+
+        // Only use this for types that dont need to be destroyed
+        template< typename T, typename ... ConstructorParams >
+        [[nodiscard]] inline T* New( ConstructorParams&&... params )
+        {
+            void* pMemory = Allocate( sizeof( T ), alignof( T ) );
+            return new( pMemory ) T( std::forward<ConstructorParams>( params )... );
+        }
+
+        // Release all allocations, this will coalesce all the blocks into a single one if we needed more than one
+        void Reset();
+
+        // Release all allocations and free all blocks
+        void ReleaseMemory();
+
+        // Get a marker for the current allocation position, rewinding to it releases all the allocations made since then
+        inline Marker GetMarker() const { return Marker{ m_pCurrentBlock, ( m_pCurrentBlock != nullptr ) ? m_pCurrentBlock->m_used : 0, m_usedInPreviousBlocks }; }
+        void RewindToMarker( Marker const& marker );
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        // The number of bytes (including alignment padding) currently allocated from this arena
+        inline size_t GetUsedMemory() const { return m_usedInPreviousBlocks + ( ( m_pCurrentBlock != nullptr ) ? m_pCurrentBlock->m_used : 0 ); }
+
+        // The highest number of bytes used since the arena was created
+        inline size_t GetPeakUsedMemory() const { return m_peakUsedMemory; }
+
+        // The number of bytes requested from the global allocator
+        inline size_t GetReservedMemory() const { return m_reservedMemory; }
+
+        // The number of allocations since the last reset
+        inline uint32_t GetNumAllocations() const { return m_numAllocations; }
+
+    private:
+
+        EE_FORCE_INLINE static uint8_t* GetBlockData( Block* pBlock ) { return reinterpret_cast<uint8_t*>( pBlock + 1 ); }
+
+        void* AllocateFromNewBlock( size_t size, size_t alignment );
+        void FreeBlocks( Block*& pBlockList );
+
+    private:
+
+        Block*                              m_pCurrentBlock = nullptr;
+        Block*                              m_pFreeBlocks = nullptr;        // Blocks released by rewinding, reused before allocating new blocks
+        size_t                              m_blockSize = s_defaultBlockSize;
+        size_t                              m_usedInPreviousBlocks = 0;
+        size_t                              m_peakUsedMemory = 0;
+        size_t                              m_reservedMemory = 0;
+        uint32_t                            m_numAllocations = 0;
+        uint32_t                            m_numBlocks = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // Frame Arenas
+    //-------------------------------------------------------------------------
+    // Each thread has its own frame arena for transient data that only needs to live until the end of the current frame
+    // The engine advances the frame at the end of the FrameEnd update stage. The arenas are reset lazily: each thread
+    // resets its own arena on its first frame allocation in the new frame so no synchronization between threads is needed
+    //
+    // Frame allocations must not be kept across the end of a frame, this includes allocations made by tasks that span frames
+
+    struct FrameStats
+    {
+        AllocationStats                     m_globalAllocations;            // Global allocator calls during the frame (development builds only)
+        uint32_t                            m_numFrameAllocations = 0;      // Frame arena allocations across all threads
+        size_t                              m_frameMemoryUsed = 0;          // Frame arena memory used across all threads
+        size_t                              m_frameMemoryReserved = 0;      // Memory reserved by all the frame arenas
+    };
+
+    [[nodiscard]] EE_BASE_API void* FrameAlloc( size_t size, size_t alignment = EE_DEFAULT_ALIGNMENT );
+
+    template<typename T>
+    [[nodiscard]] inline T* FrameAllocArray( size_t numElements ) { return reinterpret_cast<T*>( FrameAlloc( sizeof( T ) * numElements, alignof( T ) ) ); }
+
+    // Invalidates all frame allocations, called by the engine at the end of each frame
+    EE_BASE_API void AdvanceFrame();
+
+    EE_BASE_API uint64_t GetFrameIndex();
+
+    // Get the allocation stats for the last completed frame
+    EE_BASE_API FrameStats const& GetLastFrameStats();
+
+    // Frees all the per-thread arenas, called by the memory system on shutdown
+    void ReleaseThreadArenas();
+
+    //-------------------------------------------------------------------------
+    // Scoped Scratch
+    //-------------------------------------------------------------------------
+    // Stack-like scratch memory for temporaries inside a function, each thread has its own scratch arena
+    // Everything allocated through a scope is released when the scope is destroyed
+    // Scopes can be nested, but only the innermost scope on a thread can allocate
+
+    class EE_BASE_API ScopedScratch
+    {
+    public:
+
+        ScopedScratch();
+        ScopedScratch( ScopedScratch const& ) = delete;
+        ~ScopedScratch();
+
+        ScopedScratch& operator=( ScopedScratch const& ) = delete;
+
+        [[nodiscard]] inline void* Allocate( size_t size, size_t alignment = EE_DEFAULT_ALIGNMENT )
+        {
+            EE_ASSERT( IsInnermostScope() );
+            return m_pArena->Allocate( size, alignment );
+        }
+
+        template<typename T>
+        [[nodiscard]] inline T* AllocateArray( size_t numElements )
+        {
+            EE_ASSERT( IsInnermostScope() );
+            return m_pArena->AllocateArray<T>( numElements );
+        }
+
+        // Get the underlying arena, i.e. to bind an arena allocator to it
+        inline LinearArena* GetArena() const { return m_pArena; }
+
+    private:
+
+        bool IsInnermostScope() const;
+
+    private:
+
+        LinearArena*                        m_pArena = nullptr;
+        LinearArena::Marker                 m_marker;
+        int32_t                             m_depth = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // EASTL Allocators
+    //-------------------------------------------------------------------------
+    // Deallocations are no-ops for both allocators, the memory is reclaimed when the arena is reset or rewound
+
+    // Allocates from the calling thread's frame arena, containers using this can be passed between threads during a frame
+    class FrameAllocator
+    {
+    public:
+
+        inline FrameAllocator( char const* pName = nullptr ) {}
+        inline FrameAllocator( FrameAllocator const&, char const* pName ) {}
+
+        inline void* allocate( size_t n, int flags = 0 ) { return FrameAlloc( n, EASTL_ALLOCATOR_MIN_ALIGNMENT ); }
+        inline void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 ) { EE_ASSERT( offset == 0 ); return FrameAlloc( n, alignment ); }
+        inline void deallocate( void* p, size_t n ) {}
+
+        inline char const* get_name() const { return "FrameAllocator"; }
+        inline void set_name( char const* pName ) {}
+
+        inline bool operator==( FrameAllocator const& rhs ) const { return true; }
+        inline bool operator!=( FrameAllocator const& rhs ) const { return false; }
+    };
+
+    // Allocates from a specific arena, needs to be bound to an arena before the container allocates
+    // Usage: TArenaVector<int32_t> values( ArenaAllocator( scratch.GetArena() ) );
+    class ArenaAllocator
+    {
+    public:
+
+        inline ArenaAllocator( char const* pName = nullptr ) {}
+        inline explicit ArenaAllocator( LinearArena* pArena ) : m_pArena( pArena ) { EE_ASSERT( m_pArena != nullptr ); }
+        inline ArenaAllocator( ArenaAllocator const& other, char const* pName ) : m_pArena( other.m_pArena ) {}
+
+        inline void* allocate( size_t n, int flags = 0 ) { EE_ASSERT( m_pArena != nullptr ); return m_pArena->Allocate( n, EASTL_ALLOCATOR_MIN_ALIGNMENT ); }
+        inline void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 ) { EE_ASSERT( m_pArena != nullptr && offset == 0 ); return m_pArena->Allocate( n, alignment ); }
+        inline void deallocate( void* p, size_t n ) {}
+
+        inline char const* get_name() const { return "ArenaAllocator"; }
+        inline void set_name( char const* pName ) {}
+
+        inline LinearArena* GetArena() const { return m_pArena; }
+
+        inline bool operator==( ArenaAllocator const& rhs ) const { return m_pArena == rhs.m_pArena; }
+        inline bool operator!=( ArenaAllocator const& rhs ) const { return m_pArena != rhs.m_pArena; }
+
+    private:
+
+        LinearArena*                        m_pArena = nullptr;
+    };
+}
+
+//-------------------------------------------------------------------------
+// Container aliases
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    template<typename T> using TFrameVector = eastl::vector<T, Memory::FrameAllocator>;
+    template<typename T, eastl_size_t S> using TFrameInlineVector = eastl::fixed_vector<T, S, true, Memory::FrameAllocator>;
+
+    template<typename T> using TArenaVector = eastl::vector<T, Memory::ArenaAllocator>;
+    template<typename T, eastl_size_t S> using TArenaInlineVector = eastl::fixed_vector<T, S, true, Memory::ArenaAllocator>;
+}
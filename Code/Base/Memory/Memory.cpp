@@ -1,4 +1,8 @@
 #include "Memory.h"
+#include "MemoryTags.h"
+#include "Arena.h"
+#include "Base/Math/Math.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
@@ -24,6 +28,121 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        #if EE_DEVELOPMENT_TOOLS
+        #if EE_MEMORY_TAGGING
+        struct TagCounters
+        {
+            std::atomic<int64_t>                    m_liveBytes = 0;            // Can go negative for a slot, if memory is freed on a different thread than it was allocated on
+            std::atomic<uint64_t>                   m_numAllocations = 0;
+            std::atomic<uint64_t>                   m_allocatedBytes = 0;
+        };
+        #endif
+
+        // Each thread counts its allocator calls in its own slot to avoid contention, any threads beyond the slot count share the last slot
+        struct alignas( 64 ) ThreadAllocationCounters
+        {
+            std::atomic<uint64_t>                   m_numAllocations = 0;
+            std::atomic<uint64_t>                   m_numReallocations = 0;
+            std::atomic<uint64_t>                   m_numFrees = 0;
+
+            #if EE_MEMORY_TAGGING
+            TagCounters                             m_tags[(int32_t) Tag::NumTags];
+            #endif
+        };
+
+        constexpr static int32_t const s_maxAllocationCounterSlots = 128;
+
+        static ThreadAllocationCounters             g_allocationCounters[s_maxAllocationCounterSlots];
+        static std::atomic<int32_t>                 g_numAllocationCounterSlots = 0;
+        static thread_local ThreadAllocationCounters* t_pAllocationCounters = nullptr;
+
+        static ThreadAllocationCounters& GetThreadAllocationCounters()
+        {
+            if ( t_pAllocationCounters == nullptr )
+            {
+                int32_t const slotIdx = g_numAllocationCounterSlots.fetch_add( 1, std::memory_order_relaxed );
+                t_pAllocationCounters = &g_allocationCounters[( slotIdx < s_maxAllocationCounterSlots ) ? slotIdx : s_maxAllocationCounterSlots - 1];
+            }
+
+            return *t_pAllocationCounters;
+        }
+        #endif
+
+        //-------------------------------------------------------------------------
+
+        #if EE_MEMORY_TAGGING
+        // Each tagged allocation is prefixed by a header, placed directly before the returned address
+        // The header offset is at least the requested alignment so that the returned address keeps that alignment
+        struct AllocationHeader
+        {
+            uint64_t                                m_size;                     // The requested size
+            uint32_t                                m_offset;                   // The offset from the start of the underlying allocation
+            Tag                                     m_tag;
+            uint8_t                                 m_padding[3];
+        };
+
+        static_assert( sizeof( AllocationHeader ) == 16 );
+
+        constexpr static int32_t const s_maxTagStackDepth = 32;
+
+        static thread_local Tag                     t_tagStack[s_maxTagStackDepth];
+        static thread_local int32_t                 t_tagStackDepth = 0;
+        static TagStats                             g_tagStats[(int32_t) Tag::NumTags];
+
+        EE_FORCE_INLINE static size_t GetAllocationHeaderOffset( size_t alignment )
+        {
+            return ( alignment > sizeof( AllocationHeader ) ) ? alignment : sizeof( AllocationHeader );
+        }
+
+        EE_FORCE_INLINE static AllocationHeader* GetAllocationHeader( void* pMemory )
+        {
+            return reinterpret_cast<AllocationHeader*>( pMemory ) - 1;
+        }
+
+        static void RecordTaggedAllocation( Tag tag, int64_t deltaLiveBytes, size_t allocatedBytes, bool isNewAllocation )
+        {
+            TagCounters& counters = GetThreadAllocationCounters().m_tags[(int32_t) tag];
+            counters.m_liveBytes.fetch_add( deltaLiveBytes, std::memory_order_relaxed );
+            counters.m_allocatedBytes.fetch_add( allocatedBytes, std::memory_order_relaxed );
+
+            if ( isNewAllocation )
+            {
+                counters.m_numAllocations.fetch_add( 1, std::memory_order_relaxed );
+            }
+        }
+        #endif
+
+        //-------------------------------------------------------------------------
+
+        EE_FORCE_INLINE static void* AllocateRaw( size_t size, size_t alignment )
+        {
+            #if EE_USE_CUSTOM_ALLOCATOR
+            return rpaligned_alloc( alignment, size );
+            #elif _WIN32
+            return _aligned_malloc( size, alignment );
+            #endif
+        }
+
+        EE_FORCE_INLINE static void* ReallocateRaw( void* pMemory, size_t newSize, size_t originalAlignment )
+        {
+            #if EE_USE_CUSTOM_ALLOCATOR
+            return rprealloc( pMemory, newSize );
+            #elif _WIN32
+            return _aligned_realloc( pMemory, newSize, originalAlignment );
+            #endif
+        }
+
+        EE_FORCE_INLINE static void FreeRaw( void* pMemory )
+        {
+            #if EE_USE_CUSTOM_ALLOCATOR
+            rpfree( pMemory );
+            #elif _WIN32
+            _aligned_free( pMemory );
+            #endif
+        }
+
+        //-------------------------------------------------------------------------
+
         static void CustomAssert( char const* pMessage )
         {
             EE_TRACE_HALT( pMessage );
@@ -47,6 +166,7 @@ namespace EE
         void Shutdown()
         {
             EE_ASSERT( g_isMemorySystemInitialized );
+            ReleaseThreadArenas();
             g_isMemorySystemInitialized = false;
 
             #if EE_USE_CUSTOM_ALLOCATOR
@@ -94,6 +214,112 @@ namespace EE
             return 0;
             #endif
         }
+
+        AllocationStats GetAllocationStats()
+        {
+            AllocationStats stats;
+
+            #if EE_DEVELOPMENT_TOOLS
+            int32_t const numSlots = g_numAllocationCounterSlots.load( std::memory_order_relaxed );
+            for ( int32_t i = 0; i < numSlots && i < s_maxAllocationCounterSlots; i++ )
+            {
+                stats.m_numAllocations += g_allocationCounters[i].m_numAllocations.load( std::memory_order_relaxed );
+                stats.m_numReallocations += g_allocationCounters[i].m_numReallocations.load( std::memory_order_relaxed );
+                stats.m_numFrees += g_allocationCounters[i].m_numFrees.load( std::memory_order_relaxed );
+            }
+            #endif
+
+            return stats;
+        }
+
+        //-------------------------------------------------------------------------
+        // Tags
+        //-------------------------------------------------------------------------
+
+        char const* GetTagName( Tag tag )
+        {
+            constexpr static char const* const tagNames[] =
+            {
+                "Untagged",
+                "Core",
+                "Resources",
+                "Entities",
+                "Animation",
+                "Physics",
+                "Navmesh",
+                "AI",
+                "Rendering",
+                "Gameplay",
+                "Tools",
+            };
+
+            static_assert( sizeof( tagNames ) / sizeof( tagNames[0] ) == (size_t) Tag::NumTags, "Tag names out of date" );
+            EE_ASSERT( tag < Tag::NumTags );
+            return tagNames[(int32_t) tag];
+        }
+
+        #if EE_MEMORY_TAGGING
+        void PushTag( Tag tag )
+        {
+            EE_ASSERT( tag < Tag::NumTags );
+            EE_ASSERT( t_tagStackDepth < s_maxTagStackDepth );
+            t_tagStack[t_tagStackDepth++] = tag;
+        }
+
+        void PopTag()
+        {
+            EE_ASSERT( t_tagStackDepth > 0 );
+            t_tagStackDepth--;
+        }
+
+        Tag GetCurrentTag()
+        {
+            return ( t_tagStackDepth > 0 ) ? t_tagStack[t_tagStackDepth - 1] : Tag::Untagged;
+        }
+
+        TagStats const& GetTagStats( Tag tag )
+        {
+            EE_ASSERT( tag < Tag::NumTags );
+            return g_tagStats[(int32_t) tag];
+        }
+
+        void ResetTagPeaks()
+        {
+            for ( TagStats& stats : g_tagStats )
+            {
+                stats.m_peakLiveBytes = stats.m_liveBytes;
+            }
+        }
+
+        void UpdateTagStats()
+        {
+            int32_t const numSlots = Math::Min( g_numAllocationCounterSlots.load( std::memory_order_relaxed ), s_maxAllocationCounterSlots );
+
+            for ( int32_t tagIdx = 0; tagIdx < (int32_t) Tag::NumTags; tagIdx++ )
+            {
+                int64_t liveBytes = 0;
+                uint64_t numAllocations = 0;
+                uint64_t allocatedBytes = 0;
+
+                for ( int32_t slotIdx = 0; slotIdx < numSlots; slotIdx++ )
+                {
+                    TagCounters const& counters = g_allocationCounters[slotIdx].m_tags[tagIdx];
+                    liveBytes += counters.m_liveBytes.load( std::memory_order_relaxed );
+                    numAllocations += counters.m_numAllocations.load( std::memory_order_relaxed );
+                    allocatedBytes += counters.m_allocatedBytes.load( std::memory_order_relaxed );
+                }
+
+                // The counters only ever grow so we can derive the per-frame values from the previous totals
+                TagStats& stats = g_tagStats[tagIdx];
+                stats.m_numFrameAllocations = numAllocations - stats.m_totalAllocations;
+                stats.m_frameAllocatedBytes = allocatedBytes - stats.m_totalAllocatedBytes;
+                stats.m_totalAllocations = numAllocations;
+                stats.m_totalAllocatedBytes = allocatedBytes;
+                stats.m_liveBytes = liveBytes;
+                stats.m_peakLiveBytes = Math::Max( stats.m_peakLiveBytes, liveBytes );
+            }
+        }
+        #endif
     }
 
     //-------------------------------------------------------------------------
@@ -104,12 +330,23 @@ namespace EE
 
         if ( size == 0 ) return nullptr;
 
-        void* pMemory = nullptr;
+        #if EE_DEVELOPMENT_TOOLS
+        Memory::GetThreadAllocationCounters().m_numAllocations.fetch_add( 1, std::memory_order_relaxed );
+        #endif
+
+        #if EE_MEMORY_TAGGING
+        size_t const headerOffset = Memory::GetAllocationHeaderOffset( alignment );
+        uint8_t* pAllocation = (uint8_t*) Memory::AllocateRaw( size + headerOffset, alignment );
+        EE_ASSERT( pAllocation != nullptr );
+        void* pMemory = pAllocation + headerOffset;
 
-        #if EE_USE_CUSTOM_ALLOCATOR
-        pMemory = rpaligned_alloc( alignment, size );
-        #elif _WIN32
-        pMemory = _aligned_malloc( size, alignment );
+        Memory::AllocationHeader* pHeader = Memory::GetAllocationHeader( pMemory );
+        pHeader->m_size = size;
+        pHeader->m_offset = uint32_t( headerOffset );
+        pHeader->m_tag = Memory::GetCurrentTag();
+        Memory::RecordTaggedAllocation( pHeader->m_tag, int64_t( size ), size, true );
+        #else
+        void* pMemory = Memory::AllocateRaw( size, alignment );
         #endif
 
         EE_ASSERT( Memory::IsAligned( pMemory, alignment ) );
@@ -120,12 +357,37 @@ namespace EE
     {
         EE_ASSERT( EE::Memory::g_isMemorySystemInitialized );
 
-        void* pReallocatedMemory = nullptr;
+        #if EE_DEVELOPMENT_TOOLS
+        Memory::GetThreadAllocationCounters().m_numReallocations.fetch_add( 1, std::memory_order_relaxed );
+        #endif
+
+        #if EE_MEMORY_TAGGING
+        size_t const headerOffset = Memory::GetAllocationHeaderOffset( originalAlignment );
+
+        // Reallocating null is a new allocation with the current tag, otherwise we keep the tag of the original allocation
+        Memory::Tag tag = Memory::GetCurrentTag();
+        size_t oldSize = 0;
+        uint8_t* pAllocation = nullptr;
+        if ( pMemory != nullptr )
+        {
+            Memory::AllocationHeader const* pOldHeader = Memory::GetAllocationHeader( pMemory );
+            EE_ASSERT( pOldHeader->m_offset == headerOffset );
+            tag = pOldHeader->m_tag;
+            oldSize = pOldHeader->m_size;
+            pAllocation = (uint8_t*) pMemory - headerOffset;
+        }
+
+        uint8_t* pReallocatedAllocation = (uint8_t*) Memory::ReallocateRaw( pAllocation, newSize + headerOffset, originalAlignment );
+        EE_ASSERT( pReallocatedAllocation != nullptr );
+        void* pReallocatedMemory = pReallocatedAllocation + headerOffset;
 
-        #if EE_USE_CUSTOM_ALLOCATOR
-        pReallocatedMemory = rprealloc( pMemory, newSize );
-        #elif _WIN32
-        pReallocatedMemory = _aligned_realloc( pMemory, newSize, originalAlignment );
+        Memory::AllocationHeader* pHeader = Memory::GetAllocationHeader( pReallocatedMemory );
+        pHeader->m_size = newSize;
+        pHeader->m_offset = uint32_t( headerOffset );
+        pHeader->m_tag = tag;
+        Memory::RecordTaggedAllocation( tag, int64_t( newSize ) - int64_t( oldSize ), ( newSize > oldSize ) ? newSize - oldSize : 0, pMemory == nullptr );
+        #else
+        void* pReallocatedMemory = Memory::ReallocateRaw( pMemory, newSize, originalAlignment );
         #endif
 
         EE_ASSERT( pReallocatedMemory != nullptr );
@@ -136,10 +398,21 @@ namespace EE
     {
         EE_ASSERT( EE::Memory::g_isMemorySystemInitialized );
 
-        #if EE_USE_CUSTOM_ALLOCATOR
-        rpfree( (uint8_t*) pMemory );
-        #elif _WIN32
-        _aligned_free( pMemory );
+        if ( pMemory == nullptr )
+        {
+            return;
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        Memory::GetThreadAllocationCounters().m_numFrees.fetch_add( 1, std::memory_order_relaxed );
+        #endif
+
+        #if EE_MEMORY_TAGGING
+        Memory::AllocationHeader const* pHeader = Memory::GetAllocationHeader( pMemory );
+        Memory::RecordTaggedAllocation( pHeader->m_tag, -int64_t( pHeader->m_size ), 0, false );
+        Memory::FreeRaw( (uint8_t*) pMemory - pHeader->m_offset );
+        #else
+        Memory::FreeRaw( pMemory );
         #endif
 
         pMemory = nullptr;
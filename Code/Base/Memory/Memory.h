@@ -2,6 +2,7 @@
 
 #include "Base/_Module/API.h"
 #include "Base/Esoterica.h"
+#include <algorithm>
 #include <cstring>
 #include <malloc.h>
 #include <utility>
@@ -77,6 +78,23 @@ namespace EE
 
         EE_BASE_API size_t GetTotalRequestedMemory();
         EE_BASE_API size_t GetTotalAllocatedMemory();
+
+        //-------------------------------------------------------------------------
+
+        // The number of calls to the global allocator, only tracked in development builds
+        struct AllocationStats
+        {
+            inline AllocationStats operator-( AllocationStats const& rhs ) const { return AllocationStats{ m_numAllocations - rhs.m_numAllocations, m_numReallocations - rhs.m_numReallocations, m_numFrees - rhs.m_numFrees }; }
+
+        public:
+
+            uint64_t                m_numAllocations = 0;
+            uint64_t                m_numReallocations = 0;
+            uint64_t                m_numFrees = 0;
+        };
+
+        // Get the total number of global allocator calls since startup
+        EE_BASE_API AllocationStats GetAllocationStats();
     }
 
     //-------------------------------------------------------------------------
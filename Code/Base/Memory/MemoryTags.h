@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Memory.h"
+
+//-------------------------------------------------------------------------
+// Memory Tags
+//-------------------------------------------------------------------------
+// Every global allocation is attributed to the memory tag at the top of the allocating thread's tag stack
+// Tags are pushed with EE_MEMORY_TAG_SCOPE at subsystem entry points, allocations outside of any scope are 'Untagged'
+// Frees and reallocations are always attributed to the tag that made the original allocation
+//
+// Tags are not propagated to tasks, each task needs to set its own tag scope
+// Tagging adds a small header to each allocation, define EE_MEMORY_TAGGING as 0 to compile it out of development builds
+// Tagging is never enabled in shipping builds
+
+#ifndef EE_MEMORY_TAGGING
+    #if EE_DEVELOPMENT_TOOLS
+        #define EE_MEMORY_TAGGING 1
+    #else
+        #define EE_MEMORY_TAGGING 0
+    #endif
+#endif
+
+#if EE_MEMORY_TAGGING && !EE_DEVELOPMENT_TOOLS
+    #error "Memory tagging requires development tools"
+#endif
+
+//-------------------------------------------------------------------------
+
+namespace EE::Memory
+{
+    enum class Tag : uint8_t
+    {
+        Untagged = 0,
+        Core,
+        Resources,
+        Entities,
+        Animation,
+        Physics,
+        Navmesh,
+        AI,
+        Rendering,
+        Gameplay,
+        Tools,
+
+        NumTags
+    };
+
+    EE_BASE_API char const* GetTagName( Tag tag );
+
+    //-------------------------------------------------------------------------
+
+    struct TagStats
+    {
+        int64_t                                 m_liveBytes = 0;
+        int64_t                                 m_peakLiveBytes = 0;            // The highest live bytes seen at the end of a frame
+        uint64_t                                m_totalAllocations = 0;
+        uint64_t                                m_totalAllocatedBytes = 0;
+        uint64_t                                m_numFrameAllocations = 0;      // Allocations made during the last frame
+        uint64_t                                m_frameAllocatedBytes = 0;      // Bytes allocated during the last frame
+    };
+
+    #if EE_MEMORY_TAGGING
+
+    EE_BASE_API void PushTag( Tag tag );
+    EE_BASE_API void PopTag();
+    EE_BASE_API Tag GetCurrentTag();
+
+    // Get the tag stats as of the end of the last frame
+    EE_BASE_API TagStats const& GetTagStats( Tag tag );
+
+    // Resets the peak live bytes of all tags to their current live bytes
+    EE_BASE_API void ResetTagPeaks();
+
+    // Gathers the per-thread tag counters, called when the frame is advanced
+    void UpdateTagStats();
+
+    //-------------------------------------------------------------------------
+
+    class [[nodiscard]] ScopedTag
+    {
+    public:
+
+        inline explicit ScopedTag( Tag tag ) { PushTag( tag ); }
+        inline ~ScopedTag() { PopTag(); }
+
+        ScopedTag( ScopedTag const& ) = delete;
+        ScopedTag& operator=( ScopedTag const& ) = delete;
+    };
+
+    #endif
+}
+
+//-------------------------------------------------------------------------
+
+#if EE_MEMORY_TAGGING
+    #define EE_MEMORY_TAG_SCOPE( tag ) EE::Memory::ScopedTag const _memoryTagScope( EE::Memory::Tag::tag )
+#else
+    #define EE_MEMORY_TAG_SCOPE( tag )
+#endif
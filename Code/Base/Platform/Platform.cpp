@@ -1,6 +1,12 @@
 #include "Platform.h"
 #include "Base/Esoterica.h"
 
+#if _WIN32
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
 //-------------------------------------------------------------------------
 
 namespace EE::Platform
@@ -8,6 +14,79 @@ namespace EE::Platform
     namespace Internals
     {
         void* g_pMainWindowHandle = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        static void GetCPUID( uint32_t function, uint32_t subFunction, uint32_t outRegisters[4] )
+        {
+            #if _WIN32
+            __cpuidex( (int*) outRegisters, (int) function, (int) subFunction );
+            #else
+            __cpuid_count( function, subFunction, outRegisters[0], outRegisters[1], outRegisters[2], outRegisters[3] );
+            #endif
+        }
+
+        static uint64_t GetExtendedControlRegister()
+        {
+            #if _WIN32
+            return _xgetbv( 0 );
+            #else
+            uint32_t eax, edx;
+            __asm__ volatile( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+            return ( uint64_t( edx ) << 32 ) | eax;
+            #endif
+        }
+
+        static uint32_t DetectCPUFeatures()
+        {
+            uint32_t registers[4] = {}; // EAX, EBX, ECX, EDX
+            GetCPUID( 0, 0, registers );
+            uint32_t const maxFunction = registers[0];
+
+            uint32_t features = 0;
+            if ( maxFunction < 1 )
+            {
+                return features;
+            }
+
+            GetCPUID( 1, 0, registers );
+            bool const hasSSE42 = ( registers[2] & ( 1u << 20 ) ) != 0;
+            bool const hasFMA = ( registers[2] & ( 1u << 12 ) ) != 0;
+            bool const hasOSXSave = ( registers[2] & ( 1u << 27 ) ) != 0;
+            bool const hasAVX = ( registers[2] & ( 1u << 28 ) ) != 0;
+
+            // The OS needs to save the XMM and YMM registers on context switches for us to use AVX
+            bool const hasOSSupportForAVX = hasOSXSave && ( ( GetExtendedControlRegister() & 0x6 ) == 0x6 );
+
+            bool hasAVX2 = false;
+            if ( maxFunction >= 7 )
+            {
+                GetCPUID( 7, 0, registers );
+                hasAVX2 = ( registers[1] & ( 1u << 5 ) ) != 0;
+            }
+
+            if ( hasSSE42 )
+            {
+                features |= 1u << (uint8_t) CPUFeature::SSE42;
+            }
+
+            if ( hasAVX && hasOSSupportForAVX )
+            {
+                features |= 1u << (uint8_t) CPUFeature::AVX;
+
+                if ( hasAVX2 )
+                {
+                    features |= 1u << (uint8_t) CPUFeature::AVX2;
+                }
+
+                if ( hasFMA )
+                {
+                    features |= 1u << (uint8_t) CPUFeature::FMA;
+                }
+            }
+
+            return features;
+        }
     }
 
     // Windowing
@@ -29,4 +108,13 @@ namespace EE::Platform
         EE_ASSERT( Internals::g_pMainWindowHandle != nullptr );
         Internals::g_pMainWindowHandle = nullptr;
     }
+
+    // CPU Features
+    //-------------------------------------------------------------------------
+
+    bool IsCPUFeatureSupported( CPUFeature feature )
+    {
+        static uint32_t const features = Internals::DetectCPUFeatures();
+        return ( features & ( 1u << (uint8_t) feature ) ) != 0;
+    }
 }
\ No newline at end of file
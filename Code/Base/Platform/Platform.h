@@ -1,5 +1,6 @@
 #pragma once
 #include "Base/_Module/API.h"
+#include <stdint.h>
 
 //-------------------------------------------------------------------------
 
@@ -18,4 +19,18 @@ namespace EE::Platform
     EE_BASE_API void* GetMainWindowHandle();
     EE_BASE_API void SetMainWindowHandle( void* pWindowHandle );
     EE_BASE_API void ClearMainWindowHandle();
+
+    // CPU Features
+    //-------------------------------------------------------------------------
+    // Detected once on first use, a feature is only reported as supported if the OS also supports the required register state
+
+    enum class CPUFeature : uint8_t
+    {
+        SSE42,
+        AVX,
+        AVX2,
+        FMA,
+    };
+
+    EE_BASE_API bool IsCPUFeatureSupported( CPUFeature feature );
 }
\ No newline at end of file
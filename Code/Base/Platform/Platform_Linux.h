@@ -0,0 +1,52 @@
+#pragma once
+#ifdef __linux__
+
+//-------------------------------------------------------------------------
+// Only the parts of Base that don't depend on a platform layer (math, containers, strings, profiling) build on Linux
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <strings.h>
+
+#define EE_FORCE_INLINE inline __attribute__( ( always_inline ) )
+
+//-------------------------------------------------------------------------
+// CRT
+//-------------------------------------------------------------------------
+// Versions of the MSVC secure CRT functions used in headers, these always null terminate and truncate instead of failing
+
+inline int strncpy_s( char* pDest, size_t destSize, char const* pSrc, size_t count )
+{
+    if ( pDest == nullptr || destSize == 0 )
+    {
+        return -1;
+    }
+
+    size_t const length = strnlen( pSrc, count < destSize ? count : destSize - 1 );
+    memcpy( pDest, pSrc, length );
+    pDest[length] = 0;
+    return 0;
+}
+
+inline int vsprintf_s( char* pBuffer, size_t bufferSize, char const* pFormat, va_list args )
+{
+    return vsnprintf( pBuffer, bufferSize, pFormat, args );
+}
+
+EE_FORCE_INLINE int _stricmp( char const* pStr0, char const* pStr1 ) { return strcasecmp( pStr0, pStr1 ); }
+EE_FORCE_INLINE int _strnicmp( char const* pStr0, char const* pStr1, size_t count ) { return strncasecmp( pStr0, pStr1, count ); }
+
+//-------------------------------------------------------------------------
+// Dev Defines
+//-------------------------------------------------------------------------
+
+#define EE_DISABLE_OPTIMIZATION _Pragma( "GCC push_options" ) _Pragma( "GCC optimize( \"O0\" )" )
+#define EE_ENABLE_OPTIMIZATION _Pragma( "GCC pop_options" )
+
+#if EE_DEVELOPMENT_TOOLS
+    #define EE_DEBUG_BREAK() __builtin_trap()
+#endif
+
+#endif
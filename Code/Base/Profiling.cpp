@@ -13,13 +13,31 @@
 
 namespace EE::Profiling
 {
+    void Initialize()
+    {
+        #if EE_ENABLE_BUILTIN_PROFILER
+        BuiltIn::Initialize();
+        #endif
+    }
+
+    void Shutdown()
+    {
+        #if EE_ENABLE_BUILTIN_PROFILER
+        BuiltIn::Shutdown();
+        #endif
+    }
+
+    //-------------------------------------------------------------------------
+
     void StartFrame()
     {
         #if EE_ENABLE_SUPERLUMINAL
         PerformanceAPI::BeginEvent( "Frame" );
         #endif
 
-        #if EE_DEVELOPMENT_TOOLS
+        #if EE_ENABLE_BUILTIN_PROFILER
+        BuiltIn::StartFrame();
+        #elif EE_DEVELOPMENT_TOOLS
         OPTICK_FRAME( "EE Main" );
         #endif
     }
@@ -29,11 +47,15 @@ namespace EE::Profiling
         #if EE_ENABLE_SUPERLUMINAL
         PerformanceAPI::EndEvent();
         #endif
+
+        #if EE_ENABLE_BUILTIN_PROFILER
+        BuiltIn::EndFrame();
+        #endif
     }
 
     void OpenProfiler()
     {
-        #if _WIN32
+        #if _WIN32 && !EE_ENABLE_BUILTIN_PROFILER
         FileSystem::Path const profilerPath = FileSystem::Path( Platform::Win32::GetCurrentModulePath() ) + "..\\..\\..\\..\\External\\Optick\\Optick.exe";
         Platform::Win32::StartProcess( profilerPath );
         #endif
@@ -41,16 +63,20 @@ namespace EE::Profiling
 
     void StartCapture()
     {
-        #if EE_DEVELOPMENT_TOOLS
+        #if EE_ENABLE_BUILTIN_PROFILER
+        BuiltIn::StartCapture();
+        #elif EE_DEVELOPMENT_TOOLS
         OPTICK_START_CAPTURE();
         #endif
     }
 
     void StopCapture( FileSystem::Path const& captureSavePath )
     {
-        #if EE_DEVELOPMENT_TOOLS
+        #if EE_ENABLE_BUILTIN_PROFILER
+        BuiltIn::StopCapture( captureSavePath );
+        #elif EE_DEVELOPMENT_TOOLS
         OPTICK_STOP_CAPTURE();
         OPTICK_SAVE_CAPTURE( captureSavePath.c_str() );
         #endif
     }
-}
\ No newline at end of file
+}
@@ -2,11 +2,27 @@
 
 #include "Base/Encoding/Hash.h"
 
+//-------------------------------------------------------------------------
+// The EE_PROFILE_* macros map either onto Optick or onto the built-in profiler (see Profiling_BuiltIn.h)
+// The built-in profiler has no external dependencies and is the default on platforms where Optick isnt available
+
+#ifndef EE_ENABLE_BUILTIN_PROFILER
+    #if EE_DEVELOPMENT_TOOLS && !_WIN32
+        #define EE_ENABLE_BUILTIN_PROFILER 1
+    #else
+        #define EE_ENABLE_BUILTIN_PROFILER 0
+    #endif
+#endif
+
+#if EE_ENABLE_BUILTIN_PROFILER
+#include "Base/Profiling_BuiltIn.h"
+#else
 #if !EE_DEVELOPMENT_TOOLS
 #define USE_OPTICK 0
 #endif
 
 #include <optick.h>
+#endif
 
 //-------------------------------------------------------------------------
 
@@ -18,15 +34,21 @@ namespace EE
 
     namespace Profiling
     {
+        EE_BASE_API void Initialize();
+        EE_BASE_API void Shutdown();
+
+        //-------------------------------------------------------------------------
+
         EE_BASE_API void StartFrame();
         EE_BASE_API void EndFrame();
 
         //-------------------------------------------------------------------------
 
-        // Open the profiler application (only available on Win64)
+        // Open the profiler application (only available on Win64 when using Optick)
         EE_BASE_API void OpenProfiler();
 
         // Capture management
+        // The built-in profiler saves the capture as a Chrome trace (JSON) and a per-zone summary next to it ("<path>.summary.csv")
         EE_BASE_API void StartCapture();
         EE_BASE_API void StopCapture( FileSystem::Path const& captureSavePath );
     }
@@ -34,6 +56,64 @@ namespace EE
 
 //-------------------------------------------------------------------------
 
+#if EE_ENABLE_BUILTIN_PROFILER
+
+#define EE_PROFILE_CONCAT_INTERNAL( a, b ) a##b
+#define EE_PROFILE_CONCAT( a, b ) EE_PROFILE_CONCAT_INTERNAL( a, b )
+#define EE_PROFILE_ZONE( name, category ) EE::Profiling::ScopedZone EE_PROFILE_CONCAT( _eeProfileZone, __LINE__ )( name, EE::Profiling::Category::category )
+
+#define EE_PROFILE_THREAD_START( ThreadName ) EE::Profiling::SetThreadName( ThreadName )
+
+#define EE_PROFILE_THREAD_END()
+
+// Generic scopes
+//-------------------------------------------------------------------------
+
+#define EE_PROFILE_FUNCTION() EE_PROFILE_ZONE( __FUNCTION__, Default )
+#define EE_PROFILE_SCOPE( name ) EE_PROFILE_ZONE( name, Default )
+
+// Tags
+//-------------------------------------------------------------------------
+// Tags are not recorded by the built-in profiler
+
+#define EE_PROFILE_TAG( name, value )
+
+// Waits
+//-------------------------------------------------------------------------
+
+#define EE_PROFILE_WAIT( name ) EE_PROFILE_ZONE( name, Wait )
+
+// Category scopes
+//-------------------------------------------------------------------------
+
+#define EE_PROFILE_FUNCTION_AI() EE_PROFILE_ZONE( __FUNCTION__, AI )
+#define EE_PROFILE_FUNCTION_ANIMATION() EE_PROFILE_ZONE( __FUNCTION__, Animation )
+#define EE_PROFILE_FUNCTION_CAMERA() EE_PROFILE_ZONE( __FUNCTION__, Camera )
+#define EE_PROFILE_FUNCTION_GAMEPLAY() EE_PROFILE_ZONE( __FUNCTION__, Gameplay )
+#define EE_PROFILE_FUNCTION_IO() EE_PROFILE_ZONE( __FUNCTION__, IO )
+#define EE_PROFILE_FUNCTION_NAVIGATION() EE_PROFILE_ZONE( __FUNCTION__, Navigation )
+#define EE_PROFILE_FUNCTION_PHYSICS() EE_PROFILE_ZONE( __FUNCTION__, Physics )
+#define EE_PROFILE_FUNCTION_RENDER() EE_PROFILE_ZONE( __FUNCTION__, Render )
+#define EE_PROFILE_FUNCTION_ENTITY() EE_PROFILE_ZONE( __FUNCTION__, Entity )
+#define EE_PROFILE_FUNCTION_RESOURCE() EE_PROFILE_ZONE( __FUNCTION__, Resource )
+#define EE_PROFILE_FUNCTION_NETWORK() EE_PROFILE_ZONE( __FUNCTION__, Network )
+#define EE_PROFILE_FUNCTION_DEVTOOLS() EE_PROFILE_ZONE( __FUNCTION__, DevTools )
+
+#define EE_PROFILE_SCOPE_AI( name ) EE_PROFILE_ZONE( name, AI )
+#define EE_PROFILE_SCOPE_ANIMATION( name ) EE_PROFILE_ZONE( name, Animation )
+#define EE_PROFILE_SCOPE_CAMERA( name) EE_PROFILE_ZONE( name, Camera )
+#define EE_PROFILE_SCOPE_GAMEPLAY( name) EE_PROFILE_ZONE( name, Gameplay )
+#define EE_PROFILE_SCOPE_IO( name ) EE_PROFILE_ZONE( name, IO )
+#define EE_PROFILE_SCOPE_NAVIGATION( name ) EE_PROFILE_ZONE( name, Navigation )
+#define EE_PROFILE_SCOPE_PHYSICS( name ) EE_PROFILE_ZONE( name, Physics )
+#define EE_PROFILE_SCOPE_RENDER( name ) EE_PROFILE_ZONE( name, Render )
+#define EE_PROFILE_SCOPE_ENTITY( name ) EE_PROFILE_ZONE( name, Entity )
+#define EE_PROFILE_SCOPE_RESOURCE( name ) EE_PROFILE_ZONE( name, Resource )
+#define EE_PROFILE_SCOPE_NETWORK( name ) EE_PROFILE_ZONE( name, Network )
+#define EE_PROFILE_SCOPE_DEVTOOLS( name ) EE_PROFILE_ZONE( name, DevTools )
+
+#else
+
 #define EE_PROFILE_THREAD_START( ThreadName ) OPTICK_START_THREAD( ThreadName )
 
 #define EE_PROFILE_THREAD_END() OPTICK_STOP_THREAD()
@@ -81,4 +161,6 @@ namespace EE
 #define EE_PROFILE_SCOPE_ENTITY( name ) OPTICK_EVENT( name, Optick::Category::Scene )
 #define EE_PROFILE_SCOPE_RESOURCE( name ) OPTICK_EVENT( name, Optick::Category::Streaming )
 #define EE_PROFILE_SCOPE_NETWORK( name ) OPTICK_EVENT( name, Optick::Category::Network )
-#define EE_PROFILE_SCOPE_DEVTOOLS( name ) OPTICK_EVENT( name, Optick::Category::Debug )
\ No newline at end of file
+#define EE_PROFILE_SCOPE_DEVTOOLS( name ) OPTICK_EVENT( name, Optick::Category::Debug )
+
+#endif
@@ -0,0 +1,510 @@
+#include "Profiling.h"
+
+#if EE_ENABLE_BUILTIN_PROFILER
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/FlatHashMap.h"
+#include "Base/Types/String.h"
+#include "Base/Memory/Memory.h"
+#include "Base/Time/Time.h"
+#include "Base/Math/Math.h"
+#include <EASTL/sort.h>
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Profiling
+{
+    namespace
+    {
+        // Packed into 24 bytes to keep the per-thread buffers small, the category is stored in the low bits of the duration
+        struct Zone
+        {
+            Zone() = default;
+
+            EE_FORCE_INLINE Zone( char const* pName, Category category, uint64_t startTime, uint64_t endTime )
+                : m_startTime( startTime )
+                , m_durationAndCategory( ( ( endTime - startTime ) << 8 ) | (uint8_t) category )
+                , m_pName( pName )
+            {}
+
+            EE_FORCE_INLINE uint64_t GetDuration() const { return m_durationAndCategory >> 8; }
+            EE_FORCE_INLINE Category GetCategory() const { return Category( m_durationAndCategory & 0xFF ); }
+
+            uint64_t                                m_startTime;
+            uint64_t                                m_durationAndCategory;      // Top 56 bits: duration in ticks, bottom 8 bits: category
+            char const*                             m_pName;
+        };
+
+        static_assert( sizeof( Zone ) == 24, "Zones should be kept small" );
+
+        // Single producer (the owning thread) single consumer (the main thread) ring buffer of completed zones
+        class ThreadZoneBuffer
+        {
+        public:
+
+            constexpr static uint64_t const s_capacity = 16 * 1024;
+
+        public:
+
+            ThreadZoneBuffer( uint32_t threadIdx )
+                : m_threadIdx( threadIdx )
+            {
+                m_pZones = (Zone*) EE::Alloc( sizeof( Zone ) * s_capacity, 64 );
+                Printf( m_name, 64, "Thread %u", threadIdx );
+            }
+
+            ~ThreadZoneBuffer()
+            {
+                EE::Free( (void*&) m_pZones );
+            }
+
+            // Producer
+            EE_FORCE_INLINE void Write( Zone const& zone )
+            {
+                uint64_t const writeIndex = m_writeIndex.load( std::memory_order_relaxed );
+                if ( writeIndex - m_cachedReadIndex >= s_capacity )
+                {
+                    // Only touch the consumer's cache line when we think the buffer is full
+                    m_cachedReadIndex = m_readIndex.load( std::memory_order_acquire );
+                    if ( writeIndex - m_cachedReadIndex >= s_capacity )
+                    {
+                        m_numDroppedZones.store( m_numDroppedZones.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+                        return;
+                    }
+                }
+
+                m_pZones[writeIndex & ( s_capacity - 1 )] = zone;
+                m_writeIndex.store( writeIndex + 1, std::memory_order_release );
+            }
+
+            // Consumer
+            template<typename Func>
+            void Drain( Func&& func )
+            {
+                uint64_t const writeIndex = m_writeIndex.load( std::memory_order_acquire );
+                uint64_t readIndex = m_readIndex.load( std::memory_order_relaxed );
+                for ( ; readIndex != writeIndex; readIndex++ )
+                {
+                    func( m_pZones[readIndex & ( s_capacity - 1 )] );
+                }
+
+                m_readIndex.store( readIndex, std::memory_order_release );
+            }
+
+            // Consumer - returns the number of zones dropped since the last call
+            uint64_t GetNewDroppedZoneCount()
+            {
+                uint64_t const numDropped = m_numDroppedZones.load( std::memory_order_relaxed );
+                uint64_t const numNew = numDropped - m_numReportedDroppedZones;
+                m_numReportedDroppedZones = numDropped;
+                return numNew;
+            }
+
+        public:
+
+            char                                    m_name[64];
+            uint32_t                                m_threadIdx = 0;
+
+        private:
+
+            Zone*                                   m_pZones = nullptr;
+            uint64_t                                m_numReportedDroppedZones = 0;
+            alignas( 64 ) std::atomic<uint64_t>     m_writeIndex = 0;
+            uint64_t                                m_cachedReadIndex = 0;
+            std::atomic<uint64_t>                   m_numDroppedZones = 0;
+            alignas( 64 ) std::atomic<uint64_t>     m_readIndex = 0;
+        };
+
+        //-------------------------------------------------------------------------
+
+        struct CapturedZone
+        {
+            Zone                                    m_zone;
+            uint32_t                                m_threadIdx;
+        };
+
+        struct CapturedFrame
+        {
+            uint64_t                                m_frameIndex;
+            uint64_t                                m_startTime;
+            uint64_t                                m_endTime;
+        };
+
+        constexpr static int32_t const s_maxThreads = 128;
+
+        struct ProfilerData
+        {
+            std::atomic<ThreadZoneBuffer*>          m_threadBuffers[s_maxThreads] = {};
+            std::atomic<int32_t>                    m_numThreadBuffers = 0;
+
+            // Converting timestamps to time, re-calibrated every frame against the platform clock
+            uint64_t                                m_calibrationTimestamp = 0;
+            uint64_t                                m_calibrationTime = 0;
+            double                                  m_millisecondsPerTick = 0.0;
+
+            // Frame summary
+            uint64_t                                m_frameIndex = 0;
+            uint64_t                                m_frameStartTime = 0;
+            TFlatHashMap<uintptr_t, int32_t>        m_frameZoneLookup;
+            FrameSummary                            m_frameSummary;
+            FrameSummary                            m_lastFrameSummary;
+
+            // Capture
+            TVector<CapturedZone>                   m_capturedZones;
+            TVector<CapturedFrame>                  m_capturedFrames;
+            uint64_t                                m_captureStartTime = 0;
+            uint64_t                                m_numCaptureDroppedZones = 0;
+            bool                                    m_isCapturing = false;
+        };
+
+        static ProfilerData*                        g_pProfiler = nullptr;
+        static thread_local ThreadZoneBuffer*       t_pThreadBuffer = nullptr;
+        static thread_local ProfilerData*           t_pThreadBufferOwner = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        // Returns nullptr if we have run out of buffer slots, zones from this thread will not be recorded
+        static ThreadZoneBuffer* GetThreadBuffer()
+        {
+            if ( t_pThreadBufferOwner != g_pProfiler )
+            {
+                t_pThreadBufferOwner = g_pProfiler;
+                t_pThreadBuffer = nullptr;
+
+                int32_t const slotIdx = g_pProfiler->m_numThreadBuffers.fetch_add( 1 );
+                EE_ASSERT( slotIdx < s_maxThreads );
+                if ( slotIdx < s_maxThreads )
+                {
+                    t_pThreadBuffer = EE::New<ThreadZoneBuffer>( uint32_t( slotIdx ) );
+                    g_pProfiler->m_threadBuffers[slotIdx].store( t_pThreadBuffer, std::memory_order_release );
+                }
+            }
+
+            return t_pThreadBuffer;
+        }
+
+        static void Calibrate()
+        {
+            uint64_t const timestamp = GetTimestamp();
+            uint64_t const time = PlatformClock::GetTime().ToU64();
+            if ( timestamp > g_pProfiler->m_calibrationTimestamp && time > g_pProfiler->m_calibrationTime )
+            {
+                g_pProfiler->m_millisecondsPerTick = double( time - g_pProfiler->m_calibrationTime ) / double( timestamp - g_pProfiler->m_calibrationTimestamp ) / 1000000.0;
+            }
+        }
+
+        EE_FORCE_INLINE static double TicksToMilliseconds( uint64_t ticks )
+        {
+            return double( ticks ) * g_pProfiler->m_millisecondsPerTick;
+        }
+
+        //-------------------------------------------------------------------------
+
+        static void AddToSummary( FrameSummary& summary, TFlatHashMap<uintptr_t, int32_t>& lookup, Zone const& zone )
+        {
+            auto result = lookup.try_emplace( reinterpret_cast<uintptr_t>( zone.m_pName ), (int32_t) summary.m_zones.size() );
+            if ( result.second )
+            {
+                ZoneSummary& newSummary = summary.m_zones.emplace_back();
+                newSummary.m_pName = zone.m_pName;
+                newSummary.m_category = zone.GetCategory();
+            }
+
+            ZoneSummary& zoneSummary = summary.m_zones[result.first->second];
+            float const zoneTime = (float) TicksToMilliseconds( zone.GetDuration() );
+            zoneSummary.m_numCalls++;
+            zoneSummary.m_totalTimeMS += zoneTime;
+            zoneSummary.m_maxTimeMS = Math::Max( zoneSummary.m_maxTimeMS, zoneTime );
+        }
+
+        static void SortSummary( FrameSummary& summary )
+        {
+            eastl::sort( summary.m_zones.begin(), summary.m_zones.end(), [] ( ZoneSummary const& a, ZoneSummary const& b ) { return a.m_totalTimeMS > b.m_totalTimeMS; } );
+        }
+
+        // Consume all recorded zones, adding them to the current frame summary and to the capture (if one is active)
+        static void DrainThreadBuffers()
+        {
+            int32_t const numThreadBuffers = Math::Min( g_pProfiler->m_numThreadBuffers.load( std::memory_order_acquire ), s_maxThreads );
+            for ( int32_t i = 0; i < numThreadBuffers; i++ )
+            {
+                // The slot might still be empty if the thread is currently registering
+                ThreadZoneBuffer* pBuffer = g_pProfiler->m_threadBuffers[i].load( std::memory_order_acquire );
+                if ( pBuffer == nullptr )
+                {
+                    continue;
+                }
+
+                pBuffer->Drain( [pBuffer] ( Zone const& zone )
+                {
+                    AddToSummary( g_pProfiler->m_frameSummary, g_pProfiler->m_frameZoneLookup, zone );
+
+                    // Only zones that are entirely inside the capture are kept
+                    if ( g_pProfiler->m_isCapturing && zone.m_startTime >= g_pProfiler->m_captureStartTime )
+                    {
+                        g_pProfiler->m_capturedZones.push_back( { zone, pBuffer->m_threadIdx } );
+                    }
+                } );
+
+                uint64_t const numDroppedZones = pBuffer->GetNewDroppedZoneCount();
+                g_pProfiler->m_frameSummary.m_numDroppedZones += numDroppedZones;
+                if ( g_pProfiler->m_isCapturing )
+                {
+                    g_pProfiler->m_numCaptureDroppedZones += numDroppedZones;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        static void AppendJsonString( String& outString, char const* pStr )
+        {
+            for ( char const* pChar = pStr; *pChar != 0; pChar++ )
+            {
+                if ( *pChar == '"' || *pChar == '\\' )
+                {
+                    outString += '\\';
+                }
+
+                outString += *pChar;
+            }
+        }
+
+        static void AppendCsvString( String& outString, char const* pStr )
+        {
+            outString += '"';
+            for ( char const* pChar = pStr; *pChar != 0; pChar++ )
+            {
+                if ( *pChar == '"' )
+                {
+                    outString += '"';
+                }
+
+                outString += *pChar;
+            }
+            outString += '"';
+        }
+
+        // Chrome trace event format (JSON object format), also supported by Perfetto
+        static void WriteChromeTrace( FileSystem::Path const& tracePath )
+        {
+            double const microsecondsPerTick = g_pProfiler->m_millisecondsPerTick * 1000.0;
+            auto ToMicroseconds = [=] ( uint64_t timestamp ) { return double( timestamp - g_pProfiler->m_captureStartTime ) * microsecondsPerTick; };
+
+            String trace;
+            trace.reserve( 128 + g_pProfiler->m_capturedZones.size() * 128 );
+            trace += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+            // Thread names, the frame markers use their own track (tid 0)
+            trace += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}";
+
+            int32_t const numThreadBuffers = Math::Min( g_pProfiler->m_numThreadBuffers.load( std::memory_order_acquire ), s_maxThreads );
+            for ( int32_t i = 0; i < numThreadBuffers; i++ )
+            {
+                ThreadZoneBuffer const* pBuffer = g_pProfiler->m_threadBuffers[i].load( std::memory_order_acquire );
+                if ( pBuffer != nullptr )
+                {
+                    trace.append_sprintf( ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"", pBuffer->m_threadIdx + 1 );
+                    AppendJsonString( trace, pBuffer->m_name );
+                    trace += "\"}}";
+                }
+            }
+
+            // Frames
+            for ( CapturedFrame const& frame : g_pProfiler->m_capturedFrames )
+            {
+                trace.append_sprintf( ",\n{\"name\":\"Frame %llu\",\"cat\":\"Frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f}", (unsigned long long) frame.m_frameIndex, ToMicroseconds( frame.m_startTime ), double( frame.m_endTime - frame.m_startTime ) * microsecondsPerTick );
+            }
+
+            // Zones
+            for ( CapturedZone const& capturedZone : g_pProfiler->m_capturedZones )
+            {
+                Zone const& zone = capturedZone.m_zone;
+                trace += ",\n{\"name\":\"";
+                AppendJsonString( trace, zone.m_pName );
+                trace.append_sprintf( "\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", GetCategoryName( zone.GetCategory() ), capturedZone.m_threadIdx + 1, ToMicroseconds( zone.m_startTime ), double( zone.GetDuration() ) * microsecondsPerTick );
+            }
+
+            trace += "\n]}\n";
+
+            if ( !FileSystem::WriteTextFile( tracePath.c_str(), trace ) )
+            {
+                EE_LOG_ERROR( "Profiling", "Capture", "Failed to write profiler capture: %s", tracePath.c_str() );
+            }
+        }
+
+        // Per zone totals over the whole capture
+        static void WriteCaptureSummary( FileSystem::Path const& summaryPath )
+        {
+            FrameSummary captureSummary;
+            TFlatHashMap<uintptr_t, int32_t> lookup;
+            for ( CapturedZone const& capturedZone : g_pProfiler->m_capturedZones )
+            {
+                AddToSummary( captureSummary, lookup, capturedZone.m_zone );
+            }
+            SortSummary( captureSummary );
+
+            float const numFrames = (float) Math::Max( g_pProfiler->m_capturedFrames.size(), size_t( 1 ) );
+
+            String summary;
+            summary.append_sprintf( "# Frames: %u, Dropped Zones: %llu\n", (uint32_t) g_pProfiler->m_capturedFrames.size(), (unsigned long long) g_pProfiler->m_numCaptureDroppedZones );
+            summary += "Zone,Category,Calls,Total (ms),Average Per Frame (ms),Max (ms)\n";
+            for ( ZoneSummary const& zoneSummary : captureSummary.m_zones )
+            {
+                AppendCsvString( summary, zoneSummary.m_pName );
+                summary.append_sprintf( ",%s,%u,%.4f,%.4f,%.4f\n", GetCategoryName( zoneSummary.m_category ), zoneSummary.m_numCalls, zoneSummary.m_totalTimeMS, zoneSummary.m_totalTimeMS / numFrames, zoneSummary.m_maxTimeMS );
+            }
+
+            if ( !FileSystem::WriteTextFile( summaryPath.c_str(), summary ) )
+            {
+                EE_LOG_ERROR( "Profiling", "Capture", "Failed to write profiler capture summary: %s", summaryPath.c_str() );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    char const* GetCategoryName( Category category )
+    {
+        static char const* const categoryNames[] = { "Default", "Wait", "AI", "Animation", "Camera", "Gameplay", "IO", "Navigation", "Physics", "Render", "Entity", "Resource", "Network", "DevTools" };
+        static_assert( sizeof( categoryNames ) / sizeof( categoryNames[0] ) == (size_t) Category::NumCategories, "Category names out of sync" );
+        EE_ASSERT( category < Category::NumCategories );
+        return categoryNames[(uint8_t) category];
+    }
+
+    FrameSummary const& GetLastFrameSummary()
+    {
+        EE_ASSERT( g_pProfiler != nullptr );
+        return g_pProfiler->m_lastFrameSummary;
+    }
+
+    void RecordZone( char const* pName, Category category, uint64_t startTime, uint64_t endTime )
+    {
+        if ( g_pProfiler == nullptr )
+        {
+            return;
+        }
+
+        ThreadZoneBuffer* pBuffer = ( t_pThreadBufferOwner == g_pProfiler ) ? t_pThreadBuffer : GetThreadBuffer();
+        if ( pBuffer != nullptr )
+        {
+            pBuffer->Write( Zone( pName, category, startTime, endTime ) );
+        }
+    }
+
+    void SetThreadName( char const* pName )
+    {
+        if ( g_pProfiler == nullptr )
+        {
+            return;
+        }
+
+        ThreadZoneBuffer* pBuffer = GetThreadBuffer();
+        if ( pBuffer != nullptr )
+        {
+            Printf( pBuffer->m_name, 64, "%s", pName );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace BuiltIn
+    {
+        void Initialize()
+        {
+            EE_ASSERT( g_pProfiler == nullptr );
+            g_pProfiler = EE::New<ProfilerData>();
+
+            // Get an initial estimate of the timestamp frequency, this is refined every frame
+            g_pProfiler->m_calibrationTimestamp = GetTimestamp();
+            g_pProfiler->m_calibrationTime = PlatformClock::GetTime().ToU64();
+            while ( PlatformClock::GetTime().ToU64() - g_pProfiler->m_calibrationTime < 1000000 ) {}
+            Calibrate();
+        }
+
+        void Shutdown()
+        {
+            EE_ASSERT( g_pProfiler != nullptr );
+
+            // All other threads should have stopped recording zones by now
+            int32_t const numThreadBuffers = Math::Min( g_pProfiler->m_numThreadBuffers.load(), s_maxThreads );
+            for ( int32_t i = 0; i < numThreadBuffers; i++ )
+            {
+                ThreadZoneBuffer* pBuffer = g_pProfiler->m_threadBuffers[i].load();
+                EE::Delete( pBuffer );
+            }
+
+            EE::Delete( g_pProfiler );
+        }
+
+        void StartFrame()
+        {
+            EE_ASSERT( g_pProfiler != nullptr );
+            g_pProfiler->m_frameStartTime = GetTimestamp();
+        }
+
+        void EndFrame()
+        {
+            EE_ASSERT( g_pProfiler != nullptr );
+            uint64_t const frameEndTime = GetTimestamp();
+
+            Calibrate();
+            DrainThreadBuffers();
+
+            if ( g_pProfiler->m_isCapturing )
+            {
+                g_pProfiler->m_capturedFrames.push_back( { g_pProfiler->m_frameIndex, g_pProfiler->m_frameStartTime, frameEndTime } );
+            }
+
+            // Publish the frame summary and reuse the previous summary's memory for the next frame
+            FrameSummary& summary = g_pProfiler->m_frameSummary;
+            summary.m_frameIndex = g_pProfiler->m_frameIndex;
+            summary.m_frameTimeMS = (float) TicksToMilliseconds( frameEndTime - g_pProfiler->m_frameStartTime );
+            SortSummary( summary );
+
+            eastl::swap( g_pProfiler->m_lastFrameSummary, summary );
+            summary.m_zones.clear();
+            summary.m_numDroppedZones = 0;
+            g_pProfiler->m_frameZoneLookup.clear();
+            g_pProfiler->m_frameIndex++;
+        }
+
+        void StartCapture()
+        {
+            EE_ASSERT( g_pProfiler != nullptr );
+            if ( g_pProfiler->m_isCapturing )
+            {
+                return;
+            }
+
+            g_pProfiler->m_capturedZones.clear();
+            g_pProfiler->m_capturedFrames.clear();
+            g_pProfiler->m_numCaptureDroppedZones = 0;
+            g_pProfiler->m_captureStartTime = GetTimestamp();
+            g_pProfiler->m_isCapturing = true;
+        }
+
+        void StopCapture( FileSystem::Path const& captureSavePath )
+        {
+            EE_ASSERT( g_pProfiler != nullptr );
+            if ( !g_pProfiler->m_isCapturing )
+            {
+                return;
+            }
+
+            Calibrate();
+            DrainThreadBuffers();
+            g_pProfiler->m_isCapturing = false;
+
+            WriteChromeTrace( captureSavePath );
+            WriteCaptureSummary( captureSavePath.GetWithAppendedExtension( "summary.csv" ) );
+
+            // Release the capture memory
+            g_pProfiler->m_capturedZones.set_capacity( 0 );
+            g_pProfiler->m_capturedFrames.set_capacity( 0 );
+        }
+    }
+}
+#endif
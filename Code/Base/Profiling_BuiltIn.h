@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Base/_Module/API.h"
+#include "Base/Types/Arrays.h"
+
+#if _WIN32
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+//-------------------------------------------------------------------------
+// Built-in Profiler
+//-------------------------------------------------------------------------
+// A minimal hierarchical CPU profiler that backs the EE_PROFILE_* macros when Optick isnt available (see Profiling.h)
+//
+// Each zone is recorded as a single event (start, end, name, category) into a lock-free per-thread ring buffer when the
+// zone scope ends. Timestamps are raw TSC values and are only converted to time when the events are consumed.
+// Zone names are identified by pointer, so they must be string literals (or otherwise have static lifetime).
+//
+// The main thread drains all the thread buffers at the end of each frame to build the frame summary and, while a capture
+// is active, to accumulate the captured zones. If a thread produces more zones than fit in its buffer between two frames,
+// the extra zones are dropped and counted.
+
+namespace EE::FileSystem { class Path; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::Profiling
+{
+    enum class Category : uint8_t
+    {
+        Default = 0,
+        Wait,
+        AI,
+        Animation,
+        Camera,
+        Gameplay,
+        IO,
+        Navigation,
+        Physics,
+        Render,
+        Entity,
+        Resource,
+        Network,
+        DevTools,
+
+        NumCategories
+    };
+
+    EE_BASE_API char const* GetCategoryName( Category category );
+
+    //-------------------------------------------------------------------------
+
+    struct ZoneSummary
+    {
+        char const*                     m_pName = nullptr;
+        Category                        m_category = Category::Default;
+        uint32_t                        m_numCalls = 0;
+        float                           m_totalTimeMS = 0.0f;
+        float                           m_maxTimeMS = 0.0f;
+    };
+
+    struct FrameSummary
+    {
+        uint64_t                        m_frameIndex = 0;
+        float                           m_frameTimeMS = 0.0f;
+        uint64_t                        m_numDroppedZones = 0;
+        TVector<ZoneSummary>            m_zones;                // Sorted by total time (descending)
+    };
+
+    // Returns the zones recorded during the last completed frame, only safe to call from the main thread
+    EE_BASE_API FrameSummary const& GetLastFrameSummary();
+
+    //-------------------------------------------------------------------------
+
+    EE_FORCE_INLINE uint64_t GetTimestamp() { return __rdtsc(); }
+
+    // Record a completed zone for the calling thread
+    EE_BASE_API void RecordZone( char const* pName, Category category, uint64_t startTime, uint64_t endTime );
+
+    // Set the display name for the calling thread, the name is copied
+    EE_BASE_API void SetThreadName( char const* pName );
+
+    //-------------------------------------------------------------------------
+
+    class [[nodiscard]] ScopedZone
+    {
+    public:
+
+        EE_FORCE_INLINE ScopedZone( char const* pName, Category category = Category::Default )
+            : m_pName( pName )
+            , m_startTime( GetTimestamp() )
+            , m_category( category )
+        {}
+
+        EE_FORCE_INLINE ~ScopedZone()
+        {
+            RecordZone( m_pName, m_category, m_startTime, GetTimestamp() );
+        }
+
+    private:
+
+        ScopedZone( ScopedZone const& ) = delete;
+        ScopedZone& operator=( ScopedZone const& ) = delete;
+
+    private:
+
+        char const*                     m_pName;
+        uint64_t                        m_startTime;
+        Category                        m_category;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Backend implementation for the functions in Profiling.h
+    namespace BuiltIn
+    {
+        void Initialize();
+        void Shutdown();
+
+        void StartFrame();
+        void EndFrame();
+
+        void StartCapture();
+        void StopCapture( FileSystem::Path const& captureSavePath );
+    }
+}
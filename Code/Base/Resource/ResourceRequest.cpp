@@ -1,6 +1,8 @@
 #include "ResourceRequest.h"
 #include "Base/FileSystem/FileSystem.h"
 #include "Base/Profiling.h"
+#include "Base/Telemetry/PerformanceCounters.h"
+#include "Base/Time/Timers.h"
 #include "Base/Threading/Threading.h"
 
 
@@ -8,6 +10,13 @@
 
 namespace EE::Resource
 {
+    namespace
+    {
+        static Telemetry::HistogramCounter const g_loadTimeCounter( "Resource/Load Time (ms)", 0.25f );
+    }
+
+    //-------------------------------------------------------------------------
+
     ResourceRequest::ResourceRequest( ResourceRequesterID const& requesterID, Type type, ResourceRecord* pRecord, ResourceLoader* pResourceLoader )
         : m_requesterID( requesterID )
         , m_pResourceRecord( pRecord )
@@ -288,7 +297,15 @@ namespace EE::Resource
             EE_PROFILE_TAG( "Loader", resTypeID );
             #endif
 
-            if ( !m_pResourceLoader->Load( GetResourceID(), m_rawResourcePath, m_pResourceRecord ) )
+            bool loadSucceeded = false;
+            Milliseconds loadTime = 0;
+            {
+                ScopedTimer<PlatformClock> loadTimer( loadTime );
+                loadSucceeded = m_pResourceLoader->Load( GetResourceID(), m_rawResourcePath, m_pResourceRecord );
+            }
+            g_loadTimeCounter.AddSample( loadTime.ToFloat() );
+
+            if ( !loadSucceeded )
             {
                 EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load compiled resource data (%s)", m_pResourceRecord->GetResourceID().c_str() );
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
@@ -2,11 +2,22 @@
 #include "ResourceProvider.h"
 #include "ResourceRequest.h"
 #include "Base/Profiling.h"
+#include "Base/Telemetry/PerformanceCounters.h"
+#include "Base/Memory/MemoryTags.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Resource
 {
+    namespace
+    {
+        static Telemetry::Counter const g_completedLoadsCounter( "Resource/Loads Completed" );
+        static Telemetry::Counter const g_completedUnloadsCounter( "Resource/Unloads Completed" );
+        static Telemetry::GaugeCounter g_activeRequestsCounter( "Resource/Active Requests" );
+    }
+
+    //-------------------------------------------------------------------------
+
     ResourceSystem::ResourceSystem( TaskSystem& taskSystem )
         : m_taskSystem( taskSystem )
         , m_asyncProcessingTask( [this] ( TaskSetPartition range, uint32_t threadnum ) { ProcessResourceRequests(); } )
@@ -254,6 +265,7 @@ namespace EE::Resource
 
     void ResourceSystem::Update( bool waitForAsyncTask )
     {
+        EE_MEMORY_TAG_SCOPE( Resources );
         EE_PROFILE_FUNCTION_RESOURCE();
         EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( m_pResourceProvider != nullptr );
@@ -352,6 +364,8 @@ namespace EE::Resource
                 ResourceID const resourceID = pCompletedRequest->GetResourceID();
                 EE_ASSERT( pCompletedRequest->IsComplete() );
 
+                ( pCompletedRequest->IsLoadRequest() ? g_completedLoadsCounter : g_completedUnloadsCounter ).Add();
+
                 #if EE_DEVELOPMENT_TOOLS
                 m_history.emplace_back( CompletedRequestLog( pCompletedRequest->IsLoadRequest() ? PendingRequest::Type::Load : PendingRequest::Type::Unload, resourceID ) );
                 #endif
@@ -380,6 +394,8 @@ namespace EE::Resource
         // Kick off new async task
         //-------------------------------------------------------------------------
 
+        g_activeRequestsCounter.Set( (float) m_activeRequests.size() );
+
         if ( !m_activeRequests.empty() )
         {
             m_taskSystem.ScheduleTask( &m_asyncProcessingTask );
@@ -397,6 +413,7 @@ namespace EE::Resource
 
     void ResourceSystem::ProcessResourceRequests()
     {
+        EE_MEMORY_TAG_SCOPE( Resources );
         EE_PROFILE_FUNCTION_RESOURCE();
 
         //-------------------------------------------------------------------------
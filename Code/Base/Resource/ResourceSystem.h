@@ -8,6 +8,7 @@
 #include "Base/Types/Event.h"
 #include "Base/Time/TimeStamp.h"
 #include "Base/Types/HashMap.h"
+#include "Base/Types/FlatHashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -145,7 +146,7 @@ namespace EE::Resource
         TaskSystem&                                             m_taskSystem;
         ResourceProvider*                                       m_pResourceProvider = nullptr;
         THashMap<ResourceTypeID, ResourceLoader*>               m_resourceLoaders;
-        THashMap<ResourceID, ResourceRecord*>                   m_resourceRecords;
+        TFlatHashMap<ResourceID, ResourceRecord*>               m_resourceRecords;
         mutable Threading::RecursiveMutex                       m_accessLock;
 
         // Requests
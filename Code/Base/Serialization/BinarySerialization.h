@@ -341,7 +341,6 @@ namespace EE::Serialization
             //-------------------------------------------------------------------------
             // This is needed so we dont serialize it as an array
 
-            template<>
             Archive& operator<<( Blob& blob )
             {
                 if constexpr ( std::is_same<Serializer, BinaryReader>::value )
@@ -356,7 +355,6 @@ namespace EE::Serialization
                 return *this;
             }
 
-            template<>
             Archive& operator<<( Blob const& blob )
             {
                 return operator<<( const_cast<Blob&>( blob ) );
@@ -0,0 +1,542 @@
+#include "PerformanceCounters.h"
+#include "Base/FileSystem/FileStreams.h"
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/String.h"
+#include "Base/Memory/Memory.h"
+#include "Base/Math/Math.h"
+#include <EASTL/sort.h>
+#include <bit>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Telemetry
+{
+    namespace
+    {
+        constexpr static int32_t const s_maxThreadSlots = 128;
+        constexpr static int32_t const s_maxCounterSlots = 256;
+        constexpr static int32_t const s_historyLength = 600;
+        constexpr static int32_t const s_recordingFlushInterval = 60;
+
+        // Counters that dont fit write into the discard slots at the end, these are never read
+        struct alignas( 64 ) ThreadCounterSlots
+        {
+            std::atomic<uint64_t>                   m_slots[s_maxCounterSlots + HistogramCounter::NumSlots];
+        };
+
+        static ThreadCounterSlots                   g_threadSlots[s_maxThreadSlots];
+        static std::atomic<int32_t>                 g_numThreadSlots = 0;
+        static thread_local ThreadCounterSlots*     t_pThreadSlots = nullptr;
+
+        // Registration, only modified during static init/shutdown of modules
+        static CounterBase*                         g_pFirstCounter = nullptr;
+        static int32_t                              g_numAllocatedCounterSlots = 0;
+        static uint32_t                             g_registrationVersion = 0;
+
+        //-------------------------------------------------------------------------
+
+        enum class ColumnValue : uint8_t
+        {
+            Value,
+            SampleCount,
+            SampleMean,
+            SampleP50,
+            SampleP95,
+            SampleMax,
+        };
+
+        struct Column
+        {
+            CounterBase const*                      m_pCounter = nullptr;
+            String                                  m_name;
+            ColumnValue                             m_value = ColumnValue::Value;
+        };
+
+        //-------------------------------------------------------------------------
+
+        static void AppendCsvString( String& outString, char const* pString )
+        {
+            outString += '"';
+            for ( char const* pChar = pString; *pChar != 0; pChar++ )
+            {
+                if ( *pChar == '"' )
+                {
+                    outString += '"';
+                }
+                outString += *pChar;
+            }
+            outString += '"';
+        }
+
+        static void AppendJsonString( String& outString, char const* pString )
+        {
+            outString += '"';
+            for ( char const* pChar = pString; *pChar != 0; pChar++ )
+            {
+                if ( *pChar == '"' || *pChar == '\\' )
+                {
+                    outString += '\\';
+                }
+                outString += ( uint8_t( *pChar ) < 0x20 ) ? ' ' : *pChar;
+            }
+            outString += '"';
+        }
+
+        // Estimate a percentile from the bucket counts, assuming a uniform distribution within each bucket
+        static float EstimatePercentile( HistogramCounter const* pHistogram, uint64_t const* pBucketCounts, uint64_t numSamples, float maxSample, float percentile )
+        {
+            if ( numSamples == 0 )
+            {
+                return 0.0f;
+            }
+
+            float const targetRank = percentile * numSamples;
+            uint64_t cumulativeCount = 0;
+            for ( int32_t i = 0; i < HistogramCounter::s_numBuckets; i++ )
+            {
+                if ( pBucketCounts[i] == 0 )
+                {
+                    continue;
+                }
+
+                if ( float( cumulativeCount + pBucketCounts[i] ) >= targetRank )
+                {
+                    float const lowerBound = pHistogram->GetBucketLowerBound( i );
+                    float const upperBound = ( i == HistogramCounter::s_numBuckets - 1 ) ? maxSample : Math::Min( pHistogram->GetBucketLowerBound( i + 1 ), maxSample );
+                    float const t = ( targetRank - cumulativeCount ) / pBucketCounts[i];
+                    return Math::Min( lowerBound + ( upperBound - lowerBound ) * t, maxSample );
+                }
+
+                cumulativeCount += pBucketCounts[i];
+            }
+
+            return maxSample;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    struct TelemetryData
+    {
+        void RebuildLayout()
+        {
+            m_columns.clear();
+
+            TInlineVector<CounterBase*, 64> counters;
+            for ( CounterBase* pCounter = g_pFirstCounter; pCounter != nullptr; pCounter = pCounter->m_pNext )
+            {
+                pCounter->m_firstColumnIdx = InvalidIndex;
+                if ( pCounter->m_isValid )
+                {
+                    counters.emplace_back( pCounter );
+                }
+            }
+
+            eastl::sort( counters.begin(), counters.end(), [] ( CounterBase const* pA, CounterBase const* pB ) { return strcmp( pA->m_pName, pB->m_pName ) < 0; } );
+
+            for ( CounterBase* pCounter : counters )
+            {
+                pCounter->m_firstColumnIdx = (int32_t) m_columns.size();
+
+                if ( pCounter->m_type == CounterType::Histogram )
+                {
+                    m_columns.push_back( { pCounter, String( String::CtorSprintf(), "%s (count)", pCounter->m_pName ), ColumnValue::SampleCount } );
+                    m_columns.push_back( { pCounter, String( String::CtorSprintf(), "%s (mean)", pCounter->m_pName ), ColumnValue::SampleMean } );
+                    m_columns.push_back( { pCounter, String( String::CtorSprintf(), "%s (p50)", pCounter->m_pName ), ColumnValue::SampleP50 } );
+                    m_columns.push_back( { pCounter, String( String::CtorSprintf(), "%s (p95)", pCounter->m_pName ), ColumnValue::SampleP95 } );
+                    m_columns.push_back( { pCounter, String( String::CtorSprintf(), "%s (max)", pCounter->m_pName ), ColumnValue::SampleMax } );
+                }
+                else
+                {
+                    m_columns.push_back( { pCounter, String( pCounter->m_pName ), ColumnValue::Value } );
+                }
+            }
+
+            // The history is only meaningful for a fixed set of columns
+            int32_t const numColumns = (int32_t) m_columns.size();
+            m_frameValues.clear();
+            m_frameValues.resize( numColumns, 0.0f );
+            m_history.clear();
+            m_history.resize( numColumns * s_historyLength, 0.0f );
+            m_numHistoryFrames = 0;
+            m_historyFrameIdx = 0;
+
+            m_layoutVersion = g_registrationVersion;
+            m_headerWritten = false;
+        }
+
+        // Sum the slot totals over all threads and convert them into the per-frame deltas
+        void GatherSlotValues()
+        {
+            int32_t const numThreadSlots = Math::Min( g_numThreadSlots.load( std::memory_order_relaxed ), s_maxThreadSlots );
+
+            uint64_t totals[s_maxCounterSlots] = {};
+            for ( int32_t threadSlotIdx = 0; threadSlotIdx < numThreadSlots; threadSlotIdx++ )
+            {
+                ThreadCounterSlots& threadSlots = g_threadSlots[threadSlotIdx];
+                for ( int32_t i = 0; i < g_numAllocatedCounterSlots; i++ )
+                {
+                    totals[i] += threadSlots.m_slots[i].load( std::memory_order_relaxed );
+                }
+            }
+
+            // Histogram maximums arent running totals, so they are reset for each frame
+            for ( Column const& column : m_columns )
+            {
+                if ( column.m_value == ColumnValue::SampleMax )
+                {
+                    int32_t const slotIdx = column.m_pCounter->m_firstSlotIdx + HistogramCounter::SampleMax;
+                    uint64_t maxSampleBits = 0;
+                    for ( int32_t threadSlotIdx = 0; threadSlotIdx < numThreadSlots; threadSlotIdx++ )
+                    {
+                        maxSampleBits = Math::Max( maxSampleBits, g_threadSlots[threadSlotIdx].m_slots[slotIdx].exchange( 0, std::memory_order_relaxed ) );
+                    }
+                    totals[slotIdx] = maxSampleBits;
+                    m_previousTotals[slotIdx] = 0;
+                }
+            }
+
+            for ( int32_t i = 0; i < g_numAllocatedCounterSlots; i++ )
+            {
+                m_slotValues[i] = totals[i] - m_previousTotals[i];
+                m_previousTotals[i] = totals[i];
+            }
+        }
+
+        void UpdateFrameValues()
+        {
+            int32_t const numColumns = (int32_t) m_columns.size();
+            for ( int32_t columnIdx = 0; columnIdx < numColumns; columnIdx++ )
+            {
+                Column const& column = m_columns[columnIdx];
+                uint64_t const* pSlotValues = &m_slotValues[column.m_pCounter->m_firstSlotIdx];
+
+                float value = 0.0f;
+                switch ( column.m_value )
+                {
+                    case ColumnValue::Value:
+                    {
+                        switch ( column.m_pCounter->m_type )
+                        {
+                            case CounterType::Count: value = float( pSlotValues[0] ); break;
+                            case CounterType::Time: value = Nanoseconds( pSlotValues[0] ).ToMilliseconds().ToFloat(); break;
+                            case CounterType::Gauge: value = static_cast<GaugeCounter const*>( column.m_pCounter )->Get(); break;
+                            default: EE_UNREACHABLE_CODE(); break;
+                        }
+                    }
+                    break;
+
+                    case ColumnValue::SampleCount:
+                    {
+                        value = float( pSlotValues[HistogramCounter::SampleCount] );
+                    }
+                    break;
+
+                    case ColumnValue::SampleMean:
+                    {
+                        uint64_t const numSamples = pSlotValues[HistogramCounter::SampleCount];
+                        value = ( numSamples > 0 ) ? float( double( pSlotValues[HistogramCounter::SampleSum] ) / HistogramCounter::s_sumScale / numSamples ) : 0.0f;
+                    }
+                    break;
+
+                    case ColumnValue::SampleP50:
+                    case ColumnValue::SampleP95:
+                    {
+                        auto pHistogram = static_cast<HistogramCounter const*>( column.m_pCounter );
+                        float const maxSample = std::bit_cast<float>( (uint32_t) pSlotValues[HistogramCounter::SampleMax] );
+                        float const percentile = ( column.m_value == ColumnValue::SampleP50 ) ? 0.5f : 0.95f;
+                        value = EstimatePercentile( pHistogram, &pSlotValues[HistogramCounter::FirstBucket], pSlotValues[HistogramCounter::SampleCount], maxSample, percentile );
+                    }
+                    break;
+
+                    case ColumnValue::SampleMax:
+                    {
+                        value = std::bit_cast<float>( (uint32_t) pSlotValues[HistogramCounter::SampleMax] );
+                    }
+                    break;
+                }
+
+                m_frameValues[columnIdx] = value;
+                m_history[columnIdx * s_historyLength + m_historyFrameIdx] = value;
+            }
+
+            m_historyFrameIdx = ( m_historyFrameIdx + 1 ) % s_historyLength;
+            m_numHistoryFrames = Math::Min( m_numHistoryFrames + 1, s_historyLength );
+        }
+
+        void WriteRecordingLine()
+        {
+            EE_ASSERT( m_pRecordingStream != nullptr );
+
+            m_recordingLine.clear();
+
+            if ( m_isRecordingJson )
+            {
+                m_recordingLine.append_sprintf( "{\"frame\":%llu", (unsigned long long) m_frameIndex );
+                for ( int32_t i = 0; i < (int32_t) m_columns.size(); i++ )
+                {
+                    m_recordingLine += ',';
+                    AppendJsonString( m_recordingLine, m_columns[i].m_name.c_str() );
+                    m_recordingLine.append_sprintf( ":%g", m_frameValues[i] );
+                }
+                m_recordingLine += "}\n";
+            }
+            else
+            {
+                if ( !m_headerWritten )
+                {
+                    m_recordingLine += "Frame";
+                    for ( Column const& column : m_columns )
+                    {
+                        m_recordingLine += ',';
+                        AppendCsvString( m_recordingLine, column.m_name.c_str() );
+                    }
+                    m_recordingLine += '\n';
+                    m_headerWritten = true;
+                }
+
+                m_recordingLine.append_sprintf( "%llu", (unsigned long long) m_frameIndex );
+                for ( float value : m_frameValues )
+                {
+                    m_recordingLine.append_sprintf( ",%g", value );
+                }
+                m_recordingLine += '\n';
+            }
+
+            m_pRecordingStream->Write( m_recordingLine.data(), m_recordingLine.size() );
+
+            if ( ( ++m_numRecordedFrames % s_recordingFlushInterval ) == 0 )
+            {
+                m_pRecordingStream->GetStream().flush();
+            }
+        }
+
+    public:
+
+        TVector<Column>                             m_columns;
+        TVector<float>                              m_frameValues;
+        TVector<float>                              m_history;
+        uint64_t                                    m_previousTotals[s_maxCounterSlots] = {};
+        uint64_t                                    m_slotValues[s_maxCounterSlots] = {};
+        uint64_t                                    m_frameIndex = 0;
+        int32_t                                     m_historyFrameIdx = 0;
+        int32_t                                     m_numHistoryFrames = 0;
+        uint32_t                                    m_layoutVersion = 0xFFFFFFFF;
+
+        // Recording
+        FileSystem::OutputFileStream*               m_pRecordingStream = nullptr;
+        String                                      m_recordingLine;
+        uint64_t                                    m_numRecordedFrames = 0;
+        bool                                        m_isRecordingJson = false;
+        bool                                        m_headerWritten = false;
+    };
+
+    static TelemetryData* g_pTelemetry = nullptr;
+
+    //-------------------------------------------------------------------------
+
+    std::atomic<uint64_t>* Internal::GetThreadSlots()
+    {
+        if ( t_pThreadSlots == nullptr )
+        {
+            int32_t const slotIdx = g_numThreadSlots.fetch_add( 1, std::memory_order_relaxed );
+            t_pThreadSlots = &g_threadSlots[( slotIdx < s_maxThreadSlots ) ? slotIdx : s_maxThreadSlots - 1];
+        }
+
+        return t_pThreadSlots->m_slots;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CounterBase::CounterBase( char const* pName, CounterType type, int32_t numSlots )
+        : m_pName( pName )
+        , m_numSlots( numSlots )
+        , m_type( type )
+    {
+        EE_ASSERT( pName != nullptr && numSlots >= 0 && numSlots <= HistogramCounter::NumSlots );
+
+        if ( g_numAllocatedCounterSlots + numSlots <= s_maxCounterSlots )
+        {
+            m_firstSlotIdx = g_numAllocatedCounterSlots;
+            g_numAllocatedCounterSlots += numSlots;
+        }
+        else
+        {
+            EE_HALT(); // Increase the max number of counter slots!
+            m_firstSlotIdx = s_maxCounterSlots;
+            m_isValid = false;
+        }
+
+        m_pNext = g_pFirstCounter;
+        g_pFirstCounter = this;
+        g_registrationVersion++;
+    }
+
+    CounterBase::~CounterBase()
+    {
+        // Slots are not reused, counters are expected to live for the duration of the application
+        CounterBase** ppCounter = &g_pFirstCounter;
+        while ( *ppCounter != nullptr )
+        {
+            if ( *ppCounter == this )
+            {
+                *ppCounter = m_pNext;
+                g_registrationVersion++;
+                break;
+            }
+
+            ppCounter = &( *ppCounter )->m_pNext;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    HistogramCounter::HistogramCounter( char const* pName, float firstBucketLimit )
+        : CounterBase( pName, CounterType::Histogram, NumSlots )
+        , m_firstBucketLimit( firstBucketLimit )
+    {
+        EE_ASSERT( firstBucketLimit > 0.0f );
+    }
+
+    void HistogramCounter::AddSample( float value ) const
+    {
+        value = Math::Max( value, 0.0f );
+
+        int32_t bucketIdx = 0;
+        if ( value >= m_firstBucketLimit )
+        {
+            int32_t exponent = 0;
+            frexpf( value / m_firstBucketLimit, &exponent );
+            bucketIdx = Math::Min( exponent, s_numBuckets - 1 );
+        }
+
+        std::atomic<uint64_t>* pSlots = Internal::GetThreadSlots() + m_firstSlotIdx;
+        pSlots[SampleCount].fetch_add( 1, std::memory_order_relaxed );
+        pSlots[SampleSum].fetch_add( uint64_t( value * s_sumScale ), std::memory_order_relaxed );
+        pSlots[FirstBucket + bucketIdx].fetch_add( 1, std::memory_order_relaxed );
+
+        // Positive floats order the same as their bit patterns, the main thread resets the max each frame so we need a CAS
+        uint64_t const valueBits = std::bit_cast<uint32_t>( value );
+        uint64_t currentMax = pSlots[SampleMax].load( std::memory_order_relaxed );
+        while ( valueBits > currentMax && !pSlots[SampleMax].compare_exchange_weak( currentMax, valueBits, std::memory_order_relaxed ) ) {}
+    }
+
+    //-------------------------------------------------------------------------
+
+    void Initialize()
+    {
+        EE_ASSERT( g_pTelemetry == nullptr );
+        g_pTelemetry = EE::New<TelemetryData>();
+    }
+
+    void Shutdown()
+    {
+        EE_ASSERT( g_pTelemetry != nullptr );
+        StopRecording();
+        EE::Delete( g_pTelemetry );
+    }
+
+    void EndFrame()
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+        EE_ASSERT( g_pTelemetry != nullptr );
+
+        if ( g_pTelemetry->m_layoutVersion != g_registrationVersion )
+        {
+            g_pTelemetry->RebuildLayout();
+        }
+
+        g_pTelemetry->GatherSlotValues();
+        g_pTelemetry->UpdateFrameValues();
+
+        if ( g_pTelemetry->m_pRecordingStream != nullptr )
+        {
+            g_pTelemetry->WriteRecordingLine();
+        }
+
+        g_pTelemetry->m_frameIndex++;
+    }
+
+    int32_t GetNumColumns()
+    {
+        EE_ASSERT( g_pTelemetry != nullptr );
+        return (int32_t) g_pTelemetry->m_columns.size();
+    }
+
+    char const* GetColumnName( int32_t columnIdx )
+    {
+        EE_ASSERT( g_pTelemetry != nullptr );
+        EE_ASSERT( columnIdx >= 0 && columnIdx < GetNumColumns() );
+        return g_pTelemetry->m_columns[columnIdx].m_name.c_str();
+    }
+
+    CounterBase const* GetColumnCounter( int32_t columnIdx )
+    {
+        EE_ASSERT( g_pTelemetry != nullptr );
+        EE_ASSERT( columnIdx >= 0 && columnIdx < GetNumColumns() );
+        return g_pTelemetry->m_columns[columnIdx].m_pCounter;
+    }
+
+    float GetLastFrameValue( int32_t columnIdx )
+    {
+        EE_ASSERT( g_pTelemetry != nullptr );
+        EE_ASSERT( columnIdx >= 0 && columnIdx < GetNumColumns() );
+        return g_pTelemetry->m_frameValues[columnIdx];
+    }
+
+    void GetHistory( int32_t columnIdx, TVector<float>& outValues )
+    {
+        EE_ASSERT( g_pTelemetry != nullptr );
+        EE_ASSERT( columnIdx >= 0 && columnIdx < GetNumColumns() );
+
+        int32_t const numFrames = g_pTelemetry->m_numHistoryFrames;
+        int32_t const firstFrameIdx = ( g_pTelemetry->m_historyFrameIdx - numFrames + s_historyLength ) % s_historyLength;
+        float const* pColumnHistory = &g_pTelemetry->m_history[columnIdx * s_historyLength];
+
+        outValues.resize( numFrames );
+        for ( int32_t i = 0; i < numFrames; i++ )
+        {
+            outValues[i] = pColumnHistory[( firstFrameIdx + i ) % s_historyLength];
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool StartRecording( FileSystem::Path const& filePath )
+    {
+        EE_ASSERT( g_pTelemetry != nullptr );
+        EE_ASSERT( filePath.IsValid() && filePath.IsFilePath() );
+
+        StopRecording();
+
+        g_pTelemetry->m_pRecordingStream = EE::New<FileSystem::OutputFileStream>( filePath );
+        if ( !g_pTelemetry->m_pRecordingStream->IsValid() )
+        {
+            EE::Delete( g_pTelemetry->m_pRecordingStream );
+            return false;
+        }
+
+        g_pTelemetry->m_isRecordingJson = filePath.MatchesExtension( "json" );
+        g_pTelemetry->m_headerWritten = false;
+        g_pTelemetry->m_numRecordedFrames = 0;
+        return true;
+    }
+
+    void StopRecording()
+    {
+        EE_ASSERT( g_pTelemetry != nullptr );
+
+        if ( g_pTelemetry->m_pRecordingStream != nullptr )
+        {
+            g_pTelemetry->m_pRecordingStream->Close();
+            EE::Delete( g_pTelemetry->m_pRecordingStream );
+        }
+    }
+
+    bool IsRecording()
+    {
+        EE_ASSERT( g_pTelemetry != nullptr );
+        return g_pTelemetry->m_pRecordingStream != nullptr;
+    }
+}
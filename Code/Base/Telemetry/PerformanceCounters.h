@@ -0,0 +1,213 @@
+#pragma once
+
+#include "Base/_Module/API.h"
+#include "Base/Types/Arrays.h"
+#include "Base/Time/Time.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+// Performance Counters
+//-------------------------------------------------------------------------
+// Named, typed counters for per-frame telemetry (e.g. entities updated, resources loaded, stage times)
+//
+// Counters are declared as namespace scope statics and register themselves on construction (registration is not thread
+// safe, so dont create counters at runtime). Each thread accumulates into its own counter slots and the slot totals only
+// ever grow, so the main thread derives the per-frame values at the end of the frame without synchronizing with the
+// producers, the same scheme as the memory tag stats. Threads beyond the slot count share the last slot.
+//
+// The per-frame values are kept in a rolling history (used by the debug UI) and can be streamed to a file for automated
+// performance runs. Each counter produces one or more value columns:
+//  * Counter           - The sum of the values added during the frame
+//  * TimeCounter       - The sum of the times added during the frame (in milliseconds)
+//  * GaugeCounter      - The last value set
+//  * HistogramCounter  - The distribution of the samples added during the frame (count, mean, p50, p95, max)
+
+namespace EE::FileSystem { class Path; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::Telemetry
+{
+    enum class CounterType : uint8_t
+    {
+        Count,
+        Time,
+        Gauge,
+        Histogram,
+    };
+
+    namespace Internal
+    {
+        // Get the calling thread's counter slots
+        EE_BASE_API std::atomic<uint64_t>* GetThreadSlots();
+    }
+
+    //-------------------------------------------------------------------------
+
+    class EE_BASE_API CounterBase
+    {
+        friend struct TelemetryData;
+
+    public:
+
+        CounterBase( char const* pName, CounterType type, int32_t numSlots );
+        ~CounterBase();
+
+        inline char const* GetName() const { return m_pName; }
+        inline CounterType GetType() const { return m_type; }
+
+        // The index of the first value column for this counter, only valid after the first frame has ended
+        inline int32_t GetFirstColumnIndex() const { return m_firstColumnIdx; }
+
+    protected:
+
+        CounterBase( CounterBase const& ) = delete;
+        CounterBase& operator=( CounterBase const& ) = delete;
+
+        EE_FORCE_INLINE void AddToSlot( int32_t slotOffset, uint64_t value ) const
+        {
+            Internal::GetThreadSlots()[m_firstSlotIdx + slotOffset].fetch_add( value, std::memory_order_relaxed );
+        }
+
+    protected:
+
+        char const*                     m_pName = nullptr;      // Must have static lifetime
+        CounterBase*                    m_pNext = nullptr;
+        int32_t                         m_firstSlotIdx = 0;
+        int32_t                         m_numSlots = 0;
+        int32_t                         m_firstColumnIdx = InvalidIndex;
+        CounterType                     m_type;
+        bool                            m_isValid = true;       // Counters are invalid if we ran out of slots
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_BASE_API Counter final : public CounterBase
+    {
+    public:
+
+        explicit Counter( char const* pName ) : CounterBase( pName, CounterType::Count, 1 ) {}
+
+        EE_FORCE_INLINE void Add( uint64_t value = 1 ) const { AddToSlot( 0, value ); }
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_BASE_API TimeCounter final : public CounterBase
+    {
+    public:
+
+        explicit TimeCounter( char const* pName ) : CounterBase( pName, CounterType::Time, 1 ) {}
+
+        EE_FORCE_INLINE void AddTime( Nanoseconds time ) const { AddToSlot( 0, time.ToU64() ); }
+        EE_FORCE_INLINE void AddTime( Milliseconds time ) const { AddTime( time.ToNanoseconds() ); }
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_BASE_API GaugeCounter final : public CounterBase
+    {
+    public:
+
+        explicit GaugeCounter( char const* pName ) : CounterBase( pName, CounterType::Gauge, 0 ) {}
+
+        EE_FORCE_INLINE void Set( float value ) { m_value.store( value, std::memory_order_relaxed ); }
+        EE_FORCE_INLINE float Get() const { return m_value.load( std::memory_order_relaxed ); }
+
+    private:
+
+        std::atomic<float>              m_value = 0.0f;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Samples are expected to be positive, negative samples are clamped to zero
+    // The buckets grow exponentially: [0, L), [L, 2L), [2L, 4L) ... where L is the first bucket limit
+    class EE_BASE_API HistogramCounter final : public CounterBase
+    {
+    public:
+
+        constexpr static int32_t const s_numBuckets = 16;
+
+        enum SlotOffset : int32_t
+        {
+            SampleCount = 0,
+            SampleSum,                  // Fixed point, see s_sumScale
+            SampleMax,                  // Float bits, reset every frame
+            FirstBucket,
+
+            NumSlots = FirstBucket + s_numBuckets
+        };
+
+        constexpr static float const s_sumScale = 1000.0f;
+
+    public:
+
+        HistogramCounter( char const* pName, float firstBucketLimit );
+
+        void AddSample( float value ) const;
+
+        inline float GetFirstBucketLimit() const { return m_firstBucketLimit; }
+
+        // Get the lower bound of a bucket, the upper bound is the lower bound of the next bucket
+        inline float GetBucketLowerBound( int32_t bucketIdx ) const { return ( bucketIdx == 0 ) ? 0.0f : m_firstBucketLimit * float( 1u << ( bucketIdx - 1 ) ); }
+
+    private:
+
+        float                           m_firstBucketLimit;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class [[nodiscard]] ScopedTimeCounter
+    {
+    public:
+
+        EE_FORCE_INLINE explicit ScopedTimeCounter( TimeCounter const& counter ) : m_counter( counter ), m_startTime( PlatformClock::GetTime() ) {}
+        EE_FORCE_INLINE ~ScopedTimeCounter() { m_counter.AddTime( Nanoseconds( PlatformClock::GetTime().ToU64() - m_startTime.ToU64() ) ); }
+
+        ScopedTimeCounter( ScopedTimeCounter const& ) = delete;
+        ScopedTimeCounter& operator=( ScopedTimeCounter const& ) = delete;
+
+    private:
+
+        TimeCounter const&              m_counter;
+        Nanoseconds                     m_startTime;
+    };
+
+    //-------------------------------------------------------------------------
+    // Frame Values
+    //-------------------------------------------------------------------------
+    // Only call these from the main thread
+
+    EE_BASE_API void Initialize();
+    EE_BASE_API void Shutdown();
+
+    // Gathers the per-thread counters into the frame values, adds them to the history and writes them to the recording
+    EE_BASE_API void EndFrame();
+
+    EE_BASE_API int32_t GetNumColumns();
+    EE_BASE_API char const* GetColumnName( int32_t columnIdx );
+    EE_BASE_API CounterBase const* GetColumnCounter( int32_t columnIdx );
+
+    // Get the value for a column for the last completed frame
+    EE_BASE_API float GetLastFrameValue( int32_t columnIdx );
+
+    // Get the history for a column, ordered from the oldest to the most recent frame
+    EE_BASE_API void GetHistory( int32_t columnIdx, TVector<float>& outValues );
+
+    //-------------------------------------------------------------------------
+    // Recording
+    //-------------------------------------------------------------------------
+    // Streams the frame values to a file, one line per frame
+    // Paths with a ".json" extension are written as JSON lines (one object per frame), all other paths as CSV
+    // If the set of counters changes while recording, the CSV header is written again
+
+    EE_BASE_API bool StartRecording( FileSystem::Path const& filePath );
+    EE_BASE_API void StopRecording();
+    EE_BASE_API bool IsRecording();
+}
+
+//-------------------------------------------------------------------------
+
+#define EE_TELEMETRY_TIME_SCOPE( counter ) EE::Telemetry::ScopedTimeCounter const _telemetryTimeScope( counter )
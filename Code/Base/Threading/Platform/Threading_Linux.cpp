@@ -0,0 +1,132 @@
+#if __linux__
+#include "Base/Threading/Threading.h"
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    namespace Threading
+    {
+        ProcessorInfo GetProcessorInfo()
+        {
+            ProcessorInfo procInfo;
+            procInfo.m_numLogicalCores = (uint16_t) sysconf( _SC_NPROCESSORS_ONLN );
+
+            // Count the unique (package, core) pairs to get the number of physical cores
+            TVector<uint64_t> cores;
+            for ( uint16_t i = 0; i < procInfo.m_numLogicalCores; i++ )
+            {
+                InlineString path( InlineString::CtorSprintf(), "/sys/devices/system/cpu/cpu%u/topology/core_id", i );
+                FILE* pCoreFile = fopen( path.c_str(), "r" );
+                path.sprintf( "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", i );
+                FILE* pPackageFile = fopen( path.c_str(), "r" );
+
+                uint32_t coreID = i, packageID = 0;
+                if ( pCoreFile != nullptr )
+                {
+                    fscanf( pCoreFile, "%u", &coreID );
+                    fclose( pCoreFile );
+                }
+
+                if ( pPackageFile != nullptr )
+                {
+                    fscanf( pPackageFile, "%u", &packageID );
+                    fclose( pPackageFile );
+                }
+
+                uint64_t const core = ( uint64_t( packageID ) << 32 ) | coreID;
+                if ( eastl::find( cores.begin(), cores.end(), core ) == cores.end() )
+                {
+                    cores.emplace_back( core );
+                }
+            }
+
+            procInfo.m_numPhysicalCores = (uint16_t) cores.size();
+            return procInfo;
+        }
+
+        //-------------------------------------------------------------------------
+
+        ThreadID GetCurrentThreadID()
+        {
+            return (ThreadID) syscall( SYS_gettid );
+        }
+
+        void SetCurrentThreadName( char const* pName )
+        {
+            EE_ASSERT( pName != nullptr );
+
+            // Thread names are limited to 15 characters + null terminator
+            char threadName[16];
+            strncpy_s( threadName, 16, pName, 15 );
+            pthread_setname_np( pthread_self(), threadName );
+        }
+
+        //-------------------------------------------------------------------------
+
+        namespace
+        {
+            struct NativeSyncEvent
+            {
+                std::mutex              m_mutex;
+                std::condition_variable m_condition;
+                bool                    m_isSignaled = false;
+            };
+        }
+
+        SyncEvent::SyncEvent()
+            : m_pNativeHandle( nullptr )
+        {
+            m_pNativeHandle = EE::New<NativeSyncEvent>();
+        }
+
+        SyncEvent::~SyncEvent()
+        {
+            if ( m_pNativeHandle != nullptr )
+            {
+                auto pEvent = reinterpret_cast<NativeSyncEvent*>( m_pNativeHandle );
+                EE::Delete( pEvent );
+                m_pNativeHandle = nullptr;
+            }
+        }
+
+        void SyncEvent::Signal()
+        {
+            EE_ASSERT( m_pNativeHandle != nullptr );
+            auto pEvent = reinterpret_cast<NativeSyncEvent*>( m_pNativeHandle );
+            {
+                std::lock_guard<std::mutex> lock( pEvent->m_mutex );
+                pEvent->m_isSignaled = true;
+            }
+            pEvent->m_condition.notify_all();
+        }
+
+        void SyncEvent::Reset()
+        {
+            EE_ASSERT( m_pNativeHandle != nullptr );
+            auto pEvent = reinterpret_cast<NativeSyncEvent*>( m_pNativeHandle );
+            std::lock_guard<std::mutex> lock( pEvent->m_mutex );
+            pEvent->m_isSignaled = false;
+        }
+
+        void SyncEvent::Wait() const
+        {
+            EE_ASSERT( m_pNativeHandle != nullptr );
+            auto pEvent = reinterpret_cast<NativeSyncEvent*>( m_pNativeHandle );
+            std::unique_lock<std::mutex> lock( pEvent->m_mutex );
+            pEvent->m_condition.wait( lock, [pEvent] () { return pEvent->m_isSignaled; } );
+        }
+
+        void SyncEvent::Wait( Milliseconds maxWaitTime ) const
+        {
+            EE_ASSERT( m_pNativeHandle != nullptr );
+            auto pEvent = reinterpret_cast<NativeSyncEvent*>( m_pNativeHandle );
+            std::unique_lock<std::mutex> lock( pEvent->m_mutex );
+            pEvent->m_condition.wait_for( lock, std::chrono::milliseconds( (uint32_t) maxWaitTime ), [pEvent] () { return pEvent->m_isSignaled; } );
+        }
+    }
+}
+#endif
@@ -44,6 +44,12 @@ namespace EE
         inline bool IsBusy() const { return m_taskScheduler.GetIsRunning(); }
         inline uint32_t GetNumWorkers() const { return m_numWorkers; }
 
+        // Get the total number of threads that can execute tasks (workers + the main thread)
+        inline uint32_t GetNumThreads() const { EE_ASSERT( m_initialized ); return m_taskScheduler.GetNumTaskThreads(); }
+
+        // Get the index of the calling thread, this is in the range [0, GetNumThreads()) for all task threads, the main thread is always 0
+        inline uint32_t GetCurrentThreadIndex() const { EE_ASSERT( m_initialized ); return m_taskScheduler.GetThreadNum(); }
+
         inline void WaitForAll() 
         {
             m_taskScheduler.WaitforAll(); 
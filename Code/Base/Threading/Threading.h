@@ -3,6 +3,7 @@
 #include "Base/Types/String.h"
 #include "Base/Time/Time.h"
 #include "Base/ThirdParty/concurrentqueue/concurrentqueue.h"
+#include <condition_variable>
 #include <mutex>
 #include <shared_mutex>
 
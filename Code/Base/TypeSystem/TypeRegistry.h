@@ -3,6 +3,7 @@
 #include "CoreTypeIDs.h"
 #include "Base/Systems.h"
 #include "Base/Types/HashMap.h"
+#include "Base/Types/FlatHashMap.h"
 #include "Base/Resource/ResourceTypeID.h"
 #include <typeinfo>
 
@@ -131,7 +132,7 @@ namespace EE::TypeSystem
 
     private:
 
-        THashMap<TypeID, TypeInfo const*>           m_registeredTypes;
+        TFlatHashMap<TypeID, TypeInfo const*>       m_registeredTypes;
         THashMap<TypeID, EnumInfo*>                 m_registeredEnums;
         THashMap<ResourceTypeID, ResourceInfo*>     m_registeredResourceTypes;
         THashMap<TypeID, DataFileInfo*>             m_registeredDataFileTypes;
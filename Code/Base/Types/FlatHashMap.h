@@ -0,0 +1,780 @@
+#pragma once
+
+#include "Base/Memory/Memory.h"
+#include "EASTL/functional.h"
+#include "EASTL/utility.h"
+#include <emmintrin.h>
+
+#if _WIN32
+#include <intrin.h>
+#endif
+#include <type_traits>
+
+//-------------------------------------------------------------------------
+// Flat Hash Map / Set
+//-------------------------------------------------------------------------
+// Open addressing hash tables that store all their elements in a single contiguous allocation (SwissTable style)
+// Each slot has a control byte that is either empty, deleted or holds 7 bits of the element's hash. Lookups compare a
+// group of 16 control bytes at once with SSE2 and only compare keys for slots whose hash bits match
+//
+// Use these instead of THashMap for lookup tables that are hit often, THashMap allocates a node per element
+//
+// Differences with THashMap:
+//  * Inserting can move elements (when the table grows) so pointers/references to elements are invalidated by inserts
+//  * Erasing does not move other elements, so it is safe to erase the current element while iterating (use the returned iterator)
+//  * An optional inline capacity (0 or a power of two >= 16) keeps small tables entirely inside the container
+//  * The iteration order is unspecified and changes when the table grows
+//
+// The hash is remixed internally, so cheap identity hashes (e.g. for IDs) are fine
+
+namespace EE
+{
+    namespace FlatHash
+    {
+        using ControlByte = int8_t;
+
+        constexpr static ControlByte const s_empty = -128;
+        constexpr static ControlByte const s_deleted = -2;
+        constexpr static size_t const s_groupWidth = 16;
+        constexpr static size_t const s_minCapacity = 16;
+
+        EE_FORCE_INLINE bool IsFull( ControlByte c ) { return c >= 0; }
+
+        // Most of our ID hashes are the identity function, so we need to spread the bits before splitting the hash
+        EE_FORCE_INLINE uint64_t MixHash( uint64_t hash )
+        {
+            hash *= 0x9E3779B97F4A7C15ull;
+            return hash ^ ( hash >> 32 );
+        }
+
+        // The probe start position
+        EE_FORCE_INLINE size_t H1( uint64_t hash ) { return size_t( hash >> 7 ); }
+
+        // The 7 hash bits stored in the control byte
+        EE_FORCE_INLINE ControlByte H2( uint64_t hash ) { return ControlByte( hash & 0x7F ); }
+
+        EE_FORCE_INLINE uint32_t GetLowestSetBit( uint32_t mask )
+        {
+            #if _WIN32
+            unsigned long idx = 0;
+            _BitScanForward( &idx, mask );
+            return idx;
+            #else
+            return (uint32_t) __builtin_ctz( mask );
+            #endif
+        }
+
+        EE_FORCE_INLINE uint32_t GetHighestSetBit( uint32_t mask )
+        {
+            #if _WIN32
+            unsigned long idx = 0;
+            _BitScanReverse( &idx, mask );
+            return idx;
+            #else
+            return 31u - (uint32_t) __builtin_clz( mask );
+            #endif
+        }
+
+        // The number of slots we allow to be used before growing (7/8 load factor)
+        EE_FORCE_INLINE size_t GetMaxLoad( size_t capacity ) { return capacity - ( capacity / 8 ); }
+
+        // A group of 16 consecutive control bytes, the bit masks returned have one bit per slot
+        struct Group
+        {
+            EE_FORCE_INLINE explicit Group( ControlByte const* pControl ) : m_control( _mm_loadu_si128( reinterpret_cast<__m128i const*>( pControl ) ) ) {}
+
+            EE_FORCE_INLINE uint32_t Match( ControlByte h2 ) const { return (uint32_t) _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_set1_epi8( h2 ), m_control ) ); }
+            EE_FORCE_INLINE uint32_t MatchEmpty() const { return Match( s_empty ); }
+            EE_FORCE_INLINE uint32_t MatchEmptyOrDeleted() const { return (uint32_t) _mm_movemask_epi8( m_control ); }
+
+        public:
+
+            __m128i                                 m_control;
+        };
+
+        //-------------------------------------------------------------------------
+
+        struct SelectFirst
+        {
+            constexpr static bool const s_isSet = false;
+            template<typename T> EE_FORCE_INLINE auto const& operator()( T const& value ) const { return value.first; }
+        };
+
+        struct SelectSelf
+        {
+            constexpr static bool const s_isSet = true;
+            template<typename T> EE_FORCE_INLINE T const& operator()( T const& value ) const { return value; }
+        };
+
+        //-------------------------------------------------------------------------
+
+        template<typename T, size_t N>
+        struct InlineStorage
+        {
+            alignas( T ) uint8_t                    m_slots[sizeof( T ) * N];
+            ControlByte                             m_control[N + s_groupWidth];
+        };
+
+        template<typename T>
+        struct InlineStorage<T, 0>
+        {};
+
+        //-------------------------------------------------------------------------
+
+        template<typename T, bool IsConst>
+        class Iterator
+        {
+            template<typename, typename, typename, typename, typename, size_t> friend class TFlatHashTable;
+            friend class Iterator<T, !IsConst>;
+
+        public:
+
+            using value_type = T;
+            using reference = std::conditional_t<IsConst, T const&, T&>;
+            using pointer = std::conditional_t<IsConst, T const*, T*>;
+
+        public:
+
+            Iterator() = default;
+
+            // Allow conversion from mutable to const iterators
+            template<bool OtherIsConst, typename = std::enable_if_t<IsConst && !OtherIsConst>>
+            Iterator( Iterator<T, OtherIsConst> const& other ) : m_pControl( other.m_pControl ), m_pSlot( other.m_pSlot ), m_pControlEnd( other.m_pControlEnd ) {}
+
+            EE_FORCE_INLINE reference operator*() const { return *m_pSlot; }
+            EE_FORCE_INLINE pointer operator->() const { return m_pSlot; }
+
+            inline Iterator& operator++()
+            {
+                ++m_pControl;
+                ++m_pSlot;
+                SkipEmptySlots();
+                return *this;
+            }
+
+            inline Iterator operator++( int ) { Iterator tmp = *this; ++( *this ); return tmp; }
+
+            EE_FORCE_INLINE bool operator==( Iterator const& rhs ) const { return m_pControl == rhs.m_pControl; }
+            EE_FORCE_INLINE bool operator!=( Iterator const& rhs ) const { return m_pControl != rhs.m_pControl; }
+
+        private:
+
+            Iterator( ControlByte const* pControl, T* pSlot, ControlByte const* pControlEnd )
+                : m_pControl( pControl )
+                , m_pSlot( pSlot )
+                , m_pControlEnd( pControlEnd )
+            {}
+
+            inline void SkipEmptySlots()
+            {
+                while ( m_pControl != m_pControlEnd && !IsFull( *m_pControl ) )
+                {
+                    ++m_pControl;
+                    ++m_pSlot;
+                }
+            }
+
+        private:
+
+            ControlByte const*                      m_pControl = nullptr;
+            T*                                      m_pSlot = nullptr;
+            ControlByte const*                      m_pControlEnd = nullptr;
+        };
+
+        //-------------------------------------------------------------------------
+        // The shared implementation for the flat map and set
+        //-------------------------------------------------------------------------
+        // Capacity is always a power of two. The control array has an extra group of bytes at the end that mirrors
+        // the first group, so that a group can be loaded at any slot index without wrapping
+
+        template<typename Key, typename Value, typename KeyOfValue, typename Hash, typename Equal, size_t InlineCapacity>
+        class TFlatHashTable
+        {
+            static_assert( InlineCapacity == 0 || ( InlineCapacity >= s_minCapacity && ( InlineCapacity & ( InlineCapacity - 1 ) ) == 0 ), "Inline capacity needs to be 0 or a power of two >= 16" );
+
+            constexpr static size_t const s_invalidIdx = size_t( -1 );
+
+        public:
+
+            using key_type = Key;
+            using value_type = Value;
+            using size_type = size_t;
+            using hasher = Hash;
+            using key_equal = Equal;
+            using const_iterator = Iterator<Value, true>;
+            using iterator = std::conditional_t<KeyOfValue::s_isSet, const_iterator, Iterator<Value, false>>;
+
+        public:
+
+            TFlatHashTable()
+            {
+                if constexpr ( InlineCapacity > 0 )
+                {
+                    AllocateStorage( InlineCapacity );
+                }
+            }
+
+            TFlatHashTable( TFlatHashTable const& other )
+                : TFlatHashTable()
+            {
+                CopyFrom( other );
+            }
+
+            TFlatHashTable( TFlatHashTable&& other )
+                : TFlatHashTable()
+            {
+                MoveFrom( other );
+            }
+
+            ~TFlatHashTable()
+            {
+                DestroyElements();
+                FreeStorage();
+            }
+
+            TFlatHashTable& operator=( TFlatHashTable const& rhs )
+            {
+                if ( this != &rhs )
+                {
+                    DestroyElements();
+                    FreeStorage();
+                    CopyFrom( rhs );
+                }
+                return *this;
+            }
+
+            TFlatHashTable& operator=( TFlatHashTable&& rhs )
+            {
+                if ( this != &rhs )
+                {
+                    DestroyElements();
+                    FreeStorage();
+                    MoveFrom( rhs );
+                }
+                return *this;
+            }
+
+            // Iteration
+            //-------------------------------------------------------------------------
+
+            inline iterator begin() { iterator iter( m_pControl, m_pSlots, m_pControl + m_capacity ); iter.SkipEmptySlots(); return iter; }
+            inline iterator end() { return iterator( m_pControl + m_capacity, m_pSlots + m_capacity, m_pControl + m_capacity ); }
+            inline const_iterator begin() const { const_iterator iter( m_pControl, m_pSlots, m_pControl + m_capacity ); iter.SkipEmptySlots(); return iter; }
+            inline const_iterator end() const { return const_iterator( m_pControl + m_capacity, m_pSlots + m_capacity, m_pControl + m_capacity ); }
+            inline const_iterator cbegin() const { return begin(); }
+            inline const_iterator cend() const { return end(); }
+
+            // Size
+            //-------------------------------------------------------------------------
+
+            inline bool empty() const { return m_size == 0; }
+            inline size_t size() const { return m_size; }
+            inline size_t capacity() const { return m_capacity; }
+
+            // Ensure we can hold the specified number of elements without growing
+            void reserve( size_t numElements )
+            {
+                size_t const requiredCapacity = CalculateCapacity( numElements );
+                if ( requiredCapacity > m_capacity )
+                {
+                    Rehash( requiredCapacity );
+                }
+            }
+
+            // Destroys all elements but keeps the allocated storage
+            void clear()
+            {
+                DestroyElements();
+                ResetControlBytes();
+                m_size = 0;
+                m_growthLeft = GetMaxLoad( m_capacity );
+            }
+
+            void swap( TFlatHashTable& other )
+            {
+                TFlatHashTable tmp( std::move( other ) );
+                other = std::move( *this );
+                *this = std::move( tmp );
+            }
+
+            // Lookup
+            //-------------------------------------------------------------------------
+
+            inline iterator find( Key const& key ) { return MakeIterator( FindIndex( key, CalculateHash( key ) ) ); }
+            inline const_iterator find( Key const& key ) const { return MakeIterator( FindIndex( key, CalculateHash( key ) ) ); }
+
+            // Find using a different key type, the other type needs to produce the same hash as the key type and be comparable to it
+            template<typename U> inline iterator find_as( U const& key ) { return MakeIterator( FindIndex( key, FlatHash::MixHash( (uint64_t) eastl::hash<U>()( key ) ) ) ); }
+            template<typename U> inline const_iterator find_as( U const& key ) const { return MakeIterator( FindIndex( key, FlatHash::MixHash( (uint64_t) eastl::hash<U>()( key ) ) ) ); }
+
+            inline bool contains( Key const& key ) const { return FindIndex( key, CalculateHash( key ) ) != s_invalidIdx; }
+            inline size_t count( Key const& key ) const { return contains( key ) ? 1 : 0; }
+
+            // Insertion
+            //-------------------------------------------------------------------------
+
+            inline eastl::pair<iterator, bool> insert( value_type const& value )
+            {
+                auto const result = FindOrPrepareInsert( KeyOfValue()( value ) );
+                if ( result.second )
+                {
+                    new ( &m_pSlots[result.first] ) value_type( value );
+                }
+                return eastl::pair<iterator, bool>( MakeIterator( result.first ), result.second );
+            }
+
+            inline eastl::pair<iterator, bool> insert( value_type&& value )
+            {
+                auto const result = FindOrPrepareInsert( KeyOfValue()( value ) );
+                if ( result.second )
+                {
+                    new ( &m_pSlots[result.first] ) value_type( std::move( value ) );
+                }
+                return eastl::pair<iterator, bool>( MakeIterator( result.first ), result.second );
+            }
+
+            // Erasure
+            //-------------------------------------------------------------------------
+
+            // Returns the iterator to the next element
+            inline iterator erase( const_iterator iter )
+            {
+                size_t const idx = size_t( iter.m_pControl - m_pControl );
+                EE_ASSERT( idx < m_capacity && IsFull( m_pControl[idx] ) );
+                EraseAtIndex( idx );
+
+                iterator next( m_pControl + idx, m_pSlots + idx, m_pControl + m_capacity );
+                ++next;
+                return next;
+            }
+
+            // Returns the number of elements erased
+            inline size_t erase( Key const& key )
+            {
+                size_t const idx = FindIndex( key, CalculateHash( key ) );
+                if ( idx == s_invalidIdx )
+                {
+                    return 0;
+                }
+
+                EraseAtIndex( idx );
+                return 1;
+            }
+
+        protected:
+
+            EE_FORCE_INLINE static uint64_t CalculateHash( Key const& key ) { return FlatHash::MixHash( (uint64_t) Hash()( key ) ); }
+
+            template<typename K>
+            EE_FORCE_INLINE static bool AreKeysEqual( Key const& a, K const& b )
+            {
+                if constexpr ( std::is_same_v<K, Key> )
+                {
+                    return Equal()( a, b );
+                }
+                else
+                {
+                    return a == b;
+                }
+            }
+
+            EE_FORCE_INLINE iterator MakeIterator( size_t idx )
+            {
+                return ( idx == s_invalidIdx ) ? end() : iterator( m_pControl + idx, m_pSlots + idx, m_pControl + m_capacity );
+            }
+
+            EE_FORCE_INLINE const_iterator MakeIterator( size_t idx ) const
+            {
+                return ( idx == s_invalidIdx ) ? end() : const_iterator( m_pControl + idx, m_pSlots + idx, m_pControl + m_capacity );
+            }
+
+            template<typename K>
+            size_t FindIndex( K const& key, uint64_t hash ) const
+            {
+                if ( m_capacity == 0 )
+                {
+                    return s_invalidIdx;
+                }
+
+                ControlByte const h2 = H2( hash );
+                size_t const mask = m_capacity - 1;
+                size_t pos = H1( hash ) & mask;
+                size_t probeOffset = 0;
+
+                while ( true )
+                {
+                    Group const group( m_pControl + pos );
+                    for ( uint32_t matches = group.Match( h2 ); matches != 0; matches &= matches - 1 )
+                    {
+                        size_t const idx = ( pos + GetLowestSetBit( matches ) ) & mask;
+                        if ( AreKeysEqual( KeyOfValue()( m_pSlots[idx] ), key ) )
+                        {
+                            return idx;
+                        }
+                    }
+
+                    // An empty slot in the group means the probe sequence for this key ends here
+                    if ( group.MatchEmpty() != 0 )
+                    {
+                        return s_invalidIdx;
+                    }
+
+                    // Triangular probing visits every group when the capacity is a power of two
+                    probeOffset += s_groupWidth;
+                    pos = ( pos + probeOffset ) & mask;
+                    EE_ASSERT( probeOffset <= m_capacity );
+                }
+            }
+
+            // Find the first empty or deleted slot on the probe sequence
+            size_t FindInsertIndex( uint64_t hash ) const
+            {
+                size_t const mask = m_capacity - 1;
+                size_t pos = H1( hash ) & mask;
+                size_t probeOffset = 0;
+
+                while ( true )
+                {
+                    uint32_t const available = Group( m_pControl + pos ).MatchEmptyOrDeleted();
+                    if ( available != 0 )
+                    {
+                        return ( pos + GetLowestSetBit( available ) ) & mask;
+                    }
+
+                    probeOffset += s_groupWidth;
+                    pos = ( pos + probeOffset ) & mask;
+                    EE_ASSERT( probeOffset <= m_capacity );
+                }
+            }
+
+            // Returns the slot index for the key and whether the slot was newly claimed (in which case the caller needs to construct the element)
+            template<typename K>
+            eastl::pair<size_t, bool> FindOrPrepareInsert( K const& key )
+            {
+                uint64_t const hash = CalculateHash( key );
+                size_t idx = FindIndex( key, hash );
+                if ( idx != s_invalidIdx )
+                {
+                    return eastl::pair<size_t, bool>( idx, false );
+                }
+
+                if ( m_growthLeft == 0 )
+                {
+                    Grow();
+                }
+
+                idx = FindInsertIndex( hash );
+                if ( m_pControl[idx] == s_empty )
+                {
+                    m_growthLeft--;
+                }
+
+                SetControlByte( idx, H2( hash ) );
+                m_size++;
+                return eastl::pair<size_t, bool>( idx, true );
+            }
+
+            void EraseAtIndex( size_t idx )
+            {
+                m_pSlots[idx].~value_type();
+                m_size--;
+
+                // If no probe could have seen a full group around this slot, then we can mark the slot as empty rather than deleted
+                size_t const mask = m_capacity - 1;
+                uint32_t const emptyAfter = Group( m_pControl + idx ).MatchEmpty();
+                uint32_t const emptyBefore = Group( m_pControl + ( ( idx - s_groupWidth ) & mask ) ).MatchEmpty();
+                if ( emptyAfter != 0 && emptyBefore != 0 )
+                {
+                    uint32_t const numFullAfter = GetLowestSetBit( emptyAfter );
+                    uint32_t const numFullBefore = ( s_groupWidth - 1 ) - GetHighestSetBit( emptyBefore );
+                    if ( numFullAfter + numFullBefore < s_groupWidth )
+                    {
+                        SetControlByte( idx, s_empty );
+                        m_growthLeft++;
+                        return;
+                    }
+                }
+
+                SetControlByte( idx, s_deleted );
+            }
+
+            EE_FORCE_INLINE void SetControlByte( size_t idx, ControlByte value )
+            {
+                m_pControl[idx] = value;
+
+                // Keep the mirrored group in sync
+                if ( idx < s_groupWidth )
+                {
+                    m_pControl[m_capacity + idx] = value;
+                }
+            }
+
+            // Storage
+            //-------------------------------------------------------------------------
+
+            EE_FORCE_INLINE bool IsUsingInlineStorage() const { return InlineCapacity > 0 && m_capacity == InlineCapacity; }
+
+            static size_t CalculateCapacity( size_t numElements )
+            {
+                size_t capacity = ( InlineCapacity > s_minCapacity ) ? InlineCapacity : s_minCapacity;
+                while ( GetMaxLoad( capacity ) < numElements )
+                {
+                    capacity *= 2;
+                }
+                return capacity;
+            }
+
+            void AllocateStorage( size_t capacity )
+            {
+                EE_ASSERT( capacity >= s_minCapacity && ( capacity & ( capacity - 1 ) ) == 0 );
+
+                if constexpr ( InlineCapacity > 0 )
+                {
+                    if ( capacity == InlineCapacity )
+                    {
+                        m_pSlots = reinterpret_cast<value_type*>( m_inlineStorage.m_slots );
+                        m_pControl = m_inlineStorage.m_control;
+                    }
+                }
+
+                if ( !( InlineCapacity > 0 && capacity == InlineCapacity ) )
+                {
+                    size_t const slotsSize = sizeof( value_type ) * capacity;
+                    uint8_t* pMemory = (uint8_t*) EE::Alloc( slotsSize + capacity + s_groupWidth, ( alignof( value_type ) > EE_DEFAULT_ALIGNMENT ) ? alignof( value_type ) : EE_DEFAULT_ALIGNMENT );
+                    m_pSlots = reinterpret_cast<value_type*>( pMemory );
+                    m_pControl = reinterpret_cast<ControlByte*>( pMemory + slotsSize );
+                }
+
+                m_capacity = capacity;
+                m_growthLeft = GetMaxLoad( capacity );
+                ResetControlBytes();
+            }
+
+            void FreeStorage()
+            {
+                if ( m_capacity > 0 && !IsUsingInlineStorage() )
+                {
+                    void* pMemory = m_pSlots;
+                    EE::Free( pMemory );
+                }
+
+                m_pSlots = nullptr;
+                m_pControl = nullptr;
+                m_capacity = 0;
+                m_size = 0;
+                m_growthLeft = 0;
+            }
+
+            inline void ResetControlBytes()
+            {
+                if ( m_capacity > 0 )
+                {
+                    memset( m_pControl, (uint8_t) s_empty, m_capacity + s_groupWidth );
+                }
+            }
+
+            void DestroyElements()
+            {
+                if constexpr ( !std::is_trivially_destructible_v<value_type> )
+                {
+                    for ( size_t i = 0; i < m_capacity; i++ )
+                    {
+                        if ( IsFull( m_pControl[i] ) )
+                        {
+                            m_pSlots[i].~value_type();
+                        }
+                    }
+                }
+            }
+
+            void Grow()
+            {
+                // Rehash in place if most of the used slots are tombstones, otherwise double the capacity
+                // Inline storage can't be rehashed into itself, so we always move to the heap
+                size_t newCapacity = ( m_capacity == 0 ) ? CalculateCapacity( 0 ) : m_capacity * 2;
+                if ( m_capacity > 0 && !IsUsingInlineStorage() && m_size < GetMaxLoad( m_capacity ) / 2 )
+                {
+                    newCapacity = m_capacity;
+                }
+
+                Rehash( newCapacity );
+            }
+
+            void Rehash( size_t newCapacity )
+            {
+                EE_ASSERT( newCapacity >= CalculateCapacity( m_size ) );
+
+                value_type* pOldSlots = m_pSlots;
+                ControlByte* pOldControl = m_pControl;
+                size_t const oldCapacity = m_capacity;
+                bool const wasUsingInlineStorage = IsUsingInlineStorage();
+                size_t const numElements = m_size;
+
+                AllocateStorage( newCapacity );
+
+                for ( size_t i = 0; i < oldCapacity; i++ )
+                {
+                    if ( IsFull( pOldControl[i] ) )
+                    {
+                        uint64_t const hash = CalculateHash( KeyOfValue()( pOldSlots[i] ) );
+                        size_t const idx = FindInsertIndex( hash );
+                        SetControlByte( idx, H2( hash ) );
+                        new ( &m_pSlots[idx] ) value_type( std::move( pOldSlots[i] ) );
+                        pOldSlots[i].~value_type();
+                    }
+                }
+
+                m_size = numElements;
+                m_growthLeft = GetMaxLoad( m_capacity ) - m_size;
+
+                if ( oldCapacity > 0 && !wasUsingInlineStorage )
+                {
+                    void* pMemory = pOldSlots;
+                    EE::Free( pMemory );
+                }
+            }
+
+            // Expects this table to have been emptied and its storage freed
+            void CopyFrom( TFlatHashTable const& other )
+            {
+                if ( other.m_capacity == 0 )
+                {
+                    if constexpr ( InlineCapacity > 0 )
+                    {
+                        AllocateStorage( InlineCapacity );
+                    }
+                    return;
+                }
+
+                // Use the same capacity so that we can copy the layout as is
+                AllocateStorage( other.m_capacity );
+                memcpy( m_pControl, other.m_pControl, m_capacity + s_groupWidth );
+                for ( size_t i = 0; i < m_capacity; i++ )
+                {
+                    if ( IsFull( m_pControl[i] ) )
+                    {
+                        new ( &m_pSlots[i] ) value_type( other.m_pSlots[i] );
+                    }
+                }
+
+                m_size = other.m_size;
+                m_growthLeft = other.m_growthLeft;
+            }
+
+            // Expects this table to have been emptied and its storage freed, leaves the other table empty
+            void MoveFrom( TFlatHashTable& other )
+            {
+                if ( other.IsUsingInlineStorage() )
+                {
+                    AllocateStorage( other.m_capacity );
+                    memcpy( m_pControl, other.m_pControl, m_capacity + s_groupWidth );
+                    for ( size_t i = 0; i < m_capacity; i++ )
+                    {
+                        if ( IsFull( m_pControl[i] ) )
+                        {
+                            new ( &m_pSlots[i] ) value_type( std::move( other.m_pSlots[i] ) );
+                        }
+                    }
+
+                    m_size = other.m_size;
+                    m_growthLeft = other.m_growthLeft;
+                    other.clear();
+                }
+                else
+                {
+                    m_pSlots = other.m_pSlots;
+                    m_pControl = other.m_pControl;
+                    m_capacity = other.m_capacity;
+                    m_size = other.m_size;
+                    m_growthLeft = other.m_growthLeft;
+
+                    other.m_pSlots = nullptr;
+                    other.m_pControl = nullptr;
+                    other.m_capacity = 0;
+                    other.m_size = 0;
+                    other.m_growthLeft = 0;
+
+                    if constexpr ( InlineCapacity > 0 )
+                    {
+                        other.AllocateStorage( InlineCapacity );
+                    }
+                }
+            }
+
+        protected:
+
+            value_type*                             m_pSlots = nullptr;
+            ControlByte*                            m_pControl = nullptr;
+            size_t                                  m_capacity = 0;
+            size_t                                  m_size = 0;
+            size_t                                  m_growthLeft = 0;           // The number of empty slots we can fill before we need to grow
+            InlineStorage<value_type, InlineCapacity> m_inlineStorage;
+        };
+    }
+
+    //-------------------------------------------------------------------------
+    // Flat Hash Map
+    //-------------------------------------------------------------------------
+
+    template<typename K, typename V, size_t InlineCapacity = 0, typename Hash = eastl::hash<K>, typename Equal = eastl::equal_to<K>>
+    class TFlatHashMap : public FlatHash::TFlatHashTable<K, eastl::pair<K const, V>, FlatHash::SelectFirst, Hash, Equal, InlineCapacity>
+    {
+        using BaseType = FlatHash::TFlatHashTable<K, eastl::pair<K const, V>, FlatHash::SelectFirst, Hash, Equal, InlineCapacity>;
+
+    public:
+
+        using mapped_type = V;
+        using typename BaseType::value_type;
+        using typename BaseType::iterator;
+        using typename BaseType::const_iterator;
+        using BaseType::insert;
+
+    public:
+
+        // Support inserting key/value pairs with a non-const key (e.g. TPair<K, V>)
+        inline eastl::pair<iterator, bool> insert( eastl::pair<K, V> const& value ) { return try_emplace( value.first, value.second ); }
+        inline eastl::pair<iterator, bool> insert( eastl::pair<K, V>&& value ) { return try_emplace( std::move( value.first ), std::move( value.second ) ); }
+
+        // Constructs the value from the arguments if the key is not already present, does nothing otherwise
+        template<typename KeyArg, typename... Args>
+        eastl::pair<iterator, bool> try_emplace( KeyArg&& key, Args&&... args )
+        {
+            auto const result = this->FindOrPrepareInsert( key );
+            if ( result.second )
+            {
+                new ( &this->m_pSlots[result.first] ) value_type( std::forward<KeyArg>( key ), V( std::forward<Args>( args )... ) );
+            }
+            return eastl::pair<iterator, bool>( this->MakeIterator( result.first ), result.second );
+        }
+
+        template<typename KeyArg, typename ValueArg>
+        inline eastl::pair<iterator, bool> emplace( KeyArg&& key, ValueArg&& value ) { return try_emplace( std::forward<KeyArg>( key ), std::forward<ValueArg>( value ) ); }
+
+        inline V& operator[]( K const& key ) { return try_emplace( key ).first->second; }
+        inline V& operator[]( K&& key ) { return try_emplace( std::move( key ) ).first->second; }
+
+        // Expects the key to be present
+        inline V& at( K const& key ) { auto iter = this->find( key ); EE_ASSERT( iter != this->end() ); return iter->second; }
+        inline V const& at( K const& key ) const { auto iter = this->find( key ); EE_ASSERT( iter != this->end() ); return iter->second; }
+    };
+
+    //-------------------------------------------------------------------------
+    // Flat Hash Set
+    //-------------------------------------------------------------------------
+
+    template<typename K, size_t InlineCapacity = 0, typename Hash = eastl::hash<K>, typename Equal = eastl::equal_to<K>>
+    class TFlatHashSet : public FlatHash::TFlatHashTable<K, K, FlatHash::SelectSelf, Hash, Equal, InlineCapacity>
+    {
+        using BaseType = FlatHash::TFlatHashTable<K, K, FlatHash::SelectSelf, Hash, Equal, InlineCapacity>;
+
+    public:
+
+        using typename BaseType::iterator;
+        using BaseType::insert;
+
+    public:
+
+        template<typename... Args>
+        inline eastl::pair<iterator, bool> emplace( Args&&... args ) { return insert( K( std::forward<Args>( args )... ) ); }
+    };
+}
@@ -0,0 +1,36 @@
+#if __linux__
+#include "../UUID.h"
+#include <random>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    UUID UUID::GenerateID()
+    {
+        static thread_local std::mt19937_64 generator( std::random_device{}() );
+
+        UUID newID( generator(), generator() );
+
+        // Mark as a version 4 (random) UUID
+        newID.m_data.m_U8[6] = ( newID.m_data.m_U8[6] & 0x0F ) | 0x40;
+        newID.m_data.m_U8[8] = ( newID.m_data.m_U8[8] & 0x3F ) | 0x80;
+        return newID;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace StringUtils
+    {
+        int32_t CompareInsensitive( char const* pStr0, char const* pStr1 )
+        {
+            return strcasecmp( pStr0, pStr1 );
+        }
+
+        int32_t CompareInsensitive( char const* pStr0, char const* pStr1, size_t n )
+        {
+            return strncasecmp( pStr0, pStr1, n );
+        }
+    }
+}
+#endif
@@ -1,39 +1,157 @@
 #include "StringID.h"
 #include "Base/Memory/Memory.h"
 #include "Base/Encoding/Hash.h"
-#include "Base/Threading/Threading.h"
 #include "String.h"
-#include "EASTL/hash_map.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
+// String Table
+//-------------------------------------------------------------------------
+// A fixed number of buckets, each holding a singly linked list of interned strings. Strings are only ever added, so
+// readers can walk the lists without any synchronization beyond acquiring the bucket head. Writers prepend new entries
+// with a CAS on the bucket head, if the CAS fails another thread added an entry to the bucket and we need to check whether
+// it was the same string before retrying.
+//
+// The entries and the strings are allocated from an append-only set of memory chunks that are only freed on shutdown.
 
 namespace EE
 {
-    class StringIDHashMap : public eastl::hash_map<uint64_t, String>
+    namespace
     {
-    public:
-      
-        eastl::hash_node<value_type, false> const* const* GetBuckets() const { return mpBucketArray; }
-    };
+        using InternedString = StringID::InternedString;
+
+        struct StringChunk
+        {
+            StringChunk*                    m_pPrevious = nullptr;
+            size_t                          m_size = 0;
+            std::atomic<size_t>             m_used = 0;
+        };
+
+        constexpr static size_t const s_numBuckets = 1 << 16;
+        constexpr static size_t const s_chunkSize = 64 * 1024;
+
+        static InternedString const**       g_pBuckets = nullptr;
+        static std::atomic<StringChunk*>    g_pCurrentChunk = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        static StringChunk* CreateChunk( size_t size, StringChunk* pPrevious )
+        {
+            StringChunk* pChunk = new ( EE::Alloc( sizeof( StringChunk ) + size, alignof( StringChunk ) ) ) StringChunk();
+            pChunk->m_pPrevious = pPrevious;
+            pChunk->m_size = size;
+            return pChunk;
+        }
+
+        // Lock-free bump allocation from the current chunk, a new chunk is swapped in once the current one is full
+        static void* AllocateFromChunks( size_t size )
+        {
+            size = ( size + 7 ) & ~size_t( 7 );
+
+            while ( true )
+            {
+                StringChunk* pChunk = g_pCurrentChunk.load( std::memory_order_acquire );
+                size_t const offset = pChunk->m_used.fetch_add( size, std::memory_order_relaxed );
+                if ( offset + size <= pChunk->m_size )
+                {
+                    return reinterpret_cast<uint8_t*>( pChunk + 1 ) + offset;
+                }
+
+                // Only one thread gets to install the new chunk, the others free theirs and retry
+                StringChunk* pNewChunk = CreateChunk( ( size > s_chunkSize ) ? size : s_chunkSize, pChunk );
+                if ( !g_pCurrentChunk.compare_exchange_strong( pChunk, pNewChunk, std::memory_order_acq_rel ) )
+                {
+                    pNewChunk->~StringChunk();
+                    EE::Free( pNewChunk );
+                }
+            }
+        }
+
+        EE_FORCE_INLINE static std::atomic_ref<InternedString const*> GetBucket( uint64_t ID )
+        {
+            return std::atomic_ref<InternedString const*>( g_pBuckets[ID & ( s_numBuckets - 1 )] );
+        }
+
+        static InternedString const* FindInList( InternedString const* pEntry, InternedString const* pEnd, uint64_t ID )
+        {
+            while ( pEntry != pEnd )
+            {
+                if ( pEntry->m_ID == ID )
+                {
+                    return pEntry;
+                }
+
+                pEntry = pEntry->m_pNext;
+            }
+
+            return nullptr;
+        }
+    }
 
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
-    StringID::DebuggerInfo*             StringID::s_pDebuggerInfo = nullptr;
+    StringID::DebuggerInfo* StringID::s_pDebuggerInfo = nullptr;
     #endif
 
-    static Threading::Mutex*            g_pStringCacheMutex = nullptr;
-    static StringIDHashMap*             g_pStringCache = nullptr;
+    void StringID::InternString( uint64_t ID, char const* pStr, size_t length )
+    {
+        EE_ASSERT( g_pBuckets != nullptr );
+        EE_ASSERT( ID != 0 );
+
+        std::atomic_ref<InternedString const*> bucket = GetBucket( ID );
+        InternedString const* pHead = bucket.load( std::memory_order_acquire );
+
+        // Common case - the string was already interned
+        InternedString const* pExisting = FindInList( pHead, nullptr, ID );
+        if ( pExisting != nullptr )
+        {
+            EE_ASSERT( strncmp( pExisting->m_pString, pStr, length ) == 0 && pExisting->m_pString[length] == 0 ); // Hash collision
+            return;
+        }
+
+        // Create the new entry and try to publish it
+        //-------------------------------------------------------------------------
+
+        InternedString* pNewEntry = new ( AllocateFromChunks( sizeof( InternedString ) + length + 1 ) ) InternedString();
+        char* pStringStorage = reinterpret_cast<char*>( pNewEntry + 1 );
+        memcpy( pStringStorage, pStr, length );
+        pStringStorage[length] = 0;
+        pNewEntry->m_ID = ID;
+        pNewEntry->m_pString = pStringStorage;
+
+        while ( true )
+        {
+            pNewEntry->m_pNext = pHead;
+            InternedString const* pExpectedHead = pHead;
+            if ( bucket.compare_exchange_weak( pExpectedHead, pNewEntry, std::memory_order_release, std::memory_order_acquire ) )
+            {
+                return;
+            }
+
+            // Only check the entries added since our last attempt, the entry memory is simply abandoned if we lost the race
+            if ( FindInList( pExpectedHead, pHead, ID ) != nullptr )
+            {
+                return;
+            }
+
+            pHead = pExpectedHead;
+        }
+    }
 
     //-------------------------------------------------------------------------
 
     void StringID::Initialize()
     {
-        g_pStringCacheMutex = EE::New<Threading::Mutex>();
-        g_pStringCache = EE::New<StringIDHashMap>();
+        EE_ASSERT( g_pBuckets == nullptr );
+        g_pBuckets = (InternedString const**) EE::Alloc( sizeof( InternedString const* ) * s_numBuckets, alignof( InternedString const* ) );
+        memset( g_pBuckets, 0, sizeof( InternedString const* ) * s_numBuckets );
+        g_pCurrentChunk = CreateChunk( s_chunkSize, nullptr );
 
         #if EE_DEVELOPMENT_TOOLS
         s_pDebuggerInfo = EE::New<StringID::DebuggerInfo>();
+        s_pDebuggerInfo->m_pBuckets = g_pBuckets;
+        s_pDebuggerInfo->m_numBuckets = s_numBuckets;
         #endif
     }
 
@@ -43,39 +161,30 @@ namespace EE
         EE::Delete( s_pDebuggerInfo );
         #endif
 
-        EE::Delete( g_pStringCache);
-        EE::Delete( g_pStringCacheMutex );
+        StringChunk* pChunk = g_pCurrentChunk.exchange( nullptr );
+        while ( pChunk != nullptr )
+        {
+            StringChunk* pPrevious = pChunk->m_pPrevious;
+            pChunk->~StringChunk();
+            EE::Free( pChunk );
+            pChunk = pPrevious;
+        }
+
+        EE::Free( g_pBuckets );
     }
 
     //-------------------------------------------------------------------------
 
     StringID::StringID( char const* pStr )
     {
-        // If this is nullptr then you are likely trying to statically allocate a stringID, this is not allowed and you need to use the "StaticStringID" type instead!
-        EE_ASSERT( g_pStringCacheMutex != nullptr ); 
-
-        if ( pStr != nullptr && strlen( pStr ) > 0 )
+        if ( pStr != nullptr && pStr[0] != 0 )
         {
-            m_ID = Hash::GetHash64( pStr );
-
-            // Cache the string
-            Threading::ScopeLock lock( *g_pStringCacheMutex );
-            auto iter = g_pStringCache->find( m_ID );
-            if ( iter == g_pStringCache->end() )
-            {
-                ( *g_pStringCache )[m_ID] = String( pStr );
+            // If the table doesnt exist then you are likely trying to statically allocate a stringID, this is not allowed and you need to use the "StaticStringID" type instead!
+            EE_ASSERT( g_pBuckets != nullptr );
 
-                #if EE_DEVELOPMENT_TOOLS
-                s_pDebuggerInfo->m_pBuckets = g_pStringCache->GetBuckets();
-                s_pDebuggerInfo->m_numBuckets = g_pStringCache->bucket_count();
-                #endif
-            }
-            else
-            {
-                #if EE_DEVELOPMENT_TOOLS
-                EE_ASSERT( iter->second == pStr );
-                #endif
-            }
+            size_t const length = strlen( pStr );
+            m_ID = Hash::GetHash64( pStr, length );
+            InternString( m_ID, pStr, length );
         }
     }
 
@@ -89,32 +198,16 @@ namespace EE
 
     char const* StringID::c_str() const
     {
-        if ( m_ID == 0 )
+        if ( m_ID != 0 )
         {
-            return nullptr;
-        }
-
-        {
-            // Get cached string
-            Threading::ScopeLock lock( *g_pStringCacheMutex );
-            auto iter = g_pStringCache->find( m_ID );
-            if ( iter != g_pStringCache->end() )
+            InternedString const* pEntry = FindInList( GetBucket( m_ID ).load( std::memory_order_acquire ), nullptr, m_ID );
+            if ( pEntry != nullptr )
             {
-                return iter->second.c_str();
+                return pEntry->m_pString;
             }
         }
 
-        // ID likely directly created via uint64_t
+        // Either invalid or the ID was likely directly created via uint64_t
         return nullptr;
     }
-
-    //-------------------------------------------------------------------------
-
-    StaticStringID::StaticStringID( char const* pStr )
-    {
-        EE_ASSERT( pStr != nullptr );
-        size_t const length = strlen( pStr );
-        EE_ASSERT( length < 64 );
-        memcpy( m_buffer, pStr, length);
-    }
-}
\ No newline at end of file
+}
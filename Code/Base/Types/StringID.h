@@ -2,7 +2,9 @@
 
 #include "Base/_Module/API.h"
 #include "Base/Types/Containers_ForwardDecl.h"
+#include "Base/Encoding/HashConstexpr.h"
 #include "Base/Esoterica.h"
+#include <cstring>
 
 //-------------------------------------------------------------------------
 // String ID
@@ -10,17 +12,11 @@
 // Deterministic numeric ID generated from a string
 // StringIDs are CASE-SENSITIVE!
 // Uses the 64bit default hash
-
-namespace eastl
-{
-    template <typename Value, bool CacheHashCode>
-    struct hash_node;
-
-    template <typename T1, typename T2>
-    struct pair;
-}
-
-//-------------------------------------------------------------------------
+//
+// The strings are interned in a lock-free append-only table so that we can get them back from the IDs
+//
+// Use EE_STRING_ID( "literal" ) for string literals, the ID is generated at compile time and (after the first use) never
+// touches the string table
 
 namespace EE
 {
@@ -28,11 +24,17 @@ namespace EE
     {
     public:
 
-        using StringIDHashNode = eastl::hash_node<eastl::pair<const uint64_t, String>, false>;
+        // An interned string, chained per bucket in the string table
+        struct InternedString
+        {
+            InternedString const*           m_pNext = nullptr;
+            uint64_t                        m_ID = 0;
+            char const*                     m_pString = nullptr;
+        };
 
         struct DebuggerInfo
         {
-            StringIDHashNode const* const*  m_pBuckets = nullptr;
+            InternedString const* const*    m_pBuckets = nullptr;
             size_t                          m_numBuckets = 0;
         };
 
@@ -40,31 +42,50 @@ namespace EE
         static DebuggerInfo*                s_pDebuggerInfo;
         #endif
 
+        // Add a string to the string table, this is threadsafe and does nothing if the string is already present
+        static void InternString( uint64_t ID, char const* pStr, size_t length );
+
+        // Used by EE_STRING_ID to only add the literal to the string table once
+        template<uint64_t ID, size_t N>
+        inline static StringID InternLiteral( char const ( &str )[N] )
+        {
+            [[maybe_unused]] static bool const s_isInterned = ( InternString( ID, str, N - 1 ), true );
+            return StringID( ID );
+        }
+
         // Initialize global state for StringID system
         static void Initialize();
 
         // Shutdown global state for StringID system
         static void Shutdown();
 
+        // Create an ID from a string literal at compile time, this doesnt add the string to the string table. Prefer EE_STRING_ID
+        template<size_t N>
+        consteval static StringID FromLiteral( char const ( &str )[N] )
+        {
+            return StringID( ( N > 1 ) ? Hash::XXHash::GetHash64Constexpr( str, N - 1 ) : 0 );
+        }
+
     public:
 
         StringID() = default;
         explicit StringID( nullptr_t ) : m_ID( 0 ) {}
         explicit StringID( char const* pStr );
-        explicit StringID( uint64_t ID ) : m_ID( ID ) {}
+        constexpr explicit StringID( uint64_t ID ) : m_ID( ID ) {}
         explicit StringID( String const& str );
         explicit StringID( InlineString const& str );
 
-        inline bool IsValid() const { return m_ID != 0; }
-        inline uint64_t ToUint() const { return m_ID; }
-        inline operator uint64_t() const { return m_ID; }
+        constexpr inline bool IsValid() const { return m_ID != 0; }
+        constexpr inline uint64_t ToUint() const { return m_ID; }
+        constexpr inline operator uint64_t() const { return m_ID; }
 
         inline void Clear() { m_ID = 0; }
 
+        // Returns nullptr if the string is unknown (i.e. the ID was directly created from a uint64_t)
         char const* c_str() const;
 
-        inline bool operator==( StringID const& rhs ) const { return m_ID == rhs.m_ID; }
-        inline bool operator!=( StringID const& rhs ) const { return m_ID != rhs.m_ID; }
+        constexpr inline bool operator==( StringID const& rhs ) const { return m_ID == rhs.m_ID; }
+        constexpr inline bool operator!=( StringID const& rhs ) const { return m_ID != rhs.m_ID; }
 
     private:
 
@@ -79,23 +100,38 @@ namespace EE
     {
     public:
 
-        // General constructor
-        StaticStringID( char const* pStr );
+        // General constructor, the ID is generated at compile time for constant initialized globals
+        constexpr StaticStringID( char const* pStr )
+        {
+            size_t length = 0;
+            while ( pStr[length] != 0 )
+            {
+                length++;
+            }
+
+            m_ID = StringID( ( length > 0 ) ? Hash::XXHash::GetHash64Constexpr( pStr, length ) : 0 );
+
+            EE_ASSERT( length < 64 );
+            for ( size_t i = 0; i < length; i++ )
+            {
+                m_buffer[i] = pStr[i];
+            }
+        }
 
-        // Lazily construct the ID on first use
+        // The string is only added to the string table on first use since the table might not exist when this is constructed
         inline StringID const& GetID() const
         {
-            if ( !m_isCreated )
+            if ( !m_isInterned && m_ID.IsValid() )
             {
-                m_ID = StringID( m_buffer );
-                m_isCreated = true;
+                StringID::InternString( m_ID, m_buffer, strlen( m_buffer ) );
+                m_isInterned = true;
             }
 
             return m_ID;
         }
 
         inline operator StringID() const { return GetID(); }
-        inline bool operator==( StringID const& rhs ) const { return GetID() == rhs; }
+        inline bool operator==( StringID const& rhs ) const { return m_ID == rhs; }
         inline char const* c_str() const { return GetID().c_str(); }
 
     private:
@@ -104,12 +140,18 @@ namespace EE
 
     private:
 
+        StringID                    m_ID;
         char                        m_buffer[64] = { 0 };
-        mutable StringID            m_ID;
-        mutable bool                m_isCreated = false;
+        mutable bool                m_isInterned = false;
     };
 }
 
+//-------------------------------------------------------------------------
+// Compile time StringIDs for string literals
+//-------------------------------------------------------------------------
+
+#define EE_STRING_ID( str ) EE::StringID::InternLiteral<EE::StringID::FromLiteral( str ).ToUint()>( str )
+
 //-------------------------------------------------------------------------
 
 namespace eastl
@@ -0,0 +1,171 @@
+#include "AIScheduler.h"
+#include "Engine/AI/Components/Component_AI.h"
+#include "Engine/Entity/Entity.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::AI
+{
+    Scheduler::Scheduler()
+    {
+        m_tierSettings[(int32_t) Tier::High] = { 15.0f, 1 };
+        m_tierSettings[(int32_t) Tier::Medium] = { 40.0f, 2 };
+        m_tierSettings[(int32_t) Tier::Low] = { 80.0f, 4 };
+        m_tierSettings[(int32_t) Tier::Minimal] = { FLT_MAX, 8 };
+    }
+
+    void Scheduler::SetTierSettings( Tier tier, TierSettings const& settings )
+    {
+        EE_ASSERT( tier < Tier::NumTiers );
+        EE_ASSERT( settings.m_decisionInterval > 0 && settings.m_decisionInterval <= s_numBuckets && Math::IsPowerOf2( settings.m_decisionInterval ) );
+        m_tierSettings[(int32_t) tier] = settings;
+    }
+
+    void Scheduler::ResetStats()
+    {
+        // Keep the current AI counts, these are not accumulated
+        Stats newStats;
+        for ( int32_t i = 0; i < s_numBuckets; i++ )
+        {
+            newStats.m_buckets[i].m_numAIs = m_stats.m_buckets[i].m_numAIs;
+        }
+        newStats.m_numAIsPerTier = m_stats.m_numAIsPerTier;
+        m_stats = newStats;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void Scheduler::RegisterAI( Entity const* pEntity, AIComponent* pAIComponent )
+    {
+        EE_ASSERT( pEntity != nullptr && pAIComponent != nullptr );
+
+        // Newly added AI always make their decisions on their first update
+        pAIComponent->m_schedulerBucketIdx = (uint8_t) m_nextBucketIdx;
+        pAIComponent->m_schedulerTier = (uint8_t) Tier::High;
+        pAIComponent->m_isDecisionUpdateScheduled = true;
+        pAIComponent->m_wasDecisionUpdateDeferred = false;
+        m_nextBucketIdx = ( m_nextBucketIdx + 1 ) % s_numBuckets;
+
+        m_AIs.emplace_back( ScheduledAI{ pEntity, pAIComponent } );
+    }
+
+    void Scheduler::UnregisterAI( AIComponent* pAIComponent )
+    {
+        for ( int32_t i = 0; i < (int32_t) m_AIs.size(); i++ )
+        {
+            if ( m_AIs[i].m_pAIComponent == pAIComponent )
+            {
+                m_AIs.erase_unsorted( m_AIs.begin() + i );
+                return;
+            }
+        }
+
+        EE_UNREACHABLE_CODE();
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool Scheduler::TryBeginDecisionUpdate( AIComponent* pAIComponent )
+    {
+        EE_ASSERT( pAIComponent != nullptr );
+
+        if ( !pAIComponent->m_isDecisionUpdateScheduled )
+        {
+            return false;
+        }
+
+        // Once the budget is used up, defer the update to the next frame
+        // Updates that were already deferred always run so that no AI gets starved under sustained load
+        uint64_t const budgetMicroseconds = uint64_t( m_frameBudget.ToFloat() * 1000.0f );
+        if ( !pAIComponent->m_wasDecisionUpdateDeferred && m_frameDecisionTimeMicroseconds.load( std::memory_order_relaxed ) >= budgetMicroseconds )
+        {
+            pAIComponent->m_wasDecisionUpdateDeferred = true;
+            m_bucketCounters[pAIComponent->m_schedulerBucketIdx].m_numDeferred.fetch_add( 1, std::memory_order_relaxed );
+            return false;
+        }
+
+        pAIComponent->m_wasDecisionUpdateDeferred = false;
+        return true;
+    }
+
+    void Scheduler::EndDecisionUpdate( AIComponent* pAIComponent, Milliseconds decisionTime )
+    {
+        EE_ASSERT( pAIComponent != nullptr );
+
+        uint64_t const decisionTimeMicroseconds = uint64_t( decisionTime.ToFloat() * 1000.0f );
+        BucketCounters& counters = m_bucketCounters[pAIComponent->m_schedulerBucketIdx];
+        counters.m_numEvaluations.fetch_add( 1, std::memory_order_relaxed );
+        counters.m_decisionTimeMicroseconds.fetch_add( decisionTimeMicroseconds, std::memory_order_relaxed );
+        m_frameDecisionTimeMicroseconds.fetch_add( decisionTimeMicroseconds, std::memory_order_relaxed );
+    }
+
+    //-------------------------------------------------------------------------
+
+    Scheduler::Tier Scheduler::CalculateTier( Entity const* pEntity, Vector const* pViewerPosition ) const
+    {
+        if ( pViewerPosition == nullptr || !pEntity->IsSpatialEntity() )
+        {
+            return Tier::High;
+        }
+
+        float const distanceSq = pEntity->GetWorldTransform().GetTranslation().GetDistanceSquared3( *pViewerPosition );
+        for ( int32_t i = 0; i < (int32_t) Tier::NumTiers - 1; i++ )
+        {
+            if ( distanceSq <= Math::Sqr( m_tierSettings[i].m_maxDistance ) )
+            {
+                return (Tier) i;
+            }
+        }
+
+        return Tier::Minimal;
+    }
+
+    void Scheduler::UpdateSchedule( Vector const* pViewerPosition )
+    {
+        EE_PROFILE_FUNCTION_AI();
+
+        // Gather this frame's stats
+        //-------------------------------------------------------------------------
+
+        Milliseconds const frameDecisionTime = Milliseconds( m_frameDecisionTimeMicroseconds.exchange( 0 ) / 1000.0f );
+        m_stats.m_lastFrameDecisionTime = frameDecisionTime;
+        m_stats.m_numFrames++;
+
+        if ( frameDecisionTime > m_frameBudget )
+        {
+            m_stats.m_numOverrunFrames++;
+            m_stats.m_maxOverrun = Math::Max( m_stats.m_maxOverrun.ToFloat(), frameDecisionTime.ToFloat() - m_frameBudget.ToFloat() );
+        }
+
+        for ( int32_t i = 0; i < s_numBuckets; i++ )
+        {
+            BucketStats& bucketStats = m_stats.m_buckets[i];
+            bucketStats.m_numAIs = 0;
+            bucketStats.m_numEvaluations += m_bucketCounters[i].m_numEvaluations.exchange( 0 );
+            bucketStats.m_numDeferred += m_bucketCounters[i].m_numDeferred.exchange( 0 );
+            bucketStats.m_totalDecisionTime += Milliseconds( m_bucketCounters[i].m_decisionTimeMicroseconds.exchange( 0 ) / 1000.0f );
+        }
+
+        m_stats.m_numAIsPerTier.fill( 0 );
+
+        // Schedule the next frame
+        //-------------------------------------------------------------------------
+        // An AI in bucket B with an interval of N frames makes decisions whenever ( frame + B ) is a multiple of N
+
+        m_frameIdx++;
+
+        for ( ScheduledAI const& scheduledAI : m_AIs )
+        {
+            AIComponent* pAIComponent = scheduledAI.m_pAIComponent;
+
+            Tier const tier = CalculateTier( scheduledAI.m_pEntity, pViewerPosition );
+            uint32_t const interval = m_tierSettings[(int32_t) tier].m_decisionInterval;
+            pAIComponent->m_schedulerTier = (uint8_t) tier;
+            pAIComponent->m_isDecisionUpdateScheduled = pAIComponent->m_wasDecisionUpdateDeferred || ( ( m_frameIdx + pAIComponent->m_schedulerBucketIdx ) & ( interval - 1 ) ) == 0;
+
+            m_stats.m_buckets[pAIComponent->m_schedulerBucketIdx].m_numAIs++;
+            m_stats.m_numAIsPerTier[(int32_t) tier]++;
+        }
+    }
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Base/Math/Vector.h"
+#include "Base/Time/Time.h"
+#include "Base/Types/Arrays.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE { class Entity; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::AI
+{
+    class AIComponent;
+
+    //-------------------------------------------------------------------------
+    // AI Scheduler
+    //-------------------------------------------------------------------------
+    // Decides which AI get to re-evaluate their behaviors (i.e. make decisions) each frame
+    // Action execution (movement, animation) is not scheduled and always runs at full rate
+    //
+    // Each AI is assigned a tier based on its distance to the viewer and each tier has a decision interval in frames
+    // AI are spread across round-robin buckets on registration so that each frame only a slice of each tier re-evaluates
+    // Decision updates also share a per-frame time budget, once the budget is used up any remaining scheduled updates are
+    // deferred to the next frame where they are guaranteed to run
+    //
+    // Beginning and ending decision updates is threadsafe, the schedule itself is only updated by the AI manager
+
+    class EE_ENGINE_API Scheduler
+    {
+    public:
+
+        constexpr static int32_t const s_numBuckets = 8;
+
+        enum class Tier : uint8_t
+        {
+            High = 0,
+            Medium,
+            Low,
+            Minimal,
+
+            NumTiers
+        };
+
+        struct TierSettings
+        {
+            float                                   m_maxDistance = FLT_MAX;            // AI further away than this are assigned to the next tier
+            uint32_t                                m_decisionInterval = 1;             // In frames, needs to be a power of two no larger than the number of buckets
+        };
+
+        struct BucketStats
+        {
+            inline Milliseconds GetAverageDecisionTime() const { return ( m_numEvaluations > 0 ) ? Milliseconds( m_totalDecisionTime / float( m_numEvaluations ) ) : Milliseconds( 0.0f ); }
+
+        public:
+
+            int32_t                                 m_numAIs = 0;
+            uint32_t                                m_numEvaluations = 0;
+            uint32_t                                m_numDeferred = 0;
+            Milliseconds                            m_totalDecisionTime = 0.0f;
+        };
+
+        struct Stats
+        {
+            inline float GetOverrunRate() const { return ( m_numFrames > 0 ) ? float( m_numOverrunFrames ) / m_numFrames : 0.0f; }
+
+        public:
+
+            TArray<BucketStats, s_numBuckets>       m_buckets;
+            TArray<int32_t, (int32_t) Tier::NumTiers> m_numAIsPerTier = {};
+            uint32_t                                m_numFrames = 0;
+            uint32_t                                m_numOverrunFrames = 0;
+            Milliseconds                            m_lastFrameDecisionTime = 0.0f;
+            Milliseconds                            m_maxOverrun = 0.0f;
+        };
+
+    private:
+
+        struct ScheduledAI
+        {
+            Entity const*                           m_pEntity = nullptr;
+            AIComponent*                            m_pAIComponent = nullptr;
+        };
+
+        struct BucketCounters
+        {
+            std::atomic<uint32_t>                   m_numEvaluations = 0;
+            std::atomic<uint32_t>                   m_numDeferred = 0;
+            std::atomic<uint64_t>                   m_decisionTimeMicroseconds = 0;
+        };
+
+    public:
+
+        Scheduler();
+
+        void RegisterAI( Entity const* pEntity, AIComponent* pAIComponent );
+        void UnregisterAI( AIComponent* pAIComponent );
+
+        // Called by each AI before making decisions - returns false if the AI isn't scheduled this frame or the budget is used up
+        bool TryBeginDecisionUpdate( AIComponent* pAIComponent );
+
+        // Called by each AI after it has made its decisions to record the time spent
+        void EndDecisionUpdate( AIComponent* pAIComponent, Milliseconds decisionTime );
+
+        // Gather this frame's stats and schedule the next frame's decision updates
+        // Needs to be called once all the AI have been updated, the viewer position is used to assign tiers (if there is no viewer all AI are high tier)
+        void UpdateSchedule( Vector const* pViewerPosition );
+
+        // Settings
+        //-------------------------------------------------------------------------
+
+        inline Milliseconds GetFrameBudget() const { return m_frameBudget; }
+        inline void SetFrameBudget( Milliseconds budget ) { EE_ASSERT( budget > 0.0f ); m_frameBudget = budget; }
+
+        inline TierSettings const& GetTierSettings( Tier tier ) const { return m_tierSettings[(int32_t) tier]; }
+        void SetTierSettings( Tier tier, TierSettings const& settings );
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        inline Stats const& GetStats() const { return m_stats; }
+        void ResetStats();
+
+    private:
+
+        Tier CalculateTier( Entity const* pEntity, Vector const* pViewerPosition ) const;
+
+    private:
+
+        TVector<ScheduledAI>                        m_AIs;
+        TArray<TierSettings, (int32_t) Tier::NumTiers> m_tierSettings;
+        Milliseconds                                m_frameBudget = 1.0f;
+        uint32_t                                    m_frameIdx = 0;
+        int32_t                                     m_nextBucketIdx = 0;
+
+        // Per-frame counters, written during the AI updates
+        BucketCounters                              m_bucketCounters[s_numBuckets];
+        std::atomic<uint64_t>                       m_frameDecisionTimeMicroseconds = 0;
+
+        Stats                                       m_stats;
+    };
+}
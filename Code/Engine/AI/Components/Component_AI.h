@@ -13,9 +13,19 @@ namespace EE::AI
     {
         EE_SINGLETON_ENTITY_COMPONENT( AIComponent );
 
+        friend class Scheduler;
+
     public:
 
         inline AIComponent() = default;
         inline AIComponent( StringID name ) : EntityComponent( name ) {}
+
+    private:
+
+        // Runtime scheduling state - only modified by the AI scheduler
+        uint8_t                 m_schedulerBucketIdx = 0;
+        uint8_t                 m_schedulerTier = 0;
+        bool                    m_isDecisionUpdateScheduled = true;
+        bool                    m_wasDecisionUpdateDeferred = false;
     };
 }
\ No newline at end of file
@@ -4,8 +4,11 @@
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityMap.h"
+#include "Engine/Player/Systems/WorldSystem_PlayerManager.h"
+#include "Engine/Camera/Components/Component_Camera.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Threading/TaskSystem.h"
+#include "Base/Memory/MemoryTags.h"
 
 //-------------------------------------------------------------------------
 
@@ -26,6 +29,7 @@ namespace EE::AI
         if ( auto pAIComponent = TryCast<AIComponent>( pComponent ) )
         {
             m_AIs.emplace_back( pAIComponent );
+            m_scheduler.RegisterAI( pEntity, pAIComponent );
         }
     }
 
@@ -39,6 +43,7 @@ namespace EE::AI
         if ( auto pAIComponent = TryCast<AIComponent>( pComponent ) )
         {
             m_AIs.erase_first( pAIComponent );
+            m_scheduler.UnregisterAI( pAIComponent );
         }
     }
 
@@ -46,10 +51,24 @@ namespace EE::AI
 
     void AIManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( AI );
         if ( ctx.IsGameWorld() && !m_hasSpawnedAI )
         {
             m_hasSpawnedAI = TrySpawnAI( ctx );
         }
+
+        // All AI have been updated for this frame, so schedule the next frame's decision updates
+        // We use the player camera as the viewer, so AI in view get their decisions updated more often
+        auto pPlayerManager = ctx.GetWorldSystem<PlayerManager>();
+        if ( pPlayerManager->HasPlayer() )
+        {
+            Vector const viewerPosition = pPlayerManager->GetPlayerCamera()->GetPosition();
+            m_scheduler.UpdateSchedule( &viewerPosition );
+        }
+        else
+        {
+            m_scheduler.UpdateSchedule( nullptr );
+        }
     }
 
     bool AIManager::TrySpawnAI( EntityWorldUpdateContext const& ctx )
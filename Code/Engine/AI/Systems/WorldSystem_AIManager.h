@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/AI/AIScheduler.h"
 #include "Base/Types/IDVector.h"
 
 //-------------------------------------------------------------------------
@@ -20,6 +21,9 @@ namespace EE::AI
 
         EE_ENTITY_WORLD_SYSTEM( AIManager, RequiresUpdate( UpdateStage::PrePhysics ) );
 
+        inline Scheduler& GetScheduler() { return m_scheduler; }
+        inline Scheduler const& GetScheduler() const { return m_scheduler; }
+
     private:
 
         virtual void ShutdownSystem() override final;
@@ -36,6 +40,7 @@ namespace EE::AI
 
         TVector<AISpawnComponent*>          m_spawnPoints;
         TVector<AIComponent*>               m_AIs;
+        Scheduler                           m_scheduler;
         bool                                m_hasSpawnedAI = false;
     };
 } 
\ No newline at end of file
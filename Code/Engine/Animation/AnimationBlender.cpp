@@ -1,4 +1,5 @@
 #include "AnimationBlender.h"
+#include "Base/Memory/Arena.h"
 
 //-------------------------------------------------------------------------
 
@@ -35,13 +36,12 @@ namespace EE::Animation
         TVector<int32_t> const& parentIndices = pBasePose->GetSkeleton()->GetParentBoneIndices();
         int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
 
-        TInlineVector<Quaternion, 200> baseRotations;
-        TInlineVector<Quaternion, 200> layerRotations;
-        TInlineVector<Quaternion, 200> resultRotations;
-
-        baseRotations.resize( numBones );
-        layerRotations.resize( numBones );
-        resultRotations.resize( numBones );
+        // These are only needed for the duration of the blend so use the scratch memory rather than the global allocator
+        Memory::ScopedScratch scratch;
+        Memory::ArenaAllocator const scratchAllocator( scratch.GetArena() );
+        TArenaVector<Quaternion> baseRotations( numBones, scratchAllocator );
+        TArenaVector<Quaternion> layerRotations( numBones, scratchAllocator );
+        TArenaVector<Quaternion> resultRotations( numBones, scratchAllocator );
 
         baseRotations[0] = pBasePose->m_parentSpaceTransforms[0].GetRotation();
         layerRotations[0] = pLayerPose->m_parentSpaceTransforms[0].GetRotation();
@@ -70,35 +70,62 @@ namespace EE::Animation
         // Blend global space poses together and convert back to local space
         //-------------------------------------------------------------------------
 
-        for ( int32_t boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        // Masked out bones use the base local pose, so we only need to blend the non-zero mask ranges
+
+        auto CopyBaseTransforms = [&] ( int32_t startIdx, int32_t endIdx )
         {
-            // Use the source local pose for masked out bones
-            boneBlendWeight = pBoneMask->GetWeight( boneIdx );
-            if ( boneBlendWeight == 0.0f )
+            if ( endIdx > startIdx )
             {
-                resultRotations[boneIdx] = baseRotations[boneIdx];
-                pResultPose->SetTransform( boneIdx, pBasePose->GetTransform( boneIdx ) );
-            }
-            else // Perform Blend
-            {
-                // Blend translations
-                //-------------------------------------------------------------------------
-                // Translation blending is done in local space
-
-                Transform::DirectlySetTranslationScale( pResultPose->m_parentSpaceTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( pBasePose->m_parentSpaceTransforms[boneIdx].GetTranslationAndScale(), pLayerPose->m_parentSpaceTransforms[boneIdx].GetTranslationAndScale(), boneBlendWeight ) );
+                memcpy( &resultRotations[startIdx], &baseRotations[startIdx], sizeof( Quaternion ) * ( endIdx - startIdx ) );
 
-                // Blend Rotation
-                //-------------------------------------------------------------------------
+                if ( pBasePose != pResultPose )
+                {
+                    memcpy( &pResultPose->m_parentSpaceTransforms[startIdx], &pBasePose->m_parentSpaceTransforms[startIdx], sizeof( Transform ) * ( endIdx - startIdx ) );
+                }
+            }
+        };
 
-                resultRotations[boneIdx] = BlendFunction::BlendRotation( baseRotations[boneIdx], layerRotations[boneIdx], boneBlendWeight);
+        int32_t nextUnprocessedBoneIdx = 1;
+        for ( BoneMask::WeightRange const& range : pBoneMask->GetNonZeroWeightRanges() )
+        {
+            int32_t const rangeStartIdx = Math::Clamp( (int32_t) range.m_startIdx, 1, numBones );
+            int32_t const rangeEndIdx = Math::Clamp( (int32_t) range.m_endIdx, 1, numBones );
+            CopyBaseTransforms( nextUnprocessedBoneIdx, rangeStartIdx );
 
-                // Convert blended global space rotation to local space for the result pose
-                int32_t const parentIdx = parentIndices[boneIdx];
-                Quaternion const localRotation = Quaternion::Delta( resultRotations[parentIdx], resultRotations[boneIdx] );
-                Transform::DirectlySetRotation( pResultPose->m_parentSpaceTransforms[boneIdx], localRotation );
+            for ( int32_t boneIdx = rangeStartIdx; boneIdx < rangeEndIdx; boneIdx++ )
+            {
+                // Use the source local pose for masked out bones
+                boneBlendWeight = pBoneMask->GetWeight( boneIdx );
+                if ( boneBlendWeight == 0.0f )
+                {
+                    resultRotations[boneIdx] = baseRotations[boneIdx];
+                    pResultPose->m_parentSpaceTransforms[boneIdx] = pBasePose->m_parentSpaceTransforms[boneIdx];
+                }
+                else // Perform Blend
+                {
+                    // Blend translations
+                    //-------------------------------------------------------------------------
+                    // Translation blending is done in local space
+
+                    Transform::DirectlySetTranslationScale( pResultPose->m_parentSpaceTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( pBasePose->m_parentSpaceTransforms[boneIdx].GetTranslationAndScale(), pLayerPose->m_parentSpaceTransforms[boneIdx].GetTranslationAndScale(), boneBlendWeight ) );
+
+                    // Blend Rotation
+                    //-------------------------------------------------------------------------
+
+                    resultRotations[boneIdx] = BlendFunction::BlendRotation( baseRotations[boneIdx], layerRotations[boneIdx], boneBlendWeight);
+
+                    // Convert blended global space rotation to local space for the result pose
+                    int32_t const parentIdx = parentIndices[boneIdx];
+                    Quaternion const localRotation = Quaternion::Delta( resultRotations[parentIdx], resultRotations[boneIdx] );
+                    Transform::DirectlySetRotation( pResultPose->m_parentSpaceTransforms[boneIdx], localRotation );
+                }
             }
+
+            nextUnprocessedBoneIdx = Math::Max( nextUnprocessedBoneIdx, rangeEndIdx );
         }
 
+        CopyBaseTransforms( nextUnprocessedBoneIdx, numBones );
+
         // Blend the results of the global mask onto the base pose
         //-------------------------------------------------------------------------
 
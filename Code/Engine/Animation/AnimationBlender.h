@@ -4,6 +4,7 @@
 #include "AnimationBoneMask.h"
 #include "Engine/Animation/AnimationPose.h"
 #include "Base/Math/Quaternion.h"
+#include "Base/Math/BatchMath.h"
 #include "Base/Types/BitFlags.h"
 #include "Base/TypeSystem/ReflectedType.h"
 
@@ -52,6 +53,12 @@ namespace EE::Animation
             {
                 return Vector::Lerp( translationScale0, translationScale1, t );
             }
+
+            // Blend a contiguous range of transforms
+            EE_FORCE_INLINE static void BlendTransforms( Transform const* pTransforms0, Transform const* pTransforms1, float t, Transform* pResults, int32_t numTransforms )
+            {
+                BatchMath::FastSLerp( pTransforms0, pTransforms1, t, pResults, numTransforms );
+            }
         };
 
         struct AdditiveBlendFunction
@@ -66,6 +73,16 @@ namespace EE::Animation
             {
                 return Vector::MultiplyAdd( translationScale1, Vector( t ), translationScale0 );
             }
+
+            // Blend a contiguous range of transforms
+            EE_FORCE_INLINE static void BlendTransforms( Transform const* pTransforms0, Transform const* pTransforms1, float t, Transform* pResults, int32_t numTransforms )
+            {
+                for ( int32_t i = 0; i < numTransforms; i++ )
+                {
+                    Transform::DirectlySetRotation( pResults[i], BlendRotation( pTransforms0[i].GetRotation(), pTransforms1[i].GetRotation(), t ) );
+                    Transform::DirectlySetTranslationScale( pResults[i], BlendTranslationAndScale( pTransforms0[i].GetTranslationAndScale(), pTransforms1[i].GetTranslationAndScale(), t ) );
+                }
+            }
         };
 
     private:
@@ -217,14 +234,7 @@ namespace EE::Animation
         else // Blend
         {
             int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
-            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
-            {
-                Transform const& sourceTransform = pSourcePose->m_parentSpaceTransforms[boneIdx];
-                Transform const& targetTransform = pTargetPose->m_parentSpaceTransforms[boneIdx];
-                Transform::DirectlySetRotation( pResultPose->m_parentSpaceTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), blendWeight ) );
-                Transform::DirectlySetTranslationScale( pResultPose->m_parentSpaceTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), blendWeight ) );
-            }
-
+            BlendFunction::BlendTransforms( pSourcePose->m_parentSpaceTransforms.data(), pTargetPose->m_parentSpaceTransforms.data(), blendWeight, pResultPose->m_parentSpaceTransforms.data(), numBones );
             pResultPose->ClearModelSpaceTransforms();
         }
 
@@ -255,29 +265,57 @@ namespace EE::Animation
         }
         else // Perform blend
         {
-            int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
-            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            // Only the non-zero mask ranges need to be blended, everything else is a straight copy from the source
+            Transform const* pSourceTransforms = pSourcePose->m_parentSpaceTransforms.data();
+            Transform const* pTargetTransforms = pTargetPose->m_parentSpaceTransforms.data();
+            Transform* pResultTransforms = pResultPose->m_parentSpaceTransforms.data();
+            bool const shouldCopySource = ( pSourcePose != pResultPose );
+
+            auto CopySourceTransforms = [=] ( int32_t startIdx, int32_t endIdx )
             {
-                // If the bone has been masked out
-                float const boneBlendWeight = blendWeight * pBoneMask->GetWeight( boneIdx );
-                if ( boneBlendWeight == 0.0f )
-                {
-                    pResultPose->SetTransform( boneIdx, pSourcePose->GetTransform( boneIdx ) );
-                }
-                // If we're not blending on top of a pose, then we can skip the blend
-                else if ( !isLayeredBlend && boneBlendWeight == 1.0f )
+                if ( shouldCopySource && endIdx > startIdx )
                 {
-                    pResultPose->SetTransform( boneIdx, pTargetPose->GetTransform( boneIdx ) );
+                    memcpy( &pResultTransforms[startIdx], &pSourceTransforms[startIdx], sizeof( Transform ) * ( endIdx - startIdx ) );
                 }
-                else // Perform Blend
+            };
+
+            //-------------------------------------------------------------------------
+
+            int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
+            int32_t nextUnprocessedBoneIdx = 0;
+            for ( BoneMask::WeightRange const& range : pBoneMask->GetNonZeroWeightRanges() )
+            {
+                int32_t const rangeStartIdx = Math::Min( (int32_t) range.m_startIdx, numBones );
+                int32_t const rangeEndIdx = Math::Min( (int32_t) range.m_endIdx, numBones );
+                CopySourceTransforms( nextUnprocessedBoneIdx, rangeStartIdx );
+
+                for ( int32_t boneIdx = rangeStartIdx; boneIdx < rangeEndIdx; boneIdx++ )
                 {
-                    Transform const& sourceTransform = pSourcePose->m_parentSpaceTransforms[boneIdx];
-                    Transform const& targetTransform = pTargetPose->m_parentSpaceTransforms[boneIdx];
-                    Transform::DirectlySetRotation( pResultPose->m_parentSpaceTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight ) );
-                    Transform::DirectlySetTranslationScale( pResultPose->m_parentSpaceTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), boneBlendWeight ) );
+                    // If the bone has been masked out
+                    float const boneBlendWeight = blendWeight * pBoneMask->GetWeight( boneIdx );
+                    if ( boneBlendWeight == 0.0f )
+                    {
+                        pResultTransforms[boneIdx] = pSourceTransforms[boneIdx];
+                    }
+                    // If we're not blending on top of a pose, then we can skip the blend
+                    else if ( !isLayeredBlend && boneBlendWeight == 1.0f )
+                    {
+                        pResultTransforms[boneIdx] = pTargetTransforms[boneIdx];
+                    }
+                    else // Perform Blend
+                    {
+                        Transform const& sourceTransform = pSourceTransforms[boneIdx];
+                        Transform const& targetTransform = pTargetTransforms[boneIdx];
+                        Transform::DirectlySetRotation( pResultTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight ) );
+                        Transform::DirectlySetTranslationScale( pResultTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), boneBlendWeight ) );
+                    }
                 }
+
+                nextUnprocessedBoneIdx = Math::Max( nextUnprocessedBoneIdx, rangeEndIdx );
             }
 
+            CopySourceTransforms( nextUnprocessedBoneIdx, numBones );
+
             pResultPose->ClearModelSpaceTransforms();
         }
 
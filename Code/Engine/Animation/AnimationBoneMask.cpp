@@ -30,6 +30,7 @@ namespace EE::Animation
         m_pSkeleton = rhs.m_pSkeleton;
         m_weights = rhs.m_weights;
         m_weightInfo = rhs.m_weightInfo;
+        m_nonZeroWeightRanges = rhs.m_nonZeroWeightRanges;
     }
 
     BoneMask::BoneMask( BoneMask&& rhs )
@@ -39,6 +40,7 @@ namespace EE::Animation
         m_pSkeleton = rhs.m_pSkeleton;
         m_weights.swap( rhs.m_weights );
         m_weightInfo = rhs.m_weightInfo;
+        m_nonZeroWeightRanges = rhs.m_nonZeroWeightRanges;
     }
 
     BoneMask::BoneMask( Skeleton const* pSkeleton, SerializedData const& serializedMask )
@@ -60,11 +62,111 @@ namespace EE::Animation
         return m_pSkeleton != nullptr && !m_weights.empty() && m_weights.size() == CalculateNumWeightsToSet( m_pSkeleton->GetNumBones() );
     }
 
+    int32_t BoneMask::GetNumBones() const
+    {
+        EE_ASSERT( m_pSkeleton != nullptr );
+        return m_pSkeleton->GetNumBones();
+    }
+
+    void BoneMask::UpdateWeightInfo()
+    {
+        EE_ASSERT( m_weights.size() % 4 == 0 );
+
+        m_nonZeroWeightRanges.clear();
+
+        auto AddRange = [this] ( int32_t startIdx, int32_t endIdx )
+        {
+            // If we've run out of ranges, merge with the last range (this only reduces how much we can skip)
+            if ( m_nonZeroWeightRanges.size() == s_maxNonZeroWeightRanges )
+            {
+                m_nonZeroWeightRanges.back().m_endIdx = (int16_t) endIdx;
+            }
+            else
+            {
+                m_nonZeroWeightRanges.emplace_back( startIdx, endIdx );
+            }
+        };
+
+        //-------------------------------------------------------------------------
+        // Scan 4 weights at a time and only drop to per-bone checks for groups that mix zero and non-zero weights
+
+        int32_t const numBones = GetNumBones();
+        int32_t const numWeights = (int32_t) m_weights.size();
+        int32_t rangeStartIdx = InvalidIndex;
+        bool areAllZero = true;
+        bool areAllOne = true;
+
+        for ( int32_t i = 0; i < numWeights; i += 4 )
+        {
+            // Treat the padding weights as zero
+            int32_t const invalidLanesMask = ( i + 4 > numBones ) ? ( 0xF & ~( ( 1 << Math::Max( numBones - i, 0 ) ) - 1 ) ) : 0;
+
+            Vector const vWeights( &m_weights[i] );
+            int32_t const zeroMask = _mm_movemask_ps( vWeights.EqualsZero() ) | invalidLanesMask;
+            int32_t const oneMask = _mm_movemask_ps( vWeights.Equal( Vector::One ) ) | invalidLanesMask;
+            areAllZero &= ( zeroMask == 0xF );
+            areAllOne &= ( oneMask == 0xF );
+
+            if ( zeroMask == 0xF )
+            {
+                if ( rangeStartIdx != InvalidIndex )
+                {
+                    AddRange( rangeStartIdx, i );
+                    rangeStartIdx = InvalidIndex;
+                }
+            }
+            else if ( zeroMask == 0 )
+            {
+                if ( rangeStartIdx == InvalidIndex )
+                {
+                    rangeStartIdx = i;
+                }
+            }
+            else // Mixed group
+            {
+                for ( int32_t j = 0; j < 4; j++ )
+                {
+                    bool const isZero = ( zeroMask & ( 1 << j ) ) != 0;
+                    if ( isZero && rangeStartIdx != InvalidIndex )
+                    {
+                        AddRange( rangeStartIdx, i + j );
+                        rangeStartIdx = InvalidIndex;
+                    }
+                    else if ( !isZero && rangeStartIdx == InvalidIndex )
+                    {
+                        rangeStartIdx = i + j;
+                    }
+                }
+            }
+        }
+
+        if ( rangeStartIdx != InvalidIndex )
+        {
+            AddRange( rangeStartIdx, numBones );
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( areAllZero )
+        {
+            m_weightInfo = WeightInfo::Zero;
+        }
+        else if ( areAllOne )
+        {
+            m_weightInfo = WeightInfo::One;
+        }
+        else
+        {
+            m_weightInfo = WeightInfo::Mixed;
+        }
+    }
+
     BoneMask& BoneMask::operator=( BoneMask const& rhs )
     {
         m_pSkeleton = rhs.m_pSkeleton;
         m_weights = rhs.m_weights;
         m_weightInfo = rhs.m_weightInfo;
+        m_nonZeroWeightRanges = rhs.m_nonZeroWeightRanges;
 
         EE_ASSERT( m_weights.size() % 4 == 0 );
 
@@ -76,6 +178,7 @@ namespace EE::Animation
         m_pSkeleton = rhs.m_pSkeleton;
         m_weights.swap( rhs.m_weights );
         m_weightInfo = rhs.m_weightInfo;
+        m_nonZeroWeightRanges = rhs.m_nonZeroWeightRanges;
 
         EE_ASSERT( m_weights.size() % 4 == 0 );
 
@@ -91,7 +194,7 @@ namespace EE::Animation
         EE_ASSERT( fixedWeight >= 0.0f && fixedWeight <= 1.0f );
 
         int32_t const numWeightsToAllocate = CalculateNumWeightsToSet( m_pSkeleton->GetNumBones() );
-        m_weights.resize( numWeightsToAllocate, fixedWeight );
+        m_weights.assign( numWeightsToAllocate, fixedWeight );
         SetWeightInfo( fixedWeight );
     }
 
@@ -106,23 +209,7 @@ namespace EE::Animation
         EE_ASSERT( m_weights.size() >= boneWeights.size() );
 
         memcpy( m_weights.data(), boneWeights.data(), sizeof( float ) * boneWeights.size() );
-
-        //-------------------------------------------------------------------------
-
-        m_weightInfo = WeightInfo::Zero;
-
-        float fixedWeight = m_weights[0];
-        for ( float weight : boneWeights )
-        {
-            if ( weight != fixedWeight )
-            {
-                m_weightInfo = WeightInfo::Mixed;
-                return;
-            }
-        }
-
-        // If we get here then all weights are equal
-        SetWeightInfo( fixedWeight );
+        UpdateWeightInfo();
     }
 
     void BoneMask::ResetWeights( SerializedData const& serializedMask )
@@ -231,30 +318,52 @@ namespace EE::Animation
         // Weight info
         //-------------------------------------------------------------------------
 
-        m_weightInfo = WeightInfo::Zero;
-        float fixedWeight = m_weights[0];
-        for ( int32_t i = 1; i < m_weights.size(); i++ )
+        UpdateWeightInfo();
+    }
+
+    BoneMask& BoneMask::operator*=( BoneMask const& rhs )
+    {
+        EE_ASSERT( rhs.m_pSkeleton == m_pSkeleton && m_weights.size() == rhs.m_weights.size() );
+
+        // Multiplying by one or into a zero mask changes nothing
+        if ( rhs.m_weightInfo == WeightInfo::One || m_weightInfo == WeightInfo::Zero )
         {
-            if ( m_weights[i] != fixedWeight )
-            {
-                m_weightInfo = WeightInfo::Mixed;
-                break;
-            }
+            return *this;
         }
 
-        if ( m_weightInfo != WeightInfo::Mixed )
+        if ( rhs.m_weightInfo == WeightInfo::Zero )
         {
-            SetWeightInfo( fixedWeight );
+            ResetWeights();
+            return *this;
         }
-    }
 
-    BoneMask& BoneMask::operator*=( BoneMask const& rhs )
-    {
-        int32_t const numWeights = (int32_t) m_weights.size();
-        for ( auto i = 0; i < numWeights; i++ )
+        if ( m_weightInfo == WeightInfo::One )
         {
-            m_weights[i] *= rhs.m_weights[i];
+            m_weights = rhs.m_weights;
+            m_weightInfo = rhs.m_weightInfo;
+            m_nonZeroWeightRanges = rhs.m_nonZeroWeightRanges;
+            return *this;
+        }
+
+        //-------------------------------------------------------------------------
+        // The result can only be non-zero where our weights are non-zero so only process our ranges
+        // The ranges are sorted, neighboring ranges can share a 4-wide group so skip any groups we've already processed
+
+        int32_t nextUnprocessedIdx = 0;
+        for ( WeightRange const& range : m_nonZeroWeightRanges )
+        {
+            int32_t i = Math::Max( range.m_startIdx & ~3, nextUnprocessedIdx );
+            for ( ; i < range.m_endIdx; i += 4 )
+            {
+                Vector const vWeights( &m_weights[i] );
+                Vector const vRhsWeights( &rhs.m_weights[i] );
+                ( vWeights * vRhsWeights ).Store( &m_weights[i] );
+            }
+
+            nextUnprocessedIdx = Math::Max( nextUnprocessedIdx, i );
         }
+
+        UpdateWeightInfo();
         return *this;
     }
 
@@ -285,6 +394,7 @@ namespace EE::Animation
         {
             m_weights = source.m_weights;
             m_weightInfo = source.m_weightInfo;
+            m_nonZeroWeightRanges = source.m_nonZeroWeightRanges;
             return;
         }
 
@@ -304,7 +414,7 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
-        m_weightInfo = WeightInfo::Mixed;
+        UpdateWeightInfo();
     }
 
     void BoneMask::BlendTo( BoneMask const& target, float blendWeight )
@@ -334,6 +444,7 @@ namespace EE::Animation
         {
             m_weights = target.m_weights;
             m_weightInfo = target.m_weightInfo;
+            m_nonZeroWeightRanges = target.m_nonZeroWeightRanges;
             return;
         }
 
@@ -351,7 +462,7 @@ namespace EE::Animation
             vResult.Store( &m_weights[i] );
         }
 
-        m_weightInfo = WeightInfo::Mixed;
+        UpdateWeightInfo();
     }
 
     void BoneMask::ScaleWeights( float scale )
@@ -371,13 +482,26 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
+        // Scaling by a non-zero value doesnt change which bones are zero weighted so only process the non-zero ranges
+        // Neighboring ranges can share a 4-wide group, so skip any groups we've already scaled
         Vector vScale( scale );
-        size_t const numWeights = m_weights.size();
-        for ( size_t i = 0; i < numWeights; i += 4 )
+        int32_t nextUnprocessedIdx = 0;
+        for ( WeightRange const& range : m_nonZeroWeightRanges )
         {
-            Vector const vWeights( &m_weights[i] );
-            Vector const vScaledWeights = vWeights * vScale;
-            vScaledWeights.Store( &m_weights[i] );
+            int32_t i = Math::Max( range.m_startIdx & ~3, nextUnprocessedIdx );
+            for ( ; i < range.m_endIdx; i += 4 )
+            {
+                Vector const vWeights( &m_weights[i] );
+                Vector const vScaledWeights = vWeights * vScale;
+                vScaledWeights.Store( &m_weights[i] );
+            }
+
+            nextUnprocessedIdx = Math::Max( nextUnprocessedIdx, i );
+        }
+
+        if ( m_weightInfo == WeightInfo::One )
+        {
+            m_weightInfo = WeightInfo::Mixed;
         }
     }
 
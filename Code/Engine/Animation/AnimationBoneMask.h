@@ -29,6 +29,23 @@ namespace EE::Animation
             One, // All weights are set to 1.0f
         };
 
+        // A contiguous run of bones [start, end) with non-zero weights
+        struct WeightRange
+        {
+            WeightRange() = default;
+            WeightRange( int32_t startIdx, int32_t endIdx ) : m_startIdx( (int16_t) startIdx ), m_endIdx( (int16_t) endIdx ) { EE_ASSERT( startIdx <= endIdx ); }
+
+            inline int32_t GetLength() const { return m_endIdx - m_startIdx; }
+
+            int16_t             m_startIdx = 0;
+            int16_t             m_endIdx = 0;
+        };
+
+        // Masks with more ranges than this will have all the remaining ranges folded into the last range (covering any zero weight gaps between them)
+        constexpr static int32_t const s_maxNonZeroWeightRanges = 8;
+
+        using WeightRangeList = TInlineVector<WeightRange, s_maxNonZeroWeightRanges>;
+
         struct SerializedData
         {
             EE_SERIALIZE( m_ID, m_weights );
@@ -68,6 +85,10 @@ namespace EE::Animation
         inline float operator[]( uint32_t i ) const { return GetWeight( i ); }
         BoneMask& operator*=( BoneMask const& rhs );
 
+        // Get the (sparse) set of bone ranges that have non-zero weights, every bone outside of these ranges has a zero weight.
+        // Note: ranges may contain zero weight bones if the mask is too fragmented to be tracked exactly
+        inline WeightRangeList const& GetNonZeroWeightRanges() const { return m_nonZeroWeightRanges; }
+
         //-------------------------------------------------------------------------
 
         // Is this a zero mask? i.e. all the weights are set to 1.0f and therefore no masking will occur
@@ -82,7 +103,7 @@ namespace EE::Animation
         //-------------------------------------------------------------------------
 
         // Set all weights to zero
-        void ResetWeights() { Memory::MemsetZero( m_weights.data(), m_weights.size() ); m_weightInfo = WeightInfo::Zero; }
+        void ResetWeights() { Memory::MemsetZero( m_weights.data(), m_weights.size() * sizeof( float ) ); m_weightInfo = WeightInfo::Zero; m_nonZeroWeightRanges.clear(); }
 
         // Set all weights to a fixed weight
         void ResetWeights( float fixedWeight );
@@ -110,6 +131,8 @@ namespace EE::Animation
 
         EE_FORCE_INLINE void SetWeightInfo( float fixedWeight )
         {
+            m_nonZeroWeightRanges.clear();
+
             if ( fixedWeight == 0.0f )
             {
                 m_weightInfo = WeightInfo::Zero;
@@ -117,19 +140,28 @@ namespace EE::Animation
             else if ( fixedWeight == 1.0f )
             {
                 m_weightInfo = WeightInfo::One;
+                m_nonZeroWeightRanges.emplace_back( 0, GetNumBones() );
             }
             else
             {
                 m_weightInfo = WeightInfo::Mixed;
+                m_nonZeroWeightRanges.emplace_back( 0, GetNumBones() );
             }
         }
 
+        // Get the number of actual bones in the mask (the weights are padded to a multiple of 4)
+        int32_t GetNumBones() const;
+
+        // Recalculate the weight info and non-zero weight ranges from the current weights
+        void UpdateWeightInfo();
+
     private:
 
         StringID                    m_ID;
         WeightInfo                  m_weightInfo = WeightInfo::Zero;
         Skeleton const*             m_pSkeleton = nullptr;
         TVector<float>              m_weights;
+        WeightRangeList             m_nonZeroWeightRanges;
     };
 
     // Bone Mask Task System
@@ -1,6 +1,7 @@
 #include "AnimationClip.h"
 #include "Engine/Animation/AnimationPose.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Math/BatchMath.h"
 #include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
@@ -88,10 +89,7 @@ namespace EE::Animation
             ReadCompressedPose( frameTime.GetUpperBoundFrameIndex(), tmpPose.data() );
 
             float const percentageThrough = frameTime.GetPercentageThrough().ToFloat();
-            for ( auto i = 0; i < numBones; i++ )
-            {
-                pOutPose->m_parentSpaceTransforms[i] = Transform::FastSLerp( pOutPose->m_parentSpaceTransforms[i], tmpPose[i], percentageThrough );
-            }
+            BatchMath::FastSLerp( pOutPose->m_parentSpaceTransforms.data(), tmpPose.data(), percentageThrough, pOutPose->m_parentSpaceTransforms.data(), numBones );
         }
 
         // Flag the pose as being set
@@ -9,6 +9,7 @@
 #include "Base/Math/NumericRange.h"
 #include "Base/Time/Time.h"
 #include "Base/Encoding/Quantization.h"
+#include "EASTL/algorithm.h"
 
 //-------------------------------------------------------------------------
 
@@ -84,8 +85,8 @@ namespace EE::Animation
 
     class EE_ENGINE_API AnimationClip : public Resource::IResource
     {
-        EE_RESOURCE( 'anim', "Animation Clip", 57, false );
-        EE_SERIALIZE( m_skeleton, m_numFrames, m_duration, m_compressedPoseData, m_compressedPoseOffsets, m_trackCompressionSettings, m_rootMotion, m_isAdditive );
+        EE_RESOURCE( 'anim', "Animation Clip", 58, false );
+        EE_SERIALIZE( m_skeleton, m_numFrames, m_duration, m_compressedPoseData, m_compressedPoseOffsets, m_trackCompressionSettings, m_rootMotion, m_isAdditive, m_eventStartTimes, m_eventMaxEndTimes );
 
         friend class AnimationClipCompiler;
         friend class AnimationClipLoader;
@@ -230,6 +231,8 @@ namespace EE::Animation
         TVector<TrackCompressionSettings>       m_trackCompressionSettings;
         TVector<uint32_t>                       m_compressedPoseOffsets;
         TVector<Event*>                         m_events;
+        TVector<float>                          m_eventStartTimes;          // The start time for each event, events are sorted by start time
+        TVector<float>                          m_eventMaxEndTimes;         // The latest end time of all events up to and including each event (monotonically increasing)
         TInlineVector<AnimationClip const*,1>   m_secondaryAnimations;
         SyncTrack                               m_syncTrack;
         bool                                    m_isAdditive = false;
@@ -247,16 +250,21 @@ namespace EE::Animation
     inline void AnimationClip::GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const
     {
         EE_ASSERT( toTime >= fromTime );
+        EE_ASSERT( m_eventStartTimes.size() == m_events.size() && m_eventMaxEndTimes.size() == m_events.size() );
 
-        for ( auto const& pEvent : m_events )
-        {
-            // Events are stored sorted by time so as soon as we reach an event after the end of the time range, we're done
-            if ( pEvent->GetStartTime() > toTime )
-            {
-                break;
-            }
+        // Events are sorted by start time so every event after the first one that starts after the range end can be skipped
+        auto const endIter = eastl::upper_bound( m_eventStartTimes.begin(), m_eventStartTimes.end(), toTime.ToFloat() );
+        int32_t const endIdx = (int32_t) ( endIter - m_eventStartTimes.begin() );
 
-            if ( FloatRange( fromTime, toTime ).Overlaps( pEvent->GetTimeRange() ) )
+        // All events before the first event whose running max end time reaches the range start have ended before the range
+        auto const startIter = eastl::lower_bound( m_eventMaxEndTimes.begin(), m_eventMaxEndTimes.begin() + endIdx, fromTime.ToFloat() );
+        int32_t const startIdx = (int32_t) ( startIter - m_eventMaxEndTimes.begin() );
+
+        FloatRange const queryRange( fromTime, toTime );
+        for ( int32_t i = startIdx; i < endIdx; i++ )
+        {
+            Event const* pEvent = m_events[i];
+            if ( queryRange.Overlaps( pEvent->GetTimeRange() ) )
             {
                 outEvents.emplace_back( pEvent );
             }
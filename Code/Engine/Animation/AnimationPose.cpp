@@ -30,6 +30,9 @@ namespace EE::Animation
         m_pSkeleton = rhs.m_pSkeleton;
         m_parentSpaceTransforms.swap( rhs.m_parentSpaceTransforms );
         m_modelSpaceTransforms.swap( rhs.m_modelSpaceTransforms );
+        m_dirtyBones.swap( rhs.m_dirtyBones );
+        m_firstDirtyBoneIdx = rhs.m_firstDirtyBoneIdx;
+        m_isModelSpaceCacheInvalid = rhs.m_isModelSpaceCacheInvalid;
         m_state = rhs.m_state;
 
         return *this;
@@ -40,6 +43,9 @@ namespace EE::Animation
         m_pSkeleton = rhs.m_pSkeleton;
         m_parentSpaceTransforms = rhs.m_parentSpaceTransforms;
         m_modelSpaceTransforms = rhs.m_modelSpaceTransforms;
+        m_dirtyBones = rhs.m_dirtyBones;
+        m_firstDirtyBoneIdx = rhs.m_firstDirtyBoneIdx;
+        m_isModelSpaceCacheInvalid = rhs.m_isModelSpaceCacheInvalid;
         m_state = rhs.m_state;
 
         return *this;
@@ -50,6 +56,9 @@ namespace EE::Animation
         m_pSkeleton = rhs.m_pSkeleton;
         m_parentSpaceTransforms = rhs.m_parentSpaceTransforms;
         m_modelSpaceTransforms = rhs.m_modelSpaceTransforms;
+        m_dirtyBones = rhs.m_dirtyBones;
+        m_firstDirtyBoneIdx = rhs.m_firstDirtyBoneIdx;
+        m_isModelSpaceCacheInvalid = rhs.m_isModelSpaceCacheInvalid;
         m_state = rhs.m_state;
     }
 
@@ -63,8 +72,12 @@ namespace EE::Animation
         m_state = rhs.m_state;
         rhs.m_state = tempState;
 
+        eastl::swap( m_firstDirtyBoneIdx, rhs.m_firstDirtyBoneIdx );
+        eastl::swap( m_isModelSpaceCacheInvalid, rhs.m_isModelSpaceCacheInvalid );
+
         m_parentSpaceTransforms.swap( rhs.m_parentSpaceTransforms );
         m_modelSpaceTransforms.swap( rhs.m_modelSpaceTransforms );
+        m_dirtyBones.swap( rhs.m_dirtyBones );
     }
 
     void Pose::ChangeSkeleton( Skeleton const* pSkeleton )
@@ -79,6 +92,8 @@ namespace EE::Animation
         m_pSkeleton = pSkeleton;
         m_parentSpaceTransforms.resize( pSkeleton->GetNumBones() );
         m_modelSpaceTransforms.clear();
+        m_dirtyBones.clear();
+        ClearModelSpaceTransforms();
         m_state = State::Unset;
     }
 
@@ -103,6 +118,7 @@ namespace EE::Animation
             default:
             {
                 // Leave memory intact, just change state
+                ClearModelSpaceTransforms();
                 m_state = State::Unset;
             }
             break;
@@ -116,10 +132,11 @@ namespace EE::Animation
         if ( setGlobalPose )
         {
             m_modelSpaceTransforms = m_pSkeleton->GetModelSpaceReferencePose();
+            ResetModelSpaceDirtyState();
         }
         else
         {
-            m_modelSpaceTransforms.clear();
+            ClearModelSpaceTransforms();
         }
 
         m_state = State::ReferencePose;
@@ -134,10 +151,11 @@ namespace EE::Animation
         if ( setGlobalPose )
         {
             m_modelSpaceTransforms = m_parentSpaceTransforms;
+            ResetModelSpaceDirtyState();
         }
         else
         {
-            m_modelSpaceTransforms.clear();
+            ClearModelSpaceTransforms();
         }
 
         m_state = State::ZeroPose;
@@ -145,61 +163,126 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    void Pose::ResetModelSpaceDirtyState()
+    {
+        int32_t const numBones = m_pSkeleton->GetNumBones();
+        m_dirtyBones.resize( numBones );
+        eastl::fill( m_dirtyBones.begin(), m_dirtyBones.end(), false );
+        m_firstDirtyBoneIdx = InvalidIndex;
+        m_isModelSpaceCacheInvalid = false;
+    }
+
     void Pose::CalculateModelSpaceTransforms( Skeleton::LOD lod )
     {
         int32_t const numTotalBones = m_pSkeleton->GetNumBones( Skeleton::LOD::High );
         int32_t const numRelevantBones = m_pSkeleton->GetNumBones( lod );
-        m_modelSpaceTransforms.resize( numTotalBones );
 
-        m_modelSpaceTransforms[0] = m_parentSpaceTransforms[0];
-        for ( int32_t boneIdx = 1; boneIdx < numRelevantBones; boneIdx++ )
+        // Full update
+        //-------------------------------------------------------------------------
+
+        if ( m_isModelSpaceCacheInvalid || m_modelSpaceTransforms.size() != numTotalBones )
+        {
+            m_modelSpaceTransforms.resize( numTotalBones );
+
+            m_modelSpaceTransforms[0] = m_parentSpaceTransforms[0];
+            for ( int32_t boneIdx = 1; boneIdx < numRelevantBones; boneIdx++ )
+            {
+                int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
+                EE_ASSERT( parentIdx < boneIdx );
+                m_modelSpaceTransforms[boneIdx] = m_parentSpaceTransforms[boneIdx] * m_modelSpaceTransforms[parentIdx];
+            }
+
+            ResetModelSpaceDirtyState();
+            return;
+        }
+
+        // Incremental update
+        //-------------------------------------------------------------------------
+        // Bones are sorted so that parents always precede children, so we can propagate the dirty flags down the hierarchy as we go.
+        // Any bone before the first dirty bone is guaranteed to be unaffected.
+
+        if ( m_firstDirtyBoneIdx == InvalidIndex )
+        {
+            return;
+        }
+
+        int32_t firstBoneToUpdate = m_firstDirtyBoneIdx;
+        if ( firstBoneToUpdate == 0 )
+        {
+            m_modelSpaceTransforms[0] = m_parentSpaceTransforms[0];
+            firstBoneToUpdate = 1;
+        }
+
+        for ( int32_t boneIdx = firstBoneToUpdate; boneIdx < numRelevantBones; boneIdx++ )
         {
             int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
             EE_ASSERT( parentIdx < boneIdx );
-            m_modelSpaceTransforms[boneIdx] = m_parentSpaceTransforms[boneIdx] * m_modelSpaceTransforms[parentIdx];
+
+            if ( m_dirtyBones[boneIdx] || m_dirtyBones[parentIdx] )
+            {
+                m_dirtyBones[boneIdx] = true;
+                m_modelSpaceTransforms[boneIdx] = m_parentSpaceTransforms[boneIdx] * m_modelSpaceTransforms[parentIdx];
+            }
         }
+
+        eastl::fill( m_dirtyBones.begin() + m_firstDirtyBoneIdx, m_dirtyBones.end(), false );
+        m_firstDirtyBoneIdx = InvalidIndex;
     }
 
     Transform Pose::GetModelSpaceTransform( int32_t boneIdx ) const
     {
         EE_ASSERT( boneIdx < m_pSkeleton->GetNumBones() );
 
-        Transform boneModelSpaceTransform;
-        if ( !m_modelSpaceTransforms.empty() )
-        {
-            boneModelSpaceTransform = m_modelSpaceTransforms[boneIdx];
-        }
-        else
-        {
-            auto boneParents = EE_STACK_ARRAY_ALLOC( int32_t, m_pSkeleton->GetNumBones() );
-            int32_t nextEntry = 0;
+        // Try to use the cache
+        //-------------------------------------------------------------------------
+        // If the cache is valid, find the highest dirty bone in this bone's chain, everything above it is still valid
 
-            // Get parent list
-            int32_t parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
-            while ( parentIdx != InvalidIndex )
+        int32_t cachedAncestorIdx = InvalidIndex;
+        if ( !m_isModelSpaceCacheInvalid )
+        {
+            if ( m_firstDirtyBoneIdx == InvalidIndex || boneIdx < m_firstDirtyBoneIdx )
             {
-                boneParents[nextEntry++] = parentIdx;
-                parentIdx = m_pSkeleton->GetParentBoneIndex( parentIdx );
+                return m_modelSpaceTransforms[boneIdx];
             }
 
-            // If we have parents
-            boneModelSpaceTransform = m_parentSpaceTransforms[boneIdx];
-            if ( nextEntry > 0 )
+            int32_t highestDirtyBoneIdx = InvalidIndex;
+            for ( int32_t idx = boneIdx; idx >= m_firstDirtyBoneIdx; idx = m_pSkeleton->GetParentBoneIndex( idx ) )
             {
-                // Calculate global transform of parent
-                int32_t arrayIdx = nextEntry - 1;
-                parentIdx = boneParents[arrayIdx--];
-                Transform parentModelSpaceTransform = m_parentSpaceTransforms[parentIdx];
-                for ( ; arrayIdx >= 0; arrayIdx-- )
+                if ( m_dirtyBones[idx] )
                 {
-                    int32_t const nextIdx = boneParents[arrayIdx];
-                    Transform const& nextTransform = m_parentSpaceTransforms[nextIdx];
-                    parentModelSpaceTransform = nextTransform * parentModelSpaceTransform;
+                    highestDirtyBoneIdx = idx;
                 }
+            }
 
-                // Calculate global transform of bone
-                boneModelSpaceTransform = boneModelSpaceTransform * parentModelSpaceTransform;
+            if ( highestDirtyBoneIdx == InvalidIndex )
+            {
+                return m_modelSpaceTransforms[boneIdx];
             }
+
+            cachedAncestorIdx = m_pSkeleton->GetParentBoneIndex( highestDirtyBoneIdx );
+        }
+
+        // Calculate the transform from the closest valid ancestor (or the root)
+        //-------------------------------------------------------------------------
+
+        auto boneChain = EE_STACK_ARRAY_ALLOC( int32_t, m_pSkeleton->GetNumBones() );
+        int32_t chainLength = 0;
+
+        for ( int32_t idx = boneIdx; idx != cachedAncestorIdx; idx = m_pSkeleton->GetParentBoneIndex( idx ) )
+        {
+            boneChain[chainLength++] = idx;
+        }
+
+        int32_t chainIdx = chainLength - 1;
+        Transform boneModelSpaceTransform = m_parentSpaceTransforms[boneChain[chainIdx--]];
+        if ( cachedAncestorIdx != InvalidIndex )
+        {
+            boneModelSpaceTransform = boneModelSpaceTransform * m_modelSpaceTransforms[cachedAncestorIdx];
+        }
+
+        for ( ; chainIdx >= 0; chainIdx-- )
+        {
+            boneModelSpaceTransform = m_parentSpaceTransforms[boneChain[chainIdx]] * boneModelSpaceTransform;
         }
 
         return boneModelSpaceTransform;
@@ -91,6 +91,7 @@ namespace EE::Animation
         {
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
             m_parentSpaceTransforms[boneIdx] = transform;
+            MarkModelSpaceTransformDirty( boneIdx );
             MarkAsValidPose();
         }
 
@@ -98,6 +99,7 @@ namespace EE::Animation
         {
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
             m_parentSpaceTransforms[boneIdx].SetRotation( rotation );
+            MarkModelSpaceTransformDirty( boneIdx );
             MarkAsValidPose();
         }
 
@@ -105,6 +107,7 @@ namespace EE::Animation
         {
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
             m_parentSpaceTransforms[boneIdx].SetTranslation( translation );
+            MarkModelSpaceTransformDirty( boneIdx );
             MarkAsValidPose();
         }
 
@@ -113,22 +116,33 @@ namespace EE::Animation
         {
             EE_ASSERT( boneIdx < GetNumBones() && boneIdx >= 0 );
             m_parentSpaceTransforms[boneIdx].SetScale( uniformScale );
+            MarkModelSpaceTransformDirty( boneIdx );
             MarkAsValidPose();
         }
 
         // Model-Space Transform Cache
         //-------------------------------------------------------------------------
+        // Setting individual bone transforms only dirties those bones, so recalculating the cache only updates the affected sub-hierarchies
 
-        inline bool HasModelSpaceTransforms() const { return !m_modelSpaceTransforms.empty(); }
-        inline void ClearModelSpaceTransforms() { m_modelSpaceTransforms.clear(); }
-        inline TVector<Transform> const& GetModelSpaceTransforms() const { return m_modelSpaceTransforms; }
+        // Is the cache fully up to date
+        inline bool HasModelSpaceTransforms() const { return !m_isModelSpaceCacheInvalid && m_firstDirtyBoneIdx == InvalidIndex; }
+
+        // Invalidate the whole cache, needed when the parent-space transforms are modified directly
+        inline void ClearModelSpaceTransforms() { m_isModelSpaceCacheInvalid = true; m_firstDirtyBoneIdx = InvalidIndex; }
+
+        inline TVector<Transform> const& GetModelSpaceTransforms() const { EE_ASSERT( HasModelSpaceTransforms() ); return m_modelSpaceTransforms; }
+
+        // Update the cache, only dirty bones and their children are recalculated if the cache is still valid
         void CalculateModelSpaceTransforms( Skeleton::LOD lod = Skeleton::LOD::High );
+
+        // Get the model space transform for a bone, this will use any valid cached ancestor transforms
         Transform GetModelSpaceTransform( int32_t boneIdx ) const;
 
         // Debug
         //-------------------------------------------------------------------------
 
         #if EE_DEVELOPMENT_TOOLS
+        size_t GetAllocatedMemory() const { return sizeof( Pose ) + ( m_parentSpaceTransforms.capacity() + m_modelSpaceTransforms.capacity() ) * sizeof( Transform ); }
         void DrawDebug( Drawing::DrawContext& ctx, Transform const& worldTransform, Skeleton::LOD lod = Skeleton::LOD::High, Color color = Colors::HotPink, float lineThickness = 2.0f, bool bDrawBoneNames = false, BoneMask const* pBoneMask = nullptr, TVector<int32_t> const& boneIdxFilter = {} ) const;
         #endif
 
@@ -139,6 +153,23 @@ namespace EE::Animation
         void SetToReferencePose( bool setGlobalPose );
         void SetToZeroPose( bool setGlobalPose );
 
+        // Flag the model-space cache as fully valid
+        void ResetModelSpaceDirtyState();
+
+        EE_FORCE_INLINE void MarkModelSpaceTransformDirty( int32_t boneIdx )
+        {
+            if ( m_isModelSpaceCacheInvalid )
+            {
+                return;
+            }
+
+            m_dirtyBones[boneIdx] = true;
+            if ( m_firstDirtyBoneIdx == InvalidIndex || boneIdx < m_firstDirtyBoneIdx )
+            {
+                m_firstDirtyBoneIdx = boneIdx;
+            }
+        }
+
         EE_FORCE_INLINE void MarkAsValidPose()
         {
             if ( m_state != State::Pose && m_state != State::AdditivePose )
@@ -152,6 +183,9 @@ namespace EE::Animation
         Skeleton const*             m_pSkeleton;                // The skeleton for this pose
         TVector<Transform>          m_parentSpaceTransforms;    // Parent-space transforms
         TVector<Transform>          m_modelSpaceTransforms;     // Model-space transforms
+        TVector<bool>               m_dirtyBones;               // Bones whose parent-space transform changed since the model-space cache was calculated
+        int32_t                     m_firstDirtyBoneIdx = InvalidIndex; // The lowest dirty bone index, bones before this one have valid cached model-space transforms
+        bool                        m_isModelSpaceCacheInvalid = true; // Is the entire model-space cache invalid
         State                       m_state = State::Unset;     // Pose state
     };
 }
\ No newline at end of file
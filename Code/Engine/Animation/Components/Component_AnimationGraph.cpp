@@ -4,6 +4,7 @@
 #include "Engine/Animation/AnimationPose.h"
 #include "Engine/UpdateContext.h"
 #include "Engine/Physics/PhysicsWorld.h"
+#include "Base/Memory/MemoryTags.h"
 
 //-------------------------------------------------------------------------
 
@@ -89,6 +90,7 @@ namespace EE::Animation
 
     void GraphComponent::EvaluateGraph( Seconds deltaTime, Transform const& characterWorldTransform, Physics::PhysicsWorld* pPhysicsWorld )
     {
+        EE_MEMORY_TAG_SCOPE( Animation );
         EE_ASSERT( HasGraph() );
 
         m_pGraphInstance->SetSkeletonLOD( m_skeletonLOD );
@@ -103,12 +105,14 @@ namespace EE::Animation
 
     void GraphComponent::ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform )
     {
+        EE_MEMORY_TAG_SCOPE( Animation );
         EE_ASSERT( HasGraph() );
         m_pGraphInstance->ExecutePrePhysicsPoseTasks( characterWorldTransform );
     }
 
     void GraphComponent::ExecutePostPhysicsTasks()
     {
+        EE_MEMORY_TAG_SCOPE( Animation );
         EE_ASSERT( HasGraph() );
         m_pGraphInstance->ExecutePostPhysicsPoseTasks();
     }
@@ -514,7 +514,7 @@ namespace EE::Animation
 
                 ImGui::TableNextColumn();
                 ImGui::AlignTextToFramePadding();
-                if ( sampledEvent.IsFromActiveBranch() )
+                if ( sampledEvents.IsFromActiveBranch( i ) )
                 {
                     ImGui::TextColored( Colors::Lime.ToFloat4(), EE_ICON_SOURCE_BRANCH_CHECK );
                     ImGuiX::TextTooltip( "Active Branch" );
@@ -526,7 +526,7 @@ namespace EE::Animation
                 }
 
                 ImGui::TableNextColumn();
-                if ( sampledEvent.IsIgnored() )
+                if ( sampledEvents.IsIgnored( i ) )
                 {
                     ImGui::SameLine( 4.0f );
                     ImGui::TextColored( Colors::LightGray.ToFloat4(), EE_ICON_CLOSE );
@@ -541,7 +541,7 @@ namespace EE::Animation
                 //-------------------------------------------------------------------------
 
                 ImGui::TableNextColumn();
-                ImGui::TextColored( Color::EvaluateRedGreenGradient( sampledEvent.GetWeight() ).ToFloat4(), "%.2f", sampledEvent.GetWeight() );
+                ImGui::TextColored( Color::EvaluateRedGreenGradient( sampledEvents.GetWeight( i ) ).ToFloat4(), "%.2f", sampledEvents.GetWeight( i ) );
 
                 ImGui::TableNextColumn();
                 ImGui::TextColored( Color::EvaluateRedGreenGradient( sampledEvent.GetPercentageThrough().ToFloat() ).ToFloat4(), "%.1f", sampledEvent.GetPercentageThrough().ToFloat() * 100 );
@@ -649,7 +649,7 @@ namespace EE::Animation
 
                 ImGui::TableNextColumn();
                 ImGui::AlignTextToFramePadding();
-                if ( sampledEvent.IsFromActiveBranch() )
+                if ( sampledEvents.IsFromActiveBranch( i ) )
                 {
                     ImGui::TextColored( Colors::Lime.ToFloat4(), EE_ICON_SOURCE_BRANCH_CHECK );
                     ImGuiX::TextTooltip( "Active Branch" );
@@ -661,7 +661,7 @@ namespace EE::Animation
                 }
 
                 ImGui::TableNextColumn();
-                if ( sampledEvent.IsIgnored() )
+                if ( sampledEvents.IsIgnored( i ) )
                 {
                     ImGui::TextColored( Colors::LightGray.ToFloat4(), EE_ICON_CLOSE );
                     ImGuiX::TextTooltip( "Ignored" );
@@ -675,7 +675,7 @@ namespace EE::Animation
                 //-------------------------------------------------------------------------
 
                 ImGui::TableNextColumn();
-                ImGui::TextColored( Color::EvaluateRedGreenGradient( sampledEvent.GetWeight() ).ToFloat4(), "%.2f", sampledEvent.GetWeight() );
+                ImGui::TextColored( Color::EvaluateRedGreenGradient( sampledEvents.GetWeight( i ) ).ToFloat4(), "%.2f", sampledEvents.GetWeight( i ) );
 
                 ImGui::TableNextColumn();
                 {
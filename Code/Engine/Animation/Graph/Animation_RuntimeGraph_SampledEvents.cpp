@@ -24,6 +24,8 @@ namespace EE::Animation
     void SampledEventsBuffer::Clear()
     {
         m_sampledEvents.clear();
+        m_weights.clear();
+        m_flags.clear();
         m_numAnimEventsSampled = m_numStateEventsSampled = 0;
 
         #if EE_DEVELOPMENT_TOOLS
@@ -35,74 +37,12 @@ namespace EE::Animation
 
     bool SampledEventsBuffer::ContainsStateEvent( StringID ID, bool onlyFromActiveBranch ) const
     {
-        if ( onlyFromActiveBranch )
-        {
-            for ( auto const& se : m_sampledEvents )
-            {
-                if ( !se.IsStateEvent() )
-                {
-                    continue;
-                }
-
-                if ( !se.IsIgnored() && se.IsFromActiveBranch() && se.GetStateEventID() == ID )
-                {
-                    return true;
-                }
-            }
-        }
-        else
-        {
-            for ( auto const& se : m_sampledEvents )
-            {
-                if ( !se.IsStateEvent() )
-                {
-                    continue;
-                }
-
-                if ( !se.IsIgnored() && se.GetStateEventID() == ID )
-                {
-                    return true;
-                }
-            }
-        }
-
-        return false;
+        return ContainsStateEvent( SampledEventRange( 0, GetNumSampledEvents() ), ID, onlyFromActiveBranch );
     }
 
     bool SampledEventsBuffer::ContainsSpecificStateEvent( StateEventType eventType, StringID ID, bool onlyFromActiveBranch ) const
     {
-        if ( onlyFromActiveBranch )
-        {
-            for ( auto const& se : m_sampledEvents )
-            {
-                if ( !se.IsStateEvent() )
-                {
-                    continue;
-                }
-
-                if ( !se.IsIgnored() && se.IsFromActiveBranch() && se.GetStateEventType() == eventType && se.GetStateEventID() == ID )
-                {
-                    return true;
-                }
-            }
-        }
-        else
-        {
-            for ( auto const& se : m_sampledEvents )
-            {
-                if ( !se.IsStateEvent() )
-                {
-                    continue;
-                }
-
-                if ( !se.IsIgnored() && se.GetStateEventType() == eventType && se.GetStateEventID() == ID )
-                {
-                    return true;
-                }
-            }
-        }
-
-        return false;
+        return ContainsSpecificStateEvent( SampledEventRange( 0, GetNumSampledEvents() ), eventType, ID, onlyFromActiveBranch );
     }
 
     bool SampledEventsBuffer::ContainsStateEvent( SampledEventRange const& range, StringID ID, bool onlyFromActiveBranch ) const
@@ -118,12 +58,12 @@ namespace EE::Animation
                 continue;
             }
 
-            if ( se.IsIgnored() )
+            if ( IsIgnored( i ) )
             {
                 continue;
             }
 
-            if ( onlyFromActiveBranch && !se.IsFromActiveBranch() )
+            if ( onlyFromActiveBranch && !IsFromActiveBranch( i ) )
             {
                 continue;
             }
@@ -150,12 +90,12 @@ namespace EE::Animation
                 continue;
             }
 
-            if ( se.IsIgnored() )
+            if ( IsIgnored( i ) )
             {
                 continue;
             }
 
-            if ( onlyFromActiveBranch && !se.IsFromActiveBranch() )
+            if ( onlyFromActiveBranch && !IsFromActiveBranch( i ) )
             {
                 continue;
             }
@@ -220,6 +160,8 @@ namespace EE::Animation
 
         m_sampledEvents.reserve( m_sampledEvents.size() + otherBuffer.m_sampledEvents.size() );
         m_sampledEvents.insert( m_sampledEvents.end(), otherBuffer.m_sampledEvents.begin(), otherBuffer.m_sampledEvents.end() );
+        m_weights.insert( m_weights.end(), otherBuffer.m_weights.begin(), otherBuffer.m_weights.end() );
+        m_flags.insert( m_flags.end(), otherBuffer.m_flags.begin(), otherBuffer.m_flags.end() );
 
         m_numAnimEventsSampled += otherBuffer.m_numAnimEventsSampled;
         m_numStateEventsSampled += otherBuffer.m_numStateEventsSampled;
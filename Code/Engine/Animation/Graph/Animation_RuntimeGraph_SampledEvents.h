@@ -6,6 +6,7 @@
 #include "Base/Types/StringID.h"
 #include "Base/Types/BitFlags.h"
 #include "Base/Types/Arrays.h"
+#include "Base/Memory/Memory.h"
 #include "Base/TypeSystem/ReflectedType.h"
 
 //-------------------------------------------------------------------------
@@ -53,6 +54,7 @@ namespace EE::Animation
     //-------------------------------------------------------------------------
     // A sampled event from the graph
     //-------------------------------------------------------------------------
+    // Note: the per-event weights and flags are stored separately in the sampled events buffer, so that range updates operate on contiguous arrays
 
     struct EE_ENGINE_API SampledEvent
     {
@@ -74,22 +76,16 @@ namespace EE::Animation
 
     public:
 
-        explicit SampledEvent( float weight, bool isFromActiveBranch, StateEventType eventType, StringID eventID )
-            : m_weight( weight )
-            , m_isFromActiveBranch( isFromActiveBranch )
-            , m_isIgnored( false )
-            , m_isStateEvent( true )
+        explicit SampledEvent( StateEventType eventType, StringID eventID )
+            : m_isStateEvent( true )
         {
             EE_ASSERT( eventID.IsValid() );
             m_stateData.m_ID = eventID;
             m_stateData.m_type = eventType;
         }
 
-        explicit SampledEvent( float weight, bool isFromActiveBranch, Event const* pEvent, Percentage percentageThrough )
-            : m_weight( weight )
-            , m_isFromActiveBranch( isFromActiveBranch )
-            , m_isIgnored( false )
-            , m_isStateEvent( false )
+        explicit SampledEvent( Event const* pEvent, Percentage percentageThrough )
+            : m_isStateEvent( false )
         {
             EE_ASSERT( pEvent != nullptr );
             EE_ASSERT( percentageThrough >= 0 && percentageThrough <= 1.0f );
@@ -103,10 +99,6 @@ namespace EE::Animation
         inline bool IsAnimationEvent() const { return !m_isStateEvent; }
         inline bool IsStateEvent() const { return m_isStateEvent; }
 
-        inline bool IsFromActiveBranch() const { return m_isFromActiveBranch; }
-        inline bool IsIgnored() const { return m_isIgnored; }
-        inline float GetWeight() const { return m_weight; }
-
         // Animation Events
         //-------------------------------------------------------------------------
 
@@ -141,9 +133,6 @@ namespace EE::Animation
 
     private:
 
-        float                               m_weight = 1.0f;                // The weight of the event when sampled
-        bool                                m_isFromActiveBranch = false;
-        bool                                m_isIgnored = false;
         bool                                m_isStateEvent = false;
 
         union
@@ -183,6 +172,9 @@ namespace EE::Animation
     {
         friend class AnimationDebugView;
 
+        constexpr static uint8_t const s_ignoredFlag = 1 << 0;
+        constexpr static uint8_t const s_fromActiveBranchFlag = 1 << 1;
+
     public:
 
         // Empty the buffer
@@ -200,6 +192,15 @@ namespace EE::Animation
         // Get the event at specified index
         EE_FORCE_INLINE SampledEvent const& GetEvent( uint32_t i ) const { EE_ASSERT( i < m_sampledEvents.size() ); return m_sampledEvents[i]; }
 
+        // Get the weight of the event at the specified index
+        EE_FORCE_INLINE float GetWeight( uint32_t i ) const { EE_ASSERT( i < m_weights.size() ); return m_weights[i]; }
+
+        // Has the event at the specified index been ignored
+        EE_FORCE_INLINE bool IsIgnored( uint32_t i ) const { EE_ASSERT( i < m_flags.size() ); return ( m_flags[i] & s_ignoredFlag ) != 0; }
+
+        // Did the event at the specified index come from the active branch
+        EE_FORCE_INLINE bool IsFromActiveBranch( uint32_t i ) const { EE_ASSERT( i < m_flags.size() ); return ( m_flags[i] & s_fromActiveBranchFlag ) != 0; }
+
         // Is the supplied range valid for the current state of the buffer?
         inline bool IsValidRange( SampledEventRange range ) const
         {
@@ -217,9 +218,10 @@ namespace EE::Animation
         inline void UpdateWeights( SampledEventRange range, float weightMultiplier )
         {
             EE_ASSERT( IsValidRange( range ) );
-            for ( int16_t i = range.m_startIdx; i < range.m_endIdx; i++ )
+            float* pWeights = m_weights.data();
+            for ( int32_t i = range.m_startIdx; i < range.m_endIdx; i++ )
             {
-                m_sampledEvents[i].m_weight *= weightMultiplier;
+                pWeights[i] *= weightMultiplier;
             }
         }
 
@@ -227,41 +229,36 @@ namespace EE::Animation
         inline void MarkEvents( SampledEventRange range, bool isIgnored, bool isFromActiveBranch )
         {
             EE_ASSERT( IsValidRange( range ) );
-            for ( int16_t i = range.m_startIdx; i < range.m_endIdx; i++ )
-            {
-                m_sampledEvents[i].m_isIgnored = isIgnored;
-                m_sampledEvents[i].m_isFromActiveBranch = isFromActiveBranch;
-            }
+            uint8_t const flags = ( isIgnored ? s_ignoredFlag : 0 ) | ( isFromActiveBranch ? s_fromActiveBranchFlag : 0 );
+            memset( m_flags.data() + range.m_startIdx, flags, range.GetLength() );
         }
 
         // Mark all events in the range as ignored
         inline void MarkEventsAsIgnored( SampledEventRange range )
         {
             EE_ASSERT( IsValidRange( range ) );
-            for ( int16_t i = range.m_startIdx; i < range.m_endIdx; i++ )
+            uint8_t* pFlags = m_flags.data();
+            for ( int32_t i = range.m_startIdx; i < range.m_endIdx; i++ )
             {
-                m_sampledEvents[i].m_isIgnored = true;
+                pFlags[i] |= s_ignoredFlag;
             }
         }
 
         // Mark all events in the range as ignored and clear their weights
         inline void MarkEventsAsIgnoredAndClearWeights( SampledEventRange range )
         {
-            EE_ASSERT( IsValidRange( range ) );
-            for ( int16_t i = range.m_startIdx; i < range.m_endIdx; i++ )
-            {
-                m_sampledEvents[i].m_isIgnored = true;
-                m_sampledEvents[i].m_weight = 0.0f;
-            }
+            MarkEventsAsIgnored( range );
+            Memory::MemsetZero( m_weights.data() + range.m_startIdx, range.GetLength() * sizeof( float ) );
         }
 
         // Mark all the events in the range as coming from an inactive branch
         inline void MarkEventsAsFromInactiveBranch( SampledEventRange range )
         {
             EE_ASSERT( IsValidRange( range ) );
-            for ( int16_t i = range.m_startIdx; i < range.m_endIdx; i++ )
+            uint8_t* pFlags = m_flags.data();
+            for ( int32_t i = range.m_startIdx; i < range.m_endIdx; i++ )
             {
-                m_sampledEvents[i].m_isFromActiveBranch = false;
+                pFlags[i] &= ~s_fromActiveBranchFlag;
             }
         }
 
@@ -283,7 +280,9 @@ namespace EE::Animation
             #endif
 
             m_numAnimEventsSampled++;
-            return m_sampledEvents.emplace_back( 1.0f, isFromActiveBranch, pEvent, percentageThrough );
+            m_weights.emplace_back( 1.0f );
+            m_flags.emplace_back( isFromActiveBranch ? s_fromActiveBranchFlag : 0 );
+            return m_sampledEvents.emplace_back( pEvent, percentageThrough );
         }
 
         inline int16_t GetNumAnimationEventsSampled() const { return m_numAnimEventsSampled; }
@@ -300,7 +299,9 @@ namespace EE::Animation
             #endif
 
             m_numStateEventsSampled++;
-            return m_sampledEvents.emplace_back( 1.0f, isFromActiveBranch, type, ID );
+            m_weights.emplace_back( 1.0f );
+            m_flags.emplace_back( isFromActiveBranch ? s_fromActiveBranchFlag : 0 );
+            return m_sampledEvents.emplace_back( type, ID );
         }
 
         inline int16_t GetNumStateEventsSampled() const { return m_numStateEventsSampled; }
@@ -314,11 +315,11 @@ namespace EE::Animation
         inline void MarkOnlyStateEventsAsIgnored( SampledEventRange range )
         {
             EE_ASSERT( IsValidRange( range ) );
-            for ( int16_t i = range.m_startIdx; i < range.m_endIdx; i++ )
+            for ( int32_t i = range.m_startIdx; i < range.m_endIdx; i++ )
             {
                 if ( m_sampledEvents[i].IsStateEvent() )
                 {
-                    m_sampledEvents[i].m_isIgnored = true;
+                    m_flags[i] |= s_ignoredFlag;
                 }
             }
         }
@@ -356,6 +357,8 @@ namespace EE::Animation
     public:
 
         TVector<SampledEvent>                       m_sampledEvents;
+        TVector<float>                              m_weights;                  // Per event weights (parallel to the sampled events array)
+        TVector<uint8_t>                            m_flags;                    // Per event ignored/active branch flags (parallel to the sampled events array)
         int16_t                                     m_numAnimEventsSampled = 0;
         int16_t                                     m_numStateEventsSampled = 0;
 
@@ -85,13 +85,13 @@ namespace EE::Animation::GraphNodes
 
             SampledEvent const& sampledEvent = context.m_pSampledEventsBuffer->GetEvent( i );
 
-            if ( sampledEvent.IsIgnored() )
+            if ( context.m_pSampledEventsBuffer->IsIgnored( i ) )
             {
                 continue;
             }
 
             // Skip events from inactive branch if so requested
-            if ( ignoreInactiveEvents && !sampledEvent.IsFromActiveBranch() )
+            if ( ignoreInactiveEvents && !context.m_pSampledEventsBuffer->IsFromActiveBranch( i ) )
             {
                 continue;
             }
@@ -200,13 +200,13 @@ namespace EE::Animation::GraphNodes
             for ( auto i = searchRange.m_startIdx; i < searchRange.m_endIdx; i++ )
             {
                 auto pSampledEvent = &context.m_pSampledEventsBuffer->GetEvent( i );
-                if ( pSampledEvent->IsIgnored() || pSampledEvent->IsStateEvent() )
+                if ( context.m_pSampledEventsBuffer->IsIgnored( i ) || pSampledEvent->IsStateEvent() )
                 {
                     continue;
                 }
 
                 // Skip events from inactive branch if so requested
-                if ( ignoreInactiveEvents && !pSampledEvent->IsFromActiveBranch() )
+                if ( ignoreInactiveEvents && !context.m_pSampledEventsBuffer->IsFromActiveBranch( i ) )
                 {
                     continue;
                 }
@@ -222,7 +222,7 @@ namespace EE::Animation::GraphNodes
                     {
                         if ( preferHigherWeight )
                         {
-                            if ( pSampledEvent->GetWeight() >= highestWeightFound )
+                            if ( context.m_pSampledEventsBuffer->GetWeight( i ) >= highestWeightFound )
                             {
                                 updateEvent = true;
                             }
@@ -247,7 +247,7 @@ namespace EE::Animation::GraphNodes
                         foundEventID = pEvent->GetID();
                         eventFound = true;
                         foundPercentageThrough = pSampledEvent->GetPercentageThrough().ToFloat();
-                        highestWeightFound = pSampledEvent->GetWeight();
+                        highestWeightFound = context.m_pSampledEventsBuffer->GetWeight( i );
                     }
                 }
             }
@@ -312,13 +312,13 @@ namespace EE::Animation::GraphNodes
             for ( auto i = searchRange.m_startIdx; i < searchRange.m_endIdx; i++ )
             {
                 auto pSampledEvent = &context.m_pSampledEventsBuffer->GetEvent( i );
-                if ( pSampledEvent->IsIgnored() || pSampledEvent->IsStateEvent() )
+                if ( context.m_pSampledEventsBuffer->IsIgnored( i ) || pSampledEvent->IsStateEvent() )
                 {
                     continue;
                 }
 
                 // Skip events from inactive branch if so requested
-                if ( ignoreInactiveEvents && !pSampledEvent->IsFromActiveBranch() )
+                if ( ignoreInactiveEvents && !context.m_pSampledEventsBuffer->IsFromActiveBranch( i ) )
                 {
                     continue;
                 }
@@ -341,7 +341,7 @@ namespace EE::Animation::GraphNodes
                     {
                         if ( preferHigherWeight )
                         {
-                            if ( pSampledEvent->GetWeight() >= highestWeightFound )
+                            if ( context.m_pSampledEventsBuffer->GetWeight( i ) >= highestWeightFound )
                             {
                                 updateEvent = true;
                             }
@@ -365,7 +365,7 @@ namespace EE::Animation::GraphNodes
                     {
                         eventFound = true;
                         foundPercentageThrough = pSampledEvent->GetPercentageThrough().ToFloat();
-                        highestWeightFound = pSampledEvent->GetWeight();
+                        highestWeightFound = context.m_pSampledEventsBuffer->GetWeight( i );
                     }
                 }
             }
@@ -436,13 +436,13 @@ namespace EE::Animation::GraphNodes
         {
             SampledEvent const& sampledEvent = context.m_pSampledEventsBuffer->GetEvent( i );
 
-            if ( sampledEvent.IsIgnored() )
+            if ( context.m_pSampledEventsBuffer->IsIgnored( i ) )
             {
                 continue;
             }
 
             // Skip events from inactive branch if so requested
-            if ( ignoreInactiveEvents && !sampledEvent.IsFromActiveBranch() )
+            if ( ignoreInactiveEvents && !context.m_pSampledEventsBuffer->IsFromActiveBranch( i ) )
             {
                 continue;
             }
@@ -531,13 +531,13 @@ namespace EE::Animation::GraphNodes
             for ( auto i = searchRange.m_startIdx; i < searchRange.m_endIdx; i++ )
             {
                 auto pSampledEvent = &context.m_pSampledEventsBuffer->GetEvent( i );
-                if ( pSampledEvent->IsIgnored() || pSampledEvent->IsStateEvent() )
+                if ( context.m_pSampledEventsBuffer->IsIgnored( i ) || pSampledEvent->IsStateEvent() )
                 {
                     continue;
                 }
 
                 // Skip events from inactive branch if so requested
-                if ( ignoreInactiveEvents && !pSampledEvent->IsFromActiveBranch() )
+                if ( ignoreInactiveEvents && !context.m_pSampledEventsBuffer->IsFromActiveBranch( i ) )
                 {
                     continue;
                 }
@@ -648,13 +648,13 @@ namespace EE::Animation::GraphNodes
             for ( auto i = searchRange.m_startIdx; i < searchRange.m_endIdx; i++ )
             {
                 auto pSampledEvent = &context.m_pSampledEventsBuffer->GetEvent( i );
-                if ( pSampledEvent->IsIgnored() || pSampledEvent->IsStateEvent() )
+                if ( context.m_pSampledEventsBuffer->IsIgnored( i ) || pSampledEvent->IsStateEvent() )
                 {
                     continue;
                 }
 
                 // Skip events from inactive branch if so requested
-                if ( ignoreInactiveEvents && !pSampledEvent->IsFromActiveBranch() )
+                if ( ignoreInactiveEvents && !context.m_pSampledEventsBuffer->IsFromActiveBranch( i ) )
                 {
                     continue;
                 }
@@ -730,7 +730,7 @@ namespace EE::Animation::GraphNodes
                     {
                         if ( preferHigherWeight )
                         {
-                            if ( pSampledEvent->GetWeight() >= highestWeightFound )
+                            if ( context.m_pSampledEventsBuffer->GetWeight( i ) >= highestWeightFound )
                             {
                                 updateEvent = true;
                             }
@@ -754,7 +754,7 @@ namespace EE::Animation::GraphNodes
                     {
                         eventFound = true;
                         foundPercentageThrough = pSampledEvent->GetPercentageThrough().ToFloat();
-                        highestWeightFound = pSampledEvent->GetWeight();
+                        highestWeightFound = context.m_pSampledEventsBuffer->GetWeight( i );
                     }
                 }
             }
@@ -817,13 +817,13 @@ namespace EE::Animation::GraphNodes
             for ( auto i = searchRange.m_startIdx; i < searchRange.m_endIdx; i++ )
             {
                 auto pSampledEvent = &context.m_pSampledEventsBuffer->GetEvent( i );
-                if ( pSampledEvent->IsIgnored() || pSampledEvent->IsStateEvent() )
+                if ( context.m_pSampledEventsBuffer->IsIgnored( i ) || pSampledEvent->IsStateEvent() )
                 {
                     continue;
                 }
 
                 // Skip events from inactive branch if so requested
-                if ( ignoreInactiveEvents && !pSampledEvent->IsFromActiveBranch() )
+                if ( ignoreInactiveEvents && !context.m_pSampledEventsBuffer->IsFromActiveBranch( i ) )
                 {
                     continue;
                 }
@@ -839,7 +839,7 @@ namespace EE::Animation::GraphNodes
                     {
                         if ( preferHigherWeight )
                         {
-                            if ( pSampledEvent->GetWeight() >= highestWeightFound )
+                            if ( context.m_pSampledEventsBuffer->GetWeight( i ) >= highestWeightFound )
                             {
                                 updateEvent = true;
                             }
@@ -863,7 +863,7 @@ namespace EE::Animation::GraphNodes
                     {
                         eventFound = true;
                         foundPercentageThrough = pSampledEvent->GetPercentageThrough().ToFloat();
-                        highestWeightFound = pSampledEvent->GetWeight();
+                        highestWeightFound = context.m_pSampledEventsBuffer->GetWeight( i );
                         foundID = pEvent->GetSyncEventID();
                     }
                 }
@@ -1062,13 +1062,13 @@ namespace EE::Animation::GraphNodes
             for ( auto i = searchRange.m_startIdx; i < searchRange.m_endIdx; i++ )
             {
                 SampledEvent const* pSampledEvent = &context.m_pSampledEventsBuffer->GetEvent( i );
-                if ( pSampledEvent->IsIgnored() || pSampledEvent->IsStateEvent() )
+                if ( context.m_pSampledEventsBuffer->IsIgnored( i ) || pSampledEvent->IsStateEvent() )
                 {
                     continue;
                 }
 
                 // Skip events from inactive branch if so requested
-                if ( ignoreInactiveEvents && !pSampledEvent->IsFromActiveBranch() )
+                if ( ignoreInactiveEvents && !context.m_pSampledEventsBuffer->IsFromActiveBranch( i ) )
                 {
                     continue;
                 }
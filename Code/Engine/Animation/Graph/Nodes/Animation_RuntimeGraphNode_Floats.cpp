@@ -285,7 +285,7 @@ namespace EE::Animation::GraphNodes
             MarkNodeActive( context );
 
             float const inputTargetValue = m_pInputValueNode->GetValue<float>( context );
-            m_currentValue = pDefinition->m_curve.Evaluate( inputTargetValue );
+            m_currentValue = pDefinition->m_curve.Evaluate( inputTargetValue, m_segmentHint );
         }
 
         *reinterpret_cast<float*>( pOutValue ) = m_currentValue;
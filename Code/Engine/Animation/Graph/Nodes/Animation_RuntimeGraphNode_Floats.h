@@ -167,6 +167,7 @@ namespace EE::Animation::GraphNodes
 
         FloatValueNode*                 m_pInputValueNode = nullptr;
         float                           m_currentValue = 0.0f;
+        int32_t                         m_segmentHint = 0;          // The input is usually coherent frame to frame
         FloatCurve                      m_curve;
     };
 
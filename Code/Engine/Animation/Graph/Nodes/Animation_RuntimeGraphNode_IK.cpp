@@ -51,6 +51,11 @@ namespace EE::Animation::GraphNodes
                 pTarget->Initialize( context );
             }
         }
+
+        if ( m_pRig != nullptr )
+        {
+            m_pRig->ClearCachedSolve();
+        }
     }
 
     void IKRigNode::ShutdownInternal( GraphContext& context )
@@ -84,10 +84,14 @@ namespace EE::Animation::GraphNodes
         //-------------------------------------------------------------------------
 
         SampledEvent const* pSampledEvent = nullptr;
+        float sampledEventWeight = 0.0f;
 
-        for ( auto const& sampledEvent : *context.m_pSampledEventsBuffer )
+        SampledEventsBuffer const& sampledEventsBuffer = *context.m_pSampledEventsBuffer;
+        int16_t const numSampledEvents = sampledEventsBuffer.GetNumSampledEvents();
+        for ( int16_t i = 0; i < numSampledEvents; i++ )
         {
-            if ( sampledEvent.IsIgnored() || !sampledEvent.IsFromActiveBranch() || sampledEvent.IsStateEvent() )
+            SampledEvent const& sampledEvent = sampledEventsBuffer.GetEvent( i );
+            if ( sampledEventsBuffer.IsIgnored( i ) || !sampledEventsBuffer.IsFromActiveBranch( i ) || sampledEvent.IsStateEvent() )
             {
                 continue;
             }
@@ -98,9 +102,10 @@ namespace EE::Animation::GraphNodes
                 // If we are not blending, check all events to find the one with the greatest weight to determine the blend duration
                 if ( m_blendState == BlendState::None )
                 {
-                    if ( pSampledEvent == nullptr || sampledEvent.GetWeight() > pSampledEvent->GetWeight() )
+                    if ( pSampledEvent == nullptr || sampledEventsBuffer.GetWeight( i ) > sampledEventWeight )
                     {
                         pSampledEvent = &sampledEvent;
+                        sampledEventWeight = sampledEventsBuffer.GetWeight( i );
                     }
                 }
                 else // Just checking if we still have an event or not
@@ -246,6 +246,15 @@ namespace EE::Animation
 
         // Allocate storage for body transforms
         m_pBodyTransforms = EE::New< RkArray<RkTransform>>( numBodies );
+        m_pCachedBodyTransforms = EE::New< RkArray<RkTransform>>( numBodies );
+        m_inputBodyTransforms.resize( numBodies );
+        m_cachedInputBodyTransforms.resize( numBodies );
+
+        // Allocate storage for the effector targets
+        int32_t const numEffectors = m_pDefinition->GetNumEffectors();
+        m_effectorTargets.resize( numEffectors, Transform::Identity );
+        m_cachedEffectorTargets.resize( numEffectors, Transform::Identity );
+        m_cachedEffectorEnabledStates.resize( numEffectors, false );
 
         // Setup Joints
         //-------------------------------------------------------------------------
@@ -286,9 +295,50 @@ namespace EE::Animation
     {
         EE::Delete( m_pEffectors );
         EE::Delete( m_pBodyTransforms );
+        EE::Delete( m_pCachedBodyTransforms );
         EE::Delete( m_pSolver );
     }
 
+    bool IKRig::CanReuseCachedSolve() const
+    {
+        if ( !m_hasCachedSolve )
+        {
+            return false;
+        }
+
+        // Effectors
+        //-------------------------------------------------------------------------
+
+        int32_t const numEffectors = (int32_t) m_pEffectors->Size();
+        for ( int32_t effectorIdx = 0; effectorIdx < numEffectors; effectorIdx++ )
+        {
+            bool const isEnabled = ( *m_pEffectors )[effectorIdx].Enabled;
+            if ( isEnabled != m_cachedEffectorEnabledStates[effectorIdx] )
+            {
+                return false;
+            }
+
+            if ( isEnabled && !m_effectorTargets[effectorIdx].IsNearEqual( m_cachedEffectorTargets[effectorIdx], m_rotationTolerance, m_translationTolerance ) )
+            {
+                return false;
+            }
+        }
+
+        // Bodies
+        //-------------------------------------------------------------------------
+
+        int32_t const numBodies = (int32_t) m_inputBodyTransforms.size();
+        for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
+        {
+            if ( !m_inputBodyTransforms[bodyIdx].IsNearEqual( m_cachedInputBodyTransforms[bodyIdx], m_rotationTolerance, m_translationTolerance ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     void IKRig::Solve( Pose* pPose )
     {
         if ( m_pSolver == nullptr )
@@ -309,15 +359,38 @@ namespace EE::Animation
         int32_t const numBodies = m_pDefinition->GetNumLinks();
         for ( int32 bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
         {
-            Transform const& boneTransform = m_modelSpacePoseTransforms[ m_pDefinition->m_bodyToBoneMap[bodyIdx] ];
-            ( *m_pBodyTransforms )[bodyIdx].Rotation = ToRk( boneTransform.GetRotation() );
-            ( *m_pBodyTransforms )[bodyIdx].Translation = ToRk( boneTransform.GetTranslation() );
+            m_inputBodyTransforms[bodyIdx] = m_modelSpacePoseTransforms[ m_pDefinition->m_bodyToBoneMap[bodyIdx] ];
         }
 
         // Run Solver
         //-------------------------------------------------------------------------
+        // If neither the bodies nor the effector targets have moved meaningfully since the last solve, reuse its results
 
-        m_pSolver->Solve( *m_pEffectors, *m_pBodyTransforms, m_pDefinition->m_iterations );
+        if ( CanReuseCachedSolve() )
+        {
+            *m_pBodyTransforms = *m_pCachedBodyTransforms;
+        }
+        else
+        {
+            for ( int32 bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
+            {
+                ( *m_pBodyTransforms )[bodyIdx] = ToRk( m_inputBodyTransforms[bodyIdx] );
+            }
+
+            m_pSolver->Solve( *m_pEffectors, *m_pBodyTransforms, m_pDefinition->m_iterations );
+
+            // Cache the inputs and results
+            int32_t const numEffectors = (int32_t) m_pEffectors->Size();
+            for ( int32 effectorIdx = 0; effectorIdx < numEffectors; effectorIdx++ )
+            {
+                m_cachedEffectorEnabledStates[effectorIdx] = ( *m_pEffectors )[effectorIdx].Enabled;
+                m_cachedEffectorTargets[effectorIdx] = m_effectorTargets[effectorIdx];
+            }
+
+            m_cachedInputBodyTransforms = m_inputBodyTransforms;
+            *m_pCachedBodyTransforms = *m_pBodyTransforms;
+            m_hasCachedSolve = true;
+        }
 
         // Copy the results back
         //-------------------------------------------------------------------------
@@ -381,6 +454,8 @@ namespace EE::Animation
         effector.TargetOrientation = ToRk( target.GetRotation() );
         effector.TargetPosition = ToRk( target.GetTranslation() );
         effector.Enabled = true;
+
+        m_effectorTargets[effectorIdx] = target;
     }
 
     #if EE_DEVELOPMENT_TOOLS
@@ -98,10 +98,21 @@ namespace EE::Animation
     class Pose;
 
     //-------------------------------------------------------------------------
+    // IK Rig
+    //-------------------------------------------------------------------------
+    // Each rig is solved inline by its IK task, as part of the owning character's pose task list. Rigs are not batched across
+    // characters: characters already update in parallel and the solved pose is consumed by the rest of the task list right away.
+    // To reduce the cost, the last solve is cached and reused as long as the rig bodies and effector targets stay within tolerance.
 
     class EE_ENGINE_API IKRig final
     {
 
+    public:
+
+        // Default movement thresholds below which we reuse the previous solve result
+        constexpr static float const s_defaultTranslationTolerance = 0.001f;
+        constexpr static float const s_defaultRotationTolerance = Math::DegreesToRadians * 0.1f;
+
     public:
 
         IKRig( IKRigDefinition const* pDefinition );
@@ -111,6 +122,12 @@ namespace EE::Animation
 
         void SetEffectorTarget( int32_t effectorIdx, Transform target );
 
+        // Set how far the rig bodies and effector targets need to move before we rerun the solver, zero tolerances will always solve
+        inline void SetSolveTolerances( float translationTolerance, Radians rotationTolerance ) { EE_ASSERT( translationTolerance >= 0.0f && rotationTolerance >= 0.0f ); m_translationTolerance = translationTolerance; m_rotationTolerance = rotationTolerance; }
+
+        // Force the next solve to run the solver
+        inline void ClearCachedSolve() { m_hasCachedSolve = false; }
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -118,6 +135,11 @@ namespace EE::Animation
         void DrawDebug( Drawing::DrawContext& ctx, Transform const& worldTransform ) const;
         #endif
 
+    private:
+
+        // Check whether the current inputs are close enough to the last solve's inputs that we can reuse its result
+        bool CanReuseCachedSolve() const;
+
     private:
 
         IKRigDefinition const*      m_pDefinition = nullptr;
@@ -129,5 +151,16 @@ namespace EE::Animation
         RkArray<RkIkEffector>*      m_pEffectors = nullptr;
 
         TVector<Transform>          m_modelSpacePoseTransforms;
+
+        // Solve cache
+        TVector<Transform>          m_inputBodyTransforms;
+        TVector<Transform>          m_effectorTargets;
+        TVector<Transform>          m_cachedInputBodyTransforms;
+        TVector<Transform>          m_cachedEffectorTargets;
+        TVector<bool>               m_cachedEffectorEnabledStates;
+        RkArray<RkTransform>*       m_pCachedBodyTransforms = nullptr;
+        float                       m_translationTolerance = s_defaultTranslationTolerance;
+        Radians                     m_rotationTolerance = s_defaultRotationTolerance;
+        bool                        m_hasCachedSolve = false;
     };
 }
\ No newline at end of file
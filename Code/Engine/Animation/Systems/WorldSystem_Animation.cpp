@@ -2,6 +2,7 @@
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Memory/MemoryTags.h"
 
 //-------------------------------------------------------------------------
 
@@ -30,6 +31,7 @@ namespace EE::Animation
 
     void AnimationWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( Animation );
         #if EE_DEVELOPMENT_TOOLS
         Drawing::DrawContext drawingCtx = ctx.GetDrawingContext();
         for ( auto pComponent : m_graphComponents )
@@ -50,11 +50,10 @@ namespace EE::Animation
 
     void PoseBuffer::UpdateSecondarySkeletonList( SecondarySkeletonList const& secondarySkeletons )
     {
-        int32_t const numExistingSecondarySkeletons = int32_t( m_poses.size() ) - 1;
-        int32_t const numRequiredSecondarySkeletons = int32_t( secondarySkeletons.size() );
-        int32_t const numSkeletonsToUpdate = Math::Min( numRequiredSecondarySkeletons, numExistingSecondarySkeletons );
+        int32_t const numRequiredPoses = int32_t( secondarySkeletons.size() ) + 1;
+        int32_t const numPosesToUpdate = Math::Min( numRequiredPoses, int32_t( m_poses.size() ) );
 
-        for ( int32_t i = 1; i < numSkeletonsToUpdate; i++ )
+        for ( int32_t i = 1; i < numPosesToUpdate; i++ )
         {
             // If the skeleton differs, then change it
             if ( m_poses[i].GetSkeleton() != secondarySkeletons[i - 1] )
@@ -64,22 +63,48 @@ namespace EE::Animation
         }
 
         // If we need less poses, then just destroy the extras
-        if ( numExistingSecondarySkeletons > numRequiredSecondarySkeletons )
+        while ( int32_t( m_poses.size() ) > numRequiredPoses )
         {
-            while( m_poses.size() > numRequiredSecondarySkeletons )
-            {
-                m_poses.pop_back();
-            }
+            m_poses.pop_back();
         }
+
         // If we need more poses, then create the excess
-        else if( numExistingSecondarySkeletons < numRequiredSecondarySkeletons )
+        for ( int32_t i = int32_t( m_poses.size() ); i < numRequiredPoses; i++ )
+        {
+            m_poses.emplace_back( secondarySkeletons[i - 1] );
+        }
+    }
+
+    bool PoseBuffer::HasSecondarySkeletons( SecondarySkeletonList const& secondarySkeletons ) const
+    {
+        if ( m_poses.size() != secondarySkeletons.size() + 1 )
         {
-            for ( int32_t i = numExistingSecondarySkeletons; i < numRequiredSecondarySkeletons; i++ )
+            return false;
+        }
+
+        int32_t const numSecondarySkeletons = (int32_t) secondarySkeletons.size();
+        for ( int32_t i = 0; i < numSecondarySkeletons; i++ )
+        {
+            if ( m_poses[i + 1].GetSkeleton() != secondarySkeletons[i] )
             {
-                m_poses.emplace_back( secondarySkeletons[i] );
+                return false;
             }
         }
+
+        return true;
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    size_t PoseBuffer::GetAllocatedMemory() const
+    {
+        size_t allocatedMemory = sizeof( PoseBuffer );
+        for ( Pose const& pose : m_poses )
+        {
+            allocatedMemory += pose.GetAllocatedMemory();
+        }
+        return allocatedMemory;
     }
+    #endif
 
     //-------------------------------------------------------------------------
     // Cached Pose Buffer
@@ -93,6 +118,154 @@ namespace EE::Animation
         m_shouldBeReset = false;
     }
 
+    //-------------------------------------------------------------------------
+    // Pose Buffer Arena
+    //-------------------------------------------------------------------------
+
+    static Threading::Mutex g_arenaRegistryMutex;
+    static TVector<PoseBufferArena*>* g_pArenas = nullptr;
+
+    void PoseBufferArena::Initialize()
+    {
+        EE_ASSERT( g_pArenas == nullptr );
+        g_pArenas = EE::New<TVector<PoseBufferArena*>>();
+    }
+
+    void PoseBufferArena::Shutdown()
+    {
+        EE_ASSERT( g_pArenas != nullptr );
+        EE_ASSERT( g_pArenas->empty() ); // Someone is leaking a task system
+        EE::Delete( g_pArenas );
+    }
+
+    PoseBufferArena* PoseBufferArena::AcquireArena( Skeleton const* pPrimarySkeleton )
+    {
+        EE_ASSERT( pPrimarySkeleton != nullptr );
+        EE_ASSERT( g_pArenas != nullptr );
+
+        Threading::ScopeLock lock( g_arenaRegistryMutex );
+
+        PoseBufferArena* pArena = nullptr;
+        for ( PoseBufferArena* pExistingArena : *g_pArenas )
+        {
+            if ( pExistingArena->m_pPrimarySkeleton == pPrimarySkeleton )
+            {
+                pArena = pExistingArena;
+                break;
+            }
+        }
+
+        if ( pArena == nullptr )
+        {
+            pArena = g_pArenas->emplace_back( EE::New<PoseBufferArena>( pPrimarySkeleton ) );
+        }
+
+        pArena->m_referenceCount++;
+        return pArena;
+    }
+
+    void PoseBufferArena::ReleaseArena( PoseBufferArena*& pArena )
+    {
+        EE_ASSERT( pArena != nullptr && g_pArenas != nullptr );
+
+        {
+            Threading::ScopeLock lock( g_arenaRegistryMutex );
+
+            EE_ASSERT( pArena->m_referenceCount > 0 );
+            pArena->m_referenceCount--;
+
+            // Destroy the arena once the last user goes away, the skeleton may be unloaded after this point
+            if ( pArena->m_referenceCount == 0 )
+            {
+                g_pArenas->erase_first_unsorted( pArena );
+                EE::Delete( pArena );
+            }
+        }
+
+        pArena = nullptr;
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    size_t PoseBufferArena::GetTotalAllocatedMemory()
+    {
+        EE_ASSERT( g_pArenas != nullptr );
+        Threading::ScopeLock lock( g_arenaRegistryMutex );
+
+        size_t totalAllocatedMemory = 0;
+        for ( PoseBufferArena* pArena : *g_pArenas )
+        {
+            totalAllocatedMemory += pArena->GetAllocatedMemory();
+        }
+        return totalAllocatedMemory;
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
+    PoseBufferArena::PoseBufferArena( Skeleton const* pPrimarySkeleton )
+        : m_pPrimarySkeleton( pPrimarySkeleton )
+    {
+        EE_ASSERT( m_pPrimarySkeleton != nullptr );
+    }
+
+    PoseBufferArena::~PoseBufferArena()
+    {
+        // All buffers need to have been returned before we destroy the arena
+        EE_ASSERT( m_freeBuffers.size_approx() == m_allocatedBuffers.size() );
+
+        for ( PoseBuffer*& pBuffer : m_allocatedBuffers )
+        {
+            EE::Delete( pBuffer );
+        }
+        m_allocatedBuffers.clear();
+    }
+
+    PoseBuffer* PoseBufferArena::AcquireBuffer( SecondarySkeletonList const& secondarySkeletons )
+    {
+        PoseBuffer* pBuffer = nullptr;
+        if ( m_freeBuffers.try_dequeue( pBuffer ) )
+        {
+            // Buffers are shared between task systems that might animate different secondary skeletons
+            if ( !pBuffer->HasSecondarySkeletons( secondarySkeletons ) )
+            {
+                pBuffer->UpdateSecondarySkeletonList( secondarySkeletons );
+            }
+        }
+        else // Grow the arena
+        {
+            pBuffer = EE::New<PoseBuffer>( m_pPrimarySkeleton, secondarySkeletons );
+
+            Threading::ScopeLock lock( m_allocationMutex );
+            m_allocatedBuffers.emplace_back( pBuffer );
+        }
+
+        EE_ASSERT( !pBuffer->m_isUsed );
+        pBuffer->m_isUsed = true;
+        return pBuffer;
+    }
+
+    void PoseBufferArena::ReleaseBuffer( PoseBuffer* pBuffer )
+    {
+        EE_ASSERT( pBuffer != nullptr && pBuffer->m_isUsed );
+        EE_ASSERT( pBuffer->GetPrimaryPose()->GetSkeleton() == m_pPrimarySkeleton );
+        pBuffer->Release();
+        m_freeBuffers.enqueue( pBuffer );
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    size_t PoseBufferArena::GetAllocatedMemory() const
+    {
+        Threading::ScopeLock lock( m_allocationMutex );
+
+        size_t allocatedMemory = sizeof( PoseBufferArena );
+        for ( PoseBuffer const* pBuffer : m_allocatedBuffers )
+        {
+            allocatedMemory += pBuffer->GetAllocatedMemory();
+        }
+        return allocatedMemory;
+    }
+    #endif
+
     //-------------------------------------------------------------------------
     // Pose Buffer Pool
     //-------------------------------------------------------------------------
@@ -109,29 +282,35 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
+        // Transient buffers are borrowed from the shared arena on demand and cached buffers are created lazily
+        m_pArena = PoseBufferArena::AcquireArena( m_pPrimarySkeleton );
+        m_poseBuffers.resize( s_numInitialBuffers, nullptr );
+
+        #if EE_DEVELOPMENT_TOOLS
         for ( auto i = 0; i < s_numInitialBuffers; i++ )
         {
-            m_poseBuffers.emplace_back( PoseBuffer( m_pPrimarySkeleton, m_secondarySkeletons ) );
-            m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pPrimarySkeleton, m_secondarySkeletons ) );
-
-            #if EE_DEVELOPMENT_TOOLS
             m_debugPoseBuffers.emplace_back( PoseBuffer( m_pPrimarySkeleton, m_secondarySkeletons ) );
             m_debugBufferTaskIdxMapping.emplace_back( int8_t( 0 ) );
-            #endif
         }
+        #endif
     }
 
     PoseBufferPool::~PoseBufferPool()
     {
         Reset();
+        PoseBufferArena::ReleaseArena( m_pArena );
     }
 
     void PoseBufferPool::Reset()
     {
-        // Reset all buffers
-        for ( auto& poseBuffer : m_poseBuffers )
+        // Return all borrowed buffers to the arena
+        for ( auto& pPoseBuffer : m_poseBuffers )
         {
-            poseBuffer.Release();
+            if ( pPoseBuffer != nullptr )
+            {
+                m_pArena->ReleaseBuffer( pPoseBuffer );
+                pPoseBuffer = nullptr;
+            }
         }
 
         m_firstFreeBuffer = 0;
@@ -179,9 +358,17 @@ namespace EE::Animation
 
         m_secondarySkeletons = secondarySkeletons;
 
-        for ( PoseBuffer& poseBuffer : m_poseBuffers )
+        for ( PoseBuffer* pPoseBuffer : m_poseBuffers )
+        {
+            if ( pPoseBuffer != nullptr )
+            {
+                pPoseBuffer->UpdateSecondarySkeletonList( m_secondarySkeletons );
+            }
+        }
+
+        for ( CachedPoseBuffer& cachedPoseBuffer : m_cachedBuffers )
         {
-            poseBuffer.UpdateSecondarySkeletonList( m_secondarySkeletons );
+            cachedPoseBuffer.UpdateSecondarySkeletonList( m_secondarySkeletons );
         }
 
         #if EE_DEVELOPMENT_TOOLS
@@ -214,22 +401,19 @@ namespace EE::Animation
     {
         if ( m_firstFreeBuffer == m_poseBuffers.size() )
         {
-            for ( auto i = 0; i < s_bufferGrowAmount; i++ )
-            {
-                m_poseBuffers.emplace_back( PoseBuffer( m_pPrimarySkeleton, m_secondarySkeletons ) );
-            }
-            EE_ASSERT( m_poseBuffers.size() < 255 );
+            m_poseBuffers.resize( m_poseBuffers.size() + s_bufferGrowAmount, nullptr );
+            EE_ASSERT( m_poseBuffers.size() < 128 );
         }
 
         int8_t const freeBufferIdx = m_firstFreeBuffer;
-        EE_ASSERT( !m_poseBuffers[freeBufferIdx].m_isUsed );
-        m_poseBuffers[freeBufferIdx].m_isUsed = true;
+        EE_ASSERT( m_poseBuffers[freeBufferIdx] == nullptr );
+        m_poseBuffers[freeBufferIdx] = m_pArena->AcquireBuffer( m_secondarySkeletons );
 
         // Update free index
         int8_t const numPoseBuffers = (int8_t) m_poseBuffers.size();
         for ( ; m_firstFreeBuffer < numPoseBuffers; m_firstFreeBuffer++ )
         {
-            if ( !m_poseBuffers[m_firstFreeBuffer].m_isUsed )
+            if ( m_poseBuffers[m_firstFreeBuffer] == nullptr )
             {
                 break;
             }
@@ -240,11 +424,31 @@ namespace EE::Animation
 
     void PoseBufferPool::ReleasePoseBuffer( int8_t bufferIdx )
     {
-        EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
-        m_poseBuffers[bufferIdx].m_isUsed = false;
+        EE_ASSERT( m_poseBuffers[bufferIdx] != nullptr );
+        m_pArena->ReleaseBuffer( m_poseBuffers[bufferIdx] );
+        m_poseBuffers[bufferIdx] = nullptr;
         m_firstFreeBuffer = Math::Min( bufferIdx, m_firstFreeBuffer );
     }
 
+    #if EE_DEVELOPMENT_TOOLS
+    size_t PoseBufferPool::GetResidentMemory() const
+    {
+        size_t residentMemory = sizeof( PoseBufferPool );
+
+        for ( CachedPoseBuffer const& cachedBuffer : m_cachedBuffers )
+        {
+            residentMemory += cachedBuffer.GetAllocatedMemory();
+        }
+
+        for ( PoseBuffer const& debugBuffer : m_debugPoseBuffers )
+        {
+            residentMemory += debugBuffer.GetAllocatedMemory();
+        }
+
+        return residentMemory;
+    }
+    #endif
+
     //-------------------------------------------------------------------------
 
     bool PoseBufferPool::IsValidCachedPose( CachedPoseID cachedPoseID ) const
@@ -453,7 +657,7 @@ namespace EE::Animation
             EE_ASSERT( m_debugPoseBuffers.size() < 255 );
         }
 
-        EE_ASSERT( m_poseBuffers[poseBufferIdx].m_isUsed );
+        EE_ASSERT( m_poseBuffers[poseBufferIdx] != nullptr && m_poseBuffers[poseBufferIdx]->m_isUsed );
         m_debugPoseBuffers[m_firstFreeDebugBuffer].CopyFrom( m_poseBuffers[poseBufferIdx] );
         m_debugBufferTaskIdxMapping[m_firstFreeDebugBuffer] = taskIdx;
         m_firstFreeDebugBuffer++;
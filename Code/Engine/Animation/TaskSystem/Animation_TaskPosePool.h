@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Animation/AnimationPose.h"
+#include "Base/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
@@ -16,6 +17,7 @@ namespace EE::Animation
     struct EE_ENGINE_API PoseBuffer
     {
         friend class PoseBufferPool;
+        friend class PoseBufferArena;
         friend class TaskSystem;
 
     public:
@@ -37,6 +39,10 @@ namespace EE::Animation
         void ResetPose( Pose::Type poseType = Pose::Type::None, bool calculateGlobalPose = false );
         void CalculateModelSpaceTransforms();
 
+        #if EE_DEVELOPMENT_TOOLS
+        size_t GetAllocatedMemory() const;
+        #endif
+
     protected:
 
         // Releases this buffer and resets the poses
@@ -44,6 +50,9 @@ namespace EE::Animation
 
         // Changes the set of poses we store
         void UpdateSecondarySkeletonList( SecondarySkeletonList const& secondarySkeletons );
+
+        // Do we currently store poses for exactly this set of secondary skeletons
+        bool HasSecondarySkeletons( SecondarySkeletonList const& secondarySkeletons ) const;
     
     public:
 
@@ -102,10 +111,67 @@ namespace EE::Animation
         bool                                m_shouldBeReset = false;
     };
 
+    //-------------------------------------------------------------------------
+    // Pose Buffer Arena
+    //-------------------------------------------------------------------------
+    // Shared storage for the transient pose buffers that tasks request while executing.
+    // All task systems with the same primary skeleton share a single arena, so temporary buffers are recycled
+    // across characters rather than each character keeping its own resident set of buffers.
+    // Free buffers are kept in a lock-free queue so acquiring and releasing from workers doesn't take a lock.
+    // There is no thread affinity: a released buffer can be handed out to any thread by the next acquire.
+
+    class EE_ENGINE_API PoseBufferArena
+    {
+    public:
+
+        static void Initialize();
+        static void Shutdown();
+
+        // Get the shared arena for a given primary skeleton, every acquire needs a matching release
+        static PoseBufferArena* AcquireArena( Skeleton const* pPrimarySkeleton );
+
+        // Release a previously acquired arena, the arena is destroyed once it is no longer referenced
+        static void ReleaseArena( PoseBufferArena*& pArena );
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Get the total memory allocated by all arenas
+        static size_t GetTotalAllocatedMemory();
+        #endif
+
+    public:
+
+        PoseBufferArena( Skeleton const* pPrimarySkeleton );
+        PoseBufferArena( PoseBufferArena const& ) = delete;
+        ~PoseBufferArena();
+
+        PoseBufferArena& operator=( PoseBufferArena const& rhs ) = delete;
+
+        inline Skeleton const* GetPrimarySkeleton() const { return m_pPrimarySkeleton; }
+
+        // Get a free buffer, the buffer is exclusively owned by the caller until it is released back to the arena
+        PoseBuffer* AcquireBuffer( SecondarySkeletonList const& secondarySkeletons );
+
+        // Return a buffer to the arena, this can be called from any thread
+        void ReleaseBuffer( PoseBuffer* pBuffer );
+
+        #if EE_DEVELOPMENT_TOOLS
+        size_t GetAllocatedMemory() const;
+        #endif
+
+    private:
+
+        Skeleton const*                             m_pPrimarySkeleton = nullptr;
+        Threading::LockFreeQueue<PoseBuffer*>       m_freeBuffers;
+        TVector<PoseBuffer*>                        m_allocatedBuffers;
+        mutable Threading::Mutex                    m_allocationMutex;
+        int32_t                                     m_referenceCount = 0;
+    };
+
     //-------------------------------------------------------------------------
     // Pose Buffer Pool
     //-------------------------------------------------------------------------
-    // TODO: Store all poses in a contiguous block of memory and profile if this is in fact faster or not
+    // Per task system view of the pose buffers in use. Transient buffers are borrowed from the shared arena for
+    // only as long as a task needs them, cached and debug buffers are owned by the pool itself.
 
     class EE_ENGINE_API PoseBufferPool
     {
@@ -126,6 +192,11 @@ namespace EE::Animation
 
         void Reset();
 
+        #if EE_DEVELOPMENT_TOOLS
+        // Get the memory that this pool keeps resident, this excludes any borrowed transient buffers
+        size_t GetResidentMemory() const;
+        #endif
+
         // Skeletons
         //-------------------------------------------------------------------------
 
@@ -150,8 +221,8 @@ namespace EE::Animation
 
         inline PoseBuffer* GetBuffer( int8_t bufferIdx )
         {
-            EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
-            return &m_poseBuffers[bufferIdx];
+            EE_ASSERT( m_poseBuffers[bufferIdx] != nullptr && m_poseBuffers[bufferIdx]->m_isUsed );
+            return m_poseBuffers[bufferIdx];
         }
 
         // Cached Poses
@@ -188,8 +259,9 @@ namespace EE::Animation
 
     private:
 
-        TInlineVector<PoseBuffer, 10>               m_poseBuffers;
-        TInlineVector<CachedPoseBuffer, 10>         m_cachedBuffers;
+        PoseBufferArena*                            m_pArena = nullptr;
+        TInlineVector<PoseBuffer*, 10>              m_poseBuffers; // Transient buffers borrowed from the arena, null entries are free slots
+        TVector<CachedPoseBuffer>                   m_cachedBuffers;
         TInlineVector<UUID, 5>                      m_cachedPoseBuffersToDestroy;
         int8_t                                      m_firstFreeCachedBuffer = 0;
         int8_t                                      m_firstFreeBuffer = 0;
@@ -4,6 +4,7 @@
 
 #include "Base/Drawing/DebugDrawing.h"
 #include "Base/Profiling.h"
+#include "Base/Telemetry/PerformanceCounters.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Utils/TreeLayout.h"
 
@@ -13,6 +14,10 @@ namespace EE::Animation
 {
     static TVector<EE::TypeSystem::TypeInfo const*> const * g_pTaskTypeTable;
 
+    static Telemetry::TimeCounter const g_taskExecutionTimeCounter( "Animation/Pose Tasks (ms)" );
+    static Telemetry::Counter const g_executedTasksCounter( "Animation/Pose Tasks Executed" );
+    static Telemetry::HistogramCounter const g_tasksPerUpdateCounter( "Animation/Pose Tasks Per Update", 4.0f );
+
     void TaskSystem::InitializeTaskTypesList( TypeSystem::TypeRegistry const& typeRegistry )
     {
         EE_ASSERT( g_pTaskTypeTable == nullptr );
@@ -143,6 +148,7 @@ namespace EE::Animation
     void TaskSystem::UpdatePrePhysics( float deltaTime, Transform const& worldTransform, Transform const& worldTransformInverse )
     {
         EE_PROFILE_SCOPE_ANIMATION( "Anim Pre-Physics Tasks" );
+        EE_TELEMETRY_TIME_SCOPE( g_taskExecutionTimeCounter );
 
         #if EE_DEVELOPMENT_TOOLS
         m_boneMaskPool.PerformValidation();
@@ -182,6 +188,7 @@ namespace EE::Animation
                 EE_LOG_WARNING( "Animation", "TODO", "Co-dependent physics tasks detected!" );
                 RegisterTask<Tasks::ReferencePoseTask>( InvalidIndex );
                 m_tasks.back()->Execute( m_taskContext );
+                g_executedTasksCounter.Add();
             }
             else // Execute pre-physics tasks
             {
@@ -199,6 +206,8 @@ namespace EE::Animation
 
                     m_tasks[prePhysicsTaskIdx]->Execute( m_taskContext );
                 }
+
+                g_executedTasksCounter.Add( m_prePhysicsTaskIndices.size() );
             }
         }
         else // If we have no physics dependent tasks, execute all tasks now
@@ -210,8 +219,10 @@ namespace EE::Animation
     void TaskSystem::UpdatePostPhysics()
     {
         EE_PROFILE_SCOPE_ANIMATION( "Anim Post-Physics Tasks" );
+        EE_TELEMETRY_TIME_SCOPE( g_taskExecutionTimeCounter );
 
         m_taskContext.m_updateStage = TaskUpdateStage::PostPhysics;
+        g_tasksPerUpdateCounter.AddSample( (float) m_tasks.size() );
 
         // If we detected co-dependent tasks in the pre-physics update, there's nothing to do here
         if ( m_hasCodependentPhysicsTasks )
@@ -263,6 +274,7 @@ namespace EE::Animation
 
     void TaskSystem::ExecuteTasks()
     {
+        uint64_t numExecutedTasks = 0;
         int16_t const numTasks = (int8_t) m_tasks.size();
         for ( int8_t i = 0; i < numTasks; i++ )
         {
@@ -280,9 +292,11 @@ namespace EE::Animation
 
                 // Execute task
                 m_tasks[i]->Execute( m_taskContext );
+                numExecutedTasks++;
             }
         }
 
+        g_executedTasksCounter.Add( numExecutedTasks );
         m_needsUpdate = false;
     }
 
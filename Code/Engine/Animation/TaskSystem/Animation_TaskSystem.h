@@ -153,6 +153,9 @@ namespace EE::Animation
         //-------------------------------------------------------------------------
 
         #if EE_DEVELOPMENT_TOOLS
+        // Get the pose memory owned by this task system, transient buffers are shared via the pose buffer arena and are not included
+        size_t GetResidentPoseMemory() const { return m_posePool.GetResidentMemory() + m_finalPoseBuffer.GetAllocatedMemory(); }
+
         void SetDebugMode( TaskSystemDebugMode mode );
         TaskSystemDebugMode GetDebugMode() const { return m_debugMode; }
         void DrawDebug( Drawing::DrawContext& drawingContext );
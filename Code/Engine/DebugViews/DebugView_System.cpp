@@ -5,6 +5,8 @@
 #include "Base/Imgui/ImguiX.h"
 #include "Base/Profiling.h"
 #include "Base/Logging/SystemLog.h"
+#include "Base/Memory/MemoryTags.h"
+#include "Base/Telemetry/PerformanceCounters.h"
 
 //-------------------------------------------------------------------------
 
@@ -79,7 +81,7 @@ namespace EE
         // Check if there are more entries than we know about, if so updated the filtered list
         //-------------------------------------------------------------------------
 
-        if ( m_numLogEntriesWhenFiltered != SystemLog::GetLogEntries().size() )
+        if ( m_numLogEntriesWhenFiltered != SystemLog::GetNumLogEntries() )
         {
             UpdateFilteredList( context );
         }
@@ -223,38 +225,37 @@ namespace EE
 
     void SystemLogView::UpdateFilteredList( UpdateContext const& context )
     {
-        auto const& logEntries = SystemLog::GetLogEntries();
-
         UUID const previousSelection = m_selectedEntryID;
         m_selectedEntryID.Clear();
 
         //-------------------------------------------------------------------------
 
         m_filteredEntries.clear();
-        m_filteredEntries.reserve( logEntries.size() );
+        m_numLogEntriesWhenFiltered = SystemLog::GetNumLogEntries();
+        m_filteredEntries.reserve( m_numLogEntriesWhenFiltered );
 
-        for ( auto const& entry : logEntries )
+        auto FilterEntry = [this, &previousSelection] ( Log::Entry const& entry )
         {
             switch ( entry.m_severity )
             {
                 case Severity::Warning:
                 if ( !m_showLogWarnings )
                 {
-                    continue;
+                    return;
                 }
                 break;
 
                 case Severity::Error:
                 if ( !m_showLogErrors )
                 {
-                    continue;
+                    return;
                 }
                 break;
 
                 case Severity::Info:
                 if ( !m_showLogMessages )
                 {
-                    continue;
+                    return;
                 }
                 break;
 
@@ -275,7 +276,9 @@ namespace EE
                     m_selectedEntryID = entry.m_ID;
                 }
             }
-        }
+        };
+
+        SystemLog::IterateLogEntries( FilterEntry );
     }
 
     //-------------------------------------------------------------------------
@@ -340,6 +343,8 @@ namespace EE
     {
         DebugView::Initialize( systemRegistry, pWorld );
         m_windows.emplace_back( "System Log", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawLogWindow( context, isFocused ); } );
+        m_windows.emplace_back( "Memory", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawMemoryWindow( context, isFocused ); } );
+        m_windows.emplace_back( "Performance Counters", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawPerformanceCountersWindow( context, isFocused ); } );
     }
 
     void SystemDebugView::DrawMenu( EntityWorldUpdateContext const& context )
@@ -348,11 +353,142 @@ namespace EE
         {
             Profiling::OpenProfiler();
         }
+
+        if ( ImGui::MenuItem( "Show Memory Tags" ) )
+        {
+            m_windows[1].m_isOpen = true;
+        }
+
+        if ( ImGui::MenuItem( "Show Performance Counters" ) )
+        {
+            m_windows[2].m_isOpen = true;
+        }
     }
 
     void SystemDebugView::DrawLogWindow( EntityWorldUpdateContext const& context, bool isFocused )
     {
         m_logView.Draw( context );
     }
+
+    void SystemDebugView::DrawMemoryWindow( EntityWorldUpdateContext const& context, bool isFocused )
+    {
+        #if EE_MEMORY_TAGGING
+        if ( ImGui::Button( "Reset Peaks" ) )
+        {
+            Memory::ResetTagPeaks();
+        }
+
+        //-------------------------------------------------------------------------
+
+        ImGuiX::ScopedFont const sf( ImGuiX::Font::Small );
+        if ( ImGui::BeginTable( "Memory Tags Table", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY ) )
+        {
+            ImGui::TableSetupColumn( "Tag", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableSetupColumn( "Live (KB)", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Peak (KB)", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Allocs/Frame", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "KB/Frame", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupScrollFreeze( 0, 1 );
+            ImGui::TableHeadersRow();
+
+            Memory::TagStats total;
+            auto DrawRow = [] ( char const* pName, Memory::TagStats const& stats )
+            {
+                ImGui::TableNextRow();
+
+                ImGui::TableSetColumnIndex( 0 );
+                ImGui::Text( pName );
+
+                ImGui::TableSetColumnIndex( 1 );
+                ImGui::Text( "%.1f", stats.m_liveBytes / 1024.0f );
+
+                ImGui::TableSetColumnIndex( 2 );
+                ImGui::Text( "%.1f", stats.m_peakLiveBytes / 1024.0f );
+
+                ImGui::TableSetColumnIndex( 3 );
+                ImGui::Text( "%llu", stats.m_numFrameAllocations );
+
+                ImGui::TableSetColumnIndex( 4 );
+                ImGui::Text( "%.1f", stats.m_frameAllocatedBytes / 1024.0f );
+            };
+
+            for ( int32_t i = 0; i < (int32_t) Memory::Tag::NumTags; i++ )
+            {
+                Memory::Tag const tag = (Memory::Tag) i;
+                Memory::TagStats const& stats = Memory::GetTagStats( tag );
+                DrawRow( Memory::GetTagName( tag ), stats );
+
+                total.m_liveBytes += stats.m_liveBytes;
+                total.m_peakLiveBytes += stats.m_peakLiveBytes;
+                total.m_numFrameAllocations += stats.m_numFrameAllocations;
+                total.m_frameAllocatedBytes += stats.m_frameAllocatedBytes;
+            }
+
+            // The total peak is the sum of the per-tag peaks, these might not have occurred at the same time
+            DrawRow( "Total", total );
+
+            ImGui::EndTable();
+        }
+        #else
+        ImGui::Text( "Memory tagging is disabled in this build (EE_MEMORY_TAGGING)" );
+        #endif
+    }
+
+    void SystemDebugView::DrawPerformanceCountersWindow( EntityWorldUpdateContext const& context, bool isFocused )
+    {
+        ImGui::Text( Telemetry::IsRecording() ? "Recording to file" : "Not recording (use -perfcounters <path> to record)" );
+
+        //-------------------------------------------------------------------------
+
+        ImGuiX::ScopedFont const sf( ImGuiX::Font::Small );
+        if ( ImGui::BeginTable( "Performance Counters Table", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY ) )
+        {
+            ImGui::TableSetupColumn( "Counter", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableSetupColumn( "Last", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Avg", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Max", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "History", ImGuiTableColumnFlags_WidthFixed, 200 );
+            ImGui::TableSetupScrollFreeze( 0, 1 );
+            ImGui::TableHeadersRow();
+
+            int32_t const numColumns = Telemetry::GetNumColumns();
+            for ( int32_t i = 0; i < numColumns; i++ )
+            {
+                Telemetry::GetHistory( i, m_counterHistory );
+
+                float averageValue = 0.0f;
+                float maxValue = 0.0f;
+                for ( float value : m_counterHistory )
+                {
+                    averageValue += value;
+                    maxValue = Math::Max( maxValue, value );
+                }
+                averageValue = m_counterHistory.empty() ? 0.0f : averageValue / m_counterHistory.size();
+
+                //-------------------------------------------------------------------------
+
+                ImGui::PushID( i );
+                ImGui::TableNextRow();
+
+                ImGui::TableSetColumnIndex( 0 );
+                ImGui::Text( Telemetry::GetColumnName( i ) );
+
+                ImGui::TableSetColumnIndex( 1 );
+                ImGui::Text( "%.3f", Telemetry::GetLastFrameValue( i ) );
+
+                ImGui::TableSetColumnIndex( 2 );
+                ImGui::Text( "%.3f", averageValue );
+
+                ImGui::TableSetColumnIndex( 3 );
+                ImGui::Text( "%.3f", maxValue );
+
+                ImGui::TableSetColumnIndex( 4 );
+                ImGui::PlotLines( "##History", m_counterHistory.data(), (int32_t) m_counterHistory.size(), 0, nullptr, 0.0f, maxValue, ImVec2( -1, 16 ) );
+                ImGui::PopID();
+            }
+
+            ImGui::EndTable();
+        }
+    }
 }
 #endif
\ No newline at end of file
@@ -72,10 +72,13 @@ namespace EE
         void DrawMenu( EntityWorldUpdateContext const& context ) override;
 
         void DrawLogWindow( EntityWorldUpdateContext const& context, bool isFocused );
+        void DrawMemoryWindow( EntityWorldUpdateContext const& context, bool isFocused );
+        void DrawPerformanceCountersWindow( EntityWorldUpdateContext const& context, bool isFocused );
 
     private:
 
         SystemLogView m_logView;
+        TVector<float> m_counterHistory;
     };
 }
 #endif
\ No newline at end of file
@@ -2,15 +2,28 @@
 #include "Engine/Console/Console.h"
 #include "Base/Network/NetworkSystem.h"
 #include "Base/Profiling.h"
+#include "Base/Telemetry/PerformanceCounters.h"
 #include "Base/FileSystem/FileSystem.h"
 #include "Base/Time/Timers.h"
 #include "Base/FileSystem/FileSystemUtils.h"
 #include "Base/Logging/SystemLog.h"
+#include "Base/Memory/Arena.h"
+#include "Base/Memory/MemoryTags.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    namespace
+    {
+        static Telemetry::GaugeCounter          g_frameTimeCounter( "Engine/Frame Time (ms)" );
+        static Telemetry::TimeCounter           g_networkingTimeCounter( "Engine/Networking (ms)" );
+        static Telemetry::TimeCounter           g_resourceSystemTimeCounter( "Engine/Resource System (ms)" );
+        static Telemetry::TimeCounter           g_renderingTimeCounter( "Engine/Rendering (ms)" );
+    }
+
+    //-------------------------------------------------------------------------
+
     Engine::Engine( TFunction<bool( EE::String const& error )>&& errorHandler )
         : m_fatalErrorHandler( errorHandler )
     {
@@ -142,6 +155,14 @@ namespace EE
 
         m_initializationStageReached = Stage::FullyInitialized;
 
+        if ( m_performanceCountersRecordingPath.IsValid() )
+        {
+            if ( !Telemetry::StartRecording( m_performanceCountersRecordingPath ) )
+            {
+                EE_LOG_ERROR( "System", "Telemetry", "Failed to start recording performance counters to: %s", m_performanceCountersRecordingPath.c_str() );
+            }
+        }
+
         //-------------------------------------------------------------------------
 
         PostInitialize();
@@ -171,6 +192,8 @@ namespace EE
 
         PreShutdown();
 
+        Telemetry::StopRecording();
+
         //-------------------------------------------------------------------------
         // Shutdown core engine state
         //-------------------------------------------------------------------------
@@ -281,6 +304,7 @@ namespace EE
 
     bool Engine::Update()
     {
+        EE_MEMORY_TAG_SCOPE( Core );
         EE_ASSERT( m_initializationStageReached == Stage::FullyInitialized );
 
         // Check for fatal errors
@@ -305,6 +329,7 @@ namespace EE
 
             {
                 EE_PROFILE_SCOPE_NETWORK( "Networking" );
+                EE_TELEMETRY_TIME_SCOPE( g_networkingTimeCounter );
                 Network::NetworkSystem::Update();
             }
 
@@ -315,6 +340,7 @@ namespace EE
 
             {
                 EE_PROFILE_SCOPE_RESOURCE( "Resource System" );
+                EE_TELEMETRY_TIME_SCOPE( g_resourceSystemTimeCounter );
 
                 m_pResourceSystem->Update();
 
@@ -508,8 +534,15 @@ namespace EE
 
                     m_pEntityWorldManager->EndFrame();
 
-                    m_renderingSystem.Update( m_updateContext );
+                    {
+                        EE_TELEMETRY_TIME_SCOPE( g_renderingTimeCounter );
+                        m_renderingSystem.Update( m_updateContext );
+                    }
+
                     m_pInputSystem->PrepareForNewMessages();
+
+                    // Invalidate all frame allocations
+                    Memory::AdvanceFrame();
                 }
             }
         }
@@ -538,6 +571,10 @@ namespace EE
 
         m_updateContext.UpdateDeltaTime( deltaTime );
         Profiling::EndFrame();
+
+        g_frameTimeCounter.Set( deltaTime.ToFloat() );
+        Telemetry::EndFrame();
+
         EngineClock::Update( deltaTime );
 
         // Should we exit?
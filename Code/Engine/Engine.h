@@ -99,6 +99,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         DataPath                                    m_startupMap;
+        FileSystem::Path                                m_performanceCountersRecordingPath;
         Stage                                           m_initializationStageReached = Stage::Uninitialized;
         bool                                            m_exitRequested = false;
     };
@@ -125,6 +125,9 @@ namespace EE
         // Get the ID of the map this entity belongs to
         inline EntityMapID const& GetMapID() const { return m_mapID; }
 
+        // Get the order in which this entity was added to its map, this is stable across runs as long as the map's entities are added in the same order
+        inline uint32_t GetMapSpawnIndex() const { return m_mapSpawnIdx; }
+
         // Get a list of all resource referenced by this entity
         void GetReferencedResources( TVector<ResourceID>& outReferencedResources ) const;
 
@@ -358,6 +361,7 @@ namespace EE
 
         EntityID                                            m_ID = EntityID::Generate();                                            // The unique ID of this entity ( globally unique and generated at runtime )
         EntityMapID                                         m_mapID;                                                                // The ID of the map that owns this entity
+        uint32_t                                            m_mapSpawnIdx = 0;                                                      // The order in which this entity was added to its map
         EE_REFLECT( ReadOnly ) StringID     m_name;                                                                 // The name of the entity, only unique within the context of a map
         Status                                              m_status = Status::Unloaded;
         UpdateRegistrationStatus                            m_updateRegistrationStatus = UpdateRegistrationStatus::Unregistered;    // Is this entity registered for frame updates
@@ -75,11 +75,13 @@ namespace EE::EntityModel
         m_entityIDLookupMap.swap( map.m_entityIDLookupMap );
         m_pMapDesc = eastl::move( map.m_pMapDesc );
         m_entitiesCurrentlyLoading = eastl::move( map.m_entitiesCurrentlyLoading );
+        m_nextEntitySpawnIdx = map.m_nextEntitySpawnIdx;
         m_status = map.m_status;
         const_cast<bool&>( m_isTransientMap ) = map.m_isTransientMap;
 
         // Clear source map
         map.m_ID.Clear();
+        map.m_nextEntitySpawnIdx = 0;
         map.m_status = Status::Unloaded;
         return *this;
     }
@@ -138,6 +140,7 @@ namespace EE::EntityModel
         Threading::RecursiveScopeLock lock( m_mutex );
 
         pEntity->m_mapID = m_ID;
+        pEntity->m_mapSpawnIdx = m_nextEntitySpawnIdx++;
         m_entities.emplace_back( pEntity );
         m_entitiesToLoad.emplace_back( pEntity );
 
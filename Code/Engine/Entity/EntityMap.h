@@ -6,6 +6,7 @@
 #include "Base/Threading/Threading.h"
 #include "Base/Resource/ResourcePtr.h"
 #include "Base/Math/Transform.h"
+#include "Base/Types/FlatHashMap.h"
 
 //-------------------------------------------------------------------------
 // Entity Map
@@ -220,10 +221,11 @@ namespace EE
             Threading::RecursiveMutex                   m_mutex;
             TResourcePtr<EntityMapDescriptor>           m_pMapDesc;
             TVector<Entity*>                            m_entities;
-            THashMap<EntityID, Entity*>                 m_entityIDLookupMap;
+            TFlatHashMap<EntityID, Entity*>             m_entityIDLookupMap;
             TVector<Entity*>                            m_entitiesCurrentlyLoading;
             TInlineVector<Entity*, 5>                   m_entitiesToLoad;
             TInlineVector<RemovalRequest, 5>            m_entitiesToRemove;
+            uint32_t                                    m_nextEntitySpawnIdx = 0;
             EventBindingID                              m_entityUpdateEventBindingID;
             Status                                      m_status = Status::Unloaded;
             bool const                                  m_isTransientMap = false; // If this is set, then this is a transient map i.e.created and managed at runtime and not loaded from disk
@@ -3,13 +3,33 @@
 #include "EntityWorldSettings.h"
 #include "Base/Resource/ResourceSystem.h"
 #include "Base/Profiling.h"
+#include "Base/Telemetry/PerformanceCounters.h"
 #include "Base/TypeSystem/TypeRegistry.h"
+#include "Base/Memory/MemoryTags.h"
 #include <eastl/sort.h>
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    namespace
+    {
+        static Telemetry::TimeCounter const g_stageTimeCounters[(int8_t) UpdateStage::NumStages] =
+        {
+            Telemetry::TimeCounter( "Entity/Frame Start (ms)" ),
+            Telemetry::TimeCounter( "Entity/Pre-Physics (ms)" ),
+            Telemetry::TimeCounter( "Entity/Physics (ms)" ),
+            Telemetry::TimeCounter( "Entity/Post-Physics (ms)" ),
+            Telemetry::TimeCounter( "Entity/Frame End (ms)" ),
+            Telemetry::TimeCounter( "Entity/Paused (ms)" ),
+        };
+
+        static Telemetry::TimeCounter const g_worldSystemsTimeCounter( "Entity/World Systems (ms)" );
+        static Telemetry::Counter const g_entitiesUpdatedCounter( "Entity/Entity Updates" );
+    }
+
+    //-------------------------------------------------------------------------
+
     EntityWorld::EntityWorld( EntityWorldType worldType )
         : m_initializationContext( m_worldSystems, m_entityUpdateList )
         , m_worldType( worldType )
@@ -54,6 +74,7 @@ namespace EE
         
         #if EE_DEVELOPMENT_TOOLS
         m_initializationContext.SetComponentTypeMapPtr( &m_componentTypeLookup );
+        m_debugDrawingSystem.SetTaskSystem( m_pTaskSystem );
         #endif
 
         EE_ASSERT( m_initializationContext.IsValid() );
@@ -162,6 +183,10 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        #if EE_DEVELOPMENT_TOOLS
+        m_debugDrawingSystem.SetTaskSystem( nullptr );
+        #endif
+
         m_pTaskSystem = nullptr;
         m_initialized = false;
     }
@@ -237,6 +262,9 @@ namespace EE
 
             virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
             {
+                EE_MEMORY_TAG_SCOPE( Entities );
+                g_entitiesUpdatedCounter.Add( range.end - range.start );
+
                 for ( uint64_t i = range.start; i < range.end; ++i )
                 {
                     auto pEntity = m_updateList[i];
@@ -287,6 +315,7 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        EE_TELEMETRY_TIME_SCOPE( g_stageTimeCounters[(int8_t) updateStage] );
         EntityWorldUpdateContext entityWorldUpdateContext( context, this );
 
         // Update entities
@@ -305,6 +334,7 @@ namespace EE
         for ( auto pSystem : m_systemUpdateLists[(int8_t) updateStage] )
         {
             EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
+            EE_TELEMETRY_TIME_SCOPE( g_worldSystemsTimeCounter );
             EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
             pSystem->UpdateSystem( entityWorldUpdateContext );
         }
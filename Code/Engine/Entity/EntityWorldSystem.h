@@ -17,6 +17,7 @@
 namespace EE
 {
     class SystemRegistry;
+    class EntityWorld;
     class EntityWorldUpdateContext;
     class Entity;
     class EntityComponent;
@@ -43,6 +44,9 @@ namespace EE
 
     protected:
 
+        // Get the world this system belongs to
+        EntityWorld const* GetEntityWorld() const { return m_pWorld; }
+
         // Get the required update stages and priorities for this component
         virtual UpdatePriorityList const& GetRequiredUpdatePriorities() = 0;
 
@@ -0,0 +1,616 @@
+#include "NavmeshPathService.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
+#include "Base/Profiling.h"
+#include "EASTL/algorithm.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Navmesh
+{
+    void PathService::Initialize( TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+        m_pTaskSystem = pTaskSystem;
+
+        m_requests.resize( s_maxRequests );
+        m_pendingRequests.reserve( s_maxRequests );
+        m_freeRequestIndices.resize( s_maxRequests );
+        for ( int32_t i = 0; i < s_maxRequests; i++ )
+        {
+            m_freeRequestIndices[i] = s_maxRequests - i - 1;
+        }
+
+        m_cache.reserve( s_maxCacheEntries );
+    }
+
+    void PathService::Shutdown()
+    {
+        #if EE_DEVELOPMENT_TOOLS
+        StopLoadTest();
+        #endif
+
+        m_requests.clear();
+        m_freeRequestIndices.clear();
+        m_pendingRequests.clear();
+        m_cache.clear();
+        m_pTaskSystem = nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
+    PathService::RequestHandle PathService::RequestPath( Vector const& startPosition, Vector const& goalPosition )
+    {
+        Cell const startCell = CalculateCell( startPosition, s_startCellSize );
+        Cell const startRegion = CalculateCell( startPosition, s_cacheRegionSize );
+        Cell const goalRegion = CalculateCell( goalPosition, s_cacheRegionSize );
+        float const goalToleranceSq = s_goalTolerance * s_goalTolerance;
+        float const cacheReuseDistanceSq = s_cacheReuseDistance * s_cacheReuseDistance;
+
+        RequestHandle handle;
+
+        Threading::ScopeLock const lock( m_mutex );
+        m_stats.m_numRequests++;
+
+        // Check the cache
+        //-------------------------------------------------------------------------
+
+        for ( CacheEntry const& entry : m_cache )
+        {
+            if ( entry.m_startRegion == startRegion && entry.m_goalRegion == goalRegion )
+            {
+                bool const isStartClose = entry.m_path.m_points.front().GetDistanceSquared3( startPosition ) <= cacheReuseDistanceSq;
+                bool const isGoalClose = entry.m_path.m_points.back().GetDistanceSquared3( goalPosition ) <= cacheReuseDistanceSq;
+                if ( isStartClose && isGoalClose )
+                {
+                    if ( Request* pRequest = AllocateRequest( handle ) )
+                    {
+                        pRequest->m_path = entry.m_path;
+                        pRequest->m_startPosition = startPosition;
+                        pRequest->m_goalPosition = goalPosition;
+                        pRequest->m_startCell = startCell;
+                        pRequest->m_startRegion = startRegion;
+                        pRequest->m_goalRegion = goalRegion;
+
+                        // We cant just move the endpoints since the straight line to the moved endpoint might leave the navmesh,
+                        // so unless the endpoints are unchanged, the first and last segments are replanned with the other requests
+                        bool const isExactMatch = entry.m_path.m_points.front().IsNearEqual3( startPosition ) && entry.m_path.m_points.back().IsNearEqual3( goalPosition );
+                        if ( isExactMatch )
+                        {
+                            pRequest->m_status = Status::Completed;
+                            pRequest->m_completedFrameIdx = m_frameIdx;
+                            m_stats.m_numCacheHits++;
+                        }
+                        else
+                        {
+                            pRequest->m_type = RequestType::CachedPath;
+                            SubmitRequest( *pRequest, handle.m_requestIdx );
+                        }
+                    }
+
+                    return handle;
+                }
+            }
+        }
+
+        // Merge with any matching pending request
+        //-------------------------------------------------------------------------
+
+        for ( int32_t requestIdx : m_pendingRequests )
+        {
+            Request& request = m_requests[requestIdx];
+            if ( request.m_type != RequestType::Repair && request.m_startCell == startCell && request.m_goalPosition.GetDistanceSquared3( goalPosition ) <= goalToleranceSq )
+            {
+                request.m_refCount++;
+                handle.m_requestIdx = requestIdx;
+                handle.m_generation = request.m_generation;
+                m_stats.m_numMergedRequests++;
+                return handle;
+            }
+        }
+
+        // Create a new request
+        //-------------------------------------------------------------------------
+
+        if ( Request* pRequest = AllocateRequest( handle ) )
+        {
+            pRequest->m_startPosition = startPosition;
+            pRequest->m_goalPosition = goalPosition;
+            pRequest->m_startCell = startCell;
+            pRequest->m_startRegion = startRegion;
+            pRequest->m_goalRegion = goalRegion;
+            SubmitRequest( *pRequest, handle.m_requestIdx );
+        }
+
+        return handle;
+    }
+
+    PathService::RequestHandle PathService::RequestPathRepair( Path const& currentPath, int32_t currentSegmentIdx, Vector const& currentPosition, Vector const& newGoalPosition )
+    {
+        int32_t const numSegments = currentPath.GetNumSegments();
+        if ( numSegments == 0 || currentPath.m_points.back().GetDistance3( newGoalPosition ) > s_maxRepairGoalDistance )
+        {
+            return RequestPath( currentPosition, newGoalPosition );
+        }
+
+        // If we are already on the tail, there is nothing to keep
+        EE_ASSERT( currentSegmentIdx >= 0 && currentSegmentIdx < numSegments );
+        int32_t const splicePointIdx = Math::Max( currentSegmentIdx + 1, numSegments - s_numRepairTailSegments );
+        if ( splicePointIdx >= numSegments )
+        {
+            return RequestPath( currentPosition, newGoalPosition );
+        }
+
+        //-------------------------------------------------------------------------
+
+        RequestHandle handle;
+
+        Threading::ScopeLock const lock( m_mutex );
+        m_stats.m_numRequests++;
+
+        if ( Request* pRequest = AllocateRequest( handle ) )
+        {
+            pRequest->m_path.m_points.assign( currentPath.m_points.begin() + currentSegmentIdx, currentPath.m_points.begin() + splicePointIdx + 1 );
+            pRequest->m_startPosition = currentPath.m_points[splicePointIdx];
+            pRequest->m_goalPosition = newGoalPosition;
+            pRequest->m_type = RequestType::Repair;
+            SubmitRequest( *pRequest, handle.m_requestIdx );
+        }
+
+        return handle;
+    }
+
+    void PathService::ReleaseRequest( RequestHandle& handle )
+    {
+        if ( !handle.IsValid() )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        {
+            Threading::ScopeLock const lock( m_mutex );
+
+            // Ignore stale handles, their results have already been discarded
+            Request& request = m_requests[handle.m_requestIdx];
+            if ( request.m_generation == handle.m_generation )
+            {
+                EE_ASSERT( request.m_refCount > 0 );
+                request.m_refCount--;
+                if ( request.m_refCount == 0 )
+                {
+                    FreeRequest( handle.m_requestIdx );
+                }
+            }
+        }
+
+        handle.Clear();
+    }
+
+    PathService::Status PathService::GetStatus( RequestHandle const& handle ) const
+    {
+        if ( !handle.IsValid() )
+        {
+            return Status::Invalid;
+        }
+
+        Request const& request = m_requests[handle.m_requestIdx];
+        return ( request.m_generation == handle.m_generation ) ? request.m_status : Status::Invalid;
+    }
+
+    Path const& PathService::GetPath( RequestHandle const& handle ) const
+    {
+        Request const& request = GetRequest( handle );
+        EE_ASSERT( request.m_status == Status::Completed );
+        return request.m_path;
+    }
+
+    //-------------------------------------------------------------------------
+
+    PathService::Request* PathService::AllocateRequest( RequestHandle& outHandle )
+    {
+        if ( m_freeRequestIndices.empty() )
+        {
+            EE_LOG_WARNING( "Navmesh", "Path Service", "Path request queue is full, request dropped!" );
+            return nullptr;
+        }
+
+        int32_t const requestIdx = m_freeRequestIndices.back();
+        m_freeRequestIndices.pop_back();
+
+        Request& request = m_requests[requestIdx];
+        EE_ASSERT( request.m_refCount == 0 && request.m_status == Status::Invalid );
+        request.m_refCount = 1;
+
+        outHandle.m_requestIdx = requestIdx;
+        outHandle.m_generation = request.m_generation;
+        return &request;
+    }
+
+    void PathService::SubmitRequest( Request& request, int32_t requestIdx )
+    {
+        #if EE_ENABLE_NAVPOWER
+        request.m_status = Status::Pending;
+        m_pendingRequests.emplace_back( requestIdx );
+        #else
+        // Nothing will ever plan the request, so fail it immediately rather than leaving the requester waiting forever
+        request.m_status = Status::Failed;
+        request.m_completedFrameIdx = m_frameIdx;
+        #endif
+    }
+
+    void PathService::FreeRequest( int32_t requestIdx )
+    {
+        Request& request = m_requests[requestIdx];
+        if ( request.m_status == Status::Pending )
+        {
+            m_pendingRequests.erase( eastl::find( m_pendingRequests.begin(), m_pendingRequests.end(), requestIdx ) );
+        }
+
+        request.m_path.Clear();
+        request.m_planningTime = 0.0f;
+        request.m_refCount = 0;
+        request.m_status = Status::Invalid;
+        request.m_type = RequestType::Full;
+        request.m_generation++;
+        m_freeRequestIndices.emplace_back( requestIdx );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void PathService::ClearCache()
+    {
+        Threading::ScopeLock const lock( m_mutex );
+        m_cache.clear();
+    }
+
+    void PathService::AddToCache( Request const& request )
+    {
+        EE_ASSERT( request.m_type == RequestType::Full && request.m_status == Status::Completed );
+
+        // Replace the existing entry for this region pair, or the oldest entry if the cache is full
+        CacheEntry* pEntry = nullptr;
+        for ( CacheEntry& entry : m_cache )
+        {
+            if ( entry.m_startRegion == request.m_startRegion && entry.m_goalRegion == request.m_goalRegion )
+            {
+                pEntry = &entry;
+                break;
+            }
+        }
+
+        if ( pEntry == nullptr )
+        {
+            if ( m_cache.size() < s_maxCacheEntries )
+            {
+                pEntry = &m_cache.emplace_back();
+            }
+            else
+            {
+                auto Comparator = [] ( CacheEntry const& a, CacheEntry const& b ) { return a.m_frameIdx < b.m_frameIdx; };
+                pEntry = eastl::min_element( m_cache.begin(), m_cache.end(), Comparator );
+            }
+        }
+
+        pEntry->m_path = request.m_path;
+        pEntry->m_startRegion = request.m_startRegion;
+        pEntry->m_goalRegion = request.m_goalRegion;
+        pEntry->m_frameIdx = m_frameIdx;
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    void PathService::StartLoadTest( int32_t numAgents, AABB const& area )
+    {
+        EE_ASSERT( numAgents > 0 && area.IsValid() );
+
+        StopLoadTest();
+        m_loadTestArea = area;
+        m_loadTestStats = LoadTestStats();
+        m_loadTestAgents.resize( numAgents );
+    }
+
+    void PathService::StopLoadTest()
+    {
+        for ( LoadTestAgent& agent : m_loadTestAgents )
+        {
+            ReleaseRequest( agent.m_request );
+        }
+
+        m_loadTestAgents.clear();
+    }
+
+    void PathService::UpdateLoadTest()
+    {
+        if ( m_loadTestAgents.empty() )
+        {
+            return;
+        }
+
+        EE_PROFILE_SCOPE_NAVIGATION( "Path Service Load Test" );
+
+        auto GetRandomCoordinate = [this] ( float center, float extent )
+        {
+            return ( extent > 0.0f ) ? m_loadTestRNG.GetFloat( center - extent, center + extent ) : center;
+        };
+
+        auto GetRandomPoint = [this, &GetRandomCoordinate] ()
+        {
+            Vector const& center = m_loadTestArea.GetCenter();
+            Vector const& extents = m_loadTestArea.GetExtents();
+            return Vector( GetRandomCoordinate( center.GetX(), extents.GetX() ), GetRandomCoordinate( center.GetY(), extents.GetY() ), GetRandomCoordinate( center.GetZ(), extents.GetZ() ) );
+        };
+
+        //-------------------------------------------------------------------------
+
+        for ( LoadTestAgent& agent : m_loadTestAgents )
+        {
+            Status const status = GetStatus( agent.m_request );
+            if ( status == Status::Pending )
+            {
+                continue;
+            }
+
+            if ( status == Status::Completed || status == Status::Failed )
+            {
+                uint32_t const latencyFrames = GetRequest( agent.m_request ).m_completedFrameIdx - agent.m_requestFrameIdx;
+                m_loadTestStats.m_totalLatencyFrames += latencyFrames;
+                m_loadTestStats.m_maxLatencyFrames = Math::Max( m_loadTestStats.m_maxLatencyFrames, latencyFrames );
+
+                if ( status == Status::Completed )
+                {
+                    m_loadTestStats.m_numCompletedPaths++;
+                }
+                else
+                {
+                    m_loadTestStats.m_numFailedPaths++;
+                }
+            }
+
+            // Finished, dropped or stale, either way we issue a new request
+            ReleaseRequest( agent.m_request );
+            agent.m_request = RequestPath( GetRandomPoint(), GetRandomPoint() );
+            agent.m_requestFrameIdx = m_frameIdx;
+
+            if ( !agent.m_request.IsValid() )
+            {
+                m_loadTestStats.m_numDroppedRequests++;
+            }
+        }
+
+        m_loadTestStats.m_maxPendingRequests = Math::Max( m_loadTestStats.m_maxPendingRequests, GetNumPendingRequests() );
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
+    #if EE_ENABLE_NAVPOWER
+    // Plan a path and append its points to the supplied list, optionally skipping the start point (when splicing onto an existing path)
+    static bool PlanPath( bfx::SpaceHandle spaceHandle, Vector const& startPosition, Vector const& goalPosition, TVector<Vector>& outPoints, bool skipStartPoint )
+    {
+        bfx::PathSpec pathSpec;
+        pathSpec.m_snapMode = bfx::SNAP_CLOSEST;
+
+        bfx::PathCreationOptions pathOptions;
+        pathOptions.m_forceFirstPosOntoNavGraph = true;
+
+        bfx::PolylinePathRCPtr pPath = bfx::CreatePolylinePath( spaceHandle, ToBfx( startPosition ), ToBfx( goalPosition ), 0, pathSpec, pathOptions );
+        if ( !pPath.IsValid() || pPath.GetNumSegments() == 0 )
+        {
+            return false;
+        }
+
+        uint32_t const numSegments = pPath.GetNumSegments();
+        if ( !skipStartPoint )
+        {
+            outPoints.emplace_back( FromBfx( pPath.GetSurfaceSegment( 0 )->GetStartPos() ) );
+        }
+
+        for ( uint32_t s = 0; s < numSegments; s++ )
+        {
+            outPoints.emplace_back( FromBfx( pPath.GetSurfaceSegment( s )->GetEndPos() ) );
+        }
+
+        return true;
+    }
+
+    // Replan the first and/or last segments of a cached path so that it runs between the new endpoints, returns false if either end couldnt be planned
+    static bool ReplanCachedPathEnds( bfx::SpaceHandle spaceHandle, TVector<Vector> const& cachedPoints, Vector const& startPosition, Vector const& goalPosition, TVector<Vector>& outPoints )
+    {
+        int32_t const numCachedSegments = (int32_t) cachedPoints.size() - 1;
+        EE_ASSERT( numCachedSegments > 0 );
+
+        // A single segment is both the first and last segment, so there is nothing to reuse
+        if ( numCachedSegments == 1 )
+        {
+            return PlanPath( spaceHandle, startPosition, goalPosition, outPoints, false );
+        }
+
+        if ( cachedPoints.front().IsNearEqual3( startPosition ) )
+        {
+            outPoints.insert( outPoints.end(), cachedPoints.begin(), cachedPoints.begin() + 2 );
+        }
+        else if ( !PlanPath( spaceHandle, startPosition, cachedPoints[1], outPoints, false ) )
+        {
+            return false;
+        }
+
+        outPoints.insert( outPoints.end(), cachedPoints.begin() + 2, cachedPoints.end() - 1 );
+
+        if ( cachedPoints.back().IsNearEqual3( goalPosition ) )
+        {
+            outPoints.emplace_back( cachedPoints.back() );
+            return true;
+        }
+
+        return PlanPath( spaceHandle, cachedPoints[numCachedSegments - 1], goalPosition, outPoints, true );
+    }
+
+    void PathService::ProcessRequests( bfx::SpaceHandle spaceHandle )
+    {
+        EE_PROFILE_SCOPE_NAVIGATION( "Process Path Requests" );
+
+        m_frameIdx++;
+
+        // Discard any results that were never picked up (i.e. the requester was destroyed)
+        //-------------------------------------------------------------------------
+
+        if ( m_freeRequestIndices.size() < s_maxRequests )
+        {
+            for ( int32_t i = 0; i < s_maxRequests; i++ )
+            {
+                Request const& request = m_requests[i];
+                bool const isFinished = request.m_status == Status::Completed || request.m_status == Status::Failed;
+                if ( isFinished && ( m_frameIdx - request.m_completedFrameIdx ) > s_maxUnclaimedResultFrames )
+                {
+                    FreeRequest( i );
+                }
+            }
+        }
+
+        // Remove expired cache entries
+        //-------------------------------------------------------------------------
+
+        auto IsExpired = [this] ( CacheEntry const& entry ) { return ( m_frameIdx - entry.m_frameIdx ) > s_maxCacheEntryAgeFrames; };
+        m_cache.erase( eastl::remove_if( m_cache.begin(), m_cache.end(), IsExpired ), m_cache.end() );
+
+        //-------------------------------------------------------------------------
+
+        if ( m_pendingRequests.empty() )
+        {
+            return;
+        }
+
+        // Plan in parallel until we run out of budget
+        //-------------------------------------------------------------------------
+        // Each worker claims the oldest unclaimed request from the front of the queue and every claimed request is always planned,
+        // so the planned requests are always a prefix of the queue and the requests left pending are always the newest ones
+
+        struct PlanPathsTask : public ITaskSet
+        {
+            PlanPathsTask( PathService* pService, bfx::SpaceHandle spaceHandle, uint32_t numWorkers )
+                : ITaskSet( numWorkers, 1 )
+                , m_pService( pService )
+                , m_spaceHandle( spaceHandle )
+                , m_numPendingRequests( (int32_t) pService->m_pendingRequests.size() )
+            {}
+
+            inline int32_t GetNumClaimedRequests() const { return Math::Min( m_nextPendingIdx.load(), m_numPendingRequests ); }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                while ( true )
+                {
+                    // Check the budget before claiming, a claimed request must always be planned
+                    // The oldest request is always planned so the queue makes progress even with a budget smaller than a single plan
+                    if ( m_nextPendingIdx.load() > 0 && m_timer.GetElapsedTimeMilliseconds() > m_pService->m_frameBudget )
+                    {
+                        return;
+                    }
+
+                    int32_t const pendingIdx = m_nextPendingIdx.fetch_add( 1 );
+                    if ( pendingIdx >= m_numPendingRequests )
+                    {
+                        return;
+                    }
+
+                    Request& request = m_pService->m_requests[m_pService->m_pendingRequests[pendingIdx]];
+
+                    Timer<PlatformClock> planningTimer;
+                    bool wasPlanned = false;
+
+                    switch ( request.m_type )
+                    {
+                        case RequestType::Full:
+                        {
+                            wasPlanned = PlanPath( m_spaceHandle, request.m_startPosition, request.m_goalPosition, request.m_path.m_points, false );
+                        }
+                        break;
+
+                        // Repairs keep the prefix and we skip the first tail point since it is the splice point
+                        case RequestType::Repair:
+                        {
+                            wasPlanned = PlanPath( m_spaceHandle, request.m_startPosition, request.m_goalPosition, request.m_path.m_points, true );
+                        }
+                        break;
+
+                        // If the ends of the cached path cant be replanned, the cached path isnt valid for this request so we do a full plan
+                        case RequestType::CachedPath:
+                        {
+                            TVector<Vector> cachedPoints;
+                            cachedPoints.swap( request.m_path.m_points );
+                            wasPlanned = ReplanCachedPathEnds( m_spaceHandle, cachedPoints, request.m_startPosition, request.m_goalPosition, request.m_path.m_points );
+                            if ( !wasPlanned )
+                            {
+                                request.m_type = RequestType::Full;
+                                request.m_path.Clear();
+                                wasPlanned = PlanPath( m_spaceHandle, request.m_startPosition, request.m_goalPosition, request.m_path.m_points, false );
+                            }
+                        }
+                        break;
+                    }
+
+                    request.m_planningTime = planningTimer.GetElapsedTimeMilliseconds();
+                    request.m_status = ( wasPlanned && request.m_path.IsValid() ) ? Status::Completed : Status::Failed;
+                    request.m_completedFrameIdx = m_pService->m_frameIdx;
+                }
+            }
+
+        private:
+
+            PathService*                    m_pService = nullptr;
+            bfx::SpaceHandle                m_spaceHandle;
+            Timer<PlatformClock>            m_timer;
+            int32_t const                   m_numPendingRequests;
+            std::atomic<int32_t>            m_nextPendingIdx = 0;
+        };
+
+        PlanPathsTask task( this, spaceHandle, m_pTaskSystem->GetNumThreads() );
+        m_pTaskSystem->ScheduleTask( &task );
+        m_pTaskSystem->WaitForTask( &task );
+
+        // Update stats and cache, and pop all planned requests from the front of the queue
+        //-------------------------------------------------------------------------
+
+        int32_t const numPlannedRequests = task.GetNumClaimedRequests();
+        for ( int32_t i = 0; i < numPlannedRequests; i++ )
+        {
+            Request const& request = m_requests[m_pendingRequests[i]];
+            EE_ASSERT( request.m_status != Status::Pending );
+
+            switch ( request.m_type )
+            {
+                case RequestType::Full:
+                {
+                    m_stats.m_numFullPlans++;
+                    m_stats.m_totalFullPlanTime += request.m_planningTime;
+
+                    if ( request.m_status == Status::Completed )
+                    {
+                        AddToCache( request );
+                    }
+                }
+                break;
+
+                case RequestType::Repair:
+                {
+                    m_stats.m_numTailPlans++;
+                    m_stats.m_totalTailPlanTime += request.m_planningTime;
+                }
+                break;
+
+                case RequestType::CachedPath:
+                {
+                    m_stats.m_numCacheHits++;
+                    m_stats.m_totalCachedPathReplanTime += request.m_planningTime;
+                }
+                break;
+            }
+        }
+
+        m_pendingRequests.erase( m_pendingRequests.begin(), m_pendingRequests.begin() + numPlannedRequests );
+    }
+    #endif
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Navmesh/NavPower.h"
+#include "Base/Math/Vector.h"
+#include "Base/Math/BoundingVolumes.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Time/Time.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::Navmesh
+{
+    //-------------------------------------------------------------------------
+    // Path
+    //-------------------------------------------------------------------------
+    // A planned path, stored as a simple polyline so that paths can be cached and spliced together
+
+    struct Path
+    {
+        inline bool IsValid() const { return m_points.size() > 1; }
+        inline int32_t GetNumSegments() const { return IsValid() ? (int32_t) m_points.size() - 1 : 0; }
+        inline Vector const& GetSegmentStart( int32_t segmentIdx ) const { EE_ASSERT( segmentIdx < GetNumSegments() ); return m_points[segmentIdx]; }
+        inline Vector const& GetSegmentEnd( int32_t segmentIdx ) const { EE_ASSERT( segmentIdx < GetNumSegments() ); return m_points[segmentIdx + 1]; }
+        inline void Clear() { m_points.clear(); }
+
+    public:
+
+        TVector<Vector>                             m_points;
+    };
+
+    //-------------------------------------------------------------------------
+    // Path Service
+    //-------------------------------------------------------------------------
+    // Asynchronous path planning: AI request paths during their update and pick up the results in a later frame
+    // Pending requests are planned by the navmesh world system across the task workers under a per-frame time budget
+    // Requests are planned strictly in request order, whatever doesn't fit in the budget remains at the front of the queue for the next frame
+    // Requests that start in the same cell and have the same goal as a pending request are merged into it
+    //
+    // Completed full plans are cached per (start region, goal region) pair for a short while and requests close to a cached path's
+    // endpoints reuse it. If the endpoints match exactly the request completes immediately, otherwise the first and last segments of
+    // the cached path no longer end where the request does, so only those are replanned (a full plan is done if that fails).
+    //
+    // Agents following a moving goal can request a repair which keeps the current path and only replans the last few segments to the new goal.
+    //
+    // Without NavPower there is no planner, so requests that arent served from the cache fail immediately
+    //
+    // Requesting and releasing are threadsafe. Results are only written during the navmesh world system update so they can be
+    // freely read during entity updates. Handles should be released once the requester is done with them, results that are
+    // not picked up within a few frames are discarded and their handles become stale (reported as invalid)
+
+    class EE_ENGINE_API PathService
+    {
+        friend class NavmeshWorldSystem;
+
+    public:
+
+        constexpr static int32_t const s_maxRequests = 1024;
+        constexpr static float const s_startCellSize = 1.0f;        // Requests starting within the same cell (with the same goal) are merged
+        constexpr static float const s_goalTolerance = 0.1f;        // The max distance between goals for two requests to be merged
+        constexpr static uint32_t const s_maxUnclaimedResultFrames = 30;
+
+        constexpr static int32_t const s_maxCacheEntries = 256;
+        constexpr static float const s_cacheRegionSize = 4.0f;      // The size of the regions used to key the path cache
+        constexpr static float const s_cacheReuseDistance = 0.5f;   // The max distance between the request and cached endpoints for a cached path to be reused
+        constexpr static uint32_t const s_maxCacheEntryAgeFrames = 120;
+
+        constexpr static float const s_maxRepairGoalDistance = 3.0f; // If the goal moved further than this, we replan the whole path
+        constexpr static int32_t const s_numRepairTailSegments = 2;  // The number of segments at the end of the path that are replanned
+
+        enum class Status : uint8_t
+        {
+            Invalid,
+            Pending,
+            Completed,
+            Failed
+        };
+
+        struct RequestHandle
+        {
+            inline bool IsValid() const { return m_requestIdx != InvalidIndex; }
+            inline void Clear() { m_requestIdx = InvalidIndex; m_generation = 0; }
+
+            int32_t                                 m_requestIdx = InvalidIndex;
+            uint32_t                                m_generation = 0;
+        };
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct LoadTestStats
+        {
+            inline float GetAverageLatencyFrames() const { return ( m_numCompletedPaths + m_numFailedPaths ) > 0 ? float( m_totalLatencyFrames ) / ( m_numCompletedPaths + m_numFailedPaths ) : 0.0f; }
+
+        public:
+
+            uint32_t                                m_numCompletedPaths = 0;
+            uint32_t                                m_numFailedPaths = 0;
+            uint32_t                                m_numDroppedRequests = 0;   // Requests rejected since the request queue was full
+            uint64_t                                m_totalLatencyFrames = 0;
+            uint32_t                                m_maxLatencyFrames = 0;     // The most frames any request waited for its result
+            int32_t                                 m_maxPendingRequests = 0;
+        };
+        #endif
+
+        struct Stats
+        {
+            inline float GetCacheHitRate() const { return ( m_numRequests > 0 ) ? float( m_numCacheHits ) / m_numRequests : 0.0f; }
+            inline Milliseconds GetAverageFullPlanTime() const { return ( m_numFullPlans > 0 ) ? Milliseconds( m_totalFullPlanTime / m_numFullPlans ) : Milliseconds( 0.0f ); }
+            inline Milliseconds GetAverageTailPlanTime() const { return ( m_numTailPlans > 0 ) ? Milliseconds( m_totalTailPlanTime / m_numTailPlans ) : Milliseconds( 0.0f ); }
+
+            // Cache hits and merged requests save a full plan (minus the time spent replanning the ends of reused paths),
+            // repairs save the difference between a full plan and a tail plan
+            inline Milliseconds GetEstimatedPlannerTimeSaved() const
+            {
+                float const averageFullPlanTime = GetAverageFullPlanTime();
+                float const repairSaving = Math::Max( averageFullPlanTime - GetAverageTailPlanTime().ToFloat(), 0.0f );
+                float const timeSaved = ( m_numCacheHits + m_numMergedRequests ) * averageFullPlanTime + m_numTailPlans * repairSaving - m_totalCachedPathReplanTime;
+                return Math::Max( timeSaved, 0.0f );
+            }
+
+        public:
+
+            uint32_t                                m_numRequests = 0;
+            uint32_t                                m_numMergedRequests = 0;
+            uint32_t                                m_numCacheHits = 0;
+            uint32_t                                m_numFullPlans = 0;
+            uint32_t                                m_numTailPlans = 0;
+            Milliseconds                            m_totalFullPlanTime = 0.0f;
+            Milliseconds                            m_totalTailPlanTime = 0.0f;
+            Milliseconds                            m_totalCachedPathReplanTime = 0.0f;
+        };
+
+    private:
+
+        struct Cell
+        {
+            inline bool operator==( Cell const& rhs ) const { return m_x == rhs.m_x && m_y == rhs.m_y && m_z == rhs.m_z; }
+
+            int32_t                                 m_x = 0;
+            int32_t                                 m_y = 0;
+            int32_t                                 m_z = 0;
+        };
+
+        enum class RequestType : uint8_t
+        {
+            Full,                                                           // Plan the whole path
+            Repair,                                                         // Keep the current path's prefix and plan the tail to the new goal
+            CachedPath,                                                     // Reuse a cached path, replanning its first and last segments to the request's endpoints
+        };
+
+        struct Request
+        {
+            Path                                    m_path;                 // The result - for repairs this is initialized with the prefix being kept, for reused paths with the cached path
+            Vector                                  m_startPosition;        // The planner start position (the tail start for repairs)
+            Vector                                  m_goalPosition;
+            Cell                                    m_startCell;
+            Cell                                    m_startRegion;
+            Cell                                    m_goalRegion;
+            Milliseconds                            m_planningTime = 0.0f;
+            uint32_t                                m_generation = 0;
+            uint32_t                                m_completedFrameIdx = 0;
+            int32_t                                 m_refCount = 0;
+            Status                                  m_status = Status::Invalid;
+            RequestType                             m_type = RequestType::Full;
+        };
+
+        struct CacheEntry
+        {
+            Path                                    m_path;
+            Cell                                    m_startRegion;
+            Cell                                    m_goalRegion;
+            uint32_t                                m_frameIdx = 0;
+        };
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct LoadTestAgent
+        {
+            RequestHandle                           m_request;
+            uint32_t                                m_requestFrameIdx = 0;
+        };
+        #endif
+
+    public:
+
+        // Queue a path request, this will return an invalid handle if the request queue is full
+        RequestHandle RequestPath( Vector const& startPosition, Vector const& goalPosition );
+
+        // Request a new path to a goal that has moved - the current path is kept from the current segment up to the last few segments
+        // and only the tail is replanned. The resulting path starts at the current segment of the current path.
+        // If the goal moved too far from the end of the current path, this falls back to a full request from the current position.
+        RequestHandle RequestPathRepair( Path const& currentPath, int32_t currentSegmentIdx, Vector const& currentPosition, Vector const& newGoalPosition );
+
+        // Release a request handle - this cancels the request if it is still pending and nobody else shares it
+        void ReleaseRequest( RequestHandle& handle );
+
+        // Get the status of a request, stale handles return 'Invalid'
+        Status GetStatus( RequestHandle const& handle ) const;
+
+        // Get the planned path, only valid to call for completed requests
+        Path const& GetPath( RequestHandle const& handle ) const;
+
+        // Was this request a repair of an existing path
+        bool IsRepair( RequestHandle const& handle ) const { return GetRequest( handle ).m_type == RequestType::Repair; }
+
+        // The max amount of time to spend planning each frame
+        inline Milliseconds GetFrameBudget() const { return m_frameBudget; }
+        inline void SetFrameBudget( Milliseconds budget ) { EE_ASSERT( budget > 0.0f ); m_frameBudget = budget; }
+
+        inline int32_t GetNumPendingRequests() const { return (int32_t) m_pendingRequests.size(); }
+
+        // Cache
+        //-------------------------------------------------------------------------
+
+        inline int32_t GetNumCachedPaths() const { return (int32_t) m_cache.size(); }
+
+        // Needs to be called whenever the navmesh changes
+        void ClearCache();
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        inline Stats const& GetStats() const { return m_stats; }
+        inline void ResetStats() { m_stats = Stats(); }
+
+        // Load Test
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Simulate a number of agents that continuously request paths between random points in the specified area
+        // Each agent requests a new path as soon as its previous request finishes, so every agent always has a request in flight
+        void StartLoadTest( int32_t numAgents, AABB const& area );
+        void StopLoadTest();
+        inline bool IsLoadTestRunning() const { return !m_loadTestAgents.empty(); }
+        inline int32_t GetNumLoadTestAgents() const { return (int32_t) m_loadTestAgents.size(); }
+        inline LoadTestStats const& GetLoadTestStats() const { return m_loadTestStats; }
+        #endif
+
+    private:
+
+        void Initialize( TaskSystem* pTaskSystem );
+        void Shutdown();
+
+        #if EE_ENABLE_NAVPOWER
+        // Plan as many pending requests as the frame budget allows
+        void ProcessRequests( bfx::SpaceHandle spaceHandle );
+        #endif
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Pick up the load test agents' results and issue their next requests, called once per frame before the requests are processed
+        void UpdateLoadTest();
+        #endif
+
+        // Allocate a new request, the caller needs to hold the lock
+        Request* AllocateRequest( RequestHandle& outHandle );
+
+        // Queue a newly allocated request for planning (requests fail immediately if we have no planner), the caller needs to hold the lock
+        void SubmitRequest( Request& request, int32_t requestIdx );
+
+        // Return a request to the free list, the caller needs to hold the lock
+        void FreeRequest( int32_t requestIdx );
+
+        // Add a completed full plan to the cache
+        void AddToCache( Request const& request );
+
+        inline Request const& GetRequest( RequestHandle const& handle ) const
+        {
+            EE_ASSERT( handle.IsValid() && handle.m_requestIdx < s_maxRequests );
+            Request const& request = m_requests[handle.m_requestIdx];
+            EE_ASSERT( request.m_generation == handle.m_generation );
+            return request;
+        }
+
+        EE_FORCE_INLINE static Cell CalculateCell( Vector const& position, float cellSize )
+        {
+            Float3 const cellCoords = position / cellSize;
+            return Cell{ Math::FloorToInt( cellCoords.m_x ), Math::FloorToInt( cellCoords.m_y ), Math::FloorToInt( cellCoords.m_z ) };
+        }
+
+    private:
+
+        TaskSystem*                                 m_pTaskSystem = nullptr;
+        TVector<Request>                            m_requests;             // Fixed size, so that results can be read without locking
+        TVector<int32_t>                            m_freeRequestIndices;
+        TVector<int32_t>                            m_pendingRequests;      // FIFO, requests are only ever planned from the front
+        TVector<CacheEntry>                         m_cache;
+        Stats                                       m_stats;
+        Milliseconds                                m_frameBudget = 2.0f;
+        uint32_t                                    m_frameIdx = 0;
+        Threading::Mutex                            m_mutex;
+
+        #if EE_DEVELOPMENT_TOOLS
+        TVector<LoadTestAgent>                      m_loadTestAgents;
+        AABB                                        m_loadTestArea;
+        LoadTestStats                               m_loadTestStats;
+        Math::RNG                                   m_loadTestRNG = Math::RNG( 0 );
+        #endif
+    };
+}
@@ -7,6 +7,8 @@
 #include "Base/Profiling.h"
 #include "Base/Math/BoundingVolumes.h"
 #include "Base/Drawing/DebugDrawingSystem.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Memory/MemoryTags.h"
 
 //-------------------------------------------------------------------------
 
@@ -105,6 +107,8 @@ namespace EE::Navmesh
 
     void NavmeshWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
     {
+        m_pathService.Initialize( systemRegistry.GetSystem<TaskSystem>() );
+
         #if EE_ENABLE_NAVPOWER
         m_pInstance = bfx::SystemCreate( bfx::SystemParams( 2.0f, bfx::Z_UP ), NavPower::GetAllocator() );
         bfx::SetCurrentInstance( nullptr );
@@ -133,6 +137,8 @@ namespace EE::Navmesh
         bfx::SystemDestroy( m_pInstance );
         m_pInstance = nullptr;
         #endif
+
+        m_pathService.Shutdown();
     }
 
     //-------------------------------------------------------------------------
@@ -195,6 +201,9 @@ namespace EE::Navmesh
         // Add record
         m_registeredNavmeshes.emplace_back( RegisteredNavmesh( pComponent->GetID(), pNavmesh ) );
 
+        // Any cached paths may no longer be valid
+        m_pathService.ClearCache();
+
         #endif
     }
 
@@ -214,6 +223,7 @@ namespace EE::Navmesh
 
                 EE::Free( m_registeredNavmeshes[i].m_pNavmesh );
                 m_registeredNavmeshes.erase_unsorted( m_registeredNavmeshes.begin() + i );
+                m_pathService.ClearCache();
                 return;
             }
         }
@@ -226,8 +236,17 @@ namespace EE::Navmesh
 
     void NavmeshWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( Navmesh );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_pathService.UpdateLoadTest();
+        #endif
+
         #if EE_ENABLE_NAVPOWER
 
+        // All AI have updated for this frame, so plan any queued path requests
+        m_pathService.ProcessRequests( GetSpaceHandle() );
+
         {
             EE_PROFILE_SCOPE_NAVIGATION( "Navmesh Simulate" );
             bfx::SystemSimulate( m_pInstance, ctx.GetDeltaTime() );
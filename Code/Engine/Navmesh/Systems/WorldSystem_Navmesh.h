@@ -2,6 +2,7 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Navmesh/NavPower.h"
+#include "Engine/Navmesh/NavmeshPathService.h"
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "Engine/UpdateContext.h"
 
@@ -49,6 +50,10 @@ namespace EE::Navmesh
 
         AABB GetNavmeshBounds( uint32_t layerIdx ) const;
 
+        // Asynchronous path requests - requests are planned during this system's update
+        inline PathService& GetPathService() { return m_pathService; }
+        inline PathService const& GetPathService() const { return m_pathService; }
+
         #if EE_ENABLE_NAVPOWER
         EE_FORCE_INLINE bfx::SpaceHandle GetSpaceHandle() const { return bfx::GetDefaultSpaceHandle( m_pInstance ); }
         #endif
@@ -86,5 +91,6 @@ namespace EE::Navmesh
 
         TVector<NavmeshComponent*>                      m_navmeshComponents;
         TVector<RegisteredNavmesh>                      m_registeredNavmeshes;
+        PathService                                     m_pathService;
     };
 }
\ No newline at end of file
@@ -164,37 +164,66 @@ namespace EE::Physics
 
     Vector CharacterComponent::MoveCharacter( Seconds deltaTime, Quaternion const& deltaRotation, Vector const& deltaTranslation )
     {
-        EE_ASSERT( deltaTime > 0.0f );
         EE_ASSERT( IsControllerCreated() );
+        EE_ASSERT( !m_hasPendingMove );
         EE_PROFILE_FUNCTION_GAMEPLAY();
 
-        Transform const startWorldTransform = GetWorldTransform();
-        Transform endWorldTransform( deltaRotation * startWorldTransform.GetRotation() );
+        if ( BeginMove( deltaTime, deltaRotation, deltaTranslation ) )
+        {
+            auto physicsScene = m_pController->getScene();
+            physicsScene->lockWrite();
+            ExecuteMove();
+            physicsScene->unlockWrite();
+        }
 
-        //-------------------------------------------------------------------------
+        return CompleteMove();
+    }
 
-        #if EE_DEVELOPMENT_TOOLS
-        if ( m_debugCapsule )
+    void CharacterComponent::RequestMove( Seconds deltaTime, Quaternion const& deltaRotation, Vector const& deltaTranslation )
+    {
+        EE_ASSERT( deltaTime > 0.0f );
+        EE_ASSERT( IsControllerCreated() );
+
+        if ( m_hasPendingMove )
         {
-            m_debugPreMoveTransform = startWorldTransform;
+            m_pendingDeltaRotation = m_pendingDeltaRotation * deltaRotation;
+            m_pendingDeltaTranslation += deltaTranslation;
+            m_pendingDeltaTime += deltaTime;
         }
-        #endif
+        else
+        {
+            m_pendingDeltaRotation = deltaRotation;
+            m_pendingDeltaTranslation = deltaTranslation;
+            m_pendingDeltaTime = deltaTime;
+            m_hasPendingMove = true;
+        }
+    }
+
+    bool CharacterComponent::BeginMove( Seconds deltaTime, Quaternion const& deltaRotation, Vector const& deltaTranslation )
+    {
+        EE_ASSERT( deltaTime > 0.0f );
+
+        m_moveStartTransform = GetWorldTransform();
+        m_moveEndRotation = deltaRotation * m_moveStartTransform.GetRotation();
+        m_moveDesiredDeltaTranslation = deltaTranslation;
+        m_moveDeltaTime = deltaTime;
+        m_moveCollisionFlags = physx::PxControllerCollisionFlags();
 
         //-------------------------------------------------------------------------
 
         #if EE_DEVELOPMENT_TOOLS
+        if ( m_debugCapsule )
+        {
+            m_debugPreMoveTransform = m_moveStartTransform;
+        }
+
+        // Ghost mode moves are completed without touching the controller
         if ( m_isGhostModeEnabled )
         {
-            endWorldTransform.SetTranslation( startWorldTransform.GetTranslation() + deltaTranslation );
-            TeleportCharacter( endWorldTransform );
-            return deltaTranslation;
+            return false;
         }
         #endif
 
-        //-------------------------------------------------------------------------
-
-        Vector desiredDeltaTranslation = deltaTranslation;
-
         // Gravity
         //-------------------------------------------------------------------------
 
@@ -215,20 +244,34 @@ namespace EE::Physics
 
             m_gravitationalSpeed = Math::Clamp( m_gravitationalSpeed, -s_maxGravitationalSpeed, s_maxGravitationalSpeed );
             Vector const verticalDelta = Physics::Constants::s_gravity * ( m_gravitationalSpeed * deltaTime );
-            desiredDeltaTranslation += verticalDelta;
+            m_moveDesiredDeltaTranslation += verticalDelta;
         }
 
-        // Move Controller
-        //-------------------------------------------------------------------------
+        return true;
+    }
 
+    void CharacterComponent::ExecuteMove()
+    {
         m_callbackHandler.Reset();
         physx::PxControllerFilters filters( &m_queryRules.GetPxFilterData().data );
 
         // Note: do not set a minimum distance or we will early out of the move and not get back a floor
-        auto physicsScene = m_pController->getScene();
-        physicsScene->lockWrite();
-        physx::PxControllerCollisionFlags const collisionResultFlags = m_pController->move( ToPx( desiredDeltaTranslation ), 0.0f, deltaTime, filters, nullptr );
-        physicsScene->unlockWrite();
+        m_moveCollisionFlags = m_pController->move( ToPx( m_moveDesiredDeltaTranslation ), 0.0f, m_moveDeltaTime, filters, nullptr );
+    }
+
+    Vector CharacterComponent::CompleteMove()
+    {
+        Transform endWorldTransform( m_moveEndRotation );
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_isGhostModeEnabled )
+        {
+            endWorldTransform.SetTranslation( m_moveStartTransform.GetTranslation() + m_moveDesiredDeltaTranslation );
+            TeleportCharacter( endWorldTransform );
+            m_lastMoveDeltaTranslation = m_moveDesiredDeltaTranslation;
+            return m_lastMoveDeltaTranslation;
+        }
+        #endif
 
         // Process the results of the move
         //-------------------------------------------------------------------------
@@ -237,7 +280,7 @@ namespace EE::Physics
         m_pController->getState( controllerState );
 
         // Collision with a roof
-        if ( collisionResultFlags.isSet( physx::PxControllerCollisionFlag::eCOLLISION_UP ) )
+        if ( m_moveCollisionFlags.isSet( physx::PxControllerCollisionFlag::eCOLLISION_UP ) )
         {
             // If we have a upwards adjustment speed, clear it
             if ( m_gravitationalSpeed < 0 )
@@ -247,7 +290,7 @@ namespace EE::Physics
         }
 
         // Collision with the ground
-        if ( collisionResultFlags.isSet( physx::PxControllerCollisionFlag::eCOLLISION_DOWN ) )
+        if ( m_moveCollisionFlags.isSet( physx::PxControllerCollisionFlag::eCOLLISION_DOWN ) )
         {
             m_timeWithoutFloor.Reset();
             m_gravitationalSpeed = 0.0f;
@@ -292,7 +335,7 @@ namespace EE::Physics
             m_floorType = ControllerFloorType::NoFloor;
             m_floorNormal = Vector::Zero;
             m_floorContactPoint = Vector::Zero;
-            m_timeWithoutFloor.Update( deltaTime );
+            m_timeWithoutFloor.Update( m_moveDeltaTime );
         }
 
         //-------------------------------------------------------------------------
@@ -300,8 +343,8 @@ namespace EE::Physics
         // Set the world transform to the result of the controller move
         endWorldTransform.SetTranslation( FromPx( m_pController->getPosition() ) );
         SetWorldTransformDirectly( endWorldTransform, false ); // Do not fire callback as we dont want to teleport the character
-        Vector const actualDeltaTranslation = endWorldTransform.GetTranslation() - startWorldTransform.GetTranslation();
-        m_linearVelocity = actualDeltaTranslation / deltaTime;
+        m_lastMoveDeltaTranslation = endWorldTransform.GetTranslation() - m_moveStartTransform.GetTranslation();
+        m_linearVelocity = m_lastMoveDeltaTranslation / m_moveDeltaTime;
 
         //-------------------------------------------------------------------------
 
@@ -314,7 +357,7 @@ namespace EE::Physics
 
         //-------------------------------------------------------------------------
 
-        return actualDeltaTranslation;
+        return m_lastMoveDeltaTranslation;
     }
 
     void CharacterComponent::ResizeCapsule( float newRadius, float newHalfHeight, bool keepFloorPosition )
@@ -103,6 +103,9 @@ namespace EE::Physics
 
     public:
 
+        inline CharacterComponent() = default;
+        inline CharacterComponent( StringID name ) : SpatialEntityComponent( name ) {}
+
         // Movement
         //-------------------------------------------------------------------------
 
@@ -110,6 +113,18 @@ namespace EE::Physics
         // Returns the actual delta movement that was performed
         Vector MoveCharacter( Seconds deltaTime, Quaternion const& deltaRotation, Vector const& deltaTranslation );
 
+        // Request a move that will be resolved together with all other requested moves right before the physics simulation
+        // This doesnt touch the physics scene and so can be called from any entity update without contention
+        // The result of the move (transform, velocity, floor) is available from the post-physics stage onwards
+        // Multiple requests in the same frame are accumulated, a character should not mix requested and immediate moves in a frame
+        void RequestMove( Seconds deltaTime, Quaternion const& deltaRotation, Vector const& deltaTranslation );
+
+        // Do we have a requested move that hasnt been resolved yet?
+        inline bool HasPendingMove() const { return m_hasPendingMove; }
+
+        // The actual delta movement that was performed by the last move (either immediate or requested)
+        EE_FORCE_INLINE Vector const& GetLastMoveDeltaTranslation() const { return m_lastMoveDeltaTranslation; }
+
         // This will set the component's world transform and teleport the physics actor to the desired location.
         // Note: This will reset the character velocity
         // Note: This is the same as directly moving the component
@@ -269,6 +284,12 @@ namespace EE::Physics
         // Update physics world position for this shape
         virtual void OnWorldTransformUpdated() override final;
 
+        // Moves are split into stages so that the physics world can resolve all requested moves with a single scene lock
+        // Begin returns false if no controller move is needed, execute requires the scene write lock, complete returns the actual delta movement
+        bool BeginMove( Seconds deltaTime, Quaternion const& deltaRotation, Vector const& deltaTranslation );
+        void ExecuteMove();
+        Vector CompleteMove();
+
     protected:
 
         // The radius of the capsule's end caps
@@ -313,6 +334,21 @@ namespace EE::Physics
         Vector                                  m_linearVelocity = Vector::Zero;
         ControllerGravityMode                   m_gravityMode = ControllerGravityMode::Acceleration;
         ControllerFloorType                     m_floorType = ControllerFloorType::NoFloor;
+        Vector                                  m_lastMoveDeltaTranslation = Vector::Zero;
+
+        // The move currently being performed
+        Transform                               m_moveStartTransform;
+        Quaternion                              m_moveEndRotation = Quaternion::Identity;
+        Vector                                  m_moveDesiredDeltaTranslation = Vector::Zero;
+        Seconds                                 m_moveDeltaTime = 0.0f;
+        physx::PxControllerCollisionFlags       m_moveCollisionFlags;
+        bool                                    m_requiresControllerMove = false;
+
+        // The accumulated requested move, resolved by the physics world system
+        Quaternion                              m_pendingDeltaRotation = Quaternion::Identity;
+        Vector                                  m_pendingDeltaTranslation = Vector::Zero;
+        Seconds                                 m_pendingDeltaTime = 0.0f;
+        bool                                    m_hasPendingMove = false;
 
         //-------------------------------------------------------------------------
 
@@ -12,5 +12,31 @@ namespace EE::Physics
     class EE_ENGINE_API PhysicsTestComponent : public SpatialEntityComponent
     {
         EE_ENTITY_COMPONENT( PhysicsTestComponent );
+
+        friend class PhysicsWorldSystem;
+
+    public:
+
+        inline int32_t GetNumStressTestCharacters() const { return m_numStressTestCharacters; }
+
+    private:
+
+        // Spawn this many character capsules in a grid standing on this component's position and keep them moving (e.g. 1000 for the batched character move stress test)
+        EE_REFLECT( Category = "Character Stress Test" );
+        int32_t                                 m_numStressTestCharacters = 0;
+
+        // The distance between the spawned characters
+        EE_REFLECT( Category = "Character Stress Test" );
+        float                                   m_stressTestSpacing = 1.5f;
+
+        // The radius of the circles that the spawned characters walk along
+        EE_REFLECT( Category = "Character Stress Test" );
+        float                                   m_stressTestMoveRadius = 3.0f;
+
+        // The speed the spawned characters walk at (m/s)
+        EE_REFLECT( Category = "Character Stress Test" );
+        float                                   m_stressTestMoveSpeed = 4.0f;
+
+        bool                                    m_hasSpawnedStressTestCharacters = false;
     };
 }
\ No newline at end of file
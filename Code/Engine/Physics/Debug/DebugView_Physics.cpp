@@ -136,6 +136,21 @@ namespace EE::Physics
             pWorld->SetDebugDrawDistance( drawDistance );
         }
 
+        //-------------------------------------------------------------------------
+        // Characters
+        //-------------------------------------------------------------------------
+
+        ImGui::Separator();
+
+        bool isDeterministicCharacterMovementEnabled = m_pPhysicsWorldSystem->IsDeterministicCharacterMovementEnabled();
+        if ( ImGui::Checkbox( "Deterministic Character Moves", &isDeterministicCharacterMovementEnabled ) )
+        {
+            m_pPhysicsWorldSystem->SetDeterministicCharacterMovementEnabled( isDeterministicCharacterMovementEnabled );
+        }
+
+        ImGui::Text( "Moved Characters: %d (%.3fms)", m_pPhysicsWorldSystem->GetNumMovedCharacters(), m_pPhysicsWorldSystem->GetLastCharacterMoveTime().ToFloat() );
+        ImGui::Text( "Stress Test Characters: %d", m_pPhysicsWorldSystem->GetNumStressTestCharacters() );
+
         //-------------------------------------------------------------------------
         // Materials
         //-------------------------------------------------------------------------
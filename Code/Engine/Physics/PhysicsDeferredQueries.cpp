@@ -0,0 +1,58 @@
+#include "PhysicsDeferredQueries.h"
+#include "PhysicsWorld.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Physics
+{
+    void DeferredQueries::Initialize( TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( pTaskSystem != nullptr && m_pTaskSystem == nullptr );
+        m_pTaskSystem = pTaskSystem;
+        m_numThreads = (int32_t) m_pTaskSystem->GetNumThreads();
+        m_batches.resize( m_numThreads * 2 );
+        m_flushIdx = 0;
+    }
+
+    void DeferredQueries::Shutdown()
+    {
+        m_batches.clear();
+        m_numThreads = 0;
+        m_pTaskSystem = nullptr;
+    }
+
+    void DeferredQueries::Flush( PhysicsWorld* pWorld )
+    {
+        EE_PROFILE_FUNCTION_PHYSICS();
+        EE_ASSERT( pWorld != nullptr && m_pTaskSystem != nullptr );
+
+        m_isFlushing = true;
+
+        // Execute all the recorded queries
+        //-------------------------------------------------------------------------
+
+        int32_t const recordingSetOffset = ( m_flushIdx & 1 ) * m_numThreads;
+        for ( int32_t i = 0; i < m_numThreads; i++ )
+        {
+            QueryBatch& batch = m_batches[recordingSetOffset + i];
+            if ( !batch.IsEmpty() )
+            {
+                pWorld->ExecuteQueryBatch( batch, m_pTaskSystem );
+            }
+        }
+
+        // Swap sets, the new recording set holds the previous flush's results which are now stale
+        //-------------------------------------------------------------------------
+
+        m_flushIdx++;
+
+        int32_t const newRecordingSetOffset = ( m_flushIdx & 1 ) * m_numThreads;
+        for ( int32_t i = 0; i < m_numThreads; i++ )
+        {
+            m_batches[newRecordingSetOffset + i].Reset();
+        }
+
+        m_isFlushing = false;
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Physics/PhysicsQueryBatch.h"
+#include "Base/Threading/TaskSystem.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Physics
+{
+    class PhysicsWorld;
+
+    //-------------------------------------------------------------------------
+    // Deferred Queries
+    //-------------------------------------------------------------------------
+    // Allows entity update tasks to record scene queries without acquiring the scene lock
+    // Each task thread records into its own query batch so submission never contends with other threads
+    // All recorded queries are executed together by the physics world system right before the simulation step
+    //
+    // Ordering:
+    // * Queries submitted during the PrePhysics stage (and by entity updates in the Physics stage) are executed in that frame's flush
+    // * Queries see the scene state after all PrePhysics updates (and actor rebuilds and requested character moves) but before that frame's simulation step
+    // * Results are available from the flush until the next frame's flush, i.e. in PostPhysics, FrameEnd and the next frame's PrePhysics
+    // * There is no ordering between queries, each query has its own results so the submission order is irrelevant
+    // * Handles older than that are stale and have no results
+
+    class EE_ENGINE_API DeferredQueries
+    {
+        friend class PhysicsWorldSystem;
+
+    public:
+
+        struct Handle
+        {
+            inline bool IsValid() const { return m_queryHandle.IsValid(); }
+
+            QueryBatch::QueryHandle             m_queryHandle;
+            uint32_t                            m_flushIdx = 0;
+            int32_t                             m_threadIdx = InvalidIndex;
+        };
+
+    public:
+
+        // Record a query into the calling thread's batch - this is lock-free and can be called from any task thread
+        // Usage: auto handle = deferredQueries.Submit( [&] ( QueryBatch& batch ) { return batch.AddRayCast( start, end, rules ); } );
+        template<typename AddQueryFunc>
+        inline Handle Submit( AddQueryFunc&& addQueryFunction )
+        {
+            EE_ASSERT( !m_isFlushing );
+
+            int32_t const threadIdx = (int32_t) m_pTaskSystem->GetCurrentThreadIndex();
+            EE_ASSERT( threadIdx >= 0 && threadIdx < m_numThreads );
+
+            Handle handle;
+            handle.m_queryHandle = addQueryFunction( GetRecordingBatch( threadIdx ) );
+            handle.m_flushIdx = m_flushIdx;
+            handle.m_threadIdx = threadIdx;
+            return handle;
+        }
+
+        // Have the results for this query been produced and are they still available
+        inline bool HasResults( Handle const& handle ) const { return handle.IsValid() && ( handle.m_flushIdx + 1 ) == m_flushIdx; }
+
+        // Did the query hit/overlap anything
+        inline bool GetResult( Handle const& handle ) const { return GetResultsBatch( handle ).GetResult( handle.m_queryHandle ); }
+
+        inline RayCastResults const& GetRayCastResults( Handle const& handle ) const { return GetResultsBatch( handle ).GetRayCastResults( handle.m_queryHandle ); }
+        inline SweepResults const& GetSweepResults( Handle const& handle ) const { return GetResultsBatch( handle ).GetSweepResults( handle.m_queryHandle ); }
+        inline OverlapResults const& GetOverlapResults( Handle const& handle ) const { return GetResultsBatch( handle ).GetOverlapResults( handle.m_queryHandle ); }
+
+    private:
+
+        void Initialize( TaskSystem* pTaskSystem );
+        void Shutdown();
+
+        // Execute all recorded queries and make their results available, must not run concurrently with any submissions
+        void Flush( PhysicsWorld* pWorld );
+
+        // We have two sets of per-thread batches: one recording and one holding the results of the last flush
+        inline QueryBatch& GetRecordingBatch( int32_t threadIdx ) { return m_batches[( m_flushIdx & 1 ) * m_numThreads + threadIdx]; }
+
+        inline QueryBatch const& GetResultsBatch( Handle const& handle ) const
+        {
+            EE_ASSERT( HasResults( handle ) );
+            return m_batches[( handle.m_flushIdx & 1 ) * m_numThreads + handle.m_threadIdx];
+        }
+
+    private:
+
+        TaskSystem*                             m_pTaskSystem = nullptr;
+        TVector<QueryBatch>                     m_batches;
+        int32_t                                 m_numThreads = 0;
+        uint32_t                                m_flushIdx = 0;
+        bool                                    m_isFlushing = false;
+    };
+}
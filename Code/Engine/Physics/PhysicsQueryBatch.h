@@ -0,0 +1,250 @@
+#pragma once
+
+#include "Engine/Physics/PhysicsQuery.h"
+#include "Base/Math/Transform.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Physics
+{
+    //-------------------------------------------------------------------------
+    // Query Batch
+    //-------------------------------------------------------------------------
+    // A set of scene queries that are recorded up front and then executed together via 'PhysicsWorld::ExecuteQueryBatch'
+    // Executing a batch only acquires the scene read lock once per worker range rather than once per query
+    // Queries are executed grouped by shape type and the results are written into the batch's preallocated result buffers
+    //
+    // Usage: add the queries (keeping the returned handles), execute the batch and then read the results back using the handles
+    // Resetting the batch keeps all the allocated memory so a batch can be reused frame to frame without allocating
+
+    class QueryBatch
+    {
+        friend class PhysicsWorld;
+
+    public:
+
+        enum class QueryType : uint8_t
+        {
+            RayCast = 0,
+            SphereSweep,
+            CapsuleSweep,
+            CylinderSweep,
+            BoxSweep,
+            SphereOverlap,
+            CapsuleOverlap,
+            CylinderOverlap,
+            BoxOverlap,
+
+            NumTypes
+        };
+
+        // A handle to a recorded query, only valid for the batch that created it until the batch is reset
+        struct QueryHandle
+        {
+            QueryHandle() = default;
+            explicit QueryHandle( int32_t requestIdx ) : m_requestIdx( requestIdx ) {}
+
+            inline bool IsValid() const { return m_requestIdx != InvalidIndex; }
+
+            int32_t                         m_requestIdx = InvalidIndex;
+        };
+
+    private:
+
+        struct Request
+        {
+            Transform                       m_transform;                    // The start transform for sweeps/ray casts, the shape transform for overlaps
+            Vector                          m_direction = Vector::Zero;
+            Vector                          m_shapeParameters = Vector::Zero; // Sphere: (radius), Capsule/Cylinder: (radius, half-height), Box: (half extents)
+            float                           m_distance = 0.0f;
+            int32_t                         m_rulesIdx = InvalidIndex;
+            int32_t                         m_resultIdx = InvalidIndex;
+            QueryType                       m_type = QueryType::RayCast;
+            bool                            m_result = false;
+        };
+
+    public:
+
+        // Remove all recorded queries and results, this keeps all allocated memory
+        inline void Reset()
+        {
+            m_requests.clear();
+            m_rules.clear();
+            m_rayCastResults.clear();
+            m_sweepResults.clear();
+            m_overlapResults.clear();
+            m_wasExecuted = false;
+        }
+
+        // Preallocate space for the expected number of queries
+        inline void Reserve( int32_t numRayCasts, int32_t numSweeps, int32_t numOverlaps )
+        {
+            int32_t const numQueries = numRayCasts + numSweeps + numOverlaps;
+            m_requests.reserve( numQueries );
+            m_rules.reserve( numQueries );
+            m_rayCastResults.reserve( numRayCasts );
+            m_sweepResults.reserve( numSweeps );
+            m_overlapResults.reserve( numOverlaps );
+        }
+
+        inline bool IsEmpty() const { return m_requests.empty(); }
+        inline int32_t GetNumQueries() const { return (int32_t) m_requests.size(); }
+        inline bool WasExecuted() const { return m_wasExecuted; }
+
+        // Ray Casts
+        //-------------------------------------------------------------------------
+
+        inline QueryHandle AddRayCast( Vector const& start, Vector const& end, QueryRules const& rules )
+        {
+            Vector direction;
+            float distance;
+            ( end - start ).ToDirectionAndLength3( direction, distance );
+            return AddRayCast( start, direction, distance, rules );
+        }
+
+        inline QueryHandle AddRayCast( Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+        {
+            EE_ASSERT( unitDirection.IsNormalized3() && distance > 0 );
+            return AddRequest( QueryType::RayCast, Transform( Quaternion::Identity, start ), unitDirection, distance, Vector::Zero, rules );
+        }
+
+        // Sweeps
+        //-------------------------------------------------------------------------
+
+        inline QueryHandle AddSphereSweep( float radius, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+        {
+            EE_ASSERT( unitDirection.IsNormalized3() && distance > 0 );
+            return AddRequest( QueryType::SphereSweep, Transform( Quaternion::Identity, start ), unitDirection, distance, Vector( radius ), rules );
+        }
+
+        inline QueryHandle AddCapsuleSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+        {
+            EE_ASSERT( unitDirection.IsNormalized3() && distance > 0 );
+            return AddRequest( QueryType::CapsuleSweep, Transform( orientation, start ), unitDirection, distance, Vector( radius, cylinderPortionHalfHeight, 0.0f ), rules );
+        }
+
+        inline QueryHandle AddCylinderSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+        {
+            EE_ASSERT( unitDirection.IsNormalized3() && distance > 0 );
+            return AddRequest( QueryType::CylinderSweep, Transform( orientation, start ), unitDirection, distance, Vector( radius, cylinderPortionHalfHeight, 0.0f ), rules );
+        }
+
+        inline QueryHandle AddBoxSweep( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+        {
+            EE_ASSERT( unitDirection.IsNormalized3() && distance > 0 );
+            return AddRequest( QueryType::BoxSweep, Transform( orientation, start ), unitDirection, distance, halfExtents, rules );
+        }
+
+        // Overlaps
+        //-------------------------------------------------------------------------
+
+        inline QueryHandle AddSphereOverlap( float radius, Vector const& position, QueryRules const& rules )
+        {
+            return AddRequest( QueryType::SphereOverlap, Transform( Quaternion::Identity, position ), Vector::Zero, 0.0f, Vector( radius ), rules );
+        }
+
+        inline QueryHandle AddCapsuleOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+        {
+            return AddRequest( QueryType::CapsuleOverlap, Transform( orientation, position ), Vector::Zero, 0.0f, Vector( radius, cylinderPortionHalfHeight, 0.0f ), rules );
+        }
+
+        inline QueryHandle AddCylinderOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+        {
+            return AddRequest( QueryType::CylinderOverlap, Transform( orientation, position ), Vector::Zero, 0.0f, Vector( radius, cylinderPortionHalfHeight, 0.0f ), rules );
+        }
+
+        inline QueryHandle AddBoxOverlap( Vector halfExtents, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+        {
+            return AddRequest( QueryType::BoxOverlap, Transform( orientation, position ), Vector::Zero, 0.0f, halfExtents, rules );
+        }
+
+        // Results
+        //-------------------------------------------------------------------------
+
+        inline QueryType GetQueryType( QueryHandle const& handle ) const { return GetRequest( handle ).m_type; }
+
+        // Did the query hit/overlap anything
+        inline bool GetResult( QueryHandle const& handle ) const { EE_ASSERT( m_wasExecuted ); return GetRequest( handle ).m_result; }
+
+        inline RayCastResults const& GetRayCastResults( QueryHandle const& handle ) const
+        {
+            EE_ASSERT( m_wasExecuted );
+            Request const& request = GetRequest( handle );
+            EE_ASSERT( IsRayCast( request.m_type ) );
+            return m_rayCastResults[request.m_resultIdx];
+        }
+
+        inline SweepResults const& GetSweepResults( QueryHandle const& handle ) const
+        {
+            EE_ASSERT( m_wasExecuted );
+            Request const& request = GetRequest( handle );
+            EE_ASSERT( IsSweep( request.m_type ) );
+            return m_sweepResults[request.m_resultIdx];
+        }
+
+        inline OverlapResults const& GetOverlapResults( QueryHandle const& handle ) const
+        {
+            EE_ASSERT( m_wasExecuted );
+            Request const& request = GetRequest( handle );
+            EE_ASSERT( IsOverlap( request.m_type ) );
+            return m_overlapResults[request.m_resultIdx];
+        }
+
+    private:
+
+        EE_FORCE_INLINE static bool IsRayCast( QueryType type ) { return type == QueryType::RayCast; }
+        EE_FORCE_INLINE static bool IsSweep( QueryType type ) { return type >= QueryType::SphereSweep && type <= QueryType::BoxSweep; }
+        EE_FORCE_INLINE static bool IsOverlap( QueryType type ) { return type >= QueryType::SphereOverlap && type <= QueryType::BoxOverlap; }
+
+        inline Request const& GetRequest( QueryHandle const& handle ) const
+        {
+            EE_ASSERT( handle.m_requestIdx >= 0 && handle.m_requestIdx < m_requests.size() );
+            return m_requests[handle.m_requestIdx];
+        }
+
+        inline QueryHandle AddRequest( QueryType type, Transform const& transform, Vector const& direction, float distance, Vector const& shapeParameters, QueryRules const& rules )
+        {
+            EE_ASSERT( !m_wasExecuted ); // Reset the batch before reusing it
+
+            Request& request = m_requests.emplace_back();
+            request.m_type = type;
+            request.m_transform = transform;
+            request.m_direction = direction;
+            request.m_distance = distance;
+            request.m_shapeParameters = shapeParameters;
+
+            request.m_rulesIdx = (int32_t) m_rules.size();
+            m_rules.emplace_back( rules );
+
+            // Reserve the result slot
+            if ( IsRayCast( type ) )
+            {
+                request.m_resultIdx = (int32_t) m_rayCastResults.size();
+                m_rayCastResults.emplace_back();
+            }
+            else if ( IsSweep( type ) )
+            {
+                request.m_resultIdx = (int32_t) m_sweepResults.size();
+                m_sweepResults.emplace_back();
+            }
+            else
+            {
+                request.m_resultIdx = (int32_t) m_overlapResults.size();
+                m_overlapResults.emplace_back();
+            }
+
+            return QueryHandle( (int32_t) m_requests.size() - 1 );
+        }
+
+    private:
+
+        TVector<Request>                    m_requests;
+        TVector<QueryRules>                 m_rules;
+        TVector<RayCastResults>             m_rayCastResults;
+        TVector<SweepResults>               m_sweepResults;
+        TVector<OverlapResults>             m_overlapResults;
+        TVector<int32_t>                    m_executionOrder;
+        bool                                m_wasExecuted = false;
+    };
+}
@@ -1,5 +1,6 @@
 #include "PhysicsRagdoll.h"
 #include "Physics.h"
+#include "PhysicsWorld.h"
 #include "Engine/Animation/AnimationPose.h"
 #include "Base/Drawing/DebugDrawing.h"
 #include "Base/Math/MathUtils.h"
@@ -624,6 +625,24 @@ namespace EE::Physics
             }
         }
 
+        // Create the flat tables used when reading back the pose
+        //-------------------------------------------------------------------------
+
+        int32_t const numPaddedBodies = (int32_t) Math::RoundUpToNearestMultiple32( numBodies, 4 );
+
+        m_bodyParentBoneMap.clear();
+        m_inverseOffsetTransforms.clear();
+        m_bodyParentBoneMap.resize( numBodies, InvalidIndex );
+        m_inverseOffsetTransforms.resize( numPaddedBodies, Transform::Identity );
+        m_canBatchConvertPoses = true;
+
+        for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
+        {
+            m_bodyParentBoneMap[bodyIdx] = m_skeleton->GetParentBoneIndex( m_bodyToBoneMap[bodyIdx] );
+            m_inverseOffsetTransforms[bodyIdx] = m_bodies[bodyIdx].m_inverseOffsetTransform;
+            m_canBatchConvertPoses &= !m_bodies[bodyIdx].m_inverseOffsetTransform.HasNegativeScale();
+        }
+
         // Calculate self-collision rules
         //-------------------------------------------------------------------------
 
@@ -679,6 +698,104 @@ namespace EE::Physics
 
 namespace EE::Physics
 {
+    namespace
+    {
+        // Four transforms in SoA form, used to convert the transforms of all the bodies in batches of four
+        struct TransformX4
+        {
+            EE_FORCE_INLINE void Load( Transform const* pTransforms )
+            {
+                __m128 r0 = pTransforms[0].GetRotation(), r1 = pTransforms[1].GetRotation(), r2 = pTransforms[2].GetRotation(), r3 = pTransforms[3].GetRotation();
+                _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+                m_rotationX = r0;
+                m_rotationY = r1;
+                m_rotationZ = r2;
+                m_rotationW = r3;
+
+                __m128 t0 = pTransforms[0].GetTranslationAndScale(), t1 = pTransforms[1].GetTranslationAndScale(), t2 = pTransforms[2].GetTranslationAndScale(), t3 = pTransforms[3].GetTranslationAndScale();
+                _MM_TRANSPOSE4_PS( t0, t1, t2, t3 );
+                m_translationX = t0;
+                m_translationY = t1;
+                m_translationZ = t2;
+                m_scale = t3;
+            }
+
+            EE_FORCE_INLINE void Splat( Transform const& transform )
+            {
+                Quaternion const& rotation = transform.GetRotation();
+                Vector const& translationScale = transform.GetTranslationAndScale();
+                m_rotationX = _mm_shuffle_ps( rotation, rotation, _MM_SHUFFLE( 0, 0, 0, 0 ) );
+                m_rotationY = _mm_shuffle_ps( rotation, rotation, _MM_SHUFFLE( 1, 1, 1, 1 ) );
+                m_rotationZ = _mm_shuffle_ps( rotation, rotation, _MM_SHUFFLE( 2, 2, 2, 2 ) );
+                m_rotationW = _mm_shuffle_ps( rotation, rotation, _MM_SHUFFLE( 3, 3, 3, 3 ) );
+                m_translationX = translationScale.GetSplatX();
+                m_translationY = translationScale.GetSplatY();
+                m_translationZ = translationScale.GetSplatZ();
+                m_scale = translationScale.GetSplatW();
+            }
+
+            EE_FORCE_INLINE void Store( Transform* pTransforms ) const
+            {
+                __m128 r0 = m_rotationX, r1 = m_rotationY, r2 = m_rotationZ, r3 = m_rotationW;
+                _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+                __m128 t0 = m_translationX, t1 = m_translationY, t2 = m_translationZ, t3 = m_scale;
+                _MM_TRANSPOSE4_PS( t0, t1, t2, t3 );
+
+                Transform::DirectlySetRotation( pTransforms[0], Quaternion( Vector( r0 ) ) );
+                Transform::DirectlySetRotation( pTransforms[1], Quaternion( Vector( r1 ) ) );
+                Transform::DirectlySetRotation( pTransforms[2], Quaternion( Vector( r2 ) ) );
+                Transform::DirectlySetRotation( pTransforms[3], Quaternion( Vector( r3 ) ) );
+                Transform::DirectlySetTranslationScale( pTransforms[0], Vector( t0 ) );
+                Transform::DirectlySetTranslationScale( pTransforms[1], Vector( t1 ) );
+                Transform::DirectlySetTranslationScale( pTransforms[2], Vector( t2 ) );
+                Transform::DirectlySetTranslationScale( pTransforms[3], Vector( t3 ) );
+            }
+
+        public:
+
+            Vector m_rotationX, m_rotationY, m_rotationZ, m_rotationW;
+            Vector m_translationX, m_translationY, m_translationZ, m_scale;
+        };
+
+        // Calculates 'a * b' for four transforms at once, matches Transform::operator* for non-negative scales
+        EE_FORCE_INLINE TransformX4 Multiply( TransformX4 const& a, TransformX4 const& b )
+        {
+            TransformX4 result;
+
+            // Rotation: apply a's rotation then b's, i.e. the quaternion product b.a
+            Vector const rotationW = b.m_rotationW * a.m_rotationW - b.m_rotationX * a.m_rotationX - b.m_rotationY * a.m_rotationY - b.m_rotationZ * a.m_rotationZ;
+            Vector const rotationX = b.m_rotationW * a.m_rotationX + b.m_rotationX * a.m_rotationW + b.m_rotationY * a.m_rotationZ - b.m_rotationZ * a.m_rotationY;
+            Vector const rotationY = b.m_rotationW * a.m_rotationY - b.m_rotationX * a.m_rotationZ + b.m_rotationY * a.m_rotationW + b.m_rotationZ * a.m_rotationX;
+            Vector const rotationZ = b.m_rotationW * a.m_rotationZ + b.m_rotationX * a.m_rotationY - b.m_rotationY * a.m_rotationX + b.m_rotationZ * a.m_rotationW;
+
+            Vector const inverseLength = Vector( _mm_div_ps( Vector::One, _mm_sqrt_ps( rotationX * rotationX + rotationY * rotationY + rotationZ * rotationZ + rotationW * rotationW ) ) );
+            result.m_rotationX = rotationX * inverseLength;
+            result.m_rotationY = rotationY * inverseLength;
+            result.m_rotationZ = rotationZ * inverseLength;
+            result.m_rotationW = rotationW * inverseLength;
+
+            // Translation: rotate the scaled translation of a by b's rotation, i.e. v + 2w(q x v) + 2q x (q x v)
+            Vector const vx = a.m_translationX * b.m_scale;
+            Vector const vy = a.m_translationY * b.m_scale;
+            Vector const vz = a.m_translationZ * b.m_scale;
+
+            Vector const two( 2.0f );
+            Vector const tx = ( b.m_rotationY * vz - b.m_rotationZ * vy ) * two;
+            Vector const ty = ( b.m_rotationZ * vx - b.m_rotationX * vz ) * two;
+            Vector const tz = ( b.m_rotationX * vy - b.m_rotationY * vx ) * two;
+
+            result.m_translationX = vx + b.m_rotationW * tx + ( b.m_rotationY * tz - b.m_rotationZ * ty ) + b.m_translationX;
+            result.m_translationY = vy + b.m_rotationW * ty + ( b.m_rotationZ * tx - b.m_rotationX * tz ) + b.m_translationY;
+            result.m_translationZ = vz + b.m_rotationW * tz + ( b.m_rotationX * ty - b.m_rotationY * tx ) + b.m_translationZ;
+
+            result.m_scale = a.m_scale * b.m_scale;
+            return result;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     Ragdoll::Ragdoll( RagdollDefinition const* pDefinition, StringID const profileID, uint64_t userID )
         : m_pPhysics( Core::GetPxPhysics() )
         , m_pDefinition( pDefinition )
@@ -1181,65 +1298,150 @@ namespace EE::Physics
         EE_ASSERT( pPose->GetSkeleton()->GetResourceID() == m_pDefinition->m_skeleton.GetResourceID() );
         EE_ASSERT( pPose->HasModelSpaceTransforms() );
 
-        // Copy the global bone transforms here
-        //-------------------------------------------------------------------------
-
-        int32_t const numBones = pPose->GetNumBones();
-        m_globalBoneTransforms.resize( numBones );
-        m_globalBoneTransforms = pPose->GetModelSpaceTransforms();
+        int32_t const numBodies = (int32_t) m_links.size();
 
+        // Read back the body transforms
         //-------------------------------------------------------------------------
 
-        bool invalidTransformDetected = false;
+        uint32_t readbackInterval = m_poseReadbackIntervalOverride;
+        if ( readbackInterval == s_automaticPoseReadbackInterval )
+        {
+            readbackInterval = ( m_pWorld != nullptr && m_hasReadBackPose ) ? m_pWorld->GetRagdollPoseReadbackInterval( m_boneWorldTransforms[0].GetTranslation() ) : 1;
+        }
+
+        bool const hasReadbackIntervalChanged = readbackInterval != m_poseReadbackInterval;
+        m_poseReadbackInterval = readbackInterval;
+        m_numFramesSinceReadback++;
 
+        if ( !m_hasReadBackPose || hasReadbackIntervalChanged || m_numFramesSinceReadback >= readbackInterval )
         {
-            ScopedReadLock const sl( this );
-            int32_t const numBodies = (int32_t) m_links.size();
-            for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
+            if ( !ReadBackBoneWorldTransforms() )
             {
-                PxTransform const ragdollBodyTransform = m_links[bodyIdx]->getGlobalPose();
-                if ( !ragdollBodyTransform.isSane() )
-                {
-                    invalidTransformDetected = true;
-                    pPose->ClearModelSpaceTransforms();
-                    break;
-                }
+                pPose->ClearModelSpaceTransforms();
+                return false;
+            }
 
-                // Convert from world space to character space
-                int32_t const boneIdx = m_pDefinition->m_bodyToBoneMap[bodyIdx];
-                Transform const bodyWorldTransform = FromPx( ragdollBodyTransform );
-                Transform const boneWorldTranform = m_pDefinition->m_bodies[bodyIdx].m_inverseOffsetTransform * bodyWorldTransform;
-                m_globalBoneTransforms[boneIdx] = Transform::Delta( worldTransform, boneWorldTranform );
+            // Don't interpolate across readback interval changes
+            if ( !m_hasReadBackPose || hasReadbackIntervalChanged )
+            {
+                m_previousBoneWorldTransforms = m_boneWorldTransforms;
+                m_hasReadBackPose = true;
             }
+
+            m_numFramesSinceReadback = 0;
         }
 
-        if ( invalidTransformDetected )
+        // Interpolate between the last two readbacks when running at a reduced rate
+        TVector<Transform> const* pBoneWorldTransforms = &m_boneWorldTransforms;
+        if ( readbackInterval > 1 )
         {
-            return false;
+            float const percentageThroughInterval = float( m_numFramesSinceReadback ) / readbackInterval;
+            m_interpolatedBoneWorldTransforms.resize( m_boneWorldTransforms.size(), Transform::Identity );
+            for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
+            {
+                m_interpolatedBoneWorldTransforms[bodyIdx] = Transform::Lerp( m_previousBoneWorldTransforms[bodyIdx], m_boneWorldTransforms[bodyIdx], percentageThroughInterval );
+            }
+            pBoneWorldTransforms = &m_interpolatedBoneWorldTransforms;
         }
 
-        // Calculate the local transforms and set back into the pose
+        // Convert from world space to character space
         //-------------------------------------------------------------------------
 
-        for ( int32_t i = 0; i < numBones; i++ )
+        m_boneModelSpaceTransforms.resize( pBoneWorldTransforms->size(), Transform::Identity );
+
+        if ( m_pDefinition->m_canBatchConvertPoses && !worldTransform.HasNegativeScale() )
+        {
+            // Delta( world, bone ) is 'bone * inverse( world )' for non-negative scales
+            TransformX4 inverseWorldTransform;
+            inverseWorldTransform.Splat( worldTransform.GetInverse() );
+
+            int32_t const numPaddedBodies = (int32_t) pBoneWorldTransforms->size();
+            for ( int32_t bodyIdx = 0; bodyIdx < numPaddedBodies; bodyIdx += 4 )
+            {
+                TransformX4 boneWorldTransforms;
+                boneWorldTransforms.Load( &( *pBoneWorldTransforms )[bodyIdx] );
+                Multiply( boneWorldTransforms, inverseWorldTransform ).Store( &m_boneModelSpaceTransforms[bodyIdx] );
+            }
+        }
+        else
         {
-            // Keep original local transforms for non-body bones
-            if ( m_pDefinition->m_boneToBodyMap[i] == InvalidIndex )
+            for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
             {
-                continue;
+                m_boneModelSpaceTransforms[bodyIdx] = Transform::Delta( worldTransform, ( *pBoneWorldTransforms )[bodyIdx] );
             }
+        }
 
-            //-------------------------------------------------------------------------
+        // Calculate the local transforms and set back into the pose
+        //-------------------------------------------------------------------------
+        // Bones without bodies keep their original transforms
 
-            int32_t const parentBoneIdx = m_pDefinition->m_skeleton->GetParentBoneIndex( i );
+        m_globalBoneTransforms = pPose->GetModelSpaceTransforms();
+
+        for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
+        {
+            m_globalBoneTransforms[m_pDefinition->m_bodyToBoneMap[bodyIdx]] = m_boneModelSpaceTransforms[bodyIdx];
+        }
+
+        for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
+        {
+            int32_t const boneIdx = m_pDefinition->m_bodyToBoneMap[bodyIdx];
+            int32_t const parentBoneIdx = m_pDefinition->m_bodyParentBoneMap[bodyIdx];
             if ( parentBoneIdx != InvalidIndex )
             {
-                Transform const boneLocalTransform = Transform::Delta( m_globalBoneTransforms[parentBoneIdx], m_globalBoneTransforms[i] );
-                pPose->SetTransform( i, boneLocalTransform );
+                Transform const boneLocalTransform = Transform::Delta( m_globalBoneTransforms[parentBoneIdx], m_globalBoneTransforms[boneIdx] );
+                pPose->SetTransform( boneIdx, boneLocalTransform );
             }
             else
             {
-                pPose->SetTransform( i, m_globalBoneTransforms[i] );
+                pPose->SetTransform( boneIdx, m_globalBoneTransforms[boneIdx] );
+            }
+        }
+
+        return true;
+    }
+
+    bool Ragdoll::ReadBackBoneWorldTransforms() const
+    {
+        int32_t const numBodies = (int32_t) m_links.size();
+        int32_t const numPaddedBodies = (int32_t) m_pDefinition->m_inverseOffsetTransforms.size();
+        EE_ASSERT( numPaddedBodies >= numBodies && ( numPaddedBodies % 4 ) == 0 );
+
+        m_bodyWorldTransforms.resize( numPaddedBodies, Transform::Identity );
+
+        {
+            ScopedReadLock const sl( this );
+            for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
+            {
+                PxTransform const ragdollBodyTransform = m_links[bodyIdx]->getGlobalPose();
+                if ( !ragdollBodyTransform.isSane() )
+                {
+                    return false;
+                }
+
+                m_bodyWorldTransforms[bodyIdx] = FromPx( ragdollBodyTransform );
+            }
+        }
+
+        // Keep the previous readback for interpolation
+        m_previousBoneWorldTransforms.swap( m_boneWorldTransforms );
+        m_boneWorldTransforms.resize( numPaddedBodies, Transform::Identity );
+
+        // Remove the body offsets
+        if ( m_pDefinition->m_canBatchConvertPoses )
+        {
+            for ( int32_t bodyIdx = 0; bodyIdx < numPaddedBodies; bodyIdx += 4 )
+            {
+                TransformX4 inverseOffsetTransforms, bodyWorldTransforms;
+                inverseOffsetTransforms.Load( &m_pDefinition->m_inverseOffsetTransforms[bodyIdx] );
+                bodyWorldTransforms.Load( &m_bodyWorldTransforms[bodyIdx] );
+                Multiply( inverseOffsetTransforms, bodyWorldTransforms ).Store( &m_boneWorldTransforms[bodyIdx] );
+            }
+        }
+        else
+        {
+            for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
+            {
+                m_boneWorldTransforms[bodyIdx] = m_pDefinition->m_inverseOffsetTransforms[bodyIdx] * m_bodyWorldTransforms[bodyIdx];
             }
         }
 
@@ -1307,6 +1509,8 @@ namespace EE::Physics
 
     void Ragdoll::ResetState()
     {
+        m_hasReadBackPose = false;
+
         ScopedWriteLock const sl( this );
         int32_t const numBodies = (int32_t) m_links.size();
         for ( int32_t i = 0; i < numBodies; i++ )
@@ -30,6 +30,8 @@ namespace EE::Animation
 
 namespace EE::Physics
 {
+    class PhysicsWorld;
+
     //-------------------------------------------------------------------------
     // Ragdoll Settings
     //-------------------------------------------------------------------------
@@ -260,6 +262,9 @@ namespace EE::Physics
         // Runtime Data
         TVector<int32_t>                                        m_boneToBodyMap;
         TVector<int32_t>                                        m_bodyToBoneMap;
+        TVector<int32_t>                                        m_bodyParentBoneMap;            // The parent bone of each body's bone
+        TVector<Transform>                                      m_inverseOffsetTransforms;      // Contiguous copy of the body inverse offsets, padded to a multiple of 4 for the batched pose conversions
+        bool                                                    m_canBatchConvertPoses = true;  // The batched pose conversions don't support negatively scaled offsets
     };
 
     //-------------------------------------------------------------------------
@@ -274,6 +279,9 @@ namespace EE::Physics
     {
         friend class PhysicsWorld;
 
+        // Use the physics world's distance based readback interval
+        constexpr static uint32_t const s_automaticPoseReadbackInterval = 0;
+
         class [[nodiscard]] ScopedWriteLock
         {
         public:
@@ -409,6 +417,16 @@ namespace EE::Physics
         bool GetPose( Transform const& worldTransform, Animation::Pose* pPose ) const;
         void GetRagdollPose( RagdollPose& pose ) const;
 
+        // Pose Readback Rate
+        //-------------------------------------------------------------------------
+        // The body transforms can be read back at a reduced rate (i.e. every N GetPose calls) for distant ragdolls
+        // When reduced, the returned pose is interpolated between the last two readbacks which adds one interval of latency
+        // By default the physics world selects the interval based on the distance to the viewer
+
+        inline uint32_t GetPoseReadbackInterval() const { return m_poseReadbackInterval; }
+        inline void SetPoseReadbackIntervalOverride( uint32_t interval ) { m_poseReadbackIntervalOverride = interval; }
+        inline void ClearPoseReadbackIntervalOverride() { m_poseReadbackIntervalOverride = s_automaticPoseReadbackInterval; }
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -432,6 +450,9 @@ namespace EE::Physics
         void LockReadScene() const;
         void UnlockReadScene() const;
 
+        // Read the body transforms from the articulation and calculate the new bone world transforms, returns false if any body transform was invalid
+        bool ReadBackBoneWorldTransforms() const;
+
     private:
 
         physx::PxPhysics*                                       m_pPhysics = nullptr;
@@ -445,6 +466,18 @@ namespace EE::Physics
         bool                                                    m_gravityEnabled = true;
         mutable TVector<Transform>                              m_globalBoneTransforms;
 
+        // Pose readback
+        PhysicsWorld const*                                     m_pWorld = nullptr;
+        mutable TVector<Transform>                              m_bodyWorldTransforms;          // Padded to a multiple of 4
+        mutable TVector<Transform>                              m_boneWorldTransforms;          // Per body, from the latest readback
+        mutable TVector<Transform>                              m_previousBoneWorldTransforms;  // Per body, from the readback before that
+        mutable TVector<Transform>                              m_interpolatedBoneWorldTransforms;
+        mutable TVector<Transform>                              m_boneModelSpaceTransforms;     // Per body
+        uint32_t                                                m_poseReadbackIntervalOverride = s_automaticPoseReadbackInterval;
+        mutable uint32_t                                        m_poseReadbackInterval = 1;
+        mutable uint32_t                                        m_numFramesSinceReadback = 0;
+        mutable bool                                            m_hasReadBackPose = false;
+
         #if EE_DEVELOPMENT_TOOLS
         TInlineString<100>                                      m_ragdollName;
         #endif
@@ -2,6 +2,7 @@
 #include "Physics.h"
 #include "PhysicsQuery.h"
 #include "PhysicsRagdoll.h"
+#include "PhysicsQueryBatch.h"
 #include "Components/Component_PhysicsShape.h"
 #include "Components/Component_PhysicsSphere.h"
 #include "Components/Component_PhysicsBox.h"
@@ -9,6 +10,7 @@
 #include "Components/Component_PhysicsCollisionMesh.h"
 #include "Components/Component_PhysicsCharacter.h"
 #include "Engine/Entity/EntityLog.h"
+#include "Base/Threading/TaskSystem.h"
 #include "Base/Profiling.h"
 #include "EASTL/sort.h"
 
@@ -548,6 +550,159 @@ namespace EE::Physics
         return OverlapInternal( boxGeo, Transform( orientation, position ), rules, outResults );
     }
 
+    //-------------------------------------------------------------------------
+    // Batched Queries
+    //-------------------------------------------------------------------------
+
+    void PhysicsWorld::ExecuteQueryBatch( QueryBatch& batch, TaskSystem* pTaskSystem )
+    {
+        EE_PROFILE_FUNCTION_PHYSICS();
+        EE_ASSERT( !batch.m_wasExecuted );
+
+        uint32_t const numQueries = (uint32_t) batch.m_requests.size();
+        if ( numQueries == 0 )
+        {
+            batch.m_wasExecuted = true;
+            return;
+        }
+
+        // Group the queries by type so that consecutive queries in a range run the same code path
+        //-------------------------------------------------------------------------
+
+        int32_t typeOffsets[(int32_t) QueryBatch::QueryType::NumTypes + 1] = { 0 };
+        for ( auto const& request : batch.m_requests )
+        {
+            typeOffsets[(int32_t) request.m_type + 1]++;
+        }
+
+        for ( int32_t i = 1; i <= (int32_t) QueryBatch::QueryType::NumTypes; i++ )
+        {
+            typeOffsets[i] += typeOffsets[i - 1];
+        }
+
+        batch.m_executionOrder.resize( numQueries );
+        for ( int32_t i = 0; i < (int32_t) numQueries; i++ )
+        {
+            batch.m_executionOrder[typeOffsets[(int32_t) batch.m_requests[i].m_type]++] = i;
+        }
+
+        // Execute queries
+        //-------------------------------------------------------------------------
+
+        static constexpr uint32_t const s_minQueriesPerTask = 16;
+
+        if ( pTaskSystem == nullptr || numQueries <= s_minQueriesPerTask )
+        {
+            ExecuteQueryBatchRange( batch, 0, numQueries );
+        }
+        else
+        {
+            struct QueryBatchTask : public ITaskSet
+            {
+                QueryBatchTask( PhysicsWorld* pWorld, QueryBatch& batch, uint32_t numQueries )
+                    : ITaskSet( numQueries, s_minQueriesPerTask )
+                    , m_pWorld( pWorld )
+                    , m_batch( batch )
+                {}
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    m_pWorld->ExecuteQueryBatchRange( m_batch, range.start, range.end );
+                }
+
+            private:
+
+                PhysicsWorld*   m_pWorld = nullptr;
+                QueryBatch&     m_batch;
+            };
+
+            QueryBatchTask task( this, batch, numQueries );
+            pTaskSystem->ScheduleTask( &task );
+            pTaskSystem->WaitForTask( &task );
+        }
+
+        batch.m_wasExecuted = true;
+    }
+
+    void PhysicsWorld::ExecuteQueryBatchRange( QueryBatch& batch, uint32_t startIdx, uint32_t endIdx )
+    {
+        EE_PROFILE_SCOPE_PHYSICS( "Execute Query Batch Range" );
+
+        AcquireReadLock();
+
+        for ( uint32_t i = startIdx; i < endIdx; i++ )
+        {
+            auto& request = batch.m_requests[batch.m_executionOrder[i]];
+            QueryRules const& rules = batch.m_rules[request.m_rulesIdx];
+            Vector const& params = request.m_shapeParameters;
+            Quaternion const orientation = request.m_transform.GetRotation();
+            Vector const position = request.m_transform.GetTranslation();
+
+            switch ( request.m_type )
+            {
+                case QueryBatch::QueryType::RayCast:
+                {
+                    request.m_result = RayCastInternal( position, request.m_direction, request.m_distance, rules, batch.m_rayCastResults[request.m_resultIdx] );
+                }
+                break;
+
+                case QueryBatch::QueryType::SphereSweep:
+                {
+                    request.m_result = SphereSweepInternal( params.GetX(), position, request.m_direction, request.m_distance, rules, batch.m_sweepResults[request.m_resultIdx] );
+                }
+                break;
+
+                case QueryBatch::QueryType::CapsuleSweep:
+                {
+                    request.m_result = CapsuleSweepInternal( params.GetX(), params.GetY(), orientation, position, request.m_direction, request.m_distance, rules, batch.m_sweepResults[request.m_resultIdx] );
+                }
+                break;
+
+                case QueryBatch::QueryType::CylinderSweep:
+                {
+                    request.m_result = CylinderSweepInternal( params.GetX(), params.GetY(), orientation, position, request.m_direction, request.m_distance, rules, batch.m_sweepResults[request.m_resultIdx] );
+                }
+                break;
+
+                case QueryBatch::QueryType::BoxSweep:
+                {
+                    request.m_result = BoxSweepInternal( params, orientation, position, request.m_direction, request.m_distance, rules, batch.m_sweepResults[request.m_resultIdx] );
+                }
+                break;
+
+                case QueryBatch::QueryType::SphereOverlap:
+                {
+                    request.m_result = SphereOverlap( params.GetX(), position, rules, batch.m_overlapResults[request.m_resultIdx] );
+                }
+                break;
+
+                case QueryBatch::QueryType::CapsuleOverlap:
+                {
+                    request.m_result = CapsuleOverlap( params.GetX(), params.GetY(), orientation, position, rules, batch.m_overlapResults[request.m_resultIdx] );
+                }
+                break;
+
+                case QueryBatch::QueryType::CylinderOverlap:
+                {
+                    request.m_result = CylinderOverlap( params.GetX(), params.GetY(), orientation, position, rules, batch.m_overlapResults[request.m_resultIdx] );
+                }
+                break;
+
+                case QueryBatch::QueryType::BoxOverlap:
+                {
+                    request.m_result = BoxOverlap( params, orientation, position, rules, batch.m_overlapResults[request.m_resultIdx] );
+                }
+                break;
+
+                default:
+                EE_UNREACHABLE_CODE();
+                break;
+            }
+        }
+
+        ReleaseReadLock();
+    }
+
     //-------------------------------------------------------------------------
     // Actors and Shapes
     //-------------------------------------------------------------------------
@@ -827,10 +982,61 @@ namespace EE::Physics
         #endif
     }
 
+    int32_t PhysicsWorld::MoveCharacters( TVector<CharacterComponent*> const& characters, Seconds deltaTime )
+    {
+        EE_PROFILE_FUNCTION_PHYSICS();
+
+        // Apply gravity and record the move start states, this doesnt need the scene lock
+        //-------------------------------------------------------------------------
+
+        bool hasControllerMoves = false;
+        for ( CharacterComponent* pCharacter : characters )
+        {
+            EE_ASSERT( pCharacter->IsControllerCreated() && pCharacter->HasPendingMove() );
+            pCharacter->m_requiresControllerMove = pCharacter->BeginMove( pCharacter->m_pendingDeltaTime, pCharacter->m_pendingDeltaRotation, pCharacter->m_pendingDeltaTranslation );
+            pCharacter->m_hasPendingMove = false;
+            hasControllerMoves |= pCharacter->m_requiresControllerMove;
+        }
+
+        // Move all the controllers
+        //-------------------------------------------------------------------------
+
+        if ( hasControllerMoves )
+        {
+            EE_PROFILE_SCOPE_PHYSICS( "Move Controllers" );
+
+            AcquireWriteLock();
+
+            // Precompute the overlaps between characters once for the whole batch rather than letting each move discover them
+            m_pControllerManager->computeInteractions( deltaTime );
+
+            for ( CharacterComponent* pCharacter : characters )
+            {
+                if ( pCharacter->m_requiresControllerMove )
+                {
+                    pCharacter->ExecuteMove();
+                }
+            }
+
+            ReleaseWriteLock();
+        }
+
+        // Transfer the results back to the components
+        //-------------------------------------------------------------------------
+
+        for ( CharacterComponent* pCharacter : characters )
+        {
+            pCharacter->CompleteMove();
+        }
+
+        return (int32_t) characters.size();
+    }
+
     Ragdoll* PhysicsWorld::CreateRagdoll( RagdollDefinition const* pDefinition, StringID const& profileID, uint64_t userID )
     {
         EE_ASSERT( m_pScene != nullptr && pDefinition != nullptr );
         auto pRagdoll = EE::New<Ragdoll>( pDefinition, profileID, userID );
+        pRagdoll->m_pWorld = this;
         pRagdoll->AddToScene( m_pScene );
         return pRagdoll;
     }
@@ -842,6 +1048,27 @@ namespace EE::Physics
         EE::Delete( pRagdoll );
     }
 
+    uint32_t PhysicsWorld::GetRagdollPoseReadbackInterval( Vector const& ragdollPosition ) const
+    {
+        if ( !m_hasRagdollViewer )
+        {
+            return 1;
+        }
+
+        float const distanceSq = ragdollPosition.GetDistanceSquared3( m_ragdollViewerPosition );
+        if ( distanceSq > Math::Sqr( s_ragdollMinimalReadbackDistance ) )
+        {
+            return s_ragdollMinimalReadbackInterval;
+        }
+
+        if ( distanceSq > Math::Sqr( s_ragdollReducedReadbackDistance ) )
+        {
+            return s_ragdollReducedReadbackInterval;
+        }
+
+        return 1;
+    }
+
     //------------------------------------------------------------------------- 
     // Debug
     //-------------------------------------------------------------------------
@@ -7,7 +7,7 @@
 
 //-------------------------------------------------------------------------
 
-namespace EE { struct AABB; }
+namespace EE { struct AABB; class TaskSystem; }
 
 namespace physx 
 {
@@ -29,6 +29,7 @@ namespace EE::Physics
     class MaterialRegistry;
     class Ragdoll;
     struct RagdollDefinition;
+    class QueryBatch;
 
     //-------------------------------------------------------------------------
 
@@ -41,6 +42,12 @@ namespace EE::Physics
         // The distance that the shape is pushed away from a detected collision after a sweep - currently set to 5mm as that is a relatively standard value
         static constexpr float const s_sweepSeperationDistance = 0.005f;
 
+        // Ragdolls further than these distances from the viewer read back their poses at a reduced rate
+        static constexpr float const s_ragdollReducedReadbackDistance = 20.0f;
+        static constexpr float const s_ragdollMinimalReadbackDistance = 50.0f;
+        static constexpr uint32_t const s_ragdollReducedReadbackInterval = 2;
+        static constexpr uint32_t const s_ragdollMinimalReadbackInterval = 4;
+
     public:
 
         PhysicsWorld( MaterialRegistry const* pRegistry, bool isGameWorld );
@@ -60,6 +67,13 @@ namespace EE::Physics
         Ragdoll* CreateRagdoll( RagdollDefinition const* pDefinition, StringID const& profileID, uint64_t userID );
         void DestroyRagdoll( Ragdoll*& pRagdoll );
 
+        // Set the position used to select the ragdoll pose readback rates, this must not be changed during the post-physics entity updates
+        inline void SetRagdollViewerPosition( Vector const& position ) { m_ragdollViewerPosition = position; m_hasRagdollViewer = true; }
+        inline void ClearRagdollViewerPosition() { m_hasRagdollViewer = false; }
+
+        // Get the pose readback interval (in frames) for a ragdoll at the specified position
+        uint32_t GetRagdollPoseReadbackInterval( Vector const& ragdollPosition ) const;
+
         // Queries
         //-------------------------------------------------------------------------
 
@@ -194,6 +208,10 @@ namespace EE::Physics
             return BoxOverlap( halfExtents, shapeTransform.GetRotation(), shapeTransform.GetTranslation(), rules, outResults );
         }
 
+        // Execute all the queries in the batch - if a task system is supplied, the queries will be spread across the workers
+        // Each worker range only acquires the read lock once so callers must not hold a write lock when executing a batch
+        void ExecuteQueryBatch( QueryBatch& batch, TaskSystem* pTaskSystem = nullptr );
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -232,6 +250,7 @@ namespace EE::Physics
         bool BoxSweepInternal( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults );
         bool SweepInternal( physx::PxGeometry const& geo, Transform const& startTransform, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults );
         bool OverlapInternal( physx::PxGeometry const& geo, Transform const& transform, QueryRules const& rules, OverlapResults& outResults );
+        void ExecuteQueryBatchRange( QueryBatch& batch, uint32_t startIdx, uint32_t endIdx );
 
         // Actors and Shapes
         //-------------------------------------------------------------------------
@@ -242,6 +261,11 @@ namespace EE::Physics
         bool CreateCharacterController( CharacterComponent* pComponent ) const;
         void DestroyCharacterController( CharacterComponent* pComponent ) const;
 
+        // Resolve the requested moves for the supplied characters, all controller moves are performed under a single write lock
+        // Characters are moved in the order supplied, each move sees the results of the moves before it
+        // Returns the number of characters that were moved
+        int32_t MoveCharacters( TVector<CharacterComponent*> const& characters, Seconds deltaTime );
+
     private:
 
         MaterialRegistry const*                                 m_pMaterialRegistry = nullptr;
@@ -249,6 +273,9 @@ namespace EE::Physics
         physx::PxControllerManager*                             m_pControllerManager = nullptr;
         bool                                                    m_isGameWorld = false;
 
+        Vector                                                  m_ragdollViewerPosition = Vector::Zero;
+        bool                                                    m_hasRagdollViewer = false;
+
         #if EE_DEVELOPMENT_TOOLS
         uint32_t                                                m_sceneDebugFlags = 0;
         float                                                   m_debugDrawDistance = 10.0f;
@@ -7,16 +7,45 @@
 #include "Engine/Physics/Components/Component_PhysicsSphere.h"
 #include "Engine/Physics/Components/Component_PhysicsBox.h"
 #include "Engine/Physics/Components/Component_PhysicsTest.h"
+#include "Engine/Player/Systems/WorldSystem_PlayerManager.h"
+#include "Engine/Camera/Components/Component_Camera.h"
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Engine/Entity/EntityWorld.h"
+#include "Engine/Entity/EntityMap.h"
 #include "Engine/Entity/EntityLog.h"
 #include "Base/Profiling.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Memory/MemoryTags.h"
+#include "Base/Time/Timers.h"
+#include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Physics
 {
+    bool PhysicsWorldSystem::CharacterSortKey::operator<( CharacterSortKey const& rhs ) const
+    {
+        if ( m_mapPathID != rhs.m_mapPathID )
+        {
+            return m_mapPathID < rhs.m_mapPathID;
+        }
+
+        if ( m_entityName != rhs.m_entityName )
+        {
+            return m_entityName.ToUint() < rhs.m_entityName.ToUint();
+        }
+
+        if ( m_componentName != rhs.m_componentName )
+        {
+            return m_componentName.ToUint() < rhs.m_componentName.ToUint();
+        }
+
+        return m_mapSpawnIdx < rhs.m_mapSpawnIdx;
+    }
+
+    //-------------------------------------------------------------------------
+
     void PhysicsWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
     {
         auto OnRebuild = [this] ( PhysicsShapeComponent* pShapeComponent )
@@ -31,14 +60,21 @@ namespace EE::Physics
 
         m_pWorld = EE::New<PhysicsWorld>( systemRegistry.GetSystem<MaterialRegistry>(), IsInAGameWorld() );
         EE_ASSERT( m_pWorld != nullptr );
+
+        m_deferredQueries.Initialize( systemRegistry.GetSystem<TaskSystem>() );
     }
 
     void PhysicsWorldSystem::ShutdownSystem()
     {
+        m_deferredQueries.Shutdown();
         EE::Delete( m_pWorld );
 
         PhysicsShapeComponent::OnRebuildBodyRequested().Unbind( m_actorRebuildBindingID );
 
+        #if EE_DEVELOPMENT_TOOLS
+        m_stressTestCharacters.clear();
+        #endif
+
         EE_ASSERT( m_actorRebuildRequests.empty() );
         EE_ASSERT( m_physicsShapeComponents.empty() );
         EE_ASSERT( m_dynamicShapeComponents.empty() );
@@ -70,6 +106,26 @@ namespace EE::Physics
         if ( auto pCharacterComponent = TryCast<CharacterComponent>( pComponent ) )
         {
             m_characterComponents.Add( pCharacterComponent );
+
+            CharacterSortKey sortKey;
+            EntityModel::EntityMap const* pMap = GetEntityWorld()->GetMapForEntity( pEntity );
+            sortKey.m_mapPathID = pMap->IsTransientMap() ? 0 : pMap->GetMapResourceID().GetPathID();
+            sortKey.m_entityName = pEntity->GetNameID();
+            sortKey.m_componentName = pCharacterComponent->GetNameID();
+            sortKey.m_mapSpawnIdx = pEntity->GetMapSpawnIndex();
+            m_characterSortKeys.insert( { pCharacterComponent->GetID(), sortKey } );
+
+            #if EE_DEVELOPMENT_TOOLS
+            for ( StressTestCharacter& stressTestCharacter : m_stressTestCharacters )
+            {
+                if ( stressTestCharacter.m_entityID == pEntity->GetID() )
+                {
+                    stressTestCharacter.m_pCharacter = pCharacterComponent;
+                    break;
+                }
+            }
+            #endif
+
             if ( !m_pWorld->CreateCharacterController( pCharacterComponent ) )
             {
                 EE_LOG_ENTITY_ERROR( pCharacterComponent, "Physics", "Failed to create physics actor/shape for character %s (%u)!", pCharacterComponent->GetNameID().c_str(), pCharacterComponent->GetID() );
@@ -120,6 +176,18 @@ namespace EE::Physics
         {
             m_pWorld->DestroyCharacterController( pCharacterComponent );
             m_characterComponents.Remove( pComponent->GetID() );
+            m_characterSortKeys.erase( pComponent->GetID() );
+
+            #if EE_DEVELOPMENT_TOOLS
+            for ( StressTestCharacter& stressTestCharacter : m_stressTestCharacters )
+            {
+                if ( stressTestCharacter.m_pCharacter == pCharacterComponent )
+                {
+                    stressTestCharacter.m_pCharacter = nullptr;
+                    break;
+                }
+            }
+            #endif
         }
 
         //-------------------------------------------------------------------------
@@ -179,10 +247,121 @@ namespace EE::Physics
         m_actorRebuildRequests.clear();
     }
 
+    void PhysicsWorldSystem::MoveCharacters( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_PHYSICS( "Character Moves" );
+
+        m_movingCharacters.clear();
+        for ( CharacterComponent* pCharacterComponent : m_characterComponents )
+        {
+            if ( pCharacterComponent->HasPendingMove() )
+            {
+                m_movingCharacters.emplace_back( pCharacterComponent );
+            }
+        }
+
+        if ( m_isDeterministicCharacterMovementEnabled )
+        {
+            auto SortPredicate = [this] ( CharacterComponent const* pA, CharacterComponent const* pB )
+            {
+                CharacterSortKey const& keyA = m_characterSortKeys.at( pA->GetID() );
+                CharacterSortKey const& keyB = m_characterSortKeys.at( pB->GetID() );
+                if ( keyA < keyB )
+                {
+                    return true;
+                }
+
+                if ( keyB < keyA )
+                {
+                    return false;
+                }
+
+                // Identical keys are only possible for entities in different transient maps
+                return pA->GetID().m_value < pB->GetID().m_value;
+            };
+
+            eastl::sort( m_movingCharacters.begin(), m_movingCharacters.end(), SortPredicate );
+        }
+
+        ScopedTimer<PlatformClock> timer( m_lastCharacterMoveTime );
+        m_numMovedCharacters = m_movingCharacters.empty() ? 0 : m_pWorld->MoveCharacters( m_movingCharacters, ctx.GetDeltaTime() );
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void PhysicsWorldSystem::SpawnStressTestCharacters( EntityWorldUpdateContext const& ctx )
+    {
+        for ( PhysicsTestComponent* pTestComponent : m_testComponents )
+        {
+            if ( pTestComponent->m_hasSpawnedStressTestCharacters || pTestComponent->m_numStressTestCharacters <= 0 )
+            {
+                continue;
+            }
+
+            pTestComponent->m_hasSpawnedStressTestCharacters = true;
+
+            // Spawn the characters in a square grid centered on the test component, each one walks along its own circle
+            // The circles overlap the neighboring characters so the moves constantly have to resolve character vs character collisions
+            int32_t const numCharacters = pTestComponent->m_numStressTestCharacters;
+            int32_t const gridSize = Math::CeilingToInt( Math::Sqrt( (float) numCharacters ) );
+            float const spacing = Math::Max( pTestComponent->m_stressTestSpacing, 0.1f );
+            float const moveRadius = Math::Max( pTestComponent->m_stressTestMoveRadius, 0.1f );
+            Transform const& testTransform = pTestComponent->GetWorldTransform();
+            Vector const gridOrigin = testTransform.GetTranslation() - Vector( spacing * ( gridSize - 1 ) * 0.5f, spacing * ( gridSize - 1 ) * 0.5f, 0.0f );
+
+            TVector<Entity*> createdEntities;
+            createdEntities.reserve( numCharacters );
+            m_stressTestCharacters.reserve( m_stressTestCharacters.size() + numCharacters );
+
+            for ( int32_t i = 0; i < numCharacters; i++ )
+            {
+                auto pCharacter = EE::New<CharacterComponent>( StringID( "Character" ) );
+
+                // The test component marks the floor position of the grid
+                int32_t const x = i % gridSize;
+                int32_t const y = i / gridSize;
+                Vector const characterPosition = gridOrigin + Vector( spacing * x, spacing * y, pCharacter->GetCharacterHeight() * 0.5f );
+                pCharacter->TeleportCharacter( Transform( testTransform.GetRotation(), characterPosition ) );
+
+                auto pEntity = EE::New<Entity>( StringID( "Stress Test Character" ) );
+                pEntity->AddComponent( pCharacter );
+                createdEntities.emplace_back( pEntity );
+
+                StressTestCharacter& stressTestCharacter = m_stressTestCharacters.emplace_back();
+                stressTestCharacter.m_entityID = pEntity->GetID();
+                stressTestCharacter.m_moveSpeed = pTestComponent->m_stressTestMoveSpeed;
+                stressTestCharacter.m_angularSpeed = pTestComponent->m_stressTestMoveSpeed / moveRadius;
+                stressTestCharacter.m_angle = Radians( Math::TwoPi * float( i ) / numCharacters );
+            }
+
+            ctx.GetPersistentMap()->AddEntities( createdEntities );
+        }
+    }
+
+    void PhysicsWorldSystem::RequestStressTestCharacterMoves( EntityWorldUpdateContext const& ctx )
+    {
+        Seconds const deltaTime = ctx.GetDeltaTime();
+        for ( StressTestCharacter& stressTestCharacter : m_stressTestCharacters )
+        {
+            if ( stressTestCharacter.m_pCharacter == nullptr || !stressTestCharacter.m_pCharacter->IsControllerCreated() )
+            {
+                continue;
+            }
+
+            // Walk along the tangent of the character's circle
+            stressTestCharacter.m_angle += stressTestCharacter.m_angularSpeed * deltaTime.ToFloat();
+            stressTestCharacter.m_angle.Clamp360();
+            float const angle = stressTestCharacter.m_angle.ToFloat();
+            Vector const direction( -Math::Sin( angle ), Math::Cos( angle ), 0.0f );
+            stressTestCharacter.m_pCharacter->RequestMove( deltaTime, Quaternion::Identity, direction * ( stressTestCharacter.m_moveSpeed * deltaTime.ToFloat() ) );
+        }
+    }
+    #endif
+
     //-------------------------------------------------------------------------
 
     void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( Physics );
         // HACK HACK
         #if EE_DEVELOPMENT_TOOLS
         m_pWorld->AcquireReadLock();
@@ -281,8 +460,26 @@ namespace EE::Physics
 
         if ( ctx.GetUpdateStage() == UpdateStage::Physics )
         {
+            #if EE_DEVELOPMENT_TOOLS
+            if ( IsInAGameWorld() )
+            {
+                SpawnStressTestCharacters( ctx );
+            }
+            #endif
+
             ProcessActorRebuildRequests( ctx );
             PhysicsUpdate( ctx );
+
+            // Ragdolls read back their poses during the post-physics entity updates, at a rate based on the distance to the player camera
+            auto pPlayerManager = ctx.GetWorldSystem<PlayerManager>();
+            if ( pPlayerManager->HasPlayer() )
+            {
+                m_pWorld->SetRagdollViewerPosition( pPlayerManager->GetPlayerCamera()->GetPosition() );
+            }
+            else
+            {
+                m_pWorld->ClearRagdollViewerPosition();
+            }
         }
         else if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics )
         {
@@ -298,6 +495,14 @@ namespace EE::Physics
     {
         EE_PROFILE_FUNCTION_PHYSICS();
 
+        #if EE_DEVELOPMENT_TOOLS
+        RequestStressTestCharacterMoves( ctx );
+        #endif
+
+        // All pre-physics updates are complete so resolve the requested character moves and then execute any deferred queries against the pre-simulation scene
+        MoveCharacters( ctx );
+        m_deferredQueries.Flush( m_pWorld );
+
         m_pWorld->Simulate( ctx.GetDeltaTime() );
     }
 
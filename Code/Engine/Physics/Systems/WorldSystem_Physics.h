@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Physics/PhysicsDeferredQueries.h"
 #include "Engine/UpdateContext.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Systems.h"
@@ -39,6 +40,29 @@ namespace EE::Physics
             TVector<PhysicsShapeComponent*>                     m_components;
         };
 
+        // A key for ordering character moves that doesn't depend on runtime generated IDs or on the component registration order
+        struct CharacterSortKey
+        {
+            bool operator<( CharacterSortKey const& rhs ) const;
+
+            uint32_t                                            m_mapPathID = 0;        // Zero for transient maps
+            StringID                                            m_entityName;
+            StringID                                            m_componentName;
+            uint32_t                                            m_mapSpawnIdx = 0;      // Disambiguates entities that share a name (e.g. spawned AI)
+        };
+
+        #if EE_DEVELOPMENT_TOOLS
+        // A character spawned by a physics test component to stress the batched character moves
+        struct StressTestCharacter
+        {
+            EntityID                                            m_entityID;
+            CharacterComponent*                                 m_pCharacter = nullptr;     // Only set while the character is registered
+            float                                               m_angularSpeed = 0.0f;
+            Radians                                             m_angle = 0.0f;
+            float                                               m_moveSpeed = 0.0f;
+        };
+        #endif
+
     public:
 
         EE_ENTITY_WORLD_SYSTEM( PhysicsWorldSystem, RequiresUpdate( UpdateStage::Physics ), RequiresUpdate( UpdateStage::PostPhysics ), RequiresUpdate( UpdateStage::Paused ) );
@@ -50,6 +74,28 @@ namespace EE::Physics
         PhysicsWorld const* GetWorld() const { return m_pWorld; }
         PhysicsWorld* GetWorld() { return m_pWorld; }
 
+        // Lock-free query submission for entity updates, see 'DeferredQueries' for the ordering rules
+        DeferredQueries& GetDeferredQueries() { return m_deferredQueries; }
+        DeferredQueries const& GetDeferredQueries() const { return m_deferredQueries; }
+
+        // Character moves requested during entity updates are resolved together right before the simulation step
+        // In deterministic mode the moves are resolved in an order based on the owning map's path, the entity and component names and
+        // finally the order in which the entity was added to its map, so the results do not depend on the component registration order.
+        // Only characters in different transient maps with identical names and spawn indices fall back to the component creation order.
+        inline bool IsDeterministicCharacterMovementEnabled() const { return m_isDeterministicCharacterMovementEnabled; }
+        inline void SetDeterministicCharacterMovementEnabled( bool isEnabled ) { m_isDeterministicCharacterMovementEnabled = isEnabled; }
+
+        // The number of requested character moves resolved in the last update
+        inline int32_t GetNumMovedCharacters() const { return m_numMovedCharacters; }
+
+        // How long it took to resolve the requested character moves in the last update
+        inline Milliseconds GetLastCharacterMoveTime() const { return m_lastCharacterMoveTime; }
+
+        #if EE_DEVELOPMENT_TOOLS
+        // The number of characters spawned and moved by physics test components
+        inline int32_t GetNumStressTestCharacters() const { return (int32_t) m_stressTestCharacters.size(); }
+        #endif
+
     private:
 
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override;
@@ -62,6 +108,12 @@ namespace EE::Physics
         void UnregisterDynamicComponent( PhysicsShapeComponent* pComponent );
 
         void ProcessActorRebuildRequests( EntityWorldUpdateContext const& ctx );
+        void MoveCharacters( EntityWorldUpdateContext const& ctx );
+
+        #if EE_DEVELOPMENT_TOOLS
+        void SpawnStressTestCharacters( EntityWorldUpdateContext const& ctx );
+        void RequestStressTestCharacterMoves( EntityWorldUpdateContext const& ctx );
+        #endif
 
         void PhysicsUpdate( EntityWorldUpdateContext const& ctx );
         void PostPhysicsUpdate( EntityWorldUpdateContext const& ctx );
@@ -69,8 +121,14 @@ namespace EE::Physics
     private:
 
         PhysicsWorld*                                           m_pWorld = nullptr;
+        DeferredQueries                                         m_deferredQueries;
 
         TIDVector<ComponentID, CharacterComponent*>             m_characterComponents;
+        THashMap<ComponentID, CharacterSortKey>                 m_characterSortKeys;
+        TVector<CharacterComponent*>                            m_movingCharacters;
+        int32_t                                                 m_numMovedCharacters = 0;
+        Milliseconds                                            m_lastCharacterMoveTime = 0.0f;
+        bool                                                    m_isDeterministicCharacterMovementEnabled = false;
         TIDVector<ComponentID, PhysicsShapeComponent*>          m_physicsShapeComponents;
         TIDVector<ComponentID, PhysicsShapeComponent*>          m_dynamicShapeComponents; // TODO: profile and see if we need to use a dynamic pool
 
@@ -79,5 +137,9 @@ namespace EE::Physics
         TVector<PhysicsShapeComponent*>                         m_actorRebuildRequests;
 
         TVector<PhysicsTestComponent*>                          m_testComponents;
+
+        #if EE_DEVELOPMENT_TOOLS
+        TVector<StressTestCharacter>                            m_stressTestCharacters;
+        #endif
     };
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "Engine/Player/Components/Component_Player.h"
 #include "Engine/Input/GameInput.h"
 #include "Engine/Camera/Components/Component_Camera.h"
+#include "Engine/Volumes/Systems/WorldSystem_Volumes.h"
+#include "Engine/Entity/EntityWorld.h"
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityMap.h"
@@ -40,6 +42,13 @@ namespace EE
                 m_player.m_pPlayerComponent = pPlayerComponent;
                 m_registeredPlayerStateChanged = true;
 
+                // Track the player so that gameplay can react to it entering/exiting volumes
+                if ( pEntity->IsSpatialEntity() )
+                {
+                    GetEntityWorld()->GetWorldSystem<VolumeWorldSystem>()->RegisterTrackedEntity( pEntity );
+                    m_player.m_isTrackedByVolumes = true;
+                }
+
                 // Try to find the camera for this player
                 for ( auto pCamera : m_cameras )
                 {
@@ -76,6 +85,13 @@ namespace EE
             if ( m_player.m_entityID == pEntity->GetID() )
             {
                 EE_ASSERT( m_player.m_pPlayerComponent == pPlayerComponent );
+
+                if ( m_player.m_isTrackedByVolumes )
+                {
+                    GetEntityWorld()->GetWorldSystem<VolumeWorldSystem>()->UnregisterTrackedEntity( pEntity );
+                    m_player.m_isTrackedByVolumes = false;
+                }
+
                 m_player.m_entityID.Clear();
                 m_player.m_pPlayerComponent = nullptr;
                 m_player.m_pCameraComponent = nullptr;
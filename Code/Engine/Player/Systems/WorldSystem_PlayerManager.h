@@ -30,6 +30,7 @@ namespace EE
             EntityID                                m_entityID;
             Player::PlayerComponent*                m_pPlayerComponent = nullptr;
             CameraComponent*                        m_pCameraComponent = nullptr;
+            bool                                    m_isTrackedByVolumes = false;
         };
 
     public:
@@ -1,6 +1,7 @@
 #include "Component_SkeletalMesh.h"
 #include "Engine/Animation/AnimationPose.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Math/BatchMath.h"
 #include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
@@ -182,11 +183,7 @@ namespace EE::Render
         EE_ASSERT( m_skinningTransforms.size() == numBones );
 
         auto const& inverseBindPose = m_mesh->GetInverseBindPose();
-        for ( auto i = 0; i < numBones; i++ )
-        {
-            Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
-            m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
-        }
+        BatchMath::MultiplyToMatrices( inverseBindPose.data(), m_boneTransforms.data(), m_skinningTransforms.data(), (int32_t) numBones );
     }
 
     void SkeletalMeshComponent::GenerateAnimationBoneMap()
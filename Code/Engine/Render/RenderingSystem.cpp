@@ -8,6 +8,7 @@
 #include "Base/Render/RenderDevice.h"
 #include "Base/Profiling.h"
 #include "Base/Math/ViewVolume.h"
+#include "Base/Memory/MemoryTags.h"
 #include <eastl/sort.h>
 
 //-------------------------------------------------------------------------
@@ -226,6 +227,7 @@ namespace EE::Render
 
     void RenderingSystem::Update( UpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( Rendering );
         EE_ASSERT( m_pRenderDevice != nullptr );
         EE_ASSERT( ctx.GetUpdateStage() == UpdateStage::FrameEnd );
         EE_PROFILE_SCOPE_RENDER( "Rendering Post-Physics" );
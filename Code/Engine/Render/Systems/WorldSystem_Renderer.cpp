@@ -11,12 +11,38 @@
 #include "Base/Render/RenderCoreResources.h"
 #include "Base/Render/RenderViewport.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Math/BatchMath.h"
 #include "Base/Profiling.h"
+#include "Base/Memory/MemoryTags.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Render
 {
+    // Remove all the components whose bounds dont overlap the view bounds, the bounds must be in the same order as the components
+    template<typename T>
+    static void CullComponents( AABB const& viewBounds, TVector<OBB> const& componentBounds, TVector<bool>& cullResults, TVector<T const*>& components )
+    {
+        EE_ASSERT( componentBounds.size() == components.size() );
+
+        int32_t const numComponents = (int32_t) components.size();
+        cullResults.resize( numComponents );
+        BatchMath::Overlaps( viewBounds, componentBounds.data(), cullResults.data(), numComponents );
+
+        int32_t numVisibleComponents = 0;
+        for ( int32_t i = 0; i < numComponents; i++ )
+        {
+            if ( cullResults[i] )
+            {
+                components[numVisibleComponents++] = components[i];
+            }
+        }
+
+        components.resize( numVisibleComponents );
+    }
+
+    //-------------------------------------------------------------------------
+
     void RendererWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
     {}
 
@@ -197,6 +223,7 @@ namespace EE::Render
 
     void RendererWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( Rendering );
         EE_PROFILE_FUNCTION_RENDER();
 
         if ( ctx.IsWorldPaused() && ctx.GetUpdateStage() != UpdateStage::Paused )
@@ -213,30 +240,42 @@ namespace EE::Render
         AABB const viewBounds = ctx.GetViewport()->GetViewVolume().GetAABB();
 
         m_visibleStaticMeshComponents.clear();
+        m_cullBounds.clear();
 
-        for ( auto const& pMeshComponent : m_staticMeshComponents )
         {
             EE_PROFILE_SCOPE_RENDER( "Static Mesh Cull" );
 
-            if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
+            for ( auto const& pMeshComponent : m_staticMeshComponents )
             {
-                m_visibleStaticMeshComponents.emplace_back( pMeshComponent );
+                if ( pMeshComponent->IsVisible() )
+                {
+                    m_visibleStaticMeshComponents.emplace_back( pMeshComponent );
+                    m_cullBounds.emplace_back( pMeshComponent->GetWorldBounds() );
+                }
             }
+
+            CullComponents( viewBounds, m_cullBounds, m_cullResults, m_visibleStaticMeshComponents );
         }
 
         m_visibleSkeletalMeshComponents.clear();
+        m_cullBounds.clear();
 
-        for ( auto const& meshGroup : m_skeletalMeshGroups )
         {
             EE_PROFILE_SCOPE_RENDER( "Skeletal Mesh Cull" );
 
-            for ( auto pMeshComponent : meshGroup.m_components )
+            for ( auto const& meshGroup : m_skeletalMeshGroups )
             {
-                if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
+                for ( auto pMeshComponent : meshGroup.m_components )
                 {
-                    m_visibleSkeletalMeshComponents.emplace_back( pMeshComponent );
+                    if ( pMeshComponent->IsVisible() )
+                    {
+                        m_visibleSkeletalMeshComponents.emplace_back( pMeshComponent );
+                        m_cullBounds.emplace_back( pMeshComponent->GetWorldBounds() );
+                    }
                 }
             }
+
+            CullComponents( viewBounds, m_cullBounds, m_cullResults, m_visibleSkeletalMeshComponents );
         }
 
         //-------------------------------------------------------------------------
@@ -82,6 +82,10 @@ namespace EE::Render
         TIDVector<uint32_t, SkeletalMeshGroup>                          m_skeletalMeshGroups;
         TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
 
+        // Culling scratch data
+        TVector<OBB>                                                    m_cullBounds;
+        TVector<bool>                                                   m_cullResults;
+
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
         TIDVector<ComponentID, PointLightComponent*>                    m_registeredPointLightComponents;
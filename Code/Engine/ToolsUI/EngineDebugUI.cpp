@@ -10,6 +10,8 @@
 #include "Base/Logging/SystemLog.h"
 #include "Base/Imgui/ImguiX.h"
 #include "Base/Input/InputSystem.h"
+#include "Base/Memory/Arena.h"
+#include "Base/Memory/MemoryTags.h"
 #include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
@@ -299,6 +301,7 @@ namespace EE
 
     void EngineDebugUI::EndFrame( UpdateContext const& context )
     {
+        EE_MEMORY_TAG_SCOPE( Tools );
         UpdateStage const updateStage = context.GetUpdateStage();
         EE_ASSERT( updateStage == UpdateStage::FrameEnd );
 
@@ -599,6 +602,9 @@ namespace EE
 
         ImGui::SameLine();
         ImGui::Text( memStatsStr.c_str() );
+
+        Memory::FrameStats const& frameMemoryStats = Memory::GetLastFrameStats();
+        ImGuiX::ItemTooltip( "Global Allocations: %llu\nGlobal Frees: %llu\nFrame Allocations: %u\nFrame Memory: %.2fKB / %.2fKB", frameMemoryStats.m_globalAllocations.m_numAllocations + frameMemoryStats.m_globalAllocations.m_numReallocations, frameMemoryStats.m_globalAllocations.m_numFrees, frameMemoryStats.m_numFrameAllocations, frameMemoryStats.m_frameMemoryUsed / 1024.0f, frameMemoryStats.m_frameMemoryReserved / 1024.0f );
     }
 
     void EngineDebugUI::DrawOverlayElements( UpdateContext const& context, Render::Viewport const* pViewport )
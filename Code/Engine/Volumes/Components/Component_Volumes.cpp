@@ -1,10 +1,23 @@
 #include "Component_Volumes.h"
+#include "Engine/Volumes/Systems/WorldSystem_Volumes.h"
 #include "Base/Drawing/DebugDrawing.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    void VolumeComponent::OnWorldTransformUpdated()
+    {
+        // Only the first move per frame needs to be reported, the volume system reads the latest bounds in its update
+        if ( m_pVolumeSystem != nullptr && !m_isMoveNotificationPending )
+        {
+            m_isMoveNotificationPending = true;
+            m_pVolumeSystem->NotifyVolumeMoved( this );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     OBB BoxVolumeComponent::CalculateLocalBounds() const
     {
         return OBB( Vector::Zero, m_extents );
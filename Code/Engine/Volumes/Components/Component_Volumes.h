@@ -9,6 +9,7 @@
 namespace EE
 {
     namespace Drawing{ class DrawContext; }
+    class VolumeWorldSystem;
 
     //-------------------------------------------------------------------------
 
@@ -16,6 +17,8 @@ namespace EE
     {
         EE_ENTITY_COMPONENT( VolumeComponent );
 
+        friend class VolumeWorldSystem;
+
     public:
 
         inline VolumeComponent() = default;
@@ -25,6 +28,18 @@ namespace EE
         virtual Color GetVolumeColor() const { return Colors::Gray; }
         virtual void Draw( Drawing::DrawContext& drawingCtx ) const {}
         #endif
+
+    protected:
+
+        // Derived volumes overriding this need to call the base implementation so the volume system is notified of the move
+        virtual void OnWorldTransformUpdated() override;
+
+    private:
+
+        // Volume system state
+        VolumeWorldSystem*                          m_pVolumeSystem = nullptr;
+        int32_t                                     m_volumeSystemIdx = InvalidIndex;
+        bool                                        m_isMoveNotificationPending = false;
     };
 
     //-------------------------------------------------------------------------
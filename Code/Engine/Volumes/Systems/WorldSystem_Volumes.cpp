@@ -0,0 +1,750 @@
+#include "WorldSystem_Volumes.h"
+#include "Engine/Volumes/Components/Component_Volumes.h"
+#include "Engine/Entity/Entity.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Base/Profiling.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    void VolumeWorldSystem::ShutdownSystem()
+    {
+        EE_ASSERT( m_volumes.empty() );
+        EE_ASSERT( m_trackers.empty() );
+
+        m_proxies.clear();
+        m_freeProxies.clear();
+        m_endpoints.clear();
+        m_addedProxies.clear();
+        m_removedProxies.clear();
+        m_movedVolumes.clear();
+        m_events.clear();
+        m_pendingExitEvents.clear();
+        m_maxVolumeWidth = 0.0f;
+    }
+
+    void VolumeWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        if ( auto pVolumeComponent = TryCast<VolumeComponent>( pComponent ) )
+        {
+            EE_ASSERT( pVolumeComponent->m_pVolumeSystem == nullptr );
+
+            int32_t const volumeIdx = (int32_t) m_volumes.size();
+            TrackedVolume& volume = m_volumes.emplace_back();
+            volume.m_pComponent = pVolumeComponent;
+            volume.m_proxyIdx = CreateProxy( ProxyType::Volume, volumeIdx, pVolumeComponent->GetWorldBounds().GetAABB() );
+
+            pVolumeComponent->m_pVolumeSystem = this;
+            pVolumeComponent->m_volumeSystemIdx = volumeIdx;
+            pVolumeComponent->m_isMoveNotificationPending = false;
+        }
+    }
+
+    void VolumeWorldSystem::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        if ( auto pVolumeComponent = TryCast<VolumeComponent>( pComponent ) )
+        {
+            EE_ASSERT( pVolumeComponent->m_pVolumeSystem == this );
+
+            int32_t const volumeIdx = pVolumeComponent->m_volumeSystemIdx;
+            int32_t const proxyIdx = m_volumes[volumeIdx].m_proxyIdx;
+
+            // Any trackers inside this volume exit it
+            for ( Tracker& tracker : m_trackers )
+            {
+                auto foundIter = eastl::lower_bound( tracker.m_containingProxies.begin(), tracker.m_containingProxies.end(), proxyIdx );
+                if ( foundIter != tracker.m_containingProxies.end() && *foundIter == proxyIdx )
+                {
+                    tracker.m_containingProxies.erase( foundIter );
+
+                    VolumeEvent& event = m_pendingExitEvents.emplace_back();
+                    event.m_trackedEntityID = tracker.m_pEntity->GetID();
+                    event.m_volumeEntityID = pVolumeComponent->GetEntityID();
+                    event.m_volumeComponentID = pVolumeComponent->GetID();
+                    event.m_pVolume = nullptr;
+                    event.m_type = VolumeEvent::Type::Exit;
+                }
+            }
+
+            // Remove any pending move notification
+            if ( pVolumeComponent->m_isMoveNotificationPending )
+            {
+                Threading::ScopeLock const lock( m_movedVolumesMutex );
+                m_movedVolumes.erase_first_unsorted( pVolumeComponent );
+            }
+
+            DestroyProxy( proxyIdx );
+
+            // Remove the volume, patching the indices of the volume we moved into its slot
+            m_volumes.erase_unsorted( m_volumes.begin() + volumeIdx );
+            if ( volumeIdx < (int32_t) m_volumes.size() )
+            {
+                TrackedVolume& movedVolume = m_volumes[volumeIdx];
+                movedVolume.m_pComponent->m_volumeSystemIdx = volumeIdx;
+                m_proxies[movedVolume.m_proxyIdx].m_ownerIdx = volumeIdx;
+            }
+
+            pVolumeComponent->m_pVolumeSystem = nullptr;
+            pVolumeComponent->m_volumeSystemIdx = InvalidIndex;
+            pVolumeComponent->m_isMoveNotificationPending = false;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void VolumeWorldSystem::RegisterTrackedEntity( Entity const* pEntity, float radius )
+    {
+        EE_ASSERT( pEntity != nullptr && pEntity->IsSpatialEntity() );
+        EE_ASSERT( radius >= 0.0f );
+
+        #if EE_DEVELOPMENT_TOOLS
+        for ( Tracker const& tracker : m_trackers )
+        {
+            EE_ASSERT( tracker.m_pEntity != pEntity );
+        }
+        #endif
+
+        int32_t const trackerIdx = (int32_t) m_trackers.size();
+        Tracker& tracker = m_trackers.emplace_back();
+        tracker.m_pEntity = pEntity;
+        tracker.m_radius = radius;
+        tracker.m_proxyIdx = CreateProxy( ProxyType::Tracker, trackerIdx, CalculateTrackerBounds( tracker ) );
+    }
+
+    void VolumeWorldSystem::UnregisterTrackedEntity( Entity const* pEntity )
+    {
+        for ( int32_t i = 0; i < (int32_t) m_trackers.size(); i++ )
+        {
+            if ( m_trackers[i].m_pEntity == pEntity )
+            {
+                DestroyProxy( m_trackers[i].m_proxyIdx );
+
+                m_trackers.erase_unsorted( m_trackers.begin() + i );
+                if ( i < (int32_t) m_trackers.size() )
+                {
+                    m_proxies[m_trackers[i].m_proxyIdx].m_ownerIdx = i;
+                }
+                return;
+            }
+        }
+
+        EE_UNREACHABLE_CODE();
+    }
+
+    AABB VolumeWorldSystem::CalculateTrackerBounds( Tracker const& tracker ) const
+    {
+        return AABB( tracker.m_pEntity->GetWorldTransform().GetTranslation(), tracker.m_radius );
+    }
+
+    void VolumeWorldSystem::NotifyVolumeMoved( VolumeComponent* pVolume )
+    {
+        Threading::ScopeLock const lock( m_movedVolumesMutex );
+        m_movedVolumes.emplace_back( pVolume );
+    }
+
+    //-------------------------------------------------------------------------
+    // Proxies
+    //-------------------------------------------------------------------------
+
+    int32_t VolumeWorldSystem::CreateProxy( ProxyType type, int32_t ownerIdx, AABB const& bounds )
+    {
+        EE_ASSERT( type != ProxyType::Free );
+
+        int32_t proxyIdx = InvalidIndex;
+        if ( m_freeProxies.empty() )
+        {
+            proxyIdx = (int32_t) m_proxies.size();
+            m_proxies.emplace_back();
+        }
+        else
+        {
+            proxyIdx = m_freeProxies.back();
+            m_freeProxies.pop_back();
+        }
+
+        Proxy& proxy = m_proxies[proxyIdx];
+        proxy.m_type = type;
+        proxy.m_ownerIdx = ownerIdx;
+        proxy.m_minEndpointIdx = proxy.m_maxEndpointIdx = InvalidIndex;
+        SetProxyBounds( proxy, bounds );
+
+        // The endpoints are only added to the broadphase on the next update
+        m_addedProxies.emplace_back( proxyIdx );
+        return proxyIdx;
+    }
+
+    void VolumeWorldSystem::DestroyProxy( int32_t proxyIdx )
+    {
+        Proxy& proxy = m_proxies[proxyIdx];
+        EE_ASSERT( proxy.m_type != ProxyType::Free );
+
+        if ( IsProxyInBroadphase( proxy ) )
+        {
+            // Remove all pairs
+            if ( proxy.m_type == ProxyType::Volume )
+            {
+                for ( Tracker& tracker : m_trackers )
+                {
+                    tracker.m_candidateProxies.erase_first_unsorted( proxyIdx );
+                }
+            }
+
+            // The endpoints are removed with all other removed proxies on the next update, the proxy cant be reused until then
+            proxy.m_type = ProxyType::Removed;
+            proxy.m_ownerIdx = InvalidIndex;
+            m_removedProxies.emplace_back( proxyIdx );
+        }
+        else
+        {
+            m_addedProxies.erase_first_unsorted( proxyIdx );
+
+            proxy.m_type = ProxyType::Free;
+            proxy.m_ownerIdx = InvalidIndex;
+            m_freeProxies.emplace_back( proxyIdx );
+        }
+    }
+
+    void VolumeWorldSystem::SetProxyBounds( Proxy& proxy, AABB const& bounds )
+    {
+        proxy.m_min = bounds.GetMin().ToFloat3();
+        proxy.m_max = bounds.GetMax().ToFloat3();
+
+        if ( proxy.m_type == ProxyType::Volume )
+        {
+            m_maxVolumeWidth = Math::Max( m_maxVolumeWidth, proxy.m_max.m_x - proxy.m_min.m_x );
+        }
+    }
+
+    void VolumeWorldSystem::UpdateProxyBounds( int32_t proxyIdx, AABB const& bounds )
+    {
+        Proxy& proxy = m_proxies[proxyIdx];
+        float const previousMinX = proxy.m_min.m_x;
+        SetProxyBounds( proxy, bounds );
+
+        if ( !IsProxyInBroadphase( proxy ) )
+        {
+            return;
+        }
+
+        m_endpoints[proxy.m_minEndpointIdx].m_value = proxy.m_min.m_x;
+        m_endpoints[proxy.m_maxEndpointIdx].m_value = proxy.m_max.m_x;
+
+        // Sort the leading endpoint first so the trailing one never stops at a stale position
+        if ( proxy.m_min.m_x > previousMinX )
+        {
+            SortEndpoint( proxy.m_maxEndpointIdx );
+            SortEndpoint( proxy.m_minEndpointIdx );
+        }
+        else
+        {
+            SortEndpoint( proxy.m_minEndpointIdx );
+            SortEndpoint( proxy.m_maxEndpointIdx );
+        }
+
+        m_stats.m_numMovedProxies++;
+    }
+
+    //-------------------------------------------------------------------------
+    // Endpoints
+    //-------------------------------------------------------------------------
+
+    void VolumeWorldSystem::ApplyAddedAndRemovedProxies()
+    {
+        if ( m_addedProxies.empty() && m_removedProxies.empty() )
+        {
+            return;
+        }
+
+        int32_t firstChangedEndpointIdx = (int32_t) m_endpoints.size();
+
+        // Compact out the endpoints of all removed proxies in a single pass
+        //-------------------------------------------------------------------------
+
+        if ( !m_removedProxies.empty() )
+        {
+            auto IsRemoved = [this] ( Endpoint const& endpoint ) { return m_proxies[endpoint.m_proxyIdx].m_type == ProxyType::Removed; };
+            auto const firstRemovedIter = eastl::find_if( m_endpoints.begin(), m_endpoints.end(), IsRemoved );
+            firstChangedEndpointIdx = (int32_t) ( firstRemovedIter - m_endpoints.begin() );
+            m_endpoints.erase( eastl::remove_if( firstRemovedIter, m_endpoints.end(), IsRemoved ), m_endpoints.end() );
+
+            for ( int32_t proxyIdx : m_removedProxies )
+            {
+                Proxy& proxy = m_proxies[proxyIdx];
+                EE_ASSERT( proxy.m_type == ProxyType::Removed );
+                proxy.m_type = ProxyType::Free;
+                proxy.m_minEndpointIdx = proxy.m_maxEndpointIdx = InvalidIndex;
+                m_freeProxies.emplace_back( proxyIdx );
+            }
+
+            m_removedProxies.clear();
+        }
+
+        // Merge the sorted endpoints of all added proxies in a single pass
+        //-------------------------------------------------------------------------
+
+        if ( (int32_t) m_addedProxies.size() > s_minAddedProxiesForRebuild )
+        {
+            RebuildBroadphase();
+            return;
+        }
+
+        if ( !m_addedProxies.empty() )
+        {
+            m_scratchEndpoints.clear();
+
+            for ( int32_t proxyIdx : m_addedProxies )
+            {
+                Proxy const& proxy = m_proxies[proxyIdx];
+                EE_ASSERT( !IsProxyInBroadphase( proxy ) );
+
+                Endpoint& minEndpoint = m_scratchEndpoints.emplace_back();
+                minEndpoint.m_value = proxy.m_min.m_x;
+                minEndpoint.m_proxyIdx = proxyIdx;
+                minEndpoint.m_isMax = 0;
+
+                Endpoint& maxEndpoint = m_scratchEndpoints.emplace_back();
+                maxEndpoint.m_value = proxy.m_max.m_x;
+                maxEndpoint.m_proxyIdx = proxyIdx;
+                maxEndpoint.m_isMax = 1;
+            }
+
+            eastl::sort( m_scratchEndpoints.begin(), m_scratchEndpoints.end() );
+
+            // Merge from the back so every existing endpoint is moved at most once, new endpoints go after existing equal ones
+            int32_t existingIdx = (int32_t) m_endpoints.size() - 1;
+            int32_t newIdx = (int32_t) m_scratchEndpoints.size() - 1;
+            m_endpoints.resize( m_endpoints.size() + m_scratchEndpoints.size() );
+
+            for ( int32_t writeIdx = (int32_t) m_endpoints.size() - 1; newIdx >= 0; writeIdx-- )
+            {
+                if ( existingIdx >= 0 && m_scratchEndpoints[newIdx] < m_endpoints[existingIdx] )
+                {
+                    m_endpoints[writeIdx] = m_endpoints[existingIdx--];
+                }
+                else
+                {
+                    m_endpoints[writeIdx] = m_scratchEndpoints[newIdx--];
+                }
+            }
+
+            // Everything up to the last existing endpoint we didnt move is unchanged
+            firstChangedEndpointIdx = Math::Min( firstChangedEndpointIdx, existingIdx + 1 );
+        }
+
+        UpdateEndpointIndices( firstChangedEndpointIdx );
+
+        // Create the pairs once all the new proxies are in the broadphase
+        //-------------------------------------------------------------------------
+
+        for ( int32_t proxyIdx : m_addedProxies )
+        {
+            CreatePairsForAddedProxy( proxyIdx );
+        }
+
+        m_addedProxies.clear();
+    }
+
+    void VolumeWorldSystem::CreatePairsForAddedProxy( int32_t proxyIdx )
+    {
+        Proxy const& proxy = m_proxies[proxyIdx];
+        EE_ASSERT( IsProxyInBroadphase( proxy ) );
+
+        // There are very few trackers so we just test all the proxies of the other type
+        if ( proxy.m_type == ProxyType::Volume )
+        {
+            for ( Tracker const& tracker : m_trackers )
+            {
+                Proxy const& trackerProxy = m_proxies[tracker.m_proxyIdx];
+                if ( IsProxyInBroadphase( trackerProxy ) && trackerProxy.OverlapsOnX( proxy ) )
+                {
+                    AddCandidatePair( tracker.m_proxyIdx, proxyIdx );
+                }
+            }
+        }
+        else
+        {
+            for ( TrackedVolume const& volume : m_volumes )
+            {
+                Proxy const& volumeProxy = m_proxies[volume.m_proxyIdx];
+                if ( IsProxyInBroadphase( volumeProxy ) && volumeProxy.OverlapsOnX( proxy ) )
+                {
+                    AddCandidatePair( proxyIdx, volume.m_proxyIdx );
+                }
+            }
+        }
+    }
+
+    void VolumeWorldSystem::UpdateEndpointIndices( int32_t startIdx )
+    {
+        int32_t const numEndpoints = (int32_t) m_endpoints.size();
+        for ( int32_t i = startIdx; i < numEndpoints; i++ )
+        {
+            Endpoint const& endpoint = m_endpoints[i];
+            Proxy& proxy = m_proxies[endpoint.m_proxyIdx];
+            ( endpoint.m_isMax ? proxy.m_maxEndpointIdx : proxy.m_minEndpointIdx ) = i;
+        }
+    }
+
+    void VolumeWorldSystem::SortEndpoint( int32_t endpointIdx )
+    {
+        Endpoint const endpoint = m_endpoints[endpointIdx];
+        int32_t const numEndpoints = (int32_t) m_endpoints.size();
+        int32_t idx = endpointIdx;
+
+        auto MoveEndpoint = [this] ( int32_t fromIdx, int32_t toIdx )
+        {
+            m_endpoints[toIdx] = m_endpoints[fromIdx];
+            Proxy& proxy = m_proxies[m_endpoints[toIdx].m_proxyIdx];
+            ( m_endpoints[toIdx].m_isMax ? proxy.m_maxEndpointIdx : proxy.m_minEndpointIdx ) = toIdx;
+        };
+
+        // Move left
+        while ( idx > 0 && endpoint < m_endpoints[idx - 1] )
+        {
+            OnEndpointsSwapped( endpoint, m_endpoints[idx - 1] );
+            MoveEndpoint( idx - 1, idx );
+            idx--;
+        }
+
+        // Move right
+        while ( idx < numEndpoints - 1 && m_endpoints[idx + 1] < endpoint )
+        {
+            OnEndpointsSwapped( endpoint, m_endpoints[idx + 1] );
+            MoveEndpoint( idx + 1, idx );
+            idx++;
+        }
+
+        m_endpoints[idx] = endpoint;
+        Proxy& proxy = m_proxies[endpoint.m_proxyIdx];
+        ( endpoint.m_isMax ? proxy.m_maxEndpointIdx : proxy.m_minEndpointIdx ) = idx;
+    }
+
+    void VolumeWorldSystem::OnEndpointsSwapped( Endpoint const& a, Endpoint const& b )
+    {
+        m_stats.m_numEndpointSwaps++;
+
+        // Only a min passing a max can change whether two intervals overlap
+        if ( a.m_isMax == b.m_isMax || a.m_proxyIdx == b.m_proxyIdx )
+        {
+            return;
+        }
+
+        Proxy const& proxyA = m_proxies[a.m_proxyIdx];
+        Proxy const& proxyB = m_proxies[b.m_proxyIdx];
+        if ( proxyA.m_type == proxyB.m_type )
+        {
+            return;
+        }
+
+        int32_t const trackerProxyIdx = ( proxyA.m_type == ProxyType::Tracker ) ? a.m_proxyIdx : b.m_proxyIdx;
+        int32_t const volumeProxyIdx = ( proxyA.m_type == ProxyType::Tracker ) ? b.m_proxyIdx : a.m_proxyIdx;
+
+        // All other endpoints are in their sorted positions so we can simply re-test the intervals
+        if ( proxyA.OverlapsOnX( proxyB ) )
+        {
+            AddCandidatePair( trackerProxyIdx, volumeProxyIdx );
+        }
+        else
+        {
+            RemoveCandidatePair( trackerProxyIdx, volumeProxyIdx );
+        }
+    }
+
+    void VolumeWorldSystem::RebuildBroadphase()
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Rebuild Volume Broadphase" );
+
+        m_addedProxies.clear();
+        m_endpoints.clear();
+        m_maxVolumeWidth = 0.0f;
+
+        for ( Tracker& tracker : m_trackers )
+        {
+            tracker.m_candidateProxies.clear();
+        }
+
+        // Sort
+        //-------------------------------------------------------------------------
+
+        int32_t const numProxies = (int32_t) m_proxies.size();
+        for ( int32_t i = 0; i < numProxies; i++ )
+        {
+            Proxy const& proxy = m_proxies[i];
+            if ( proxy.m_type == ProxyType::Free )
+            {
+                continue;
+            }
+
+            if ( proxy.m_type == ProxyType::Volume )
+            {
+                m_maxVolumeWidth = Math::Max( m_maxVolumeWidth, proxy.m_max.m_x - proxy.m_min.m_x );
+            }
+
+            Endpoint& minEndpoint = m_endpoints.emplace_back();
+            minEndpoint.m_value = proxy.m_min.m_x;
+            minEndpoint.m_proxyIdx = i;
+            minEndpoint.m_isMax = 0;
+
+            Endpoint& maxEndpoint = m_endpoints.emplace_back();
+            maxEndpoint.m_value = proxy.m_max.m_x;
+            maxEndpoint.m_proxyIdx = i;
+            maxEndpoint.m_isMax = 1;
+        }
+
+        eastl::sort( m_endpoints.begin(), m_endpoints.end() );
+        UpdateEndpointIndices( 0 );
+
+        // Sweep
+        //-------------------------------------------------------------------------
+
+        TInlineVector<int32_t, 16> activeTrackers;
+        TVector<int32_t> activeVolumes;
+
+        for ( Endpoint const& endpoint : m_endpoints )
+        {
+            int32_t const proxyIdx = endpoint.m_proxyIdx;
+            bool const isTracker = m_proxies[proxyIdx].m_type == ProxyType::Tracker;
+
+            if ( endpoint.m_isMax )
+            {
+                if ( isTracker )
+                {
+                    activeTrackers.erase_first_unsorted( proxyIdx );
+                }
+                else
+                {
+                    activeVolumes.erase_first_unsorted( proxyIdx );
+                }
+            }
+            else
+            {
+                if ( isTracker )
+                {
+                    for ( int32_t volumeProxyIdx : activeVolumes )
+                    {
+                        m_trackers[m_proxies[proxyIdx].m_ownerIdx].m_candidateProxies.emplace_back( volumeProxyIdx );
+                    }
+                    activeTrackers.emplace_back( proxyIdx );
+                }
+                else
+                {
+                    for ( int32_t trackerProxyIdx : activeTrackers )
+                    {
+                        m_trackers[m_proxies[trackerProxyIdx].m_ownerIdx].m_candidateProxies.emplace_back( proxyIdx );
+                    }
+                    activeVolumes.emplace_back( proxyIdx );
+                }
+            }
+        }
+
+        m_stats.m_wasRebuilt = true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Pairs
+    //-------------------------------------------------------------------------
+
+    void VolumeWorldSystem::AddCandidatePair( int32_t trackerProxyIdx, int32_t volumeProxyIdx )
+    {
+        Tracker& tracker = m_trackers[m_proxies[trackerProxyIdx].m_ownerIdx];
+        if ( !VectorContains( tracker.m_candidateProxies, volumeProxyIdx ) )
+        {
+            tracker.m_candidateProxies.emplace_back( volumeProxyIdx );
+        }
+    }
+
+    void VolumeWorldSystem::RemoveCandidatePair( int32_t trackerProxyIdx, int32_t volumeProxyIdx )
+    {
+        Tracker& tracker = m_trackers[m_proxies[trackerProxyIdx].m_ownerIdx];
+        tracker.m_candidateProxies.erase_first_unsorted( volumeProxyIdx );
+    }
+
+    //-------------------------------------------------------------------------
+    // Update
+    //-------------------------------------------------------------------------
+
+    void VolumeWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_FUNCTION_ENTITY();
+
+        m_stats = Stats();
+        m_stats.m_numVolumes = (int32_t) m_volumes.size();
+        m_stats.m_numTrackers = (int32_t) m_trackers.size();
+
+        // Add new proxies and remove destroyed ones
+        //-------------------------------------------------------------------------
+
+        ApplyAddedAndRemovedProxies();
+
+        // Update moved proxies
+        //-------------------------------------------------------------------------
+        // Entity updates are complete so we can safely take the moved volume list without holding the lock
+
+        m_movedVolumesToProcess.clear();
+        m_movedVolumesToProcess.swap( m_movedVolumes );
+
+        for ( VolumeComponent* pVolume : m_movedVolumesToProcess )
+        {
+            EE_ASSERT( pVolume->m_isMoveNotificationPending );
+            pVolume->m_isMoveNotificationPending = false;
+            UpdateProxyBounds( m_volumes[pVolume->m_volumeSystemIdx].m_proxyIdx, pVolume->GetWorldBounds().GetAABB() );
+        }
+
+        // Trackers are few and usually move every frame so we simply poll them
+        for ( Tracker const& tracker : m_trackers )
+        {
+            AABB const bounds = CalculateTrackerBounds( tracker );
+            Proxy const& proxy = m_proxies[tracker.m_proxyIdx];
+            if ( !Vector( proxy.m_min ).IsEqual3( bounds.GetMin() ) || !Vector( proxy.m_max ).IsEqual3( bounds.GetMax() ) )
+            {
+                UpdateProxyBounds( tracker.m_proxyIdx, bounds );
+            }
+        }
+
+        // Generate the events
+        //-------------------------------------------------------------------------
+
+        GenerateEvents();
+
+        if ( !m_events.empty() )
+        {
+            m_volumeEventsEvent.Execute( m_events );
+        }
+    }
+
+    void VolumeWorldSystem::GenerateEvents()
+    {
+        m_events.clear();
+        m_events.swap( m_pendingExitEvents );
+
+        for ( Tracker& tracker : m_trackers )
+        {
+            Proxy const& trackerProxy = m_proxies[tracker.m_proxyIdx];
+            Vector const trackerPosition = tracker.m_pEntity->GetWorldTransform().GetTranslation();
+            AABB const trackerBounds = AABB::FromMinMax( trackerProxy.m_min, trackerProxy.m_max );
+
+            // Find all the volumes that contain this tracker
+            //-------------------------------------------------------------------------
+
+            m_scratchContainingProxies.clear();
+
+            for ( int32_t volumeProxyIdx : tracker.m_candidateProxies )
+            {
+                Proxy const& volumeProxy = m_proxies[volumeProxyIdx];
+                if ( !volumeProxy.Overlaps( trackerProxy ) )
+                {
+                    continue;
+                }
+
+                OBB const& volumeBounds = m_volumes[volumeProxy.m_ownerIdx].m_pComponent->GetWorldBounds();
+                bool const isInside = ( tracker.m_radius > 0.0f ) ? volumeBounds.Overlaps( trackerBounds ) : volumeBounds.ContainsPoint( trackerPosition );
+                if ( isInside )
+                {
+                    m_scratchContainingProxies.emplace_back( volumeProxyIdx );
+                }
+            }
+
+            m_stats.m_numCandidatePairs += (int32_t) tracker.m_candidateProxies.size();
+
+            // Diff against the previous frame's volumes
+            //-------------------------------------------------------------------------
+
+            eastl::sort( m_scratchContainingProxies.begin(), m_scratchContainingProxies.end() );
+
+            auto AddEvent = [&] ( int32_t volumeProxyIdx, VolumeEvent::Type type )
+            {
+                VolumeComponent const* pVolume = m_volumes[m_proxies[volumeProxyIdx].m_ownerIdx].m_pComponent;
+                VolumeEvent& event = m_events.emplace_back();
+                event.m_trackedEntityID = tracker.m_pEntity->GetID();
+                event.m_volumeEntityID = pVolume->GetEntityID();
+                event.m_volumeComponentID = pVolume->GetID();
+                event.m_pVolume = pVolume;
+                event.m_type = type;
+            };
+
+            for ( int32_t volumeProxyIdx : tracker.m_containingProxies )
+            {
+                if ( !eastl::binary_search( m_scratchContainingProxies.begin(), m_scratchContainingProxies.end(), volumeProxyIdx ) )
+                {
+                    AddEvent( volumeProxyIdx, VolumeEvent::Type::Exit );
+                }
+            }
+
+            for ( int32_t volumeProxyIdx : m_scratchContainingProxies )
+            {
+                if ( !eastl::binary_search( tracker.m_containingProxies.begin(), tracker.m_containingProxies.end(), volumeProxyIdx ) )
+                {
+                    AddEvent( volumeProxyIdx, VolumeEvent::Type::Enter );
+                }
+            }
+
+            tracker.m_containingProxies.swap( m_scratchContainingProxies );
+        }
+
+        m_stats.m_numEvents = (int32_t) m_events.size();
+    }
+
+    //-------------------------------------------------------------------------
+    // Queries
+    //-------------------------------------------------------------------------
+
+    int32_t VolumeWorldSystem::FindVolumesContainingPoint( Vector const& point, TVector<VolumeComponent const*>& outVolumes ) const
+    {
+        outVolumes.clear();
+
+        // Any volume containing the point needs to start within the widest volume's width of it
+        Endpoint searchStart;
+        searchStart.m_value = point.GetX() - m_maxVolumeWidth;
+        searchStart.m_proxyIdx = 0;
+        searchStart.m_isMax = 0;
+
+        float const pointX = point.GetX();
+        Float3 const point3 = point.ToFloat3();
+
+        for ( auto iter = eastl::lower_bound( m_endpoints.begin(), m_endpoints.end(), searchStart ); iter != m_endpoints.end() && iter->m_value <= pointX; ++iter )
+        {
+            if ( iter->m_isMax )
+            {
+                continue;
+            }
+
+            Proxy const& proxy = m_proxies[iter->m_proxyIdx];
+            if ( proxy.m_type != ProxyType::Volume )
+            {
+                continue;
+            }
+
+            bool const isInsideBounds = point3.m_x <= proxy.m_max.m_x && point3.m_y >= proxy.m_min.m_y && point3.m_y <= proxy.m_max.m_y && point3.m_z >= proxy.m_min.m_z && point3.m_z <= proxy.m_max.m_z;
+            if ( !isInsideBounds )
+            {
+                continue;
+            }
+
+            VolumeComponent const* pVolume = m_volumes[proxy.m_ownerIdx].m_pComponent;
+            if ( pVolume->GetWorldBounds().ContainsPoint( point ) )
+            {
+                outVolumes.emplace_back( pVolume );
+            }
+        }
+
+        // Volumes registered since the last update are not in the endpoint list yet
+        for ( int32_t proxyIdx : m_addedProxies )
+        {
+            Proxy const& proxy = m_proxies[proxyIdx];
+            if ( proxy.m_type != ProxyType::Volume )
+            {
+                continue;
+            }
+
+            VolumeComponent const* pVolume = m_volumes[proxy.m_ownerIdx].m_pComponent;
+            if ( pVolume->GetWorldBounds().ContainsPoint( point ) )
+            {
+                outVolumes.emplace_back( pVolume );
+            }
+        }
+
+        return (int32_t) outVolumes.size();
+    }
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Entity/EntityIDs.h"
+#include "Base/Math/BoundingVolumes.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Event.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class VolumeComponent;
+
+    //-------------------------------------------------------------------------
+
+    struct VolumeEvent
+    {
+        enum class Type : uint8_t
+        {
+            Enter,
+            Exit,
+        };
+
+    public:
+
+        EntityID                                        m_trackedEntityID;
+        EntityID                                        m_volumeEntityID;
+        ComponentID                                     m_volumeComponentID;
+        VolumeComponent const*                          m_pVolume = nullptr;            // Null if this exit was generated by the volume being unregistered
+        Type                                            m_type = Type::Enter;
+    };
+
+    //-------------------------------------------------------------------------
+    // Volume World System
+    //-------------------------------------------------------------------------
+    // Keeps the world bounds of all volume components in a sort-and-sweep broadphase and generates enter/exit events for
+    // tracked entities (e.g. players or AI)
+    //
+    // The broadphase keeps the bounds endpoints along the X axis sorted and only re-sorts the endpoints of proxies that
+    // moved (volumes notify us when their transforms change, trackers are polled). Tracker/volume pairs are created and
+    // destroyed as endpoints swap, so the per-frame cost depends on the amount of movement and the number of volumes near
+    // each tracker, not on the total number of volumes. Proxies added or removed between updates are applied as a single
+    // batch per update: removed endpoints are compacted out and new endpoints merged in with one pass over the endpoint list.
+    // Large batches of new volumes (i.e. level loads) are added by fully re-sorting the endpoints and sweeping once.
+    //
+    // Events are delivered as a single batch per update, with each tracked entity's exits before its enters.
+    // The batch is available until the next update of this system.
+
+    class EE_ENGINE_API VolumeWorldSystem : public EntityWorldSystem
+    {
+        friend class VolumeComponent;
+
+        constexpr static int32_t const s_minAddedProxiesForRebuild = 64;   // Adding more than this many proxies in a single update will trigger a full rebuild
+
+        enum class ProxyType : uint8_t
+        {
+            Free,
+            Volume,
+            Tracker,
+            Removed,        // Destroyed, but its endpoints are only removed from the endpoint list on the next update
+        };
+
+        struct Endpoint
+        {
+            EE_FORCE_INLINE bool operator<( Endpoint const& rhs ) const
+            {
+                // Mins sort before maxes at the same position so that touching intervals are considered overlapping
+                return ( m_value < rhs.m_value ) || ( m_value == rhs.m_value && !m_isMax && rhs.m_isMax );
+            }
+
+        public:
+
+            float                                       m_value = 0.0f;
+            uint32_t                                    m_proxyIdx : 31;
+            uint32_t                                    m_isMax : 1;
+        };
+
+        struct Proxy
+        {
+            inline bool OverlapsOnX( Proxy const& other ) const { return m_min.m_x <= other.m_max.m_x && other.m_min.m_x <= m_max.m_x; }
+            inline bool Overlaps( Proxy const& other ) const { return m_min.m_x <= other.m_max.m_x && other.m_min.m_x <= m_max.m_x && m_min.m_y <= other.m_max.m_y && other.m_min.m_y <= m_max.m_y && m_min.m_z <= other.m_max.m_z && other.m_min.m_z <= m_max.m_z; }
+
+        public:
+
+            Float3                                      m_min = Float3::Zero;
+            Float3                                      m_max = Float3::Zero;
+            int32_t                                     m_minEndpointIdx = InvalidIndex;
+            int32_t                                     m_maxEndpointIdx = InvalidIndex;
+            int32_t                                     m_ownerIdx = InvalidIndex;      // Index into either the volume or tracker list
+            ProxyType                                   m_type = ProxyType::Free;
+        };
+
+        struct TrackedVolume
+        {
+            VolumeComponent*                            m_pComponent = nullptr;
+            int32_t                                     m_proxyIdx = InvalidIndex;
+        };
+
+        struct Tracker
+        {
+            Entity const*                               m_pEntity = nullptr;
+            float                                       m_radius = 0.0f;
+            int32_t                                     m_proxyIdx = InvalidIndex;
+            TVector<int32_t>                            m_candidateProxies;             // Volume proxies overlapping this tracker along the X axis
+            TVector<int32_t>                            m_containingProxies;            // Sorted volume proxies that currently contain this tracker
+        };
+
+    public:
+
+        struct Stats
+        {
+            int32_t                                     m_numVolumes = 0;
+            int32_t                                     m_numTrackers = 0;
+            int32_t                                     m_numMovedProxies = 0;
+            int32_t                                     m_numEndpointSwaps = 0;
+            int32_t                                     m_numCandidatePairs = 0;
+            int32_t                                     m_numEvents = 0;
+            bool                                        m_wasRebuilt = false;
+        };
+
+    public:
+
+        EE_ENTITY_WORLD_SYSTEM( VolumeWorldSystem, RequiresUpdate( UpdateStage::PostPhysics ) );
+
+        // Tracking
+        //-------------------------------------------------------------------------
+        // Tracked entities need to be spatial and need to be unregistered before they are removed from the world
+        // A radius of zero tracks the entity's position, otherwise a sphere's bounds are used
+
+        void RegisterTrackedEntity( Entity const* pEntity, float radius = 0.0f );
+        void UnregisterTrackedEntity( Entity const* pEntity );
+
+        // Get the volume events generated by the last update
+        // Exits caused by volumes being unregistered come first, the remaining events are grouped by tracked entity
+        inline TVector<VolumeEvent> const& GetEvents() const { return m_events; }
+
+        // Fired at the end of each update that generated events
+        inline TEventHandle<TVector<VolumeEvent> const&> OnVolumeEvents() { return m_volumeEventsEvent; }
+
+        // Queries
+        //-------------------------------------------------------------------------
+
+        // Find all the volumes containing the specified point, returns the number of volumes found
+        // This includes volumes registered since the last update, but volumes that moved since then are tested at their previous position
+        int32_t FindVolumesContainingPoint( Vector const& point, TVector<VolumeComponent const*>& outVolumes ) const;
+
+        inline Stats const& GetStats() const { return m_stats; }
+
+    private:
+
+        virtual void ShutdownSystem() override final;
+        virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+
+        // Called by volumes whenever their transform changes - threadsafe
+        void NotifyVolumeMoved( VolumeComponent* pVolume );
+
+        // Proxies
+        int32_t CreateProxy( ProxyType type, int32_t ownerIdx, AABB const& bounds );
+        void DestroyProxy( int32_t proxyIdx );
+        void SetProxyBounds( Proxy& proxy, AABB const& bounds );
+        void UpdateProxyBounds( int32_t proxyIdx, AABB const& bounds );
+
+        // Endpoints
+        void ApplyAddedAndRemovedProxies();
+        void CreatePairsForAddedProxy( int32_t proxyIdx );
+        void UpdateEndpointIndices( int32_t startIdx );
+        void SortEndpoint( int32_t endpointIdx );
+        void OnEndpointsSwapped( Endpoint const& a, Endpoint const& b );
+        void RebuildBroadphase();
+
+        // Pairs
+        void AddCandidatePair( int32_t trackerProxyIdx, int32_t volumeProxyIdx );
+        void RemoveCandidatePair( int32_t trackerProxyIdx, int32_t volumeProxyIdx );
+        inline bool IsProxyInBroadphase( Proxy const& proxy ) const { return proxy.m_minEndpointIdx != InvalidIndex; }
+
+        AABB CalculateTrackerBounds( Tracker const& tracker ) const;
+        void GenerateEvents();
+
+    private:
+
+        TVector<TrackedVolume>                          m_volumes;
+        TVector<Tracker>                                m_trackers;
+        TVector<Proxy>                                  m_proxies;
+        TVector<int32_t>                                m_freeProxies;
+        TVector<Endpoint>                               m_endpoints;                    // Sorted along the X axis
+        TVector<int32_t>                                m_addedProxies;                 // Proxies created since the last update, not yet in the endpoint list
+        TVector<int32_t>                                m_removedProxies;               // Proxies destroyed since the last update, their endpoints are still in the endpoint list
+        TVector<Endpoint>                               m_scratchEndpoints;
+        float                                           m_maxVolumeWidth = 0.0f;        // The widest volume along X, only shrinks on rebuild
+
+        // Volumes that moved since the last update, written during entity updates
+        TVector<VolumeComponent*>                       m_movedVolumes;
+        TVector<VolumeComponent*>                       m_movedVolumesToProcess;
+        Threading::Mutex                                m_movedVolumesMutex;
+
+        TVector<VolumeEvent>                            m_events;
+        TVector<VolumeEvent>                            m_pendingExitEvents;            // Exits generated by volumes unregistered since the last update
+        TEvent<TVector<VolumeEvent> const&>             m_volumeEventsEvent;
+        TVector<int32_t>                                m_scratchContainingProxies;
+        Stats                                           m_stats;
+    };
+}
@@ -78,6 +78,7 @@ namespace EE
         //-------------------------------------------------------------------------
 
         Animation::TaskSystem::InitializeTaskTypesList( *context.m_pTypeRegistry );
+        Animation::PoseBufferArena::Initialize();
 
         //-------------------------------------------------------------------------
         // Register systems
@@ -193,6 +194,7 @@ namespace EE
         // Animation
         //-------------------------------------------------------------------------
 
+        Animation::PoseBufferArena::Shutdown();
         Animation::TaskSystem::ShutdownTaskTypesList();
 
         //-------------------------------------------------------------------------
@@ -22,6 +22,8 @@ namespace EE::Animation
     {
         TypeSystem::TypeDescriptorCollection            m_collection;
         TInlineVector<SyncTrack::EventMarker, 10>       m_syncEventMarkers;
+        TVector<float>                                  m_eventStartTimes;
+        TVector<float>                                  m_eventMaxEndTimes;
     };
 
     //-------------------------------------------------------------------------
@@ -191,6 +193,9 @@ namespace EE::Animation
         }
         Message( "Read Animation Events: %.3fms", timeTaken.ToFloat() );
 
+        animData.m_eventStartTimes = eventData.m_eventStartTimes;
+        animData.m_eventMaxEndTimes = eventData.m_eventMaxEndTimes;
+
         // Serialize animation data
         //-------------------------------------------------------------------------
 
@@ -845,14 +850,21 @@ namespace EE::Animation
 
         auto sortPredicate = [] ( TTypeInstance<Event> const& eventA, TTypeInstance<Event> const& eventB )
         {
-            return eventA->GetStartTime() < eventA->GetStartTime();
+            return eventA->GetStartTime() < eventB->GetStartTime();
         };
 
-        eastl::sort( events.begin(), events.end(), sortPredicate );
+        eastl::stable_sort( events.begin(), events.end(), sortPredicate );
 
+        float maxEndTime = 0.0f;
         for ( TTypeInstance<Event>& event : events )
         {
             outEventData.m_collection.m_descriptors.emplace_back( TypeSystem::TypeDescriptor( *m_pTypeRegistry, event.Get() ) );
+
+            // Build the event range index
+            FloatRange const eventTimeRange = event->GetTimeRange();
+            maxEndTime = Math::Max( maxEndTime, eventTimeRange.m_end );
+            outEventData.m_eventStartTimes.emplace_back( eventTimeRange.m_begin );
+            outEventData.m_eventMaxEndTimes.emplace_back( maxEndTime );
         }
 
         eastl::sort( outEventData.m_syncEventMarkers.begin(), outEventData.m_syncEventMarkers.end() );
@@ -14,21 +14,25 @@
 #include "Base/Resource/ResourceHeader.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Serialization/BinarySerialization.h"
+#include "Base/Encoding/Hash.h"
+#include "Base/FileSystem/FileSystem.h"
 #include <bfxSystem.h>
 
 //-------------------------------------------------------------------------
 
 namespace EE::Navmesh
 {
-    NavmeshGenerator::NavmeshGenerator( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& outputPath, EntityModel::EntityCollection const& entityCollection, NavmeshBuildSettings const& buildSettings )
+    NavmeshGenerator::NavmeshGenerator( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& triangleCacheDirectoryPath, FileSystem::Path const& outputPath, EntityModel::EntityCollection const& entityCollection, NavmeshBuildSettings const& buildSettings )
         : m_rawResourceDirectoryPath( rawResourceDirectoryPath )
+        , m_triangleCacheDirectoryPath( triangleCacheDirectoryPath )
         , m_outputPath( outputPath )
         , m_typeRegistry( typeRegistry )
         , m_entityCollection( entityCollection )
         , m_buildSettings( buildSettings )
-        , m_asyncTask( [this] ( TaskSetPartition range, uint32_t threadnum ) { GenerateSync(); } )
+        , m_asyncTask( [this] ( TaskSetPartition range, uint32_t threadnum ) { Generate(); } )
     {
         EE_ASSERT( rawResourceDirectoryPath.IsValid() );
+        EE_ASSERT( !m_triangleCacheDirectoryPath.IsValid() || m_triangleCacheDirectoryPath.IsDirectoryPath() );
         EE_ASSERT( m_outputPath.IsValid() );
     }
 
@@ -44,6 +48,7 @@ namespace EE::Navmesh
     void NavmeshGenerator::GenerateAsync( TaskSystem& taskSystem )
     {
         m_isGeneratingAsync = true;
+        m_pTaskSystem = &taskSystem;
         taskSystem.ScheduleTask( &m_asyncTask );
     }
 
@@ -54,6 +59,7 @@ namespace EE::Navmesh
         EE_ASSERT( m_state != State::Generating && m_pNavpowerInstance == nullptr );
 
         m_collisionPrimitives.clear();
+        m_meshTriangles.clear();
         m_buildFaces.clear();
         m_numCollisionPrimitivesToProcess = 0;
         m_progressMessage[0] = 0;
@@ -167,133 +173,274 @@ namespace EE::Navmesh
 
     bool NavmeshGenerator::CollectTriangles()
     {
-        auto LogError = [] ( char const* pFormat, ... )
-        {
-            va_list args;
-            va_start( args, pFormat );
-            SystemLog::AddEntryVarArgs( Severity::Error, "Navmesh", "Generation", __FILE__, __LINE__, pFormat, args );
-            va_end( args );
-            return false;
-        };
-
-        //-------------------------------------------------------------------------
-
         Printf( m_progressMessage, 256, "Step 2/4: Collecting Triangles" );
         m_progress = 0.0f;
 
-        float cnt = 0;
+        m_meshTriangles.clear();
+        m_meshTriangles.reserve( m_collisionPrimitives.size() );
         for ( auto const& primitiveDesc : m_collisionPrimitives )
         {
-            // Load descriptor
-            //-------------------------------------------------------------------------
+            MeshTriangles& meshTriangles = m_meshTriangles.emplace_back();
+            meshTriangles.m_descriptorPath = primitiveDesc.first;
+            meshTriangles.m_pInstances = &primitiveDesc.second;
+        }
+
+        if ( m_meshTriangles.empty() )
+        {
+            return true;
+        }
 
-            DataPath const& descriptorDataPath = primitiveDesc.first;
+        // Load the triangles for each unique collision mesh
+        //-------------------------------------------------------------------------
+        // Each mesh is loaded independently, so we spread the loading across the task workers
 
-            FileSystem::Path meshDescriptorFilePath;
-            if ( descriptorDataPath.IsValid() )
-            {
-                meshDescriptorFilePath = descriptorDataPath.GetFileSystemPath( m_rawResourceDirectoryPath );
-            }
-            else
-            {
-                return LogError( "Invalid source data path (%s) for physics mesh descriptor", primitiveDesc.first.c_str() );
-            }
+        m_numProcessedMeshes = 0;
+        float const numMeshes = (float) m_meshTriangles.size();
 
-            Physics::PhysicsCollisionMeshResourceDescriptor physicsCollisionDescriptor;
-            if ( !Resource::ResourceDescriptor::TryReadFromFile( m_typeRegistry, meshDescriptorFilePath, physicsCollisionDescriptor ) )
+        auto LoadMeshes = [this, numMeshes] ( TaskSetPartition range, uint32_t threadnum )
+        {
+            for ( uint32_t i = range.start; i < range.end; i++ )
             {
-                return LogError( "Failed to read physics mesh resource descriptor from file: %s", meshDescriptorFilePath.c_str() );
+                m_meshTriangles[i].m_wasLoaded = LoadMeshTriangles( m_meshTriangles[i] );
+                m_progress.store( ( m_numProcessedMeshes.fetch_add( 1 ) + 1 ) / numMeshes, std::memory_order_relaxed );
             }
+        };
 
-            // Load collision mesh
-            //-------------------------------------------------------------------------
+        if ( m_pTaskSystem != nullptr )
+        {
+            AsyncTask loadTask( (uint32_t) m_meshTriangles.size(), LoadMeshes );
+            m_pTaskSystem->ScheduleTask( &loadTask );
+            m_pTaskSystem->WaitForTask( &loadTask );
+        }
+        else
+        {
+            LoadMeshes( TaskSetPartition{ 0, (uint32_t) m_meshTriangles.size() }, 0 );
+        }
 
-            FileSystem::Path collisionMeshFilePath;
-            if ( descriptorDataPath.IsValid() )
-            {
-                collisionMeshFilePath = physicsCollisionDescriptor.m_sourcePath.GetFileSystemPath( m_rawResourceDirectoryPath );
-            }
-            else
+        // Allocate all build faces up front
+        //-------------------------------------------------------------------------
+        // Each mesh gets a contiguous range of faces so that the instances can be transformed in parallel
+
+        int32_t numBuildFaces = 0;
+        for ( MeshTriangles& meshTriangles : m_meshTriangles )
+        {
+            if ( !meshTriangles.m_wasLoaded )
             {
-                return LogError( "Invalid source data path (%) in physics collision descriptor: %s", physicsCollisionDescriptor.m_sourcePath.c_str(), meshDescriptorFilePath.c_str() );
+                return false;
             }
 
-            Import::ReaderContext readerCtx = 
-            { 
-                [] ( char const* pString ) { EE_LOG_WARNING( "Navmesh", "Generation", pString ); },
-                [] ( char const* pString ) { EE_LOG_ERROR( "Navmesh", "Generation", pString ); }
-            };
+            meshTriangles.m_firstFaceIdx = numBuildFaces;
+            numBuildFaces += (int32_t) ( meshTriangles.m_vertices.size() / 9 ) * (int32_t) meshTriangles.m_pInstances->size();
+        }
+
+        m_buildFaces.resize( numBuildFaces );
 
-            TUniquePtr<Import::ImportedMesh> pImportedMesh = Import::ReadStaticMesh( readerCtx, collisionMeshFilePath, physicsCollisionDescriptor.m_meshesToInclude );
-            if ( pImportedMesh == nullptr )
+        // Add triangles
+        //-------------------------------------------------------------------------
+
+        auto CreateFaces = [this] ( TaskSetPartition range, uint32_t threadnum )
+        {
+            for ( uint32_t i = range.start; i < range.end; i++ )
             {
-                return LogError( "Failed to read mesh from source file: %s" );
+                CreateBuildFaces( m_meshTriangles[i] );
             }
+        };
 
-            EE_ASSERT( pImportedMesh->IsValid() );
+        if ( m_pTaskSystem != nullptr )
+        {
+            AsyncTask createFacesTask( (uint32_t) m_meshTriangles.size(), CreateFaces );
+            m_pTaskSystem->ScheduleTask( &createFacesTask );
+            m_pTaskSystem->WaitForTask( &createFacesTask );
+        }
+        else
+        {
+            CreateFaces( TaskSetPartition{ 0, (uint32_t) m_meshTriangles.size() }, 0 );
+        }
 
-            // Add triangles
-            //-------------------------------------------------------------------------
+        m_meshTriangles.clear();
+        return true;
+    }
 
-            for ( CollisionMesh const& cm : primitiveDesc.second )
-            {
-                Float3 const finalScale = ( cm.m_localScale * cm.m_worldTransform.GetScale() ).ToFloat3();
- 
-                int32_t numNegativelyScaledAxes = ( finalScale.m_x < 0 ) ? 1 : 0;
-                numNegativelyScaledAxes += ( finalScale.m_y < 0 ) ? 1 : 0;
-                numNegativelyScaledAxes += ( finalScale.m_z < 0 ) ? 1 : 0;
+    bool NavmeshGenerator::LoadMeshTriangles( MeshTriangles& meshTriangles ) const
+    {
+        // Bump this if the cached triangle format or the triangle extraction changes
+        constexpr static uint32_t const s_triangleCacheVersion = 1;
+
+        auto LogError = [] ( char const* pFormat, ... )
+        {
+            va_list args;
+            va_start( args, pFormat );
+            SystemLog::AddEntryVarArgs( Severity::Error, "Navmesh", "Generation", __FILE__, __LINE__, pFormat, args );
+            va_end( args );
+            return false;
+        };
 
-                bool const flipWindingDueToScale = Math::IsOdd( numNegativelyScaledAxes );
+        // Load descriptor
+        //-------------------------------------------------------------------------
+
+        DataPath const& descriptorDataPath = meshTriangles.m_descriptorPath;
+        if ( !descriptorDataPath.IsValid() )
+        {
+            return LogError( "Invalid source data path (%s) for physics mesh descriptor", descriptorDataPath.c_str() );
+        }
 
-                //-------------------------------------------------------------------------
+        FileSystem::Path const meshDescriptorFilePath = descriptorDataPath.GetFileSystemPath( m_rawResourceDirectoryPath );
 
-                Matrix meshTransform = cm.m_worldTransform.ToMatrixNoScale();
-                meshTransform.SetScale( finalScale );
+        Physics::PhysicsCollisionMeshResourceDescriptor physicsCollisionDescriptor;
+        if ( !Resource::ResourceDescriptor::TryReadFromFile( m_typeRegistry, meshDescriptorFilePath, physicsCollisionDescriptor ) )
+        {
+            return LogError( "Failed to read physics mesh resource descriptor from file: %s", meshDescriptorFilePath.c_str() );
+        }
+
+        if ( !physicsCollisionDescriptor.m_sourcePath.IsValid() )
+        {
+            return LogError( "Invalid source data path (%s) in physics collision descriptor: %s", physicsCollisionDescriptor.m_sourcePath.c_str(), meshDescriptorFilePath.c_str() );
+        }
+
+        FileSystem::Path const collisionMeshFilePath = physicsCollisionDescriptor.m_sourcePath.GetFileSystemPath( m_rawResourceDirectoryPath );
+
+        // Try to read the triangles from the cache
+        //-------------------------------------------------------------------------
+        // The cache is keyed on the descriptor path and is only valid if the descriptor and the source file contents are unchanged
+
+        FileSystem::Path cacheFilePath;
+        uint64_t contentHash = 0;
+
+        if ( m_triangleCacheDirectoryPath.IsValid() )
+        {
+            Blob descriptorData, sourceData;
+            if ( FileSystem::ReadBinaryFile( meshDescriptorFilePath, descriptorData ) && FileSystem::ReadBinaryFile( collisionMeshFilePath, sourceData ) )
+            {
+                uint64_t const hashes[3] = { s_triangleCacheVersion, Hash::XXHash::GetHash64( descriptorData ), Hash::XXHash::GetHash64( sourceData ) };
+                contentHash = Hash::XXHash::GetHash64( hashes, sizeof( hashes ) );
 
-                //-------------------------------------------------------------------------
+                uint64_t const pathHash = Hash::XXHash::GetHash64( descriptorDataPath.GetString() );
+                cacheFilePath = m_triangleCacheDirectoryPath.GetAppended( String( String::CtorSprintf(), "%016llx.navtris", pathHash ) );
 
-                for ( auto const& geometrySection : pImportedMesh->GetGeometrySections() )
+                Serialization::BinaryInputArchive cacheArchive;
+                if ( cacheFilePath.Exists() && cacheArchive.ReadFromFile( cacheFilePath ) )
                 {
-                    // NavPower expects counterclockwise winding
-                    bool flipWinding = geometrySection.m_clockwiseWinding ? true : false;
-                    if ( flipWindingDueToScale )
+                    uint64_t cachedContentHash = 0;
+                    cacheArchive << cachedContentHash;
+                    if ( cachedContentHash == contentHash )
                     {
-                        flipWinding = !flipWinding;
+                        cacheArchive << meshTriangles.m_vertices;
+                        return true;
                     }
+                }
+            }
+        }
 
-                    //-------------------------------------------------------------------------
+        // Import collision mesh
+        //-------------------------------------------------------------------------
 
-                    int32_t const numTriangles = geometrySection.GetNumTriangles();
-                    int32_t const numIndices = (int32_t) geometrySection.m_indices.size();
-                    for ( auto t = 0; t < numTriangles; t++ )
-                    {
-                        int32_t const i = t * 3;
-                        EE_ASSERT( i <= numIndices - 3 );
+        Import::ReaderContext readerCtx =
+        {
+            [] ( char const* pString ) { EE_LOG_WARNING( "Navmesh", "Generation", pString ); },
+            [] ( char const* pString ) { EE_LOG_ERROR( "Navmesh", "Generation", pString ); }
+        };
 
-                        // NavPower expects counterclockwise winding
-                        int32_t const index0 = geometrySection.m_indices[flipWinding ? i + 2 : i];
-                        int32_t const index1 = geometrySection.m_indices[i + 1];
-                        int32_t const index2 = geometrySection.m_indices[flipWinding ? i : i + 2];
+        TUniquePtr<Import::ImportedMesh> pImportedMesh = Import::ReadStaticMesh( readerCtx, collisionMeshFilePath, physicsCollisionDescriptor.m_meshesToInclude );
+        if ( pImportedMesh == nullptr )
+        {
+            return LogError( "Failed to read mesh from source file: %s", collisionMeshFilePath.c_str() );
+        }
 
-                        // Add triangle
-                        auto& buildFace = m_buildFaces.emplace_back( bfx::BuildFace() );
-                        buildFace.m_type = bfx::WALKABLE_FACE;
+        EE_ASSERT( pImportedMesh->IsValid() );
 
-                        buildFace.m_verts[0] = ToBfx( meshTransform.TransformPoint( geometrySection.m_vertices[index0].m_position ) );
-                        buildFace.m_verts[1] = ToBfx( meshTransform.TransformPoint( geometrySection.m_vertices[index1].m_position ) );
-                        buildFace.m_verts[2] = ToBfx( meshTransform.TransformPoint( geometrySection.m_vertices[index2].m_position ) );
-                    }
+        // Extract triangles
+        //-------------------------------------------------------------------------
+
+        meshTriangles.m_vertices.clear();
+
+        for ( auto const& geometrySection : pImportedMesh->GetGeometrySections() )
+        {
+            // NavPower expects counterclockwise winding
+            bool const flipWinding = geometrySection.m_clockwiseWinding;
+
+            int32_t const numTriangles = geometrySection.GetNumTriangles();
+            int32_t const numIndices = (int32_t) geometrySection.m_indices.size();
+            for ( auto t = 0; t < numTriangles; t++ )
+            {
+                int32_t const i = t * 3;
+                EE_ASSERT( i <= numIndices - 3 );
+
+                int32_t const indices[3] =
+                {
+                    (int32_t) geometrySection.m_indices[flipWinding ? i + 2 : i],
+                    (int32_t) geometrySection.m_indices[i + 1],
+                    (int32_t) geometrySection.m_indices[flipWinding ? i : i + 2]
+                };
+
+                for ( int32_t const index : indices )
+                {
+                    Float4 const& position = geometrySection.m_vertices[index].m_position;
+                    meshTriangles.m_vertices.emplace_back( position.m_x );
+                    meshTriangles.m_vertices.emplace_back( position.m_y );
+                    meshTriangles.m_vertices.emplace_back( position.m_z );
                 }
+            }
+        }
 
-                // Update progress
-                cnt++;
-                m_progress = cnt / m_numCollisionPrimitivesToProcess;
+        // Update cache
+        //-------------------------------------------------------------------------
+
+        if ( cacheFilePath.IsValid() )
+        {
+            Serialization::BinaryOutputArchive cacheArchive;
+            cacheArchive << contentHash << meshTriangles.m_vertices;
+
+            if ( !m_triangleCacheDirectoryPath.EnsureDirectoryExists() || !cacheArchive.WriteToFile( cacheFilePath ) )
+            {
+                EE_LOG_WARNING( "Navmesh", "Generation", "Failed to write navmesh triangle cache file: %s", cacheFilePath.c_str() );
             }
         }
 
         return true;
     }
 
+    void NavmeshGenerator::CreateBuildFaces( MeshTriangles const& meshTriangles )
+    {
+        int32_t const numTriangles = (int32_t) meshTriangles.m_vertices.size() / 9;
+        int32_t faceIdx = meshTriangles.m_firstFaceIdx;
+
+        for ( CollisionMesh const& cm : *meshTriangles.m_pInstances )
+        {
+            Float3 const finalScale = ( cm.m_localScale * cm.m_worldTransform.GetScale() ).ToFloat3();
+
+            int32_t numNegativelyScaledAxes = ( finalScale.m_x < 0 ) ? 1 : 0;
+            numNegativelyScaledAxes += ( finalScale.m_y < 0 ) ? 1 : 0;
+            numNegativelyScaledAxes += ( finalScale.m_z < 0 ) ? 1 : 0;
+
+            // The cached triangles are already counterclockwise, so we only need to flip them if the scale mirrors the mesh
+            bool const flipWinding = Math::IsOdd( numNegativelyScaledAxes );
+
+            //-------------------------------------------------------------------------
+
+            Matrix meshTransform = cm.m_worldTransform.ToMatrixNoScale();
+            meshTransform.SetScale( finalScale );
+
+            //-------------------------------------------------------------------------
+
+            float const* pVertex = meshTriangles.m_vertices.data();
+            for ( auto t = 0; t < numTriangles; t++ )
+            {
+                Vector const v0( pVertex[0], pVertex[1], pVertex[2] );
+                Vector const v1( pVertex[3], pVertex[4], pVertex[5] );
+                Vector const v2( pVertex[6], pVertex[7], pVertex[8] );
+                pVertex += 9;
+
+                // Add triangle
+                auto& buildFace = m_buildFaces[faceIdx++];
+                buildFace.m_type = bfx::WALKABLE_FACE;
+
+                buildFace.m_verts[0] = ToBfx( meshTransform.TransformPoint( flipWinding ? v2 : v0 ) );
+                buildFace.m_verts[1] = ToBfx( meshTransform.TransformPoint( v1 ) );
+                buildFace.m_verts[2] = ToBfx( meshTransform.TransformPoint( flipWinding ? v0 : v2 ) );
+            }
+        }
+    }
+
     bool NavmeshGenerator::BuildNavmesh( NavmeshData& navmeshData )
     {
         Printf( m_progressMessage, 256, "Step 3/4: Building Navmesh" );
@@ -8,6 +8,7 @@
 #include "Base/Threading/TaskSystem.h"
 #include "Base/Types/HashMap.h"
 #include <bfxBuilder.h>
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
@@ -41,24 +42,38 @@ namespace EE::Navmesh
             Vector      m_localScale;
         };
 
+    private:
+
+        // The triangles of a single collision mesh resource, in mesh space and with counterclockwise winding
+        struct MeshTriangles
+        {
+            DataPath                                    m_descriptorPath;
+            TVector<CollisionMesh> const*               m_pInstances = nullptr;
+            TVector<float>                              m_vertices;             // 3 vertices (9 floats) per triangle
+            int32_t                                     m_firstFaceIdx = 0;
+            bool                                        m_wasLoaded = false;
+        };
+
     public:
 
-        NavmeshGenerator( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& outputPath, EntityModel::EntityCollection const& entityCollection, NavmeshBuildSettings const& buildSettings );
+        // The triangle cache directory is optional, if it is not set all collision meshes will be imported from their source files
+        NavmeshGenerator( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& rawResourceDirectoryPath, FileSystem::Path const& triangleCacheDirectoryPath, FileSystem::Path const& outputPath, EntityModel::EntityCollection const& entityCollection, NavmeshBuildSettings const& buildSettings );
         ~NavmeshGenerator();
 
         inline char const* GetProgressMessage() const { return m_progressMessage; }
-        inline float GetProgressBarValue() const { return m_progress; }
+        inline float GetProgressBarValue() const { return m_progress.load( std::memory_order_relaxed ); }
         inline State GetState() const { return m_state; }
 
         // Kick off the async generation task
         void GenerateAsync( TaskSystem& taskSystem );
 
         // Generates the navmesh via a blocking call - returns true if the generation succeeded, false otherwise
-        bool GenerateSync() { Generate(); return m_state == State::CompletedSuccess; }
+        // If a task system is supplied, the triangle collection will be spread across the task workers
+        bool GenerateSync( TaskSystem* pTaskSystem = nullptr ) { m_pTaskSystem = pTaskSystem; Generate(); return m_state == State::CompletedSuccess; }
 
     private:
 
-        virtual void BuildProgressUpdate( float percentDone ) override { m_progress = percentDone / 100.0f; }
+        virtual void BuildProgressUpdate( float percentDone ) override { m_progress.store( percentDone / 100.0f, std::memory_order_relaxed ); }
 
         //-------------------------------------------------------------------------
 
@@ -70,6 +85,12 @@ namespace EE::Navmesh
 
         bool CollectTriangles();
 
+        // Get the mesh space triangles for a collision mesh, either from the triangle cache or by importing the source file - threadsafe
+        bool LoadMeshTriangles( MeshTriangles& meshTriangles ) const;
+
+        // Transform a mesh's triangles into the build faces for each of its instances - threadsafe
+        void CreateBuildFaces( MeshTriangles const& meshTriangles );
+
         bool BuildNavmesh( NavmeshData& navmeshData );
 
         bool SaveNavmesh( NavmeshData& navmeshData );
@@ -78,6 +99,7 @@ namespace EE::Navmesh
 
         // Build data
         FileSystem::Path const                          m_rawResourceDirectoryPath;
+        FileSystem::Path const                          m_triangleCacheDirectoryPath;
         FileSystem::Path const                          m_outputPath;
         TypeSystem::TypeRegistry const&                 m_typeRegistry;
         EntityModel::EntityCollection const&            m_entityCollection;
@@ -87,11 +109,14 @@ namespace EE::Navmesh
         bfx::Instance*                                  m_pNavpowerInstance = nullptr;
         THashMap<DataPath, TVector<CollisionMesh>>      m_collisionPrimitives;
         size_t                                          m_numCollisionPrimitivesToProcess = 0;
+        TVector<MeshTriangles>                          m_meshTriangles;
         TVector<bfx::BuildFace>                         m_buildFaces;
+        TaskSystem*                                     m_pTaskSystem = nullptr;
+        std::atomic<int32_t>                            m_numProcessedMeshes = 0;
 
         // Generator state
         char                                            m_progressMessage[256];
-        float                                           m_progress = 0.0f;
+        std::atomic<float>                              m_progress = 0.0f;     // Written from the mesh loading tasks and read by the UI
         State                                           m_state = State::Idle;
         AsyncTask                                       m_asyncTask;
         bool                                            m_isGeneratingAsync = false;
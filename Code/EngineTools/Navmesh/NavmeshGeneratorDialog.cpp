@@ -78,7 +78,8 @@ namespace EE::Navmesh
                 #if EE_ENABLE_NAVPOWER
                 if ( ImGuiX::ButtonColored( "Generate", Colors::Green, Colors::White, ImVec2( -1, 0 ) ) )
                 {
-                    m_pGenerator = EE::New<NavmeshGenerator>( *m_pToolsContext->m_pTypeRegistry, m_pToolsContext->GetSourceDataDirectory(), m_navmeshOutputPath, m_entityCollection, m_buildSettings );
+                    FileSystem::Path const triangleCacheDirectoryPath = m_pToolsContext->GetCompiledResourceDirectory().GetAppended( "NavmeshTriangleCache", true );
+                    m_pGenerator = EE::New<NavmeshGenerator>( *m_pToolsContext->m_pTypeRegistry, m_pToolsContext->GetSourceDataDirectory(), triangleCacheDirectoryPath, m_navmeshOutputPath, m_entityCollection, m_buildSettings );
                     m_pGenerator->GenerateAsync( *ctx.GetSystem<TaskSystem>() );
                 }
                 #endif
@@ -127,11 +127,17 @@ namespace EE::Navmesh
         //-------------------------------------------------------------------------
 
         #if EE_ENABLE_NAVPOWER
-        Navmesh::NavmeshGenerator generator( *m_pTypeRegistry, m_sourceDataDirectoryPath, updatePregeneratedNavmesh ? ctx.m_inputFilePath : ctx.m_outputFilePath, serializedMap, buildSettings );
+        FileSystem::Path const triangleCacheDirectoryPath = m_compiledResourceDirectoryPath.GetAppended( "NavmeshTriangleCache", true );
+        Navmesh::NavmeshGenerator generator( *m_pTypeRegistry, m_sourceDataDirectoryPath, triangleCacheDirectoryPath, updatePregeneratedNavmesh ? ctx.m_inputFilePath : ctx.m_outputFilePath, serializedMap, buildSettings );
 
         {
             ScopedTimer<PlatformClock> timer( elapsedTime );
-            generator.GenerateSync();
+
+            // The compiler runs standalone, so spin up some workers to collect the collision triangles in parallel
+            TaskSystem taskSystem( Math::Max( 1, Threading::GetProcessorInfo().m_numPhysicalCores - 1 ) );
+            taskSystem.Initialize();
+            generator.GenerateSync( &taskSystem );
+            taskSystem.Shutdown();
         }
 
         Message( "Navmesh built in: %.2fms", elapsedTime.ToFloat() );
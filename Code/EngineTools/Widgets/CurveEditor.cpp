@@ -213,11 +213,20 @@ namespace EE
         int32_t const numPointsToDraw = Math::RoundToInt( m_curveCanvasWidth / 2 ) + 1;
         float const stepT = m_horizontalRangeLength / ( numPointsToDraw - 1 );
 
+        TVector<float> curveParameters;
+        TVector<float> curveValues;
+        curveParameters.resize( numPointsToDraw );
+        curveValues.resize( numPointsToDraw );
+        for ( auto i = 0; i < numPointsToDraw; i++ )
+        {
+            curveParameters[i] = m_horizontalViewRange.m_begin + ( i * stepT );
+        }
+        m_curve.Evaluate( curveParameters.data(), curveValues.data(), numPointsToDraw );
+
         TVector<ImVec2> curvePoints;
         for ( auto i = 0; i < numPointsToDraw; i++ )
         {
-            float const t = m_horizontalViewRange.m_begin + ( i * stepT );
-            Float2 curvePoint( t, m_curve.Evaluate( t ) );
+            Float2 curvePoint( curveParameters[i], curveValues[i] );
             curvePoint.m_x = m_curveCanvasStart.m_x + ( m_horizontalViewRange.GetPercentageThrough( curvePoint.m_x ) * m_curveCanvasWidth );
             curvePoint.m_y = m_curveCanvasEnd.m_y - ( m_verticalViewRange.GetPercentageThrough( curvePoint.m_y ) * m_curveCanvasHeight );
             curvePoints.emplace_back( curvePoint );
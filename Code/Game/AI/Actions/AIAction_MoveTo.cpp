@@ -3,7 +3,6 @@
 #include "Game/AI/Animation/AIAnimationController.h"
 #include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
 #include "Engine/Physics/Components/Component_PhysicsCharacter.h"
-#include "Engine/Navmesh/NavPower.h"
 #include "Base/Math/Line.h"
 
 //-------------------------------------------------------------------------
@@ -12,11 +11,7 @@ namespace EE::AI
 {
     bool MoveToAction::IsRunning() const
     {
-        #if EE_ENABLE_NAVPOWER
-        return m_path.IsValid();
-        #else
-        return false;
-        #endif
+        return m_pathRequest.IsValid() || m_path.IsValid();
     }
 
     void MoveToAction::Start( BehaviorContext const& ctx, Vector const& goalPosition )
@@ -25,31 +20,80 @@ namespace EE::AI
 
         //-------------------------------------------------------------------------
 
-        #if EE_ENABLE_NAVPOWER
-        auto spaceHandle = ctx.m_pNavmeshSystem->GetSpaceHandle();
+        // Paths are planned asynchronously by the navmesh system, we start moving once the request completes
+        auto& pathService = ctx.m_pNavmeshSystem->GetPathService();
+        pathService.ReleaseRequest( m_pathRequest );
+        m_pathRequest = pathService.RequestPath( ctx.m_pCharacter->GetPosition(), goalPosition );
+        m_repairStartSegmentIdx = InvalidIndex;
 
-        bfx::PathSpec pathSpec;
-        pathSpec.m_snapMode = bfx::SNAP_CLOSEST;
-
-        bfx::PathCreationOptions pathOptions;
-        pathOptions.m_forceFirstPosOntoNavGraph = true;
+        m_path.Clear();
+        m_currentPathSegmentIdx = InvalidIndex;
+    }
 
-        m_path = bfx::CreatePolylinePath( spaceHandle, Navmesh::ToBfx( ctx.m_pCharacter->GetPosition() ), Navmesh::ToBfx( goalPosition ), 0, pathSpec, pathOptions );
-        if ( m_path.IsValid() )
-        {
-            m_currentPathSegmentIdx = 0;
-            m_progressAlongSegment = 0.0f;
-        }
-        else
+    void MoveToAction::UpdateGoal( BehaviorContext const& ctx, Vector const& goalPosition )
+    {
+        if ( !m_path.IsValid() )
         {
-            m_currentPathSegmentIdx = InvalidIndex;
+            Start( ctx, goalPosition );
+            return;
         }
-        #endif
+
+        // Keep following the current path while the repair is in flight
+        auto& pathService = ctx.m_pNavmeshSystem->GetPathService();
+        pathService.ReleaseRequest( m_pathRequest );
+        m_pathRequest = pathService.RequestPathRepair( m_path, m_currentPathSegmentIdx, ctx.m_pCharacter->GetPosition(), goalPosition );
+        m_repairStartSegmentIdx = m_currentPathSegmentIdx;
+    }
+
+    void MoveToAction::Stop( BehaviorContext const& ctx )
+    {
+        ctx.m_pNavmeshSystem->GetPathService().ReleaseRequest( m_pathRequest );
+        m_path.Clear();
+        m_currentPathSegmentIdx = InvalidIndex;
     }
 
     void MoveToAction::Update( BehaviorContext const& ctx )
     {
-        #if EE_ENABLE_NAVPOWER
+        // Check for path request results
+        //-------------------------------------------------------------------------
+
+        if ( m_pathRequest.IsValid() )
+        {
+            auto& pathService = ctx.m_pNavmeshSystem->GetPathService();
+            auto const status = pathService.GetStatus( m_pathRequest );
+            if ( status == Navmesh::PathService::Status::Completed )
+            {
+                // Repaired paths start at the segment we were on when we requested the repair
+                if ( pathService.IsRepair( m_pathRequest ) )
+                {
+                    EE_ASSERT( m_repairStartSegmentIdx != InvalidIndex );
+                    m_path = pathService.GetPath( m_pathRequest );
+                    int32_t const newSegmentIdx = m_currentPathSegmentIdx - m_repairStartSegmentIdx;
+                    if ( newSegmentIdx >= m_path.GetNumSegments() )
+                    {
+                        m_currentPathSegmentIdx = m_path.GetNumSegments() - 1;
+                        m_progressAlongSegment = 0.0f;
+                    }
+                    else
+                    {
+                        m_currentPathSegmentIdx = newSegmentIdx;
+                    }
+                }
+                else
+                {
+                    m_path = pathService.GetPath( m_pathRequest );
+                    m_currentPathSegmentIdx = 0;
+                    m_progressAlongSegment = 0.0f;
+                }
+            }
+
+            if ( status != Navmesh::PathService::Status::Pending )
+            {
+                pathService.ReleaseRequest( m_pathRequest );
+                m_repairStartSegmentIdx = InvalidIndex;
+            }
+        }
+
         if ( !m_path.IsValid() )
         {
             return;
@@ -62,9 +106,8 @@ namespace EE::AI
 
         Vector facingDir = ctx.m_pCharacter->GetForwardVector();
         EE_ASSERT( m_currentPathSegmentIdx != InvalidIndex );
-        bfx::SurfaceSegment const* pCurrentSegment = m_path.GetSurfaceSegment( m_currentPathSegmentIdx );
-        Vector const currentSegmentStartPos = Navmesh::FromBfx( pCurrentSegment->GetStartPos() );
-        Vector const currentSegmentEndPos = Navmesh::FromBfx( pCurrentSegment->GetEndPos() );
+        Vector const& currentSegmentStartPos = m_path.GetSegmentStart( m_currentPathSegmentIdx );
+        Vector const& currentSegmentEndPos = m_path.GetSegmentEnd( m_currentPathSegmentIdx );
 
         Vector currentPosition;
         if ( !currentSegmentStartPos.IsNearEqual3( currentSegmentEndPos ) )
@@ -86,9 +129,8 @@ namespace EE::AI
         {
             bool const isLastSegment = m_currentPathSegmentIdx == ( m_path.GetNumSegments() - 1 );
 
-            bfx::SurfaceSegment const* pSegment = m_path.GetSurfaceSegment( m_currentPathSegmentIdx );
-            Vector segmentStart( Navmesh::FromBfx( pSegment->GetStartPos() ) );
-            Vector segmentEnd( Navmesh::FromBfx( pSegment->GetEndPos() ) );
+            Vector const& segmentStart = m_path.GetSegmentStart( m_currentPathSegmentIdx );
+            Vector const& segmentEnd = m_path.GetSegmentEnd( m_currentPathSegmentIdx );
 
             // Handle zero length segments
             Vector const segmentVector( segmentEnd - segmentStart );
@@ -153,8 +195,7 @@ namespace EE::AI
 
         if ( atEndOfPath )
         {
-            m_path.Release();
+            m_path.Clear();
         }
-        #endif
     }
 }
@@ -1,5 +1,5 @@
 #pragma once
-#include "Engine/Navmesh/NavPower.h"
+#include "Engine/Navmesh/NavmeshPathService.h"
 #include "Base/Math/Vector.h"
 #include "Base/Types/Percentage.h"
 
@@ -19,14 +19,17 @@ namespace EE::AI
         bool IsRunning() const;
         void Start( BehaviorContext const& ctx, Vector const& goalPosition );
         void Update( BehaviorContext const& ctx );
+        void Stop( BehaviorContext const& ctx );
 
-    private:
+        // Update the goal of a running move (e.g. when following a moving target), the current path is repaired rather than replanned
+        void UpdateGoal( BehaviorContext const& ctx, Vector const& goalPosition );
 
-        #if EE_ENABLE_NAVPOWER
-        bfx::PolylinePathRCPtr      m_path;
-        #endif
+    private:
 
-        int32_t                       m_currentPathSegmentIdx = InvalidIndex;
-        Percentage                  m_progressAlongSegment = 0.0f;
+        Navmesh::PathService::RequestHandle     m_pathRequest;
+        Navmesh::Path                           m_path;
+        int32_t                                 m_repairStartSegmentIdx = InvalidIndex;
+        int32_t                                 m_currentPathSegmentIdx = InvalidIndex;
+        Percentage                              m_progressAlongSegment = 0.0f;
     };
 }
\ No newline at end of file
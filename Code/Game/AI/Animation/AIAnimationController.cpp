@@ -20,10 +20,10 @@ namespace EE::AI
     {
         static StringID const characterStates[(uint8_t) CharacterAnimationState::NumStates] =
         {
-            StringID( "Locomotion" ),
-            StringID( "Falling" ),
-            StringID( "Ability" ),
-            StringID( "DebugMode" ),
+            EE_STRING_ID( "Locomotion" ),
+            EE_STRING_ID( "Falling" ),
+            EE_STRING_ID( "Ability" ),
+            EE_STRING_ID( "DebugMode" ),
         };
 
         EE_ASSERT( state < CharacterAnimationState::NumStates );
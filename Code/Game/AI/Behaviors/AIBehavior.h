@@ -55,6 +55,9 @@ namespace EE::AI
         //-------------------------------------------------------------------------
 
         EE_FORCE_INLINE Seconds GetDeltaTime() const { return m_pEntityWorldUpdateContext->GetDeltaTime(); }
+
+        // The time since the last decision update, decisions may be evaluated at a reduced rate so use this for any decision timers
+        EE_FORCE_INLINE Seconds GetDecisionDeltaTime() const { return m_decisionDeltaTime; }
         template<typename T> inline T* GetWorldSystem() const { return m_pEntityWorldUpdateContext->GetWorldSystem<T>(); }
         template<typename T> inline T* GetSystem() const { return m_pEntityWorldUpdateContext->GetSystem<T>(); }
 
@@ -65,6 +68,7 @@ namespace EE::AI
     public:
 
         EntityWorldUpdateContext const*             m_pEntityWorldUpdateContext = nullptr;
+        Seconds                                     m_decisionDeltaTime = 0.0f;
         Physics::PhysicsWorld*                      m_pPhysicsWorld = nullptr;
         Navmesh::NavmeshWorldSystem*                m_pNavmeshSystem = nullptr;
 
@@ -137,13 +141,21 @@ namespace EE::AI
             m_isActive = true;
         }
 
-        // Called to update this action, this will be called directly after the try start if it succeeds
+        // Called to re-evaluate this behavior's decisions, this will be called directly after the try start if it succeeds
+        // Decision updates are scheduled by the AI scheduler and may not run every frame
         inline Status Update( BehaviorContext const& ctx )
         {
             EE_ASSERT( m_isActive );
             return UpdateInternal( ctx );
         }
 
+        // Called every frame to run the behavior's active actions (movement, etc...)
+        inline void UpdateActions( BehaviorContext const& ctx )
+        {
+            EE_ASSERT( m_isActive );
+            UpdateActionsInternal( ctx );
+        }
+
         // Called to stop this action
         inline void Stop( BehaviorContext const& ctx, StopReason reason )
         {
@@ -167,9 +179,12 @@ namespace EE::AI
         // Called to start this action
         virtual void StartInternal( BehaviorContext const& ctx ) = 0;
 
-        // Called to update this action, this will be called directly after the try start if it succeeds
+        // Called to re-evaluate this behavior's decisions, this will be called directly after the try start if it succeeds
         virtual Status UpdateInternal( BehaviorContext const& ctx ) = 0;
 
+        // Called every frame to run the active actions, after the decision update (if there was one)
+        virtual void UpdateActionsInternal( BehaviorContext const& ctx ) = 0;
+
         // Called to stop this action
         virtual void StopInternal( BehaviorContext const& ctx, StopReason reason ) = 0;
 
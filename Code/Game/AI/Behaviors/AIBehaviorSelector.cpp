@@ -46,4 +46,14 @@ namespace EE::AI
             m_pActiveBehavior->Update( m_actionContext );
         }
     }
+
+    void BehaviorSelector::UpdateActions()
+    {
+        EE_ASSERT( m_actionContext.IsValid() );
+
+        if ( m_pActiveBehavior != nullptr )
+        {
+            m_pActiveBehavior->UpdateActions( m_actionContext );
+        }
+    }
 }
\ No newline at end of file
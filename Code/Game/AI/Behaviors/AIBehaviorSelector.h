@@ -42,9 +42,12 @@ namespace EE::AI
         BehaviorSelector( BehaviorContext const& context );
         ~BehaviorSelector();
 
-        // Update the currently active actions
+        // Select and update the active behavior's decisions
         void Update();
 
+        // Run the active behavior's actions - this needs to be called every frame
+        void UpdateActions();
+
     private:
 
         BehaviorContext const&                                    m_actionContext;
@@ -1,5 +1,8 @@
 #include "AIBehavior_CombatPositioning.h"
 #include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
+#include "Engine/Player/Systems/WorldSystem_PlayerManager.h"
+#include "Engine/Camera/Components/Component_Camera.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
 #include "Base/Math/MathRandom.h"
 #include "Base/Math/BoundingVolumes.h"
 
@@ -25,41 +28,120 @@ namespace EE::AI
 
         if ( m_waitTimer.IsRunning() )
         {
-            m_idleAction.Update( ctx );
-
-            // Wait for the timer to elapse and start a move
-            if ( m_waitTimer.Update( ctx.GetDeltaTime() ) )
+            // Wait for the timer to elapse and then look for cover, if there is nothing to hide from just pick a random position
+            if ( m_waitTimer.Update( ctx.GetDecisionDeltaTime() ) )
             {
-                Vector const boundsMin = navmeshBounds.GetMin();
-                Vector const boundsMax = navmeshBounds.GetMax();
-                Vector const moveGoalPosition( Math::GetRandomFloat( boundsMin.GetX(), boundsMax.GetX() ), Math::GetRandomFloat( boundsMin.GetY(), boundsMax.GetY() ), navmeshBounds.GetCenter().GetZ() );
-
-                m_moveToAction.Start( ctx, moveGoalPosition );
+                m_coverQuery = RequestCoverQuery( ctx );
+                if ( !m_coverQuery.IsValid() )
+                {
+                    StartRandomMove( ctx, navmeshBounds );
+                }
             }
         }
-        else // We're moving
+        else if ( !m_coverQuery.IsValid() && !m_moveToAction.IsRunning() ) // If the move completed, restart the wait timer
+        {
+            m_isMovingToCover = false;
+            m_idleAction.Start( ctx );
+            m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
+        }
+        else if ( m_isMovingToCover && m_coverRefreshTimer.IsRunning() ) // The player moves, so periodically check if our cover is still the best one
         {
-            // Wait for the move to complete
-            if ( m_moveToAction.IsRunning() )
+            if ( m_coverRefreshTimer.Update( ctx.GetDecisionDeltaTime() ) && !m_coverQuery.IsValid() )
             {
-                m_moveToAction.Update( ctx );
+                m_coverQuery = RequestCoverQuery( ctx );
             }
+        }
+
+        //-------------------------------------------------------------------------
 
-            // if the move completed, restart the wait timer
-            if ( !m_moveToAction.IsRunning() )
+        return Status::Running;
+    }
+
+    void CombatPositionBehavior::UpdateActionsInternal( BehaviorContext const& ctx )
+    {
+        // Cover query results are only available for a single frame, so we pick them up here rather than in the decision update
+        if ( m_coverQuery.IsValid() )
+        {
+            auto pCoverManager = ctx.GetWorldSystem<CoverManager>();
+            if ( !pCoverManager->IsPending( m_coverQuery ) )
             {
-                m_idleAction.Start( ctx );
-                m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
+                bool const hasCover = pCoverManager->HasResults( m_coverQuery ) && pCoverManager->GetNumResults( m_coverQuery ) > 0;
+                if ( m_isMovingToCover )
+                {
+                    // Only change goal if the best cover actually moved, the path is repaired rather than replanned so we keep moving
+                    // If we already arrived, the result is ignored and the decision update will restart the wait timer
+                    if ( hasCover && m_moveToAction.IsRunning() )
+                    {
+                        Vector const& newCoverPosition = pCoverManager->GetResult( m_coverQuery, 0 ).m_position;
+                        if ( newCoverPosition.GetDistance3( m_coverPosition ) > s_minCoverPositionChange )
+                        {
+                            m_coverPosition = newCoverPosition;
+                            m_moveToAction.UpdateGoal( ctx, m_coverPosition );
+                        }
+                    }
+
+                    m_coverRefreshTimer.Start( s_coverRefreshInterval );
+                }
+                else if ( hasCover )
+                {
+                    m_coverPosition = pCoverManager->GetResult( m_coverQuery, 0 ).m_position;
+                    m_moveToAction.Start( ctx, m_coverPosition );
+                    m_isMovingToCover = true;
+                    m_coverRefreshTimer.Start( s_coverRefreshInterval );
+                }
+                else
+                {
+                    AABB const navmeshBounds = ctx.m_pNavmeshSystem->GetNavmeshBounds( 0 );
+                    StartRandomMove( ctx, navmeshBounds );
+                }
+
+                m_coverQuery = CoverManager::QueryHandle();
             }
         }
 
         //-------------------------------------------------------------------------
 
-        return Status::Running;
+        if ( m_moveToAction.IsRunning() )
+        {
+            m_moveToAction.Update( ctx );
+        }
+        else
+        {
+            m_idleAction.Update( ctx );
+        }
     }
 
     void CombatPositionBehavior::StopInternal( BehaviorContext const& ctx, StopReason reason )
     {
+        m_moveToAction.Stop( ctx );
+        m_coverQuery = CoverManager::QueryHandle();
+        m_isMovingToCover = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CoverManager::QueryHandle CombatPositionBehavior::RequestCoverQuery( BehaviorContext const& ctx ) const
+    {
+        auto pPlayerManager = ctx.GetWorldSystem<PlayerManager>();
+        if ( !pPlayerManager->HasPlayer() )
+        {
+            return CoverManager::QueryHandle();
+        }
+
+        CoverQuery query;
+        query.m_agentPosition = ctx.m_pCharacter->GetPosition();
+        query.m_threatPosition = pPlayerManager->GetPlayerCamera()->GetPosition();
+        query.m_maxResults = 1;
+
+        return ctx.GetWorldSystem<CoverManager>()->RequestQuery( query );
+    }
+
+    void CombatPositionBehavior::StartRandomMove( BehaviorContext const& ctx, AABB const& navmeshBounds )
+    {
+        Vector const boundsMin = navmeshBounds.GetMin();
+        Vector const boundsMax = navmeshBounds.GetMax();
+        Vector const moveGoalPosition( Math::GetRandomFloat( boundsMin.GetX(), boundsMax.GetX() ), Math::GetRandomFloat( boundsMin.GetY(), boundsMax.GetY() ), navmeshBounds.GetCenter().GetZ() );
 
+        m_moveToAction.Start( ctx, moveGoalPosition );
     }
 }
\ No newline at end of file
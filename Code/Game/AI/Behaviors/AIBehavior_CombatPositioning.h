@@ -2,6 +2,11 @@
 #include "AIBehavior.h"
 #include "Game/AI/Actions/AIAction_MoveTo.h"
 #include "Game/AI/Actions/AIAction_Idle.h"
+#include "Game/Cover/Systems/WorldSystem_CoverManager.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { struct AABB; }
 
 //-------------------------------------------------------------------------
 
@@ -17,12 +22,25 @@ namespace EE::AI
 
         virtual void StartInternal( BehaviorContext const& ctx ) override;
         virtual Status UpdateInternal( BehaviorContext const& ctx ) override;
+        virtual void UpdateActionsInternal( BehaviorContext const& ctx ) override;
         virtual void StopInternal( BehaviorContext const& ctx, StopReason reason ) override;
 
+        // Request a query for cover from the player, returns an invalid handle if there is no player to hide from
+        CoverManager::QueryHandle RequestCoverQuery( BehaviorContext const& ctx ) const;
+
+        void StartRandomMove( BehaviorContext const& ctx, AABB const& navmeshBounds );
+
     private:
 
+        constexpr static float const s_coverRefreshInterval = 1.0f;         // How often we look for better cover while moving to cover
+        constexpr static float const s_minCoverPositionChange = 0.5f;       // How far the best cover position needs to move before we change our goal
+
         MoveToAction                m_moveToAction;
         IdleAction                  m_idleAction;
         ManualCountdownTimer        m_waitTimer;
+        CoverManager::QueryHandle   m_coverQuery;
+        ManualCountdownTimer        m_coverRefreshTimer;
+        Vector                      m_coverPosition;
+        bool                        m_isMovingToCover = false;
     };
 }
\ No newline at end of file
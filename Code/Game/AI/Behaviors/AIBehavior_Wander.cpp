@@ -25,10 +25,8 @@ namespace EE::AI
 
         if ( m_waitTimer.IsRunning() )
         {
-            m_idleAction.Update( ctx );
-
             // Wait for the timer to elapse and start a move
-            if ( m_waitTimer.Update( ctx.GetDeltaTime() ) )
+            if ( m_waitTimer.Update( ctx.GetDecisionDeltaTime() ) )
             {
                 Vector const boundsMin = navmeshBounds.GetMin();
                 Vector const boundsMax = navmeshBounds.GetMax();
@@ -37,20 +35,10 @@ namespace EE::AI
                 m_moveToAction.Start( ctx, moveGoalPosition );
             }
         }
-        else // We're moving
+        else if ( !m_moveToAction.IsRunning() ) // If the move completed, restart the wait timer
         {
-            // Wait for the move to complete
-            if ( m_moveToAction.IsRunning() )
-            {
-                m_moveToAction.Update( ctx );
-            }
-
-            // if the move completed, restart the wait timer
-            if ( !m_moveToAction.IsRunning() )
-            {
-                m_idleAction.Start( ctx );
-                m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
-            }
+            m_idleAction.Start( ctx );
+            m_waitTimer.Start( Math::GetRandomFloat( 1.0f, 3.0f ) );
         }
 
         //-------------------------------------------------------------------------
@@ -58,8 +46,20 @@ namespace EE::AI
         return Status::Running;
     }
 
-    void WanderBehavior::StopInternal( BehaviorContext const& ctx, StopReason reason )
+    void WanderBehavior::UpdateActionsInternal( BehaviorContext const& ctx )
     {
+        if ( m_moveToAction.IsRunning() )
+        {
+            m_moveToAction.Update( ctx );
+        }
+        else
+        {
+            m_idleAction.Update( ctx );
+        }
+    }
 
+    void WanderBehavior::StopInternal( BehaviorContext const& ctx, StopReason reason )
+    {
+        m_moveToAction.Stop( ctx );
     }
 }
\ No newline at end of file
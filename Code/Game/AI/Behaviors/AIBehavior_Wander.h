@@ -17,6 +17,7 @@ namespace EE::AI
 
         virtual void StartInternal( BehaviorContext const& ctx ) override;
         virtual Status UpdateInternal( BehaviorContext const& ctx ) override;
+        virtual void UpdateActionsInternal( BehaviorContext const& ctx ) override;
         virtual void StopInternal( BehaviorContext const& ctx, StopReason reason ) override;
 
     private:
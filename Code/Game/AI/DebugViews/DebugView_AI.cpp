@@ -1,5 +1,6 @@
 #include "DebugView_AI.h"
 #include "Engine/AI/Systems/WorldSystem_AIManager.h"
+#include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
 #include "Engine/Entity/EntityWorld.h"
 #include "Engine/Entity/EntitySystem.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
@@ -15,11 +16,15 @@ namespace EE::AI
     {
         DebugView::Initialize( systemRegistry, pWorld );
         m_pAIManager = pWorld->GetWorldSystem<AIManager>();
+        m_pNavmeshSystem = pWorld->GetWorldSystem<Navmesh::NavmeshWorldSystem>();
         m_windows.emplace_back( "AI Overview", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawOverviewWindow( context ); } );
+        m_windows.emplace_back( "Path Service", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawPathServiceWindow( context ); } );
+        m_windows.emplace_back( "AI Scheduler", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawSchedulerWindow( context ); } );
     }
 
     void AIDebugView::Shutdown()
     {
+        m_pNavmeshSystem = nullptr;
         m_pAIManager = nullptr;
         DebugView::Shutdown();
     }
@@ -33,6 +38,16 @@ namespace EE::AI
             m_windows[0].m_isOpen = true;
         }
 
+        if ( ImGui::MenuItem( "Path Service" ) )
+        {
+            m_windows[1].m_isOpen = true;
+        }
+
+        if ( ImGui::MenuItem( "AI Scheduler" ) )
+        {
+            m_windows[2].m_isOpen = true;
+        }
+
         //-------------------------------------------------------------------------
 
         if ( ImGui::Button( "Hack Spawn 5" ) )
@@ -55,5 +70,126 @@ namespace EE::AI
     {
         ImGui::Text( "Num AI: %u", m_pAIManager->m_AIs.size() );
     }
+
+    void AIDebugView::DrawPathServiceWindow( EntityWorldUpdateContext const& context )
+    {
+        auto& pathService = m_pNavmeshSystem->GetPathService();
+        auto const& stats = pathService.GetStats();
+
+        ImGui::Text( "Pending Requests: %d", pathService.GetNumPendingRequests() );
+        ImGui::Text( "Cached Paths: %d", pathService.GetNumCachedPaths() );
+
+        ImGui::Separator();
+
+        ImGui::Text( "Requests: %u", stats.m_numRequests );
+        ImGui::Text( "Cache Hits: %u (%.2f%%)", stats.m_numCacheHits, stats.GetCacheHitRate() * 100.0f );
+        ImGui::Text( "Cached Path End Replanning: %.2fms", stats.m_totalCachedPathReplanTime.ToFloat() );
+        ImGui::Text( "Merged Requests: %u", stats.m_numMergedRequests );
+        ImGui::Text( "Full Plans: %u (avg %.3fms)", stats.m_numFullPlans, stats.GetAverageFullPlanTime().ToFloat() );
+        ImGui::Text( "Tail Repairs: %u (avg %.3fms)", stats.m_numTailPlans, stats.GetAverageTailPlanTime().ToFloat() );
+        ImGui::Text( "Estimated Planner Time Saved: %.2fms", stats.GetEstimatedPlannerTimeSaved().ToFloat() );
+
+        if ( ImGui::Button( "Reset Stats" ) )
+        {
+            pathService.ResetStats();
+        }
+
+        ImGui::SameLine();
+
+        if ( ImGui::Button( "Clear Cache" ) )
+        {
+            pathService.ClearCache();
+        }
+
+        // Load Test
+        //-------------------------------------------------------------------------
+
+        ImGui::Separator();
+
+        if ( pathService.IsLoadTestRunning() )
+        {
+            auto const& loadTestStats = pathService.GetLoadTestStats();
+            ImGui::Text( "Load Test Agents: %d", pathService.GetNumLoadTestAgents() );
+            ImGui::Text( "Completed: %u, Failed: %u, Dropped: %u", loadTestStats.m_numCompletedPaths, loadTestStats.m_numFailedPaths, loadTestStats.m_numDroppedRequests );
+            ImGui::Text( "Latency: avg %.2f frames, max %u frames", loadTestStats.GetAverageLatencyFrames(), loadTestStats.m_maxLatencyFrames );
+            ImGui::Text( "Max Pending Requests: %d", loadTestStats.m_maxPendingRequests );
+
+            if ( ImGui::Button( "Stop Load Test" ) )
+            {
+                pathService.StopLoadTest();
+            }
+        }
+        else
+        {
+            AABB const navmeshBounds = m_pNavmeshSystem->GetNavmeshBounds( 0 );
+            ImGui::BeginDisabled( !navmeshBounds.IsValid() );
+            if ( ImGui::Button( "Start Load Test (500 Agents)" ) )
+            {
+                pathService.StartLoadTest( 500, navmeshBounds );
+            }
+            ImGui::EndDisabled();
+        }
+    }
+
+    void AIDebugView::DrawSchedulerWindow( EntityWorldUpdateContext const& context )
+    {
+        auto& scheduler = m_pAIManager->GetScheduler();
+        auto const& stats = scheduler.GetStats();
+
+        float budget = scheduler.GetFrameBudget().ToFloat();
+        if ( ImGui::SliderFloat( "Frame Budget (ms)", &budget, 0.1f, 5.0f ) )
+        {
+            scheduler.SetFrameBudget( budget );
+        }
+
+        ImGui::Text( "Last Frame Decision Time: %.3fms", stats.m_lastFrameDecisionTime.ToFloat() );
+        ImGui::Text( "Frames Over Budget: %u / %u (%.2f%%)", stats.m_numOverrunFrames, stats.m_numFrames, stats.GetOverrunRate() * 100.0f );
+        ImGui::Text( "Max Overrun: %.3fms", stats.m_maxOverrun.ToFloat() );
+
+        ImGui::Separator();
+
+        char const* const tierNames[] = { "High", "Medium", "Low", "Minimal" };
+        static_assert( sizeof( tierNames ) / sizeof( tierNames[0] ) == (int32_t) Scheduler::Tier::NumTiers );
+        for ( int32_t i = 0; i < (int32_t) Scheduler::Tier::NumTiers; i++ )
+        {
+            auto const& tierSettings = scheduler.GetTierSettings( (Scheduler::Tier) i );
+            ImGui::Text( "%s: %d AI (every %u frames)", tierNames[i], stats.m_numAIsPerTier[i], tierSettings.m_decisionInterval );
+        }
+
+        ImGui::Separator();
+
+        if ( ImGui::BeginTable( "Buckets", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg ) )
+        {
+            ImGui::TableSetupColumn( "Bucket" );
+            ImGui::TableSetupColumn( "Num AI" );
+            ImGui::TableSetupColumn( "Evaluations" );
+            ImGui::TableSetupColumn( "Deferred" );
+            ImGui::TableSetupColumn( "Avg Time (ms)" );
+            ImGui::TableHeadersRow();
+
+            for ( int32_t i = 0; i < Scheduler::s_numBuckets; i++ )
+            {
+                auto const& bucketStats = stats.m_buckets[i];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", i );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", bucketStats.m_numAIs );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%u", bucketStats.m_numEvaluations );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%u", bucketStats.m_numDeferred );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", bucketStats.GetAverageDecisionTime().ToFloat() );
+            }
+
+            ImGui::EndTable();
+        }
+
+        if ( ImGui::Button( "Reset Stats" ) )
+        {
+            scheduler.ResetStats();
+        }
+    }
 }
 #endif
\ No newline at end of file
@@ -5,6 +5,10 @@
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
+namespace EE::Navmesh { class NavmeshWorldSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::AI
 {
     class AIManager;
@@ -26,10 +30,13 @@ namespace EE::AI
         virtual void DrawMenu( EntityWorldUpdateContext const& context ) override;
 
         void DrawOverviewWindow( EntityWorldUpdateContext const& context );
+        void DrawPathServiceWindow( EntityWorldUpdateContext const& context );
+        void DrawSchedulerWindow( EntityWorldUpdateContext const& context );
 
     private:
 
         AIManager*                      m_pAIManager = nullptr;
+        Navmesh::NavmeshWorldSystem*    m_pNavmeshSystem = nullptr;
     };
 }
 #endif
\ No newline at end of file
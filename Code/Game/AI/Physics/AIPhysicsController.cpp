@@ -69,7 +69,8 @@ namespace EE::AI
 
         //-------------------------------------------------------------------------
 
-        m_pCharacterComponent->MoveCharacter( ctx.GetDeltaTime(), deltaRotation, deltaTranslation );
+        // AI dont need the results of the move this frame, so let the physics world system resolve it with all other AI moves
+        m_pCharacterComponent->RequestMove( ctx.GetDeltaTime(), deltaRotation, deltaTranslation );
         return true;
     }
 }
\ No newline at end of file
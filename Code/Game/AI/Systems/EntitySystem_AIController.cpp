@@ -2,12 +2,14 @@
 #include "Game/AI/Physics/AIPhysicsController.h"
 #include "Game/AI/Animation/AIAnimationController.h"
 #include "Engine/AI/Components/Component_AI.h"
+#include "Engine/AI/Systems/WorldSystem_AIManager.h"
 #include "Engine/Navmesh/NavPower.h"
 #include "Engine/Navmesh/Systems/WorldSystem_Navmesh.h"
 #include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Physics/Components/Component_PhysicsCharacter.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Base/Types/ScopedValue.h"
+#include "Base/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 
@@ -128,7 +130,25 @@ namespace EE::AI
         UpdateStage const updateStage = ctx.GetUpdateStage();
         if ( updateStage == UpdateStage::PrePhysics )
         {
-            m_behaviorSelector.Update();
+            // Decisions are only re-evaluated when the scheduler allows it, actions always run
+            m_timeSinceLastDecisionUpdate += ctx.GetDeltaTime();
+
+            auto& scheduler = ctx.GetWorldSystem<AIManager>()->GetScheduler();
+            if ( scheduler.TryBeginDecisionUpdate( m_behaviorContext.m_pAIComponent ) )
+            {
+                TScopedGuardValue const decisionDeltaTimeGuard( m_behaviorContext.m_decisionDeltaTime, m_timeSinceLastDecisionUpdate );
+
+                Milliseconds decisionTime = 0.0f;
+                {
+                    ScopedTimer<PlatformClock> timer( decisionTime );
+                    m_behaviorSelector.Update();
+                }
+
+                scheduler.EndDecisionUpdate( m_behaviorContext.m_pAIComponent, decisionTime );
+                m_timeSinceLastDecisionUpdate = 0.0f;
+            }
+
+            m_behaviorSelector.UpdateActions();
 
             // Update animation and get root motion delta (remember that root motion is in character space, so we need to convert the displacement to world space)
             m_pAnimGraphComponent->EvaluateGraph( ctx.GetDeltaTime(), m_pCharacterMeshComponent->GetWorldTransform(), m_behaviorContext.m_pPhysicsWorld );
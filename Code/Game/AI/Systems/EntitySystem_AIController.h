@@ -35,5 +35,6 @@ namespace EE::AI
 
         Animation::GraphComponent*                              m_pAnimGraphComponent = nullptr;
         Render::CharacterMeshComponent*                         m_pCharacterMeshComponent = nullptr;
+        Seconds                                                 m_timeSinceLastDecisionUpdate = 0.0f;
     };
 }
\ No newline at end of file
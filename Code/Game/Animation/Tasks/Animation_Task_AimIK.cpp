@@ -31,8 +31,8 @@ namespace EE::Animation::Tasks
         // Do IK
         //-------------------------------------------------------------------------
 
-        int32_t tipIdx = pPose->GetSkeleton()->GetBoneIndex( StringID( "weaponTip" ) );
-        int32_t buttIdx = pPose->GetSkeleton()->GetBoneIndex( StringID( "weaponEnd" ) );
+        int32_t tipIdx = pPose->GetSkeleton()->GetBoneIndex( EE_STRING_ID( "weaponTip" ) );
+        int32_t buttIdx = pPose->GetSkeleton()->GetBoneIndex( EE_STRING_ID( "weaponEnd" ) );
 
         if ( tipIdx != InvalidIndex && buttIdx != InvalidIndex )
         {
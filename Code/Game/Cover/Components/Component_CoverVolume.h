@@ -32,6 +32,8 @@ namespace EE
         inline CoverVolumeComponent() = default;
         inline CoverVolumeComponent( StringID name ) : BoxVolumeComponent( name ) {}
 
+        inline CoverType GetCoverType() const { return m_coverType; }
+
         #if EE_DEVELOPMENT_TOOLS
         virtual Color GetVolumeColor() const override { return Colors::GreenYellow; }
         virtual void Draw( Drawing::DrawContext& drawingCtx ) const override;
@@ -0,0 +1,292 @@
+#include "CoverDatabase.h"
+#include "Base/Math/Math.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    void CoverDatabase::Clear()
+    {
+        m_points.clear();
+        m_positionsX.clear();
+        m_positionsY.clear();
+        m_positionsZ.clear();
+        m_forwardsX.clear();
+        m_forwardsY.clear();
+        m_cellOffsets.clear();
+        m_gridDimensionX = m_gridDimensionY = 0;
+        m_isBuilt = false;
+    }
+
+    void CoverDatabase::AddCoverVolume( CoverVolumeComponent const* pVolume )
+    {
+        EE_ASSERT( pVolume != nullptr );
+
+        Transform const& WT = pVolume->GetWorldTransform();
+        Float3 const volumeExtents = pVolume->GetVolumeLocalExtents();
+
+        Vector const forward = WT.GetForwardVector();
+        Vector const flatForward = Vector( forward.GetX(), forward.GetY(), 0.0f, 0.0f ).GetNormalized2();
+        if ( flatForward.IsNearZero3() )
+        {
+            return;
+        }
+
+        Vector const right = WT.GetRightVector();
+        Vector const floorCenter = WT.GetTranslation() - WT.GetUpVector() * volumeExtents.m_z;
+
+        // Sample the center and then outwards at regular intervals (matching the debug drawing)
+        auto AddPoint = [&] ( Vector const& position )
+        {
+            CoverPoint& point = m_points.emplace_back();
+            point.m_position = position;
+            point.m_forward = flatForward;
+            point.m_volumeID = pVolume->GetID();
+            point.m_type = pVolume->GetCoverType();
+        };
+
+        AddPoint( floorCenter );
+
+        for ( float horizontalOffset = s_pointSpacing; horizontalOffset <= volumeExtents.m_x; horizontalOffset += s_pointSpacing )
+        {
+            Vector const rightOffset = right * horizontalOffset;
+            AddPoint( floorCenter + rightOffset );
+            AddPoint( floorCenter - rightOffset );
+        }
+
+        m_isBuilt = false;
+    }
+
+    void CoverDatabase::Build()
+    {
+        EE_PROFILE_FUNCTION_AI();
+
+        m_positionsX.clear();
+        m_positionsY.clear();
+        m_positionsZ.clear();
+        m_forwardsX.clear();
+        m_forwardsY.clear();
+        m_cellOffsets.clear();
+        m_gridDimensionX = m_gridDimensionY = 0;
+        m_isBuilt = true;
+
+        if ( m_points.empty() )
+        {
+            return;
+        }
+
+        // Calculate grid dimensions
+        //-------------------------------------------------------------------------
+
+        float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+        for ( CoverPoint const& point : m_points )
+        {
+            minX = Math::Min( minX, point.m_position.GetX() );
+            minY = Math::Min( minY, point.m_position.GetY() );
+            maxX = Math::Max( maxX, point.m_position.GetX() );
+            maxY = Math::Max( maxY, point.m_position.GetY() );
+        }
+
+        // Grow the cells for very large worlds to keep the grid size reasonable
+        float const maxExtent = Math::Max( maxX - minX, maxY - minY );
+        m_cellSize = Math::Max( s_minCellSize, maxExtent / ( s_maxGridDimension - 1 ) );
+        m_gridOriginX = minX;
+        m_gridOriginY = minY;
+        m_gridDimensionX = Math::FloorToInt( ( maxX - minX ) / m_cellSize ) + 1;
+        m_gridDimensionY = Math::FloorToInt( ( maxY - minY ) / m_cellSize ) + 1;
+
+        // Counting sort the points by cell
+        //-------------------------------------------------------------------------
+
+        int32_t const numPoints = (int32_t) m_points.size();
+        int32_t const numCells = m_gridDimensionX * m_gridDimensionY;
+
+        TVector<int32_t> pointCells( numPoints );
+        m_cellOffsets.resize( numCells + 1, 0 );
+
+        for ( int32_t i = 0; i < numPoints; i++ )
+        {
+            int32_t const cellX = Math::Clamp( Math::FloorToInt( ( m_points[i].m_position.GetX() - m_gridOriginX ) / m_cellSize ), 0, m_gridDimensionX - 1 );
+            int32_t const cellY = Math::Clamp( Math::FloorToInt( ( m_points[i].m_position.GetY() - m_gridOriginY ) / m_cellSize ), 0, m_gridDimensionY - 1 );
+            pointCells[i] = cellY * m_gridDimensionX + cellX;
+            m_cellOffsets[pointCells[i] + 1]++;
+        }
+
+        for ( int32_t i = 0; i < numCells; i++ )
+        {
+            m_cellOffsets[i + 1] += m_cellOffsets[i];
+        }
+
+        TVector<int32_t> writeOffsets( m_cellOffsets.begin(), m_cellOffsets.end() - 1 );
+        TVector<CoverPoint> sortedPoints( numPoints );
+        for ( int32_t i = 0; i < numPoints; i++ )
+        {
+            sortedPoints[writeOffsets[pointCells[i]]++] = m_points[i];
+        }
+
+        m_points.swap( sortedPoints );
+
+        // Create SoA data
+        //-------------------------------------------------------------------------
+        // Pad the arrays so that the scoring kernel can always load four points
+
+        int32_t const paddedNumPoints = numPoints + 3;
+        m_positionsX.resize( paddedNumPoints, 0.0f );
+        m_positionsY.resize( paddedNumPoints, 0.0f );
+        m_positionsZ.resize( paddedNumPoints, 0.0f );
+        m_forwardsX.resize( paddedNumPoints, 0.0f );
+        m_forwardsY.resize( paddedNumPoints, 0.0f );
+
+        for ( int32_t i = 0; i < numPoints; i++ )
+        {
+            m_positionsX[i] = m_points[i].m_position.GetX();
+            m_positionsY[i] = m_points[i].m_position.GetY();
+            m_positionsZ[i] = m_points[i].m_position.GetZ();
+            m_forwardsX[i] = m_points[i].m_forward.GetX();
+            m_forwardsY[i] = m_points[i].m_forward.GetY();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t CoverDatabase::FindBestCoverPoints( CoverQuery const& query, ScoredCoverPoint* pOutResults, int32_t maxResults ) const
+    {
+        EE_ASSERT( m_isBuilt );
+        EE_ASSERT( pOutResults != nullptr && maxResults >= 0 );
+        EE_ASSERT( query.m_searchRadius > 0.0f && query.m_minThreatDistance <= query.m_maxThreatDistance );
+
+        if ( m_points.empty() || maxResults == 0 )
+        {
+            return 0;
+        }
+
+        // Get the overlapped cells
+        //-------------------------------------------------------------------------
+
+        float const agentX = query.m_agentPosition.GetX();
+        float const agentY = query.m_agentPosition.GetY();
+        int32_t const minCellX = Math::Max( Math::FloorToInt( ( agentX - query.m_searchRadius - m_gridOriginX ) / m_cellSize ), 0 );
+        int32_t const minCellY = Math::Max( Math::FloorToInt( ( agentY - query.m_searchRadius - m_gridOriginY ) / m_cellSize ), 0 );
+        int32_t const maxCellX = Math::Min( Math::FloorToInt( ( agentX + query.m_searchRadius - m_gridOriginX ) / m_cellSize ), m_gridDimensionX - 1 );
+        int32_t const maxCellY = Math::Min( Math::FloorToInt( ( agentY + query.m_searchRadius - m_gridOriginY ) / m_cellSize ), m_gridDimensionY - 1 );
+
+        if ( minCellX > maxCellX || minCellY > maxCellY )
+        {
+            return 0;
+        }
+
+        // Keep the best results sorted by descending score
+        //-------------------------------------------------------------------------
+
+        int32_t numResults = 0;
+
+        auto InsertResult = [&] ( int32_t pointIdx, float score )
+        {
+            if ( numResults == maxResults )
+            {
+                if ( score <= pOutResults[numResults - 1].m_score )
+                {
+                    return;
+                }
+            }
+            else
+            {
+                numResults++;
+            }
+
+            // If we are full, the last result is dropped
+            int32_t insertIdx = numResults - 1;
+            while ( insertIdx > 0 && pOutResults[insertIdx - 1].m_score < score )
+            {
+                pOutResults[insertIdx] = pOutResults[insertIdx - 1];
+                insertIdx--;
+            }
+
+            pOutResults[insertIdx].m_pointIdx = pointIdx;
+            pOutResults[insertIdx].m_score = score;
+        };
+
+        // Score points, four at a time
+        //-------------------------------------------------------------------------
+
+        Vector const agentPosX( agentX );
+        Vector const agentPosY( agentY );
+        Vector const agentPosZ( query.m_agentPosition.GetZ() );
+        Vector const threatPosX( query.m_threatPosition.GetX() );
+        Vector const threatPosY( query.m_threatPosition.GetY() );
+        Vector const threatPosZ( query.m_threatPosition.GetZ() );
+        Vector const searchRadiusSq( Math::Sqr( query.m_searchRadius ) );
+        Vector const minThreatDistanceSq( Math::Sqr( query.m_minThreatDistance ) );
+        Vector const maxThreatDistanceSq( Math::Sqr( query.m_maxThreatDistance ) );
+        Vector const minThreatFacing( query.m_minThreatFacing );
+        Vector const distanceWeight( query.m_agentDistanceWeight / query.m_searchRadius );
+        Vector const facingWeight( query.m_threatFacingWeight );
+        Vector const minDistanceSq( Math::Epsilon );
+
+        alignas( 16 ) float scores[4];
+
+        for ( int32_t cellY = minCellY; cellY <= maxCellY; cellY++ )
+        {
+            // Cells are stored row by row, so the points for the whole row range are contiguous
+            int32_t const rowStartCellIdx = cellY * m_gridDimensionX;
+            int32_t const rangeStart = m_cellOffsets[rowStartCellIdx + minCellX];
+            int32_t const rangeEnd = m_cellOffsets[rowStartCellIdx + maxCellX + 1];
+
+            for ( int32_t i = rangeStart; i < rangeEnd; i += 4 )
+            {
+                Vector const pointX( &m_positionsX[i] );
+                Vector const pointY( &m_positionsY[i] );
+                Vector const pointZ( &m_positionsZ[i] );
+                Vector const forwardX( &m_forwardsX[i] );
+                Vector const forwardY( &m_forwardsY[i] );
+
+                // Distance to agent
+                Vector const agentDeltaX = pointX - agentPosX;
+                Vector const agentDeltaY = pointY - agentPosY;
+                Vector const agentDeltaZ = pointZ - agentPosZ;
+                Vector agentDistanceSq = agentDeltaX * agentDeltaX + agentDeltaY * agentDeltaY + agentDeltaZ * agentDeltaZ;
+
+                // Distance and direction to threat
+                Vector const threatDeltaX = threatPosX - pointX;
+                Vector const threatDeltaY = threatPosY - pointY;
+                Vector const threatDeltaZ = threatPosZ - pointZ;
+                Vector const threatDistanceSq2D = Vector::Max( threatDeltaX * threatDeltaX + threatDeltaY * threatDeltaY, minDistanceSq );
+                Vector const threatDistanceSq = threatDistanceSq2D + threatDeltaZ * threatDeltaZ;
+                Vector const threatFacing = ( forwardX * threatDeltaX + forwardY * threatDeltaY ) * Vector( _mm_div_ps( Vector::One, _mm_sqrt_ps( threatDistanceSq2D ) ) );
+
+                // Filter
+                __m128 validMask = agentDistanceSq.LessThanEqual( searchRadiusSq );
+                validMask = _mm_and_ps( validMask, threatDistanceSq.GreaterThanEqual( minThreatDistanceSq ) );
+                validMask = _mm_and_ps( validMask, threatDistanceSq.LessThanEqual( maxThreatDistanceSq ) );
+                validMask = _mm_and_ps( validMask, threatFacing.GreaterThanEqual( minThreatFacing ) );
+
+                int32_t validLanes = _mm_movemask_ps( validMask );
+                int32_t const numRemaining = rangeEnd - i;
+                if ( numRemaining < 4 )
+                {
+                    validLanes &= ( 1 << numRemaining ) - 1;
+                }
+
+                if ( validLanes == 0 )
+                {
+                    continue;
+                }
+
+                // Score
+                Vector const score = threatFacing * facingWeight - agentDistanceSq.GetSqrt() * distanceWeight;
+                score.Store( scores );
+
+                for ( int32_t lane = 0; lane < 4; lane++ )
+                {
+                    if ( validLanes & ( 1 << lane ) )
+                    {
+                        InsertResult( i + lane, scores[lane] );
+                    }
+                }
+            }
+        }
+
+        return numResults;
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Game/_Module/API.h"
+#include "Game/Cover/Components/Component_CoverVolume.h"
+#include "Base/Math/Vector.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    //-------------------------------------------------------------------------
+    // Cover Query
+    //-------------------------------------------------------------------------
+
+    struct CoverQuery
+    {
+        Vector                                  m_agentPosition = Vector::Zero;
+        Vector                                  m_threatPosition = Vector::Zero;
+        float                                   m_searchRadius = 10.0f;         // Only points within this distance of the agent are considered
+        float                                   m_minThreatDistance = 3.0f;
+        float                                   m_maxThreatDistance = 40.0f;
+        float                                   m_minThreatFacing = 0.5f;       // The min cosine of the angle between the cover direction and the direction to the threat
+        float                                   m_agentDistanceWeight = 1.0f;   // Score penalty for a point at the edge of the search radius
+        float                                   m_threatFacingWeight = 1.0f;    // Score bonus for a point directly facing the threat
+        int32_t                                 m_maxResults = 4;
+        bool                                    m_checkLineOfSight = true;      // Only used for async queries
+    };
+
+    struct ScoredCoverPoint
+    {
+        int32_t                                 m_pointIdx = InvalidIndex;
+        float                                   m_score = 0.0f;
+    };
+
+    //-------------------------------------------------------------------------
+    // Cover Database
+    //-------------------------------------------------------------------------
+    // Cover points are sampled at regular intervals across the width of each cover volume, on the volume's floor
+    // The points are stored as SoA arrays sorted by the cell of a uniform 2D grid, so a radius query only needs to
+    // visit the contiguous point range of each overlapped row of cells and can score four points at a time
+
+    class EE_GAME_API CoverDatabase
+    {
+    public:
+
+        constexpr static float const s_pointSpacing = 1.0f;
+        constexpr static float const s_minCellSize = 8.0f;
+        constexpr static int32_t const s_maxGridDimension = 1024;
+
+        struct CoverPoint
+        {
+            Vector                              m_position;
+            Vector                              m_forward;                      // The direction the cover protects against
+            ComponentID                         m_volumeID;
+            CoverType                           m_type;
+        };
+
+    public:
+
+        // Remove all points, the database needs to be rebuilt after this
+        void Clear();
+
+        // Sample the cover points of a volume, the database needs to be rebuilt once all volumes have been added
+        void AddCoverVolume( CoverVolumeComponent const* pVolume );
+
+        // Sort all the added points into the grid, needs to be called before querying
+        void Build();
+
+        inline int32_t GetNumPoints() const { return (int32_t) m_points.size(); }
+        inline int32_t GetNumCells() const { return m_gridDimensionX * m_gridDimensionY; }
+        inline float GetCellSize() const { return m_cellSize; }
+        inline CoverPoint const& GetPoint( int32_t pointIdx ) const { EE_ASSERT( pointIdx >= 0 && pointIdx < m_points.size() ); return m_points[pointIdx]; }
+
+        // Find the highest scoring points for a query, the results are sorted by descending score
+        // Returns the number of results written, this is threadsafe as long as the database isn't being modified
+        int32_t FindBestCoverPoints( CoverQuery const& query, ScoredCoverPoint* pOutResults, int32_t maxResults ) const;
+
+        inline int32_t FindBestCoverPoints( CoverQuery const& query, TVector<ScoredCoverPoint>& outResults ) const
+        {
+            outResults.resize( query.m_maxResults );
+            outResults.resize( FindBestCoverPoints( query, outResults.data(), query.m_maxResults ) );
+            return (int32_t) outResults.size();
+        }
+
+    private:
+
+        TVector<CoverPoint>                     m_points;                       // Sorted by cell once built
+        TVector<float>                          m_positionsX;                   // SoA copies of the sorted points used for scoring
+        TVector<float>                          m_positionsY;
+        TVector<float>                          m_positionsZ;
+        TVector<float>                          m_forwardsX;
+        TVector<float>                          m_forwardsY;
+        TVector<int32_t>                        m_cellOffsets;                  // The first point for each cell, with a trailing entry for the end
+        float                                   m_gridOriginX = 0.0f;
+        float                                   m_gridOriginY = 0.0f;
+        float                                   m_cellSize = s_minCellSize;
+        int32_t                                 m_gridDimensionX = 0;
+        int32_t                                 m_gridDimensionY = 0;
+        bool                                    m_isBuilt = false;
+    };
+}
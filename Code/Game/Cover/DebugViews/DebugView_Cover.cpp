@@ -25,7 +25,12 @@ namespace EE
 
     void CoverDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
-       
+        CoverDatabase const& database = m_pCoverManager->GetDatabase();
+        ImGui::Text( "Num Cover Volumes: %u", m_pCoverManager->m_coverVolumes.size() );
+        ImGui::Text( "Num Cover Points: %d", database.GetNumPoints() );
+        ImGui::Text( "Num Grid Cells: %d (%.2fm)", database.GetNumCells(), database.GetCellSize() );
+        ImGui::Text( "Num Queries Last Update: %u", m_pCoverManager->m_processedQueries.size() );
+        ImGui::Text( "Num Line Of Sight Checks Last Update: %d", m_pCoverManager->m_lineOfSightBatch.GetNumQueries() );
     }
 }
 #endif
\ No newline at end of file
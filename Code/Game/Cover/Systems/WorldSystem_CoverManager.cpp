@@ -1,16 +1,34 @@
 #include "WorldSystem_CoverManager.h"
 #include "Game/Cover/Components/Component_CoverVolume.h"
+#include "Engine/Physics/Systems/WorldSystem_Physics.h"
+#include "Engine/Physics/PhysicsWorld.h"
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityMap.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Profiling.h"
+#include "Base/Systems.h"
+#include "Base/Memory/MemoryTags.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    void CoverManager::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+    }
+
     void CoverManager::ShutdownSystem()
     {
         EE_ASSERT( m_coverVolumes.empty() );
+        m_database.Clear();
+        m_pendingQueries.clear();
+        m_processedQueries.clear();
+        m_candidates.clear();
+        m_lineOfSightQueries.clear();
+        m_lineOfSightBatch.Reset();
+        m_pTaskSystem = nullptr;
     }
 
     void CoverManager::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -18,6 +36,7 @@ namespace EE
         if ( auto pCoverComponent = TryCast<CoverVolumeComponent>( pComponent ) )
         {
             m_coverVolumes.Add( pCoverComponent );
+            m_isDatabaseDirty = true;
         }
     }
 
@@ -26,6 +45,7 @@ namespace EE
         if ( auto pCoverComponent = TryCast<CoverVolumeComponent>( pComponent ) )
         {
             m_coverVolumes.Remove( pCoverComponent->GetID() );
+            m_isDatabaseDirty = true;
         }
     }
 
@@ -33,5 +53,164 @@ namespace EE
 
     void CoverManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( AI );
+        EE_PROFILE_FUNCTION_AI();
+
+        // Cover volumes are static so we only need to rebuild when volumes are added or removed
+        // This happens after the entity updates, so any point indices returned this frame remain valid until the next update
+        if ( m_isDatabaseDirty )
+        {
+            RebuildDatabase();
+        }
+
+        ProcessQueries( ctx );
+    }
+
+    void CoverManager::RebuildDatabase()
+    {
+        m_database.Clear();
+
+        for ( CoverVolumeComponent const* pCoverVolume : m_coverVolumes )
+        {
+            m_database.AddCoverVolume( pCoverVolume );
+        }
+
+        m_database.Build();
+        m_isDatabaseDirty = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CoverManager::QueryHandle CoverManager::RequestQuery( CoverQuery const& query )
+    {
+        EE_ASSERT( query.m_maxResults > 0 && query.m_maxResults <= s_maxQueryResults );
+
+        Threading::ScopeLock const lock( m_mutex );
+
+        QueryHandle handle;
+        handle.m_queryIdx = (int32_t) m_pendingQueries.size();
+        handle.m_processIdx = m_processIdx;
+        m_pendingQueries.emplace_back( query );
+        return handle;
+    }
+
+    void CoverManager::ProcessQueries( EntityWorldUpdateContext const& ctx )
+    {
+        m_processedQueries.clear();
+        m_candidates.clear();
+        m_lineOfSightQueries.clear();
+        m_lineOfSightBatch.Reset();
+
+        // Allocate the candidate slots for each query
+        //-------------------------------------------------------------------------
+
+        int32_t numCandidates = 0;
+        for ( CoverQuery const& query : m_pendingQueries )
+        {
+            ProcessedQuery& processedQuery = m_processedQueries.emplace_back();
+            processedQuery.m_query = query;
+            processedQuery.m_firstCandidateIdx = numCandidates;
+            processedQuery.m_maxCandidates = query.m_checkLineOfSight ? query.m_maxResults * s_lineOfSightCandidatesPerResult : query.m_maxResults;
+            numCandidates += processedQuery.m_maxCandidates;
+        }
+
+        m_pendingQueries.clear();
+        m_processIdx++;
+
+        if ( m_processedQueries.empty() )
+        {
+            return;
+        }
+
+        m_candidates.resize( numCandidates );
+
+        // Score all queries
+        //-------------------------------------------------------------------------
+        // Each query writes into its own candidate range so we can spread them across the workers
+
+        {
+            EE_PROFILE_SCOPE_AI( "Score Cover Queries" );
+
+            struct ScoreQueriesTask : public ITaskSet
+            {
+                ScoreQueriesTask( CoverManager* pManager ) : ITaskSet( (uint32_t) pManager->m_processedQueries.size(), 8 ), m_pManager( pManager ) {}
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    for ( uint32_t i = range.start; i < range.end; i++ )
+                    {
+                        ProcessedQuery& processedQuery = m_pManager->m_processedQueries[i];
+                        ScoredCoverPoint* pCandidates = &m_pManager->m_candidates[processedQuery.m_firstCandidateIdx];
+                        processedQuery.m_numCandidates = m_pManager->m_database.FindBestCoverPoints( processedQuery.m_query, pCandidates, processedQuery.m_maxCandidates );
+                    }
+                }
+
+            private:
+
+                CoverManager* m_pManager = nullptr;
+            };
+
+            ScoreQueriesTask scoreTask( this );
+            m_pTaskSystem->ScheduleTask( &scoreTask );
+            m_pTaskSystem->WaitForTask( &scoreTask );
+        }
+
+        // Check line of sight from the threat for all candidates in a single batch
+        //-------------------------------------------------------------------------
+
+        Physics::PhysicsWorld* pPhysicsWorld = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->GetWorld();
+
+        Physics::QueryRules lineOfSightRules;
+        lineOfSightRules.ClearCollidesWithMask();
+        lineOfSightRules.SetCollidesWith( Physics::CollisionCategory::Environment );
+
+        m_lineOfSightQueries.resize( numCandidates );
+
+        for ( ProcessedQuery& processedQuery : m_processedQueries )
+        {
+            if ( !processedQuery.m_query.m_checkLineOfSight )
+            {
+                continue;
+            }
+
+            Vector const& threatPosition = processedQuery.m_query.m_threatPosition;
+            for ( int32_t i = 0; i < processedQuery.m_numCandidates; i++ )
+            {
+                int32_t const candidateIdx = processedQuery.m_firstCandidateIdx + i;
+                Vector const targetPosition = m_database.GetPoint( m_candidates[candidateIdx].m_pointIdx ).m_position + ( Vector::WorldUp * s_lineOfSightCheckHeight );
+                m_lineOfSightQueries[candidateIdx] = m_lineOfSightBatch.AddRayCast( threatPosition, targetPosition, lineOfSightRules );
+            }
+        }
+
+        if ( !m_lineOfSightBatch.IsEmpty() )
+        {
+            EE_PROFILE_SCOPE_AI( "Cover Line Of Sight Checks" );
+            pPhysicsWorld->ExecuteQueryBatch( m_lineOfSightBatch, m_pTaskSystem );
+        }
+
+        // Select the results
+        //-------------------------------------------------------------------------
+        // Candidates are sorted by score, so we keep the first few that are hidden from the threat
+
+        for ( ProcessedQuery& processedQuery : m_processedQueries )
+        {
+            if ( !processedQuery.m_query.m_checkLineOfSight )
+            {
+                processedQuery.m_numResults = processedQuery.m_numCandidates;
+                continue;
+            }
+
+            processedQuery.m_numResults = 0;
+            for ( int32_t i = 0; i < processedQuery.m_numCandidates && processedQuery.m_numResults < processedQuery.m_query.m_maxResults; i++ )
+            {
+                int32_t const candidateIdx = processedQuery.m_firstCandidateIdx + i;
+                bool const isHiddenFromThreat = m_lineOfSightBatch.GetResult( m_lineOfSightQueries[candidateIdx] );
+                if ( isHiddenFromThreat )
+                {
+                    m_candidates[processedQuery.m_firstCandidateIdx + processedQuery.m_numResults] = m_candidates[candidateIdx];
+                    processedQuery.m_numResults++;
+                }
+            }
+        }
     }
-}
\ No newline at end of file
+}
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "Game/_Module/API.h"
+#include "Game/Cover/CoverDatabase.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Physics/PhysicsQueryBatch.h"
+#include "Base/Threading/Threading.h"
 #include "Base/Types/IDVector.h"
 
 //-------------------------------------------------------------------------
@@ -9,8 +12,17 @@
 namespace EE
 {
     class CoverVolumeComponent;
+    class TaskSystem;
 
     //-------------------------------------------------------------------------
+    // Cover Manager
+    //-------------------------------------------------------------------------
+    // Owns the cover point database for the world and answers cover queries
+    //
+    // Immediate queries only score points and can be run during entity updates
+    // Async queries are requested during entity updates and processed together in this system's update: all queries are
+    // scored in parallel and the line of sight checks for all candidates are executed as a single physics query batch.
+    // Results are available from the frame after the request until the following processing pass
 
     class EE_GAME_API CoverManager : public EntityWorldSystem
     {
@@ -20,15 +32,89 @@ namespace EE
 
         EE_ENTITY_WORLD_SYSTEM( CoverManager, RequiresUpdate( UpdateStage::PrePhysics ) );
 
+        constexpr static int32_t const s_maxQueryResults = 16;
+        constexpr static int32_t const s_lineOfSightCandidatesPerResult = 2;   // How many extra candidates to score per result to allow for line of sight failures
+        constexpr static float const s_lineOfSightCheckHeight = 1.0f;           // The height above the cover point used for the line of sight checks
+
+        struct QueryHandle
+        {
+            inline bool IsValid() const { return m_queryIdx != InvalidIndex; }
+
+            int32_t                                         m_queryIdx = InvalidIndex;
+            uint32_t                                        m_processIdx = 0;
+        };
+
+    private:
+
+        struct ProcessedQuery
+        {
+            CoverQuery                                      m_query;
+            int32_t                                         m_firstCandidateIdx = 0;
+            int32_t                                         m_maxCandidates = 0;
+            int32_t                                         m_numCandidates = 0;
+            int32_t                                         m_numResults = 0;
+        };
+
+    public:
+
+        inline CoverDatabase const& GetDatabase() const { return m_database; }
+
+        // Immediate query - scores points without any line of sight checks, only valid during entity updates
+        inline int32_t FindBestCoverPoints( CoverQuery const& query, TVector<ScoredCoverPoint>& outResults ) const { return m_database.FindBestCoverPoints( query, outResults ); }
+
+        // Async queries
+        //-------------------------------------------------------------------------
+
+        // Request a query to be processed this frame - threadsafe
+        QueryHandle RequestQuery( CoverQuery const& query );
+
+        // Is this query still waiting to be processed
+        inline bool IsPending( QueryHandle const& handle ) const { return handle.IsValid() && handle.m_processIdx == m_processIdx; }
+
+        // Have the results for this query been produced and are they still available
+        inline bool HasResults( QueryHandle const& handle ) const { return handle.IsValid() && ( handle.m_processIdx + 1 ) == m_processIdx; }
+
+        // Get the results for a processed query, results are sorted by descending score
+        inline int32_t GetNumResults( QueryHandle const& handle ) const { return GetProcessedQuery( handle ).m_numResults; }
+
+        inline CoverDatabase::CoverPoint const& GetResult( QueryHandle const& handle, int32_t resultIdx ) const
+        {
+            ProcessedQuery const& processedQuery = GetProcessedQuery( handle );
+            EE_ASSERT( resultIdx >= 0 && resultIdx < processedQuery.m_numResults );
+            return m_database.GetPoint( m_candidates[processedQuery.m_firstCandidateIdx + resultIdx].m_pointIdx );
+        }
+
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+        void RebuildDatabase();
+        void ProcessQueries( EntityWorldUpdateContext const& ctx );
+
+        inline ProcessedQuery const& GetProcessedQuery( QueryHandle const& handle ) const
+        {
+            EE_ASSERT( HasResults( handle ) );
+            return m_processedQueries[handle.m_queryIdx];
+        }
+
     private:
 
-        TIDVector<ComponentID, CoverVolumeComponent*>      m_coverVolumes;
+        TaskSystem*                                         m_pTaskSystem = nullptr;
+        TIDVector<ComponentID, CoverVolumeComponent*>       m_coverVolumes;
+        CoverDatabase                                       m_database;
+        bool                                                m_isDatabaseDirty = false;
+
+        // Async queries
+        TVector<CoverQuery>                                 m_pendingQueries;
+        TVector<ProcessedQuery>                             m_processedQueries;
+        TVector<ScoredCoverPoint>                           m_candidates;
+        TVector<Physics::QueryBatch::QueryHandle>           m_lineOfSightQueries;    // One per candidate
+        Physics::QueryBatch                                 m_lineOfSightBatch;
+        uint32_t                                            m_processIdx = 0;
+        Threading::Mutex                                    m_mutex;
     };
-}
\ No newline at end of file
+}
@@ -143,18 +143,21 @@ namespace EE::Player
 
         //-------------------------------------------------------------------------
 
-        for ( auto const& sampledEvent : GetSampledEvents() )
+        Animation::SampledEventsBuffer const& sampledEventsBuffer = GetSampledEvents();
+        int16_t const numSampledEvents = sampledEventsBuffer.GetNumSampledEvents();
+        for ( int16_t i = 0; i < numSampledEvents; i++ )
         {
-            if ( sampledEvent.IsIgnored() )
+            if ( sampledEventsBuffer.IsIgnored( i ) )
             {
                 continue;
             }
 
             //-------------------------------------------------------------------------
 
+            Animation::SampledEvent const& sampledEvent = sampledEventsBuffer.GetEvent( i );
             if ( sampledEvent.IsAnimationEvent() )
             {
-                if ( sampledEvent.IsFromActiveBranch() )
+                if ( sampledEventsBuffer.IsFromActiveBranch( i ) )
                 {
                     if ( auto pTransitionEvent = sampledEvent.TryGetEvent<Animation::TransitionEvent>() )
                     {
@@ -388,7 +391,7 @@ namespace EE::Player
 
         // This is stupid but it's a demo
         Animation::Pose const* pPose = GetCurrentPose();
-        int32_t const headIdx = pPose->GetSkeleton()->GetBoneIndex( StringID( "head" ) );
+        int32_t const headIdx = pPose->GetSkeleton()->GetBoneIndex( EE_STRING_ID( "head" ) );
         if ( headIdx != InvalidIndex )
         {
             Vector headPos = pPose->GetModelSpaceTransform( headIdx ).GetTranslation();
@@ -460,7 +463,7 @@ namespace EE::Player
 
     void AnimationController::TriggerHitReaction()
     {
-        m_hitReactionState.Set( StringID( "HR_Flinch" ) );
+        m_hitReactionState.Set( EE_STRING_ID( "HR_Flinch" ) );
     }
 
     void AnimationController::ClearHitReaction()
@@ -28,12 +28,13 @@ namespace EE::Player
             Vector const capsulePosition = ctx.m_pCharacterComponent->GetPosition();
 
             // Test for environment collision right below the player
-            ctx.m_pPhysicsWorld->AcquireReadLock();
-            Physics::SweepResults sweepResults;
-            bool collided = ctx.m_pPhysicsWorld->CapsuleSweep( capsuleHalfHeight, capsuleRadius, capsuleOrientation.GetNormalized(), capsulePosition, -Vector::UnitZ, g_FallingEmptySpaceRequired, filter, sweepResults );
-            ctx.m_pPhysicsWorld->ReleaseReadLock();
+            // The sweep is deferred so we dont need to lock the scene, so we use the result of the sweep submitted last frame
+            bool const hasSweepResult = ctx.m_pDeferredQueries->HasResults( m_emptySpaceSweep );
+            bool const collided = hasSweepResult && ctx.m_pDeferredQueries->GetResult( m_emptySpaceSweep );
 
-            if( collided )
+            m_emptySpaceSweep = ctx.m_pDeferredQueries->Submit( [&] ( Physics::QueryBatch& batch ) { return batch.AddCapsuleSweep( capsuleRadius, capsuleHalfHeight, capsuleOrientation.GetNormalized(), capsulePosition, -Vector::UnitZ, g_FallingEmptySpaceRequired, filter ); } );
+
+            if( !hasSweepResult || collided )
             {
                 return false;
             }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Game/Player/StateMachine/PlayerAction.h"
+#include "Engine/Physics/PhysicsDeferredQueries.h"
 #include "Base/Time/Timers.h"
 
 //-------------------------------------------------------------------------
@@ -16,5 +17,10 @@ namespace EE::Player
         virtual bool TryStartInternal( ActionContext const& ctx ) override;
         virtual Status UpdateInternal( ActionContext const& ctx, bool isFirstUpdate ) override;
         virtual void StopInternal( ActionContext const& ctx, StopReason reason ) override;
+
+    private:
+
+        // The sweep for empty space below the player, this is submitted every frame we're in the air and read the frame after
+        Physics::DeferredQueries::Handle        m_emptySpaceSweep;
     };
 }
\ No newline at end of file
@@ -52,7 +52,7 @@ namespace EE::Player
         if( ctx.m_pInput->m_interact.WasPressed() )
         {
             // Create external controller
-            m_pController = ctx.m_pAnimationController->TryCreateExternalGraphController<ExternalController>( StringID( "Interaction" ), ctx.m_pPlayerComponent->m_pAvailableInteraction, true );
+            m_pController = ctx.m_pAnimationController->TryCreateExternalGraphController<ExternalController>( EE_STRING_ID( "Interaction" ), ctx.m_pPlayerComponent->m_pAvailableInteraction, true );
             if ( m_pController != nullptr )
             {
                 ctx.m_pAnimationController->SetCharacterState( AnimationController::CharacterState::Interaction );
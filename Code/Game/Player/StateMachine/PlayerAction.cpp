@@ -10,7 +10,7 @@ namespace EE::Player
 {
     ActionContext::~ActionContext()
     {
-        EE_ASSERT( m_pEntityWorldUpdateContext == nullptr && m_pPhysicsWorld == nullptr );
+        EE_ASSERT( m_pEntityWorldUpdateContext == nullptr && m_pPhysicsWorld == nullptr && m_pDeferredQueries == nullptr );
         EE_ASSERT( m_pCharacterComponent == nullptr );
         EE_ASSERT( m_pPlayerComponent == nullptr && m_pAnimationController == nullptr && m_pCameraController == nullptr );
     }
@@ -32,7 +32,7 @@ namespace EE::Player
             return false;
         }
 
-        return m_pEntityWorldUpdateContext != nullptr && m_pCameraController != nullptr && m_pPhysicsWorld != nullptr && m_pInput != nullptr;
+        return m_pEntityWorldUpdateContext != nullptr && m_pCameraController != nullptr && m_pPhysicsWorld != nullptr && m_pDeferredQueries != nullptr && m_pInput != nullptr;
     }
 
     #if EE_DEVELOPMENT_TOOLS
@@ -13,7 +13,7 @@
 namespace EE
 {
     class EntityComponent;
-    namespace Physics { class CharacterComponent; class PhysicsWorld; }
+    namespace Physics { class CharacterComponent; class PhysicsWorld; class DeferredQueries; }
     namespace Input { class InputSystem; }
     namespace Animation { class GraphController; }
 }
@@ -67,6 +67,7 @@ namespace EE::Player
         EntityWorldUpdateContext const*             m_pEntityWorldUpdateContext = nullptr;
         GameInputMap*                               m_pInput = nullptr;
         Physics::PhysicsWorld*                      m_pPhysicsWorld = nullptr;
+        Physics::DeferredQueries*                   m_pDeferredQueries = nullptr;   // Prefer these over locking the physics world for queries
 
         MainPlayerComponent*                        m_pPlayerComponent = nullptr;
         Physics::CharacterComponent*                m_pCharacterComponent = nullptr;
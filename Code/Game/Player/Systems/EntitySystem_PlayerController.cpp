@@ -139,7 +139,9 @@ namespace EE::Player
         //-------------------------------------------------------------------------
 
         TScopedGuardValue const contextGuardValue( m_actionContext.m_pEntityWorldUpdateContext, &ctx );
-        TScopedGuardValue const physicsSystemGuard( m_actionContext.m_pPhysicsWorld, ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->GetWorld() );
+        auto pPhysicsWorldSystem = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>();
+        TScopedGuardValue const physicsSystemGuard( m_actionContext.m_pPhysicsWorld, pPhysicsWorldSystem->GetWorld() );
+        TScopedGuardValue const deferredQueriesGuard( m_actionContext.m_pDeferredQueries, &pPhysicsWorldSystem->GetDeferredQueries() );
 
         if ( !m_actionContext.IsValid() )
         {
@@ -3,6 +3,7 @@
 #include "Game/Player/Components/Component_MainPlayer.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/Entity.h"
+#include "Base/Memory/MemoryTags.h"
 
 //-------------------------------------------------------------------------
 
@@ -53,6 +54,7 @@ namespace EE::Player
 
     void PlayerInteractionSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        EE_MEMORY_TAG_SCOPE( Gameplay );
         if ( !ctx.IsGameWorld() )
         {
             return;